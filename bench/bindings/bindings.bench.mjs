@@ -0,0 +1,83 @@
+// Microbenchmarks for the native binding layer's hot paths, driven through
+// the public JS API so they measure the same entry points user code hits:
+// Buffer accessors, Headers lookups, structuredClone shapes, stream pipeTo,
+// and bun:sqlite row extraction.
+//
+// Run directly with `bun bindings.bench.mjs` for the mitata table, or via
+// `bun run bench:bindings` at the repo root for the baseline-checked JSON
+// pipeline (see run.mjs).
+import { Database } from "bun:sqlite";
+import { bench, group, run } from "../runner.mjs";
+
+group("Buffer accessors", () => {
+  const buf = Buffer.alloc(4096, 0xab);
+  bench("readUInt32LE", () => buf.readUInt32LE(128));
+  bench("readDoubleLE", () => buf.readDoubleLE(128));
+  bench("readBigUInt64LE", () => buf.readBigUInt64LE(128));
+  bench("writeUInt32LE", () => buf.writeUInt32LE(0xdeadbeef, 128));
+  bench("indexOf (miss)", () => buf.indexOf(0xff));
+});
+
+group("Headers lookups", () => {
+  const headers = new Headers({
+    "Content-Type": "text/plain",
+    "Content-Length": "123",
+    "Cache-Control": "no-cache",
+    "X-Custom-Header": "Hello World",
+    "X-Another-Custom-Header": "Hello World",
+    "X-Request-Id": "0b1c2d3e4f",
+    "Accept-Encoding": "gzip, deflate, br",
+    "User-Agent": "bench/1.0",
+  });
+  bench("get (hit)", () => headers.get("content-type"));
+  bench("get (miss)", () => headers.get("x-missing"));
+  bench("has", () => headers.has("x-custom-header"));
+  bench("set (existing)", () => headers.set("x-request-id", "5a6b7c8d9e"));
+});
+
+group("structuredClone", () => {
+  const flat = { id: 1, name: "row", active: true, score: 3.14 };
+  const nested = {
+    user: { id: 1, tags: ["a", "b", "c"] },
+    items: Array.from({ length: 32 }, (_, i) => ({ sku: i, qty: i % 7 })),
+  };
+  const collections = new Map([
+    ["set", new Set([1, 2, 3])],
+    ["dates", [new Date(0), new Date(1e12)]],
+  ]);
+  const bytes = new Uint8Array(16 * 1024);
+  bench("flat object", () => structuredClone(flat));
+  bench("nested object", () => structuredClone(nested));
+  bench("Map of Set/Date", () => structuredClone(collections));
+  bench("Uint8Array 16KB", () => structuredClone(bytes));
+});
+
+group("stream pipeTo", () => {
+  const chunk = new Uint8Array(16 * 1024);
+  bench("16 x 16KB chunks", async () => {
+    const readable = new ReadableStream({
+      start(controller) {
+        for (let i = 0; i < 16; i++) controller.enqueue(chunk);
+        controller.close();
+      },
+    });
+    await readable.pipeTo(new WritableStream({ write() {} }));
+  });
+});
+
+group("bun:sqlite row extraction", () => {
+  const db = new Database(":memory:");
+  db.run("CREATE TABLE rows (id INTEGER PRIMARY KEY, name TEXT, score REAL, payload BLOB)");
+  const insert = db.prepare("INSERT INTO rows (name, score, payload) VALUES (?, ?, ?)");
+  const payload = new Uint8Array(64);
+  db.transaction(() => {
+    for (let i = 0; i < 1000; i++) insert.run(`row-${i}`, i * 0.5, payload);
+  })();
+  const all = db.prepare("SELECT * FROM rows");
+  const one = db.prepare("SELECT * FROM rows WHERE id = ?");
+  bench(".all() 1000 rows", () => all.all());
+  bench(".get() single row", () => one.get(500));
+  bench(".values() 1000 rows", () => all.values());
+});
+
+await run();
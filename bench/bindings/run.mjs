@@ -0,0 +1,94 @@
+// Baseline-checked wrapper around bindings.bench.mjs.
+//
+// Runs the suite with mitata's JSON reporter, writes a percentile document
+// (results.json, or $BENCH_BINDINGS_OUTPUT) that perf dashboards can ingest,
+// and exits non-zero if any benchmark's average regresses past its pinned
+// baseline. Baselines are machine-specific — pin them on the machine that
+// will run the comparison:
+//
+//   bun run.mjs                     # compare against baselines.json
+//   bun run.mjs --update-baselines  # re-pin baselines from this run
+import { join } from "path";
+
+const dir = import.meta.dir;
+const update = process.argv.includes("--update-baselines");
+
+const proc = Bun.spawn({
+  cmd: [process.execPath, join(dir, "bindings.bench.mjs")],
+  env: { ...process.env, BENCHMARK_RUNNER: "1" },
+  stdout: "pipe",
+  stderr: "inherit",
+});
+const stdout = await proc.stdout.text();
+if ((await proc.exited) !== 0) {
+  console.error("bindings.bench.mjs failed");
+  process.exit(1);
+}
+
+// mitata's JSON reporter prints one document; skip any preamble bytes.
+const report = JSON.parse(stdout.slice(stdout.indexOf("{")));
+
+const results = [];
+for (const benchmark of report.benchmarks ?? []) {
+  for (const r of benchmark.runs ?? []) {
+    const stats = r.stats;
+    if (!stats) continue;
+    results.push({
+      name: benchmark.alias ?? r.name,
+      group: benchmark.group ?? null,
+      avg_ns: stats.avg,
+      min_ns: stats.min,
+      max_ns: stats.max,
+      percentiles_ns: {
+        p25: stats.p25,
+        p50: stats.p50,
+        p75: stats.p75,
+        p99: stats.p99,
+        p999: stats.p999,
+      },
+    });
+  }
+}
+
+if (results.length === 0) {
+  console.error("no benchmark results parsed from mitata output");
+  process.exit(1);
+}
+
+const resultsPath = process.env.BENCH_BINDINGS_OUTPUT ?? join(dir, "results.json");
+await Bun.write(
+  resultsPath,
+  JSON.stringify({ version: 1, createdAt: new Date().toISOString(), results }, null, 2) + "\n",
+);
+
+const baselinesPath = join(dir, "baselines.json");
+const baselines = JSON.parse(await Bun.file(baselinesPath).text());
+
+if (update) {
+  baselines.benchmarks = Object.fromEntries(results.map(r => [r.name, { avg_ns: Math.round(r.avg_ns) }]));
+  await Bun.write(baselinesPath, JSON.stringify(baselines, null, 2) + "\n");
+  console.log(`pinned ${results.length} baselines to ${baselinesPath}`);
+  process.exit(0);
+}
+
+const defaultThreshold = baselines.thresholdDefault ?? 1.25;
+let regressions = 0;
+for (const r of results) {
+  const pinned = baselines.benchmarks?.[r.name];
+  if (!pinned) continue;
+  const threshold = pinned.threshold ?? defaultThreshold;
+  const limit = pinned.avg_ns * threshold;
+  if (r.avg_ns > limit) {
+    regressions++;
+    console.error(
+      `regression: ${r.name} avg ${r.avg_ns.toFixed(0)}ns > ${limit.toFixed(0)}ns ` +
+        `(baseline ${pinned.avg_ns}ns x ${threshold})`,
+    );
+  }
+}
+
+if (regressions > 0) {
+  console.error(`${regressions} benchmark(s) regressed`);
+  process.exit(1);
+}
+console.log(`wrote ${results.length} results to ${resultsPath}; no regressions`);
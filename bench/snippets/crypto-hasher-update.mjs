@@ -0,0 +1,48 @@
+// so it can run in environments without node module resolution
+import { bench, run } from "../runner.mjs";
+
+// Two things to read off this benchmark:
+//  - sub-1KB sizes are binding-overhead bound: this is what the DOMJIT
+//    fast path for `update(typedArray)` targets
+//  - the 64KB size is compression bound: throughput in the GB/s range means
+//    BoringSSL dispatched to hardware SHA (SHA-NI on x64, the SHA2
+//    extensions on ARM); hundreds of MB/s means the portable fallback
+const sizes = [64, 256, 1024, 65536];
+const buffers = sizes.map(size => {
+  const buf = Buffer.allocUnsafe(size);
+  buf.fill(123);
+  return buf;
+});
+
+if ("Bun" in globalThis) {
+  const { CryptoHasher } = Bun;
+
+  for (let i = 0; i < sizes.length; i++) {
+    const buf = buffers[i];
+    bench(`CryptoHasher(sha256).update(${sizes[i]} bytes)`, () => {
+      const hasher = new CryptoHasher("sha256");
+      hasher.update(buf);
+      hasher.digest();
+    });
+  }
+
+  for (let i = 0; i < sizes.length; i++) {
+    const buf = buffers[i];
+    bench(`CryptoHasher.hash("sha256", ${sizes[i]} bytes, "hex")`, () => {
+      CryptoHasher.hash("sha256", buf, "hex");
+    });
+  }
+
+  // Streaming many small chunks into one hasher — the audit-log shape where
+  // per-update() overhead dominates.
+  const chunk = buffers[0];
+  bench("CryptoHasher(sha256).update(64 bytes) x 64", () => {
+    const hasher = new CryptoHasher("sha256");
+    for (let i = 0; i < 64; i++) {
+      hasher.update(chunk);
+    }
+    hasher.digest();
+  });
+}
+
+await run();
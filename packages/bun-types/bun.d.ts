@@ -587,6 +587,18 @@ declare module "bun" {
     options?: StringWidthOptions,
   ): number;
 
+  namespace stringWidth {
+    /**
+     * Measure many strings in one call. Options are parsed once, so this is
+     * cheaper than calling {@link stringWidth} in a loop when re-measuring
+     * many short strings (for example, table cells in a TUI re-render).
+     *
+     * @param inputs The strings to measure
+     * @returns The width of each string in columns, in input order
+     */
+    function batch(inputs: readonly string[], options?: StringWidthOptions): number[];
+  }
+
   /**
    * Remove ANSI escape codes from a string.
    *
@@ -2346,6 +2358,7 @@ declare module "bun" {
     wyhash: (data: string | ArrayBufferView | ArrayBuffer | SharedArrayBuffer, seed?: bigint) => bigint;
     adler32: (data: string | ArrayBufferView | ArrayBuffer | SharedArrayBuffer) => number;
     crc32: (data: string | ArrayBufferView | ArrayBuffer | SharedArrayBuffer, seed?: number) => number;
+    crc32c: (data: string | ArrayBufferView | ArrayBuffer | SharedArrayBuffer, seed?: number) => number;
     cityHash32: (data: string | ArrayBufferView | ArrayBuffer | SharedArrayBuffer) => number;
     cityHash64: (data: string | ArrayBufferView | ArrayBuffer | SharedArrayBuffer, seed?: bigint) => bigint;
     xxHash32: (data: string | ArrayBufferView | ArrayBuffer | SharedArrayBuffer, seed?: number) => number;
@@ -3267,6 +3280,30 @@ declare module "bun" {
       algorithm?: Password.AlgorithmLabel | Password.Argon2Algorithm | Password.BCryptAlgorithm,
     ): Promise<string>;
 
+    /**
+     * Asynchronously hash a batch of passwords, fanning the work across
+     * worker threads. Resolves with the hashes in input order, or rejects
+     * with the first error.
+     *
+     * @example
+     * ```ts
+     * import {password} from "bun";
+     * const hashes = await password.hashMany(["hunter2", "hunter3"]);
+     * ```
+     */
+    hashMany(
+      /**
+       * The passwords to hash. Throws if any password is empty.
+       */
+      passwords: Bun.StringOrBuffer[],
+      /**
+       * Applied to every password in the batch.
+       *
+       * @default "argon2id"
+       */
+      algorithm?: Password.AlgorithmLabel | Password.Argon2Algorithm | Password.BCryptAlgorithm,
+    ): Promise<string[]>;
+
     /**
      * Synchronously verify a password against a previously hashed password using
      * argon2 or bcrypt. The default is argon2.
@@ -4099,6 +4136,13 @@ declare module "bun" {
     clientRenegotiationLimit?: number;
 
     clientRenegotiationWindow?: number;
+
+    /**
+     * Maximum number of TLS sessions kept in the server-side session cache
+     * for session-ID resumption, allowing returning clients to skip the full
+     * handshake. `0` (the default) disables the cache.
+     */
+    sessionCacheSize?: number;
   }
 
   interface SocketAddress {
@@ -4228,6 +4272,12 @@ declare module "bun" {
      * Whether to compact the output
      */
     compact?: boolean;
+    /**
+     * Hard cap on the output size in bytes. Formatting stops storing once the
+     * budget is reached, so inspecting a huge object cannot exhaust memory.
+     * `Infinity` (the default) means unlimited.
+     */
+    maxBytes?: number;
   }
 
   type WebSocketOptionsProtocolsOrProtocol =
@@ -7851,6 +7901,43 @@ declare module "bun" {
     parse(expression: CronWithAutocomplete, relativeDate?: Date | number, options?: CronOptions): Date | null;
   };
 
+  /**
+   * Task priority for {@link Bun.scheduler.postTask}, highest first.
+   *
+   * Matches the [W3C Scheduling APIs](https://wicg.github.io/scheduling-apis/) tiers.
+   */
+  type SchedulerTaskPriority = "user-blocking" | "user-visible" | "background";
+
+  /**
+   * Priority-tiered task scheduling, shaped after the
+   * [W3C Scheduler API](https://wicg.github.io/scheduling-apis/).
+   *
+   * Each posted task runs as its own event-loop task, so I/O, timers, and
+   * microtasks interleave between tasks. Lower-priority tiers are
+   * starvation-protected: a tier that keeps getting passed over eventually
+   * runs even while higher-priority work is queued.
+   */
+  const scheduler: {
+    /**
+     * Queue `callback` to run on the event loop at the given priority
+     * (default `"user-visible"`).
+     *
+     * @returns A Promise that resolves with the callback's return value, or
+     *   rejects if it throws.
+     *
+     * @example
+     * ```ts
+     * // Cache refill that yields to request handling
+     * Bun.scheduler.postTask(() => refillCacheChunk(), { priority: "background" });
+     * ```
+     */
+    postTask<T>(callback: () => T, options?: { priority?: SchedulerTaskPriority }): Promise<Awaited<T>>;
+    /**
+     * Current number of queued (not yet started) tasks per priority tier.
+     */
+    queueDepths(): { "user-blocking": number; "user-visible": number; background: number };
+  };
+
   /** Utility type for any process from {@link Bun.spawn()} with both stdout and stderr set to `"pipe"` */
   type ReadableSubprocess = Subprocess<any, "pipe", "pipe">;
   /** Utility type for any process from {@link Bun.spawn()} with stdin set to `"pipe"` */
@@ -8150,6 +8237,23 @@ declare module "bun" {
    */
   function indexOfLine(buffer: ArrayBufferView | ArrayBufferLike, offset?: number): number;
 
+  /**
+   * Iterate over the lines of a stream or file without buffering the whole
+   * body. Newline scanning happens natively (SIMD), so this is much faster
+   * than splitting strings in JavaScript.
+   *
+   * Lines are yielded without their trailing `\n` (or `\r\n`); a final
+   * unterminated line is yielded too.
+   *
+   * @example
+   * ```ts
+   * for await (const line of Bun.lines(Bun.file("access.log"))) {
+   *   console.log(JSON.parse(line));
+   * }
+   * ```
+   */
+  function lines(input: ReadableStream<Uint8Array> | Blob): AsyncIterableIterator<string>;
+
   interface GlobScanOptions {
     /**
      * The root directory to start matching from. Defaults to `process.cwd()`
@@ -198,6 +198,16 @@ interface Crypto {
    */
   randomUUID(): `${string}-${string}-${string}-${string}-${string}`;
 
+  /**
+   * Generate `count` v4 UUIDs in a single native call.
+   *
+   * Equivalent to calling {@link Crypto.randomUUID} in a loop, but amortizes
+   * the per-call binding overhead — useful when issuing UUIDs in bulk.
+   *
+   * @param count Number of UUIDs to generate
+   */
+  randomUUIDBatch(count: number): `${string}-${string}-${string}-${string}-${string}`[];
+
   timingSafeEqual: typeof import("node:crypto").timingSafeEqual;
 }
 declare var Crypto: {
@@ -230,6 +240,18 @@ interface TextEncoder extends Bun.__internal.LibEmptyOrNodeUtilTextEncoder {
    * @param dest The array that receives the encoded bytes.
    */
   encodeInto(src?: string, dest?: Bun.BufferSource): import("node:util").TextEncoderEncodeIntoResult;
+
+  /**
+   * UTF-8 encodes `src` into a buffer owned by this encoder and returns a
+   * `Uint8Array` view of the encoded bytes. The view is only valid until the
+   * next `encodePooled` call on the same encoder, which reuses the buffer —
+   * copy it if you need it afterwards. Avoids the per-call allocation of
+   * {@link TextEncoder.encode} in tight loops where the result is consumed
+   * immediately (e.g. written to a socket).
+   *
+   * @param src The text to encode.
+   */
+  encodePooled(src?: string): Uint8Array<ArrayBuffer>;
 }
 declare var TextEncoder: Bun.__internal.UseLibDomIfAvailable<
   "TextEncoder",
@@ -780,9 +780,14 @@ declare module "bun" {
        *
        * This allows multiple processes to bind to the same port, which is useful for load balancing.
        *
+       * The object form declares `SO_REUSEPORT` listener sharding: run the
+       * server in `workers` Worker threads that each call `Bun.serve()` with
+       * this config, and the kernel distributes accepted connections across
+       * the per-worker listen sockets.
+       *
        * @default false
        */
-      reusePort?: boolean;
+      reusePort?: boolean | { workers?: number };
 
       /**
        * Whether the `IPV6_V6ONLY` flag should be set.
@@ -797,6 +802,15 @@ declare module "bun" {
        */
       http3?: boolean;
 
+      /**
+       * Shorthand for {@link http3}. `quic: true` enables HTTP/3 using the
+       * {@link tls} certificate; the object form supplies the QUIC
+       * certificate directly when `tls` is not set.
+       * @default false
+       * @experimental
+       */
+      quic?: boolean | TLSOptions;
+
       /**
        * Listen for HTTP/1.1 over TCP. Set to `false` together with
        * `http3: true` to serve HTTP/3 only.
@@ -901,6 +915,25 @@ declare module "bun" {
      */
     reload<R extends string>(options: Serve.Options<WebSocketData, R>): Server<WebSocketData>;
 
+    /**
+     * Cache a pre-rendered {@link Response} for a path. `GET`/`HEAD` requests
+     * matching `path` are answered from the cached snapshot — headers and
+     * body are serialized once at store time — without invoking `fetch`.
+     *
+     * Call with no response (or `null`) to invalidate the entry.
+     *
+     * @param path Request path to cache, starting with `/`
+     * @param response A `Response` with a fully buffered body
+     * @param options `ttlMs` expires the entry after the given duration
+     * @returns `true` if an entry was stored or removed
+     *
+     * @example
+     * ```js
+     * server.cache("/api/stats", Response.json(stats), { ttlMs: 5_000 });
+     * ```
+     */
+    cache(path: string, response?: Response | null, options?: { ttlMs?: number }): boolean;
+
     /**
      * Mock the fetch handler for a running server.
      *
@@ -82,6 +82,25 @@ declare module "bun:sqlite" {
      * @since v1.1.14
      */
     strict?: boolean;
+
+    /**
+     * Enable a native cache of `get()`/`all()` results for this connection.
+     *
+     * Repeated executions of the same readonly statement with the same bound
+     * parameters are answered from the cache without re-running the query.
+     * The cache is flushed whenever the database changes — writes through
+     * this connection (including `exec()` and incremental blob writes) or a
+     * commit from any other connection. Results are stored as native buffers,
+     * not JS objects, so cached data does not retain object graphs; each hit
+     * still materializes fresh row objects.
+     *
+     * Pass `true` for the default capacity (128 statements) or a number to
+     * set the maximum number of cached statements. Oversized results
+     * (over 1 MB) are never cached.
+     *
+     * @default false
+     */
+    resultCache?: boolean | number;
   }
 
   /**
@@ -410,6 +429,29 @@ declare module "bun:sqlite" {
      */
     serialize(name?: string): Buffer;
 
+    /**
+     * Open a blob for incremental I/O without materializing the whole value.
+     *
+     * Internally, this calls `sqlite3_blob_open`, so blob pages stream in a
+     * fixed working set instead of one full copy per value. The handle stays
+     * open until {@link SQLiteBlob.close} is called (or the database is
+     * closed), and becomes stale if the underlying row is deleted or the
+     * value is rewritten.
+     *
+     * @param table Name of the table containing the blob
+     * @param column Name of the blob column
+     * @param rowid Rowid of the row containing the blob
+     * @param options Pass `{ write: true }` to open the blob for writing
+     *
+     * @example
+     * ```ts
+     * const blob = db.openBlob("artifacts", "data", 1);
+     * await Bun.write("artifact.bin", new Response(blob.stream()));
+     * blob.close();
+     * ```
+     */
+    openBlob(table: string, column: string, rowid: number | bigint, options?: { write?: boolean }): SQLiteBlob;
+
     /**
      * Load a serialized SQLite3 database
      *
@@ -696,6 +738,31 @@ declare module "bun:sqlite" {
      */
     run(...params: ParamsType): Changes;
 
+    /**
+     * Execute the prepared statement once per row in `rows`, entirely in
+     * native code.
+     *
+     * Each element of `rows` is bound the same way {@link run} binds a single
+     * object or array of parameters, but the bind/step/reset loop never
+     * returns to JavaScript between rows. The whole batch runs inside one
+     * transaction when the caller hasn't already opened one; if any row
+     * fails, the batch is rolled back and the error is thrown.
+     *
+     * @param rows the parameter objects or arrays to bind, one per execution
+     * @returns A `Changes` object; `changes` counts the whole batch
+     *
+     * @example
+     * ```ts
+     * const insert = db.prepare("INSERT INTO users (name, age) VALUES (?, ?)");
+     * insert.runBatch([
+     *   ["Alice", 30],
+     *   ["Bob", 41],
+     * ]);
+     * // => { changes: 2, lastInsertRowid: 2 }
+     * ```
+     */
+    runBatch(rows: ReadonlyArray<SQLQueryBindings | SQLQueryBindings[]>): Changes;
+
     /**
      * Execute the prepared statement and return the results as an array of arrays.
      *
@@ -758,6 +825,34 @@ declare module "bun:sqlite" {
      */
     raw(...params: ParamsType): Array<Array<Uint8Array | null>>;
 
+    /**
+     * Execute the prepared statement and return the results column-by-column
+     * instead of row-by-row, as one object with a property per column.
+     *
+     * Columns containing only integers and floats come back as a
+     * `Float64Array`, or a `BigInt64Array` for integer-only columns when
+     * {@link safeIntegers} is enabled. Columns containing text, blobs,
+     * `NULL`s, or mixed types come back as a plain array. This avoids
+     * materializing one object per row, which matters for large analytical
+     * reads, and the typed arrays can be handed to columnar consumers
+     * directly.
+     *
+     * @param params optional values to bind to the statement. If omitted, the
+     * statement is run with the last bound values or no parameters if there
+     * are none.
+     *
+     * @example
+     * ```ts
+     * const stmt = db.prepare("SELECT id, name FROM users");
+     *
+     * stmt.columnar();
+     * // => { id: Float64Array(3) [1, 2, 3], name: ["alice", "bob", "carol"] }
+     * ```
+     */
+    columnar(
+      ...params: ParamsType
+    ): Record<string, Float64Array | BigInt64Array | Array<string | bigint | number | Uint8Array | null>>;
+
     /**
      * The names of the columns returned by the prepared statement.
      * @example
@@ -1305,4 +1400,48 @@ declare module "bun:sqlite" {
      */
     lastInsertRowid: number | bigint;
   }
+
+  /**
+   * An open handle for incremental blob I/O, returned by
+   * {@link Database.openBlob}. Wraps `sqlite3_blob_open`.
+   */
+  export interface SQLiteBlob extends Disposable {
+    /**
+     * Size of the blob in bytes. Fixed at open time; incremental I/O cannot
+     * resize a blob.
+     */
+    readonly byteLength: number;
+
+    /**
+     * `true` once {@link close} has been called.
+     */
+    readonly closed: boolean;
+
+    /**
+     * Read `length` bytes starting at `offset` into a new `Uint8Array`.
+     * Throws if the range extends past the end of the blob.
+     */
+    readAt(offset: number, length: number): Uint8Array;
+
+    /**
+     * Write `data` into the blob starting at `offset`. The blob must have
+     * been opened with `{ write: true }`, and the range must fit inside the
+     * existing blob — use a zeroblob() placeholder sized up front when
+     * inserting.
+     */
+    writeAt(data: NodeJS.TypedArray | DataView, offset?: number): void;
+
+    /**
+     * Stream the blob's contents as `Uint8Array` chunks of at most
+     * `chunkSize` bytes (64 KB by default). The handle must stay open until
+     * the stream is fully consumed.
+     */
+    stream(chunkSize?: number): ReadableStream<Uint8Array>;
+
+    /**
+     * Close the blob handle. Safe to call more than once. Open handles are
+     * closed automatically when the database is closed.
+     */
+    close(): void;
+  }
 }
@@ -23,6 +23,7 @@
 #include <string.h>
 #include <limits.h>
 #include <stdatomic.h>
+#include <stdint.h>
 #include <time.h>
 
 /* These are in sni_tree.cpp */
@@ -36,6 +37,8 @@ void *sni_find(void *sni, const char *hostname);
 #include <openssl/bio.h>
 #include <openssl/dh.h>
 #include <openssl/err.h>
+#include <openssl/evp.h>
+#include <openssl/sha.h>
 #include <openssl/ssl.h>
 #include <openssl/pkcs12.h>
 #elif LIBUS_USE_WOLFSSL
@@ -162,6 +165,8 @@ static int us_ctx_cache_ex_idx = -1;
  * ca/caFile options or a later addCACert): the per-socket client attach must
  * not replace such a store with the process-shared default roots. */
 static int us_ctx_user_ca_ex_idx = -1;
+/* Per-context chain-verification verdict cache (see us_cert_verify_cb). */
+static int us_ctx_verify_cache_ex_idx = -1;
 static int us_ssl_reneg_state_idx = -1;
 /* Per-connection async-SNI suspension state (select_certificate_cb retry). */
 static int us_ssl_sni_pending_idx = -1;
@@ -360,6 +365,59 @@ static void ssl_flush_pending_session(struct us_socket_t *s) {
   }
 }
 
+/* ── X.509 chain-verification verdict cache ───────────────────────────────
+ * mTLS-heavy servers see the same handful of client chains on every accept,
+ * and the chain signature checks dominate the accept path. Each SSL_CTX
+ * carries a small direct-mapped cache: SHA-256 over {client/server role,
+ * verification store pointer, each presented cert's own SHA-256} → a
+ * SUCCESSFUL verdict, honored until the chain's earliest notAfter. Only
+ * X509_V_OK is cached — failures can heal with time (notBefore) or config
+ * (addCACert flushes the cache), and are the rare path anyway. The store
+ * pointer is part of the key because the per-socket client attach (and the
+ * Rust SSL wrapper) may swap in the process-shared default roots per-SSL.
+ * A collision or expired slot just re-verifies. */
+#define US_VERIFY_CACHE_BUCKETS 64
+
+struct us_verify_cache_entry_t {
+  uint8_t fingerprint[SHA256_DIGEST_LENGTH];
+  int64_t expires_at; /* posix seconds; 0 = empty slot */
+};
+
+struct us_verify_cache_t {
+  /* Handshakes on one SSL_CTX can run on the JS and HTTP-client loops
+   * concurrently; a spinlock suffices for the nanoseconds each probe holds it. */
+  atomic_int lock;
+  struct us_verify_cache_entry_t entries[US_VERIFY_CACHE_BUCKETS];
+};
+
+static void us_verify_cache_lock(struct us_verify_cache_t *c) {
+  while (atomic_exchange_explicit(&c->lock, 1, memory_order_acquire)) {
+  }
+}
+
+static void us_verify_cache_unlock(struct us_verify_cache_t *c) {
+  atomic_store_explicit(&c->lock, 0, memory_order_release);
+}
+
+static void us_verify_cache_free(void *parent, void *ptr, CRYPTO_EX_DATA *ad,
+                                 int index, long argl, void *argp) {
+  (void)parent; (void)ad; (void)index; (void)argl; (void)argp;
+  us_free(ptr);
+}
+
+/* Drop every cached verdict. Called when the context's trust store mutates
+ * (addCACert) so stale approvals never outlive the config that produced them. */
+static void us_verify_cache_flush(SSL_CTX *ctx) {
+  struct us_verify_cache_t *cache = us_ctx_verify_cache_ex_idx >= 0
+      ? SSL_CTX_get_ex_data(ctx, us_ctx_verify_cache_ex_idx) : NULL;
+  if (!cache) {
+    return;
+  }
+  us_verify_cache_lock(cache);
+  memset(cache->entries, 0, sizeof(cache->entries));
+  us_verify_cache_unlock(cache);
+}
+
 /* Defined in `src/runtime/api/bun/SSLContextCache.rs`: tombstones the cache entry on
  * SSL_CTX refcount→0 so the per-VM weak SSL_CTX cache learns the pointer is
  * dead without holding a ref of its own. */
@@ -371,6 +429,7 @@ static void us_ex_idx_init(void) {
   us_sni_ex_idx = SSL_CTX_get_ex_new_index(0, NULL, NULL, NULL, NULL);
   us_ctx_cache_ex_idx = SSL_CTX_get_ex_new_index(0, NULL, NULL, NULL, bun_ssl_ctx_cache_on_free);
   us_ctx_user_ca_ex_idx = SSL_CTX_get_ex_new_index(0, NULL, NULL, NULL, NULL);
+  us_ctx_verify_cache_ex_idx = SSL_CTX_get_ex_new_index(0, NULL, NULL, NULL, us_verify_cache_free);
   us_ssl_reneg_state_idx = SSL_get_ex_new_index(0, NULL, NULL, NULL, us_ssl_reneg_state_free);
   us_ssl_sni_pending_idx = SSL_get_ex_new_index(0, NULL, NULL, NULL, us_ssl_sni_pending_free);
   us_ssl_listener_ex_idx = SSL_get_ex_new_index(0, NULL, NULL, NULL, NULL);
@@ -909,6 +968,89 @@ static int us_verify_callback(int preverify_ok, X509_STORE_CTX *ctx) {
   return 1;
 }
 
+/* Cache key + expiry for the presented chain. Feeds the role (client/server
+ * purpose checks differ), the store pointer (per-SSL store swaps, see the
+ * cache doc comment) and each cert's own SHA-256 into one digest, and tracks
+ * the earliest notAfter across the chain. Returns 0 when anything is
+ * undigestible — the caller then just verifies without caching. */
+static int us_verify_cache_fingerprint(SSL *ssl, X509_STORE_CTX *store_ctx,
+                                       uint8_t out[SHA256_DIGEST_LENGTH],
+                                       int64_t *min_not_after) {
+  X509 *leaf = X509_STORE_CTX_get0_cert(store_ctx);
+  if (!leaf) {
+    return 0;
+  }
+  SHA256_CTX h;
+  SHA256_Init(&h);
+  uint8_t role = ssl && SSL_is_server(ssl) ? 1 : 0;
+  SHA256_Update(&h, &role, sizeof(role));
+  X509_STORE *store = X509_STORE_CTX_get0_store(store_ctx);
+  SHA256_Update(&h, &store, sizeof(store));
+  int64_t min_na = INT64_MAX;
+  STACK_OF(X509) *untrusted = X509_STORE_CTX_get0_untrusted(store_ctx);
+  size_t count = untrusted ? sk_X509_num(untrusted) : 0;
+  for (size_t i = 0; i <= count; i++) {
+    /* i == 0 is the leaf; the untrusted stack may repeat it — harmless, the
+     * duplication is deterministic. */
+    X509 *cert = i == 0 ? leaf : sk_X509_value(untrusted, i - 1);
+    unsigned char md[SHA256_DIGEST_LENGTH];
+    unsigned int md_len = 0;
+    if (!X509_digest(cert, EVP_sha256(), md, &md_len)) {
+      return 0;
+    }
+    SHA256_Update(&h, md, md_len);
+    int64_t not_after;
+    if (!ASN1_TIME_to_posix(X509_get0_notAfter(cert), &not_after)) {
+      return 0;
+    }
+    if (not_after < min_na) {
+      min_na = not_after;
+    }
+  }
+  SHA256_Final(out, &h);
+  *min_not_after = min_na;
+  return 1;
+}
+
+/* Replaces BoringSSL's direct X509_verify_cert call for contexts built here.
+ * Observable behavior is identical — us_verify_callback already defers every
+ * failure to JS, so the verdict lands in SSL_get_verify_result either way —
+ * this only skips re-proving a chain this context already proved. */
+static int us_cert_verify_cb(X509_STORE_CTX *store_ctx, void *arg) {
+  (void)arg;
+  SSL *ssl = X509_STORE_CTX_get_ex_data(store_ctx,
+                                        SSL_get_ex_data_X509_STORE_CTX_idx());
+  struct us_verify_cache_t *cache = NULL;
+  if (ssl && us_ctx_verify_cache_ex_idx >= 0) {
+    cache = SSL_CTX_get_ex_data(SSL_get_SSL_CTX(ssl), us_ctx_verify_cache_ex_idx);
+  }
+  uint8_t fp[SHA256_DIGEST_LENGTH];
+  int64_t min_not_after = 0;
+  if (!cache || !us_verify_cache_fingerprint(ssl, store_ctx, fp, &min_not_after)) {
+    return X509_verify_cert(store_ctx);
+  }
+  int64_t now = (int64_t)time(NULL);
+  struct us_verify_cache_entry_t *slot =
+      &cache->entries[fp[0] % US_VERIFY_CACHE_BUCKETS];
+  us_verify_cache_lock(cache);
+  int hit = slot->expires_at > now &&
+            memcmp(slot->fingerprint, fp, sizeof(fp)) == 0;
+  us_verify_cache_unlock(cache);
+  if (hit) {
+    X509_STORE_CTX_set_error(store_ctx, X509_V_OK);
+    return 1;
+  }
+  int ok = X509_verify_cert(store_ctx);
+  if (ok > 0 && X509_STORE_CTX_get_error(store_ctx) == X509_V_OK &&
+      min_not_after > now) {
+    us_verify_cache_lock(cache);
+    memcpy(slot->fingerprint, fp, sizeof(fp));
+    slot->expires_at = min_not_after;
+    us_verify_cache_unlock(cache);
+  }
+  return ok;
+}
+
 /* Drop the strdup'd passphrase. Called as soon as private-key load completes
  * (the only consumer of the passwd_cb), so the secret never outlives ctx
  * construction and SSL_CTX_free() is sufficient on every later path. Also
@@ -1181,13 +1323,30 @@ SSL_CTX *us_ssl_ctx_build_raw(struct us_bun_socket_context_options_t options,
   /* Surface resumable sessions through the new-session callback the way Node
    * does: for TLS 1.3 the resumable session only exists once the peer's
    * NewSessionTicket arrives, and BoringSSL only exposes it here. NO_INTERNAL
-   * keeps BoringSSL from also caching it. */
-  SSL_CTX_set_session_cache_mode(ssl_context, SSL_SESS_CACHE_CLIENT |
-                                                  SSL_SESS_CACHE_SERVER |
-                                                  SSL_SESS_CACHE_NO_INTERNAL |
-                                                  SSL_SESS_CACHE_NO_AUTO_CLEAR);
+   * keeps BoringSSL from also caching it — unless the user asked for a
+   * server-side session cache, in which case the internal cache answers
+   * session-ID lookups from resuming TLS <= 1.2 clients (the callback still
+   * fires and still returns 0, so the 'session' event path is unchanged).
+   * The cache evicts LRU past session_cache_size, so memory stays bounded
+   * without AUTO_CLEAR's every-255-handshakes flush pause. */
+  long session_cache_mode = SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_SERVER |
+                            SSL_SESS_CACHE_NO_AUTO_CLEAR;
+  if (options.session_cache_size > 0) {
+    SSL_CTX_sess_set_cache_size(ssl_context, options.session_cache_size);
+  } else {
+    session_cache_mode |= SSL_SESS_CACHE_NO_INTERNAL;
+  }
+  SSL_CTX_set_session_cache_mode(ssl_context, session_cache_mode);
   SSL_CTX_sess_set_new_cb(ssl_context, us_ssl_new_session_cb);
   SSL_CTX_set_keylog_callback(ssl_context, us_ssl_keylog_cb);
+
+  /* Verdict cache for peer-chain verification; see us_cert_verify_cb. An
+   * allocation failure just leaves the context on the uncached path. */
+  struct us_verify_cache_t *verify_cache = us_calloc(1, sizeof(*verify_cache));
+  if (verify_cache) {
+    SSL_CTX_set_ex_data(ssl_context, us_ctx_verify_cache_ex_idx, verify_cache);
+    SSL_CTX_set_cert_verify_callback(ssl_context, us_cert_verify_cb, NULL);
+  }
   return ssl_context;
 }
 
@@ -1208,7 +1367,12 @@ int us_ssl_ctx_add_ca_cert(SSL_CTX *ctx, const char *content) {
   /* A CA added after the context was built (pfx extras, addCACert) lands in
    * the store the handshake-time auto-chain walks, so a leaf-only cert picks
    * the intermediate up with no eager re-walk. */
-  return add_ca_cert_to_ctx_store(ctx, content, store);
+  int added = add_ca_cert_to_ctx_store(ctx, content, store);
+  if (added) {
+    /* The trust set changed; cached verdicts were proved against the old one. */
+    us_verify_cache_flush(ctx);
+  }
+  return added;
 }
 
 /* node:tls `pfx` support: parse a PKCS#12 blob and hand back PEM-encoded
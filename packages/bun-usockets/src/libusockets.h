@@ -492,6 +492,10 @@ struct us_bun_socket_context_options_t {
     unsigned int client_renegotiation_window;
     /* Session timeout in seconds applied via SSL_CTX_set_timeout; 0 = library default. */
     int session_timeout;
+    /* Max entries in BoringSSL's internal session cache (server-side session-ID
+     * resumption). 0 keeps the cache disabled (SSL_SESS_CACHE_NO_INTERNAL),
+     * matching the historical behavior where sessions are only surfaced to JS. */
+    unsigned int session_cache_size;
     /* PEM-encoded CRLs added to the context's X509_STORE (enables CRL checking). */
     const char * const *crl;
     unsigned int crl_count;
@@ -81,6 +81,7 @@ namespace uWS {
         unsigned int client_renegotiation_limit = 3;
         unsigned int client_renegotiation_window = 600;
         int session_timeout = 0;
+        unsigned int session_cache_size = 0;
         const char **crl = nullptr;
         unsigned int crl_count = 0;
         int allow_partial_trust_chain = 0;
@@ -54,6 +54,11 @@ new!(pub BUN_CONFIG_DNS_TIME_TO_LIVE_SECONDS: unsigned, "BUN_CONFIG_DNS_TIME_TO_
 // if it fires the request fails with `error.Timeout`. Covers the TLS
 // handshake through the response body. 0 disables. See `src/http/lib.rs`.
 new!(pub BUN_CONFIG_HTTP_IDLE_TIMEOUT: unsigned, "BUN_CONFIG_HTTP_IDLE_TIMEOUT", { default: 300 });
+// Minutes an idle keep-alive socket may sit parked in the HTTP client's
+// connection pool before uws sweeps it (minute granularity comes from uws's
+// long-timeout wheel). 0 disables pooling: sockets close after each request
+// instead of being parked. See `HTTPContext::release_socket`.
+new!(pub BUN_CONFIG_HTTP_KEEPALIVE_IDLE_MINUTES: unsigned, "BUN_CONFIG_HTTP_KEEPALIVE_IDLE_MINUTES", { default: 5 });
 // Opening-handshake timeout for the `new WebSocket()` client, in seconds.
 // A peer that accepts the TCP connection but never answers the upgrade fails
 // with error + close(1006). 0 disables; uSockets' 4 s sweep rounds small values up.
@@ -103,7 +108,22 @@ new!(pub BUN_NEEDS_PROC_SELF_WORKAROUND: boolean, "BUN_NEEDS_PROC_SELF_WORKAROUN
 new!(pub BUN_OPTIONS: string, "BUN_OPTIONS", {});
 new!(pub BUN_POSTGRES_SOCKET_MONITOR: string, "BUN_POSTGRES_SOCKET_MONITOR", {});
 new!(pub BUN_POSTGRES_SOCKET_MONITOR_READER: string, "BUN_POSTGRES_SOCKET_MONITOR_READER", {});
+// Opt-in: persist bare-specifier `require()` resolutions to
+// `node_modules/.cache/bun/resolve.cache` so repeat cold starts skip the
+// node_modules directory walk. Invalidated by top-level package.json/lockfile
+// mtime. See bun_resolver's resolution_cache.rs.
+new!(pub BUN_RESOLUTION_CACHE: boolean, "BUN_RESOLUTION_CACHE", { default: false });
+// Opt-in: serve repeated path-based fs.stat()/fs.lstat() results (including
+// ENOENT) from an in-memory cache for this many milliseconds. Results may be
+// stale up to the TTL for changes made outside node:fs path ops. See
+// bun_runtime's node_fs_stat_cache.rs.
+new!(pub BUN_FS_STAT_CACHE_TTL_MS: unsigned, "BUN_FS_STAT_CACHE_TTL_MS", { default: 0 });
 new!(pub BUN_RUNTIME_TRANSPILER_CACHE_PATH: string, "BUN_RUNTIME_TRANSPILER_CACHE_PATH", {});
+// Opt-in: also persist JSC bytecode next to each transpiler-cache entry so
+// repeat cold starts skip JSC's parse + codegen. Costs one extra codegen pass
+// per module on the first (cache-miss) run, so it only pays off for workloads
+// that restart often (serverless, CI). See RuntimeTranspilerCache.rs.
+new!(pub BUN_RUNTIME_TRANSPILER_CACHE_BYTECODE: boolean, "BUN_RUNTIME_TRANSPILER_CACHE_BYTECODE", { default: false });
 new!(pub BUN_SSG_DISABLE_STATIC_ROUTE_VISITOR: boolean, "BUN_SSG_DISABLE_STATIC_ROUTE_VISITOR", { default: false });
 new!(pub BUN_TCC_OPTIONS: string, "BUN_TCC_OPTIONS", {});
 // Standard C compiler environment variable for include paths (colon-separated).
@@ -202,6 +222,8 @@ pub mod feature_flag {
 
     new_feature_flag!(pub BUN_FEATURE_FLAG_DISABLE_ADDRCONFIG, "BUN_FEATURE_FLAG_DISABLE_ADDRCONFIG", {});
     new_feature_flag!(pub BUN_FEATURE_FLAG_DISABLE_ASYNC_TRANSPILER, "BUN_FEATURE_FLAG_DISABLE_ASYNC_TRANSPILER", {});
+    // Disable speculative pre-transpilation of a module's imports
+    new_feature_flag!(pub BUN_FEATURE_FLAG_DISABLE_SPECULATIVE_TRANSPILE, "BUN_FEATURE_FLAG_DISABLE_SPECULATIVE_TRANSPILE", {});
     new_feature_flag!(pub BUN_FEATURE_FLAG_DISABLE_ISOLATION_SOURCE_CACHE, "BUN_FEATURE_FLAG_DISABLE_ISOLATION_SOURCE_CACHE", {});
     new_feature_flag!(pub BUN_FEATURE_FLAG_DISABLE_DNS_CACHE, "BUN_FEATURE_FLAG_DISABLE_DNS_CACHE", {});
     new_feature_flag!(pub BUN_FEATURE_FLAG_DISABLE_DNS_CACHE_LIBINFO, "BUN_FEATURE_FLAG_DISABLE_DNS_CACHE_LIBINFO", {});
@@ -241,6 +263,12 @@ pub mod feature_flag {
     // server selects it. Off by default while the client implementation
     // matures. `--experimental-http2-fetch` is the CLI equivalent.
     new_feature_flag!(pub BUN_FEATURE_FLAG_EXPERIMENTAL_HTTP2_CLIENT, "BUN_FEATURE_FLAG_EXPERIMENTAL_HTTP2_CLIENT", {});
+    // Offer "h2" for `bun install` registry requests (manifests + tarballs)
+    // without turning the experimental client on for fetch(). Multiplexing
+    // hundreds of manifest GETs over a few connections cuts cold-resolve time
+    // on high-RTT links. Off by default while the client implementation
+    // matures.
+    new_feature_flag!(pub BUN_FEATURE_FLAG_EXPERIMENTAL_HTTP2_INSTALL, "BUN_FEATURE_FLAG_EXPERIMENTAL_HTTP2_INSTALL", {});
     // Honor `Alt-Svc: h3` from fetch() responses: subsequent requests to the
     // same origin go over QUIC/HTTP-3 instead of TCP. Off by default while
     // the client implementation matures. `--experimental-http3-fetch` is the
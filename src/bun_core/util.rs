@@ -4577,6 +4577,60 @@ impl SpawnStatus {
     }
 }
 
+/// A spawned-but-not-yet-reaped child from [`spawn_inherit_no_stdin`].
+/// Callers that need several children running at once (e.g. multi-target
+/// `bun build --compile`) spawn them all, then [`SpawnHandle::wait`] each.
+#[derive(Debug)]
+pub struct SpawnHandle {
+    #[cfg(unix)]
+    pid: libc::pid_t,
+    #[cfg(windows)]
+    child: std::process::Child,
+}
+
+impl SpawnHandle {
+    /// Block until the child exits and return its status. Non-exit
+    /// terminations (signals) report as `code: -1`, matching
+    /// [`spawn_sync_inherit`].
+    pub fn wait(self) -> crate::CrateResult<SpawnStatus> {
+        #[cfg(unix)]
+        {
+            let mut status: i32 = 0;
+            loop {
+                // SAFETY: `self.pid` is a child this process spawned and has
+                // not yet reaped; `status` is a valid out-param.
+                let r = unsafe { libc::waitpid(self.pid, &raw mut status, 0) };
+                if r == -1 {
+                    let e = std::io::Error::last_os_error().raw_os_error().unwrap_or(-1);
+                    if e == libc::EINTR {
+                        continue;
+                    }
+                    return Err(crate::CrateError::Unexpected);
+                }
+                break;
+            }
+            let code = if libc::WIFEXITED(status) {
+                libc::WEXITSTATUS(status)
+            } else {
+                -1
+            };
+            Ok(SpawnStatus { code })
+        }
+        #[cfg(windows)]
+        {
+            let mut child = self.child;
+            let status = child.wait().map_err(|_| crate::CrateError::Unexpected)?;
+            Ok(SpawnStatus {
+                code: status.code().unwrap_or(-1),
+            })
+        }
+        #[cfg(not(any(unix, windows)))]
+        {
+            Err(crate::CrateError::Unexpected)
+        }
+    }
+}
+
 // ── posix_spawn_bun FFI (canonical #[repr(C)] mirror) ─────────────────────
 // RULE: libc `posix_spawn`/`posix_spawnp` must NEVER be called directly on
 // Linux/FreeBSD. Bun ships its own vfork-based spawner in
@@ -4711,17 +4765,23 @@ enum StdinBehavior {
 /// Spawn argv, inherit stdout/stderr, **ignore stdin** (fd 0 ← /dev/null),
 /// wait.
 pub fn spawn_sync_inherit_no_stdin(argv: &[impl AsRef<[u8]>]) -> crate::CrateResult<SpawnStatus> {
-    spawn_sync_inherit_impl(argv, StdinBehavior::Ignore)
+    spawn_inherit_impl(argv, StdinBehavior::Ignore)?.wait()
 }
 
 pub fn spawn_sync_inherit(argv: &[impl AsRef<[u8]>]) -> crate::CrateResult<SpawnStatus> {
-    spawn_sync_inherit_impl(argv, StdinBehavior::Inherit)
+    spawn_inherit_impl(argv, StdinBehavior::Inherit)?.wait()
+}
+
+/// Like [`spawn_sync_inherit_no_stdin`], but returns without waiting so the
+/// caller can run several children concurrently.
+pub fn spawn_inherit_no_stdin(argv: &[impl AsRef<[u8]>]) -> crate::CrateResult<SpawnHandle> {
+    spawn_inherit_impl(argv, StdinBehavior::Ignore)
 }
 
-fn spawn_sync_inherit_impl(
+fn spawn_inherit_impl(
     argv: &[impl AsRef<[u8]>],
     stdin: StdinBehavior,
-) -> crate::CrateResult<SpawnStatus> {
+) -> crate::CrateResult<SpawnHandle> {
     // Empty argv: fail like the Windows path below instead of panicking on
     // the `argv[0]` reads in the per-OS unix arms.
     if argv.is_empty() {
@@ -4731,7 +4791,7 @@ fn spawn_sync_inherit_impl(
     // SAFETY: argv strings are owned `ZBox`es (NUL-terminated) kept alive in
     // `cargs` for the duration of the spawn; `ptrs`/`environ` are null-
     // terminated `*const c_char` arrays as required by `posix_spawn_bun` /
-    // `posix_spawnp`. `waitpid` is passed a valid `&mut c_int` out-param.
+    // `posix_spawnp`.
     unsafe {
         let cargs: Vec<ZBox> = argv
             .iter()
@@ -4892,24 +4952,7 @@ fn spawn_sync_inherit_impl(
             return Err(crate::CrateError::Unexpected);
         };
 
-        let mut status: i32 = 0;
-        loop {
-            let r = libc::waitpid(pid, &raw mut status, 0);
-            if r == -1 {
-                let e = std::io::Error::last_os_error().raw_os_error().unwrap_or(-1);
-                if e == libc::EINTR {
-                    continue;
-                }
-                return Err(crate::CrateError::Unexpected);
-            }
-            break;
-        }
-        let code = if libc::WIFEXITED(status) {
-            libc::WEXITSTATUS(status)
-        } else {
-            -1
-        };
-        Ok(SpawnStatus { code })
+        Ok(SpawnHandle { pid })
     }
     #[cfg(windows)]
     {
@@ -4940,13 +4983,12 @@ fn spawn_sync_inherit_impl(
         if stdin == StdinBehavior::Ignore {
             cmd.stdin(std::process::Stdio::null());
         }
-        let status = cmd.status().map_err(|e| match e.kind() {
+        let child = cmd.spawn().map_err(|e| match e.kind() {
             std::io::ErrorKind::NotFound => crate::CrateError::FileNotFound,
             std::io::ErrorKind::PermissionDenied => crate::CrateError::AccessDenied,
             _ => crate::CrateError::Unexpected,
         })?;
-        let code = status.code().unwrap_or(-1);
-        Ok(SpawnStatus { code })
+        Ok(SpawnHandle { child })
     }
     #[cfg(not(any(unix, windows)))]
     {
@@ -342,6 +342,24 @@ pub fn write_output_files_to_disk(
                     Ok(_) => {}
                 }
 
+                // Bun-target builds also get a binary mappings sidecar so
+                // runtime stack traces restore the map without a JSON/VLQ
+                // parse (Sidecar.rs in bun_sourcemap). Best effort: on any
+                // failure the runtime just parses the JSON.
+                if c.options.target.is_bun() {
+                    if let Some(sidecar) =
+                        bun_sourcemap::sidecar::encode_from_json(&output_source_map)
+                    {
+                        let sidecar_rel_path =
+                            strings::concat(&[&source_map_final_rel_path, b".bin"]);
+                        let _ = bun_sys::File::write_file(
+                            bun_sys::Fd::from_std_dir(&root_dir),
+                            paths::resolve_path::z(&sidecar_rel_path, &mut pathbuf),
+                            &sidecar,
+                        );
+                    }
+                }
+
                 source_map_output_file = Some(OutputFile::init(OutputFileInit {
                     output_path: source_map_final_rel_path,
                     input_path: strings::concat(&[&input_path, b".map"]),
@@ -438,6 +438,7 @@ JSValue InternalModuleRegistry::createInternalModuleById(JSGlobalObject* globalO
               `InternalModuleRegistryConstants::${idToEnumName(id)}CodeOffset, ` +
               `InternalModuleRegistryConstants::${idToEnumName(id)}CodeLength, "${urlString}"_s);`;
         return `case Field::${idToEnumName(id)}: {
+      InternalModuleInitTracer perfTracer("${moduleName}");
       ${inner}
     }`;
       })
@@ -65,6 +65,20 @@ export type Field =
         returns: string;
         args?: [string, string] | [string, string, string] | [string] | [];
         pure?: boolean;
+        /**
+         * Pass the JS `this` (the wrapper cell) as an extra `JSValue`
+         * argument before the unwrapped args. Required for methods that
+         * return `this` for chaining — the fast path otherwise only sees
+         * the unwrapped `m_ctx` pointer.
+         */
+        passThis?: boolean;
+        /**
+         * DOMJIT declarations are stripped unless this is set: the port
+         * dispatches each fast path to an inherent
+         * `${fn}_without_type_checks` method on the Rust struct, and most
+         * declarations predate those impls existing.
+         */
+        enabled?: boolean;
       };
     } & PropertyAttribute)
   | { internal: true }
@@ -316,7 +330,7 @@ export function define(
       Object.entries(klass)
         .sort(([a], [b]) => a.localeCompare(b))
         .map(([k, v]) => {
-          v["DOMJIT"] = undefined;
+          if (!v["DOMJIT"]?.enabled) v["DOMJIT"] = undefined;
           return [k, v];
         }),
     ),
@@ -324,7 +338,7 @@ export function define(
       Object.entries(proto)
         .sort(([a], [b]) => a.localeCompare(b))
         .map(([k, v]) => {
-          v["DOMJIT"] = undefined;
+          if (!v["DOMJIT"]?.enabled) v["DOMJIT"] = undefined;
           return [k, v];
         }),
     ),
@@ -89,12 +89,13 @@ function DOMJITReturnType(type) {
   }[type];
 }
 
-function DOMJITFunctionDeclaration(jsClassName, fnName, symName, { args, returns, pure = false }) {
+function DOMJITFunctionDeclaration(jsClassName, fnName, symName, { args, returns, pure = false, passThis = false }) {
   const argNames = args.map((arg, i) => `${argTypeName(arg)} arg${i}`);
   const formattedArgs = argNames.length > 0 ? `, ${argNames.join(", ")}` : "";
+  const thisArg = passThis ? ", JSC::EncodedJSValue jsThisValue" : "";
   const domJITArgs = args.length > 0 ? `, ${args.map(DOMJITType).join(", ")}` : "";
   externs += `
-extern JSC_CALLCONV JSC::EncodedJSValue JSC_HOST_CALL_ATTRIBUTES ${DOMJITName(symName)}(void* ptr, JSC::JSGlobalObject * lexicalGlobalObject${formattedArgs});
+extern JSC_CALLCONV JSC::EncodedJSValue JSC_HOST_CALL_ATTRIBUTES ${DOMJITName(symName)}(void* ptr, JSC::JSGlobalObject * lexicalGlobalObject${thisArg}${formattedArgs});
   `;
 
   return (
@@ -114,9 +115,10 @@ static const JSC::DOMJIT::Signature DOMJITSignatureFor${fnName}(${DOMJITName(fnN
   );
 }
 
-function DOMJITFunctionDefinition(jsClassName, fnName, symName, { args }, fn) {
+function DOMJITFunctionDefinition(jsClassName, fnName, symName, { args, passThis = false }, fn) {
   const argNames = args.map((arg, i) => `${argTypeName(arg)} arg${i}`);
   const formattedArgs = argNames.length > 0 ? `, ${argNames.join(", ")}` : "";
+  const thisFwd = passThis ? ", JSC::JSValue::encode(JSC::JSValue(reinterpret_cast<JSC::JSCell*>(thisValue)))" : "";
   const retArgs = argNames.length > 0 ? `, ${args.map((b, i) => "arg" + i).join(", ")}` : "";
 
   return `
@@ -131,7 +133,7 @@ JSC_DEFINE_JIT_OPERATION(${DOMJITName(
     JSC::JITOperationPrologueCallFrameTracer tracer(vm, callFrame);
 #if BUN_DEBUG
     ${jsClassName}* wrapper = reinterpret_cast<${jsClassName}*>(thisValue);
-    JSC::EncodedJSValue result = ${DOMJITName(symName)}(wrapper->wrapped(), lexicalGlobalObject${retArgs});
+    JSC::EncodedJSValue result = ${DOMJITName(symName)}(wrapper->wrapped(), lexicalGlobalObject${thisFwd}${retArgs});
     JSValue decoded = JSValue::decode(result);
     if (wrapper->m_${fn}_expectedResultType) {
         if (decoded.isCell() && !decoded.isEmpty()) {
@@ -147,7 +149,7 @@ JSC_DEFINE_JIT_OPERATION(${DOMJITName(
     }
     return { result };
 #endif
-    return {${DOMJITName(symName)}(reinterpret_cast<${jsClassName}*>(thisValue)->wrapped(), lexicalGlobalObject${retArgs})};
+    return {${DOMJITName(symName)}(reinterpret_cast<${jsClassName}*>(thisValue)->wrapped(), lexicalGlobalObject${thisFwd}${retArgs})};
 }
 `.trim();
 }
@@ -2379,14 +2381,14 @@ function generateRust(
       if (names.fn) {
         const id = rustSnakeIdent(fn);
         if (names.DOMJIT) {
-          const { args } = DOMJIT;
+          const { args, passThis: domjitPassThis = false } = DOMJIT;
           const argDecl = args.map((t, i) => `arg${i}: ${RustDOMJITArgType(t)}`).join(", ");
           const argFwd = args.map((_, i) => `arg${i}`).join(", ");
           const fastId = rustSnakeIdent(DOMJITName(fn));
           thunk(
             names.DOMJIT,
-            `(this: ${recv}, global: &JSGlobalObject${args.length ? ", " + argDecl : ""}) -> JSValue`,
-            `    ${T}::${fastId}(this, global${args.length ? ", " + argFwd : ""})`,
+            `(this: ${recv}, global: &JSGlobalObject${domjitPassThis ? ", this_value: JSValue" : ""}${args.length ? ", " + argDecl : ""}) -> JSValue`,
+            `    ${T}::${fastId}(this, global${domjitPassThis ? ", this_value" : ""}${args.length ? ", " + argFwd : ""})`,
           );
         }
         thunk(
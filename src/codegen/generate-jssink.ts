@@ -187,6 +187,10 @@ function header() {
 
 JSC_DECLARE_CUSTOM_GETTER(function${name}__getter);
 
+// Direct write with a raw \`wrapped()\` pointer and the chunk as a bare value —
+// the readStreamIntoSink pump's bypass of the \`write\` host-fn callframe.
+extern "C" JSC::EncodedJSValue ${name}__writeValue(JSC::JSGlobalObject*, void* sinkPtr, JSC::EncodedJSValue chunk);
+
         `;
   }
 
@@ -1015,14 +1019,15 @@ extern "C" void ${name}__onClose(JSC::EncodedJSValue controllerValue, JSC::Encod
 // Emits `generated_jssink.rs`: `#[unsafe(no_mangle)] extern "C"` thunks for the
 // per-sink symbols the C++ side (JSSink.cpp / headers.h) declares as
 // `BUN_DECLARE_HOST_FUNCTION(${name}__{construct,write,end,flush,start})` plus
-// the two non-host-fn externs `${name}__getInternalFd` / `${name}__memoryCost`.
+// the non-host-fn externs `${name}__{getInternalFd,memoryCost,writeValue}`.
 // Each thunk calls an inherent method on the real sink struct in
 // `crate::webcore`; a missing method is a compile error.
 //
 // Calling convention: `BUN_DECLARE_HOST_FUNCTION` and `endWithSink` use
 // `SYSV_ABI` (= `extern "sysv64"` on win-x64, `"C"` elsewhere) — wrapped in
 // `bun_jsc::jsc_host_abi!`. The remaining `ZIG_DECL` / plain `extern "C"`
-// symbols (finalize/close/updateRef/getInternalFd/memoryCost) stay `extern "C"`.
+// symbols (finalize/close/updateRef/getInternalFd/memoryCost/writeValue) stay
+// `extern "C"`.
 function rustSink() {
   // All sink structs live (or will live) under `crate::webcore`.
   const sinkPaths: Record<string, string> = {
@@ -1051,7 +1056,8 @@ function rustSink() {
 //
 // Calling convention: \`BUN_DECLARE_HOST_FUNCTION\` and \`endWithSink\` use
 // SYSV ABI (\`jsc_host_abi!\`); the \`ZIG_DECL\` / plain \`extern "C"\` symbols
-// (finalize/close/updateRef/getInternalFd/memoryCost) stay \`extern "C"\`.
+// (finalize/close/updateRef/getInternalFd/memoryCost/writeValue) stay
+// \`extern "C"\`.
 //
 // Safe-body: \`m_sinkPtr\` params are typed \`&\`/\`&mut\` (every C++ caller
 // null-checks first); host fns route through \`bun_jsc::host_fn::host_fn_static\`.
@@ -1105,6 +1111,17 @@ pub extern "C" fn ${name}__memoryCost(this: &${name}) -> usize {
     ${JSSinkT}::js_memory_cost(this)
 }
 
+`;
+
+    // extern "C" JSC::EncodedJSValue ${name}__writeValue(JSC::JSGlobalObject*, void* sinkPtr, JSC::EncodedJSValue)
+    // — the readStreamIntoSink pump's direct write (BunStreamSource.cpp).
+    // C++ caller null-checks `wrapped()` before calling.
+    symbols.push(`${name}__writeValue`);
+    templ += `#[unsafe(no_mangle)]
+pub extern "C" fn ${name}__writeValue(global: &JSGlobalObject, this: &mut ${name}, chunk: JSValue) -> JSValue {
+    ${JSSinkT}::js_write_value(global, this, chunk)
+}
+
 `;
 
     // ZIG_DECL void ${name}__finalize(void* sinkPtr) — called from JS${name}::~JS${name}.
@@ -0,0 +1,232 @@
+//! Always-on in-memory flight recorder.
+//!
+//! `CURRENT_ACTION` answers "what is this thread doing right now"; the flight
+//! recorder answers "what was every thread doing just before the crash".
+//! Subsystems record fixed-size events — a `&'static str` label plus one
+//! integer — into a per-thread lock-free ring, and the crash handler dumps the
+//! events from the last [`DUMP_WINDOW_NS`] alongside the stack trace.
+//!
+//! Recording is one monotonic clock read plus a handful of relaxed atomic
+//! stores, cheap enough to stay enabled in release builds on hot paths (the
+//! per-task event-loop dispatch records unconditionally). Each slot is a tiny
+//! seqlock so the crash thread can read *other* threads' rings while their
+//! owners keep writing: a torn slot fails the sequence check and is skipped
+//! instead of printing a mismatched label pointer/length pair.
+//!
+//! The dump path is built for signal context: no allocation, no blocking
+//! locks (`try_lock` on the registry, same as `BEFORE_CRASH_HANDLERS`), and
+//! `clock_gettime` is async-signal-safe.
+
+use core::cell::Cell;
+use core::sync::atomic::{AtomicU64, AtomicUsize, Ordering, fence};
+
+use bun_io::Write;
+
+/// Events retained per thread. At 40 bytes per slot this is ~10 KB per
+/// recording thread, which buys several event-loop turns of history.
+const RING_LEN: usize = 256;
+
+/// How far back the crash dump looks. 50 ms covers a few event-loop turns
+/// without flooding the report.
+pub const DUMP_WINDOW_NS: u64 = 50 * bun_core::time::NS_PER_MS;
+
+/// Monotonic nanoseconds. `ForceRealTime` — fake timers must not rewrite the
+/// crash timeline.
+#[inline]
+fn monotonic_ns() -> u64 {
+    bun_core::Timespec::now(bun_core::timespec_mode::ForceRealTime).ns()
+}
+
+/// One recorded event. Every field is an atomic so cross-thread reads are
+/// race-free by construction; `seq` (odd while the owner is mid-write) is
+/// what keeps the *pair* of label words consistent.
+struct Slot {
+    seq: AtomicU64,
+    timestamp_ns: AtomicU64,
+    label_ptr: AtomicUsize,
+    label_len: AtomicUsize,
+    arg: AtomicU64,
+}
+
+impl Slot {
+    const fn new() -> Slot {
+        Slot {
+            seq: AtomicU64::new(0),
+            timestamp_ns: AtomicU64::new(0),
+            label_ptr: AtomicUsize::new(0),
+            label_len: AtomicUsize::new(0),
+            arg: AtomicU64::new(0),
+        }
+    }
+}
+
+/// A validated copy of a [`Slot`], read out by the dump path.
+#[derive(Clone, Copy)]
+struct Event {
+    timestamp_ns: u64,
+    label: &'static str,
+    arg: u64,
+}
+
+pub struct ThreadRing {
+    thread_id: u64,
+    /// Total events ever recorded by the owner; the write cursor is
+    /// `head % RING_LEN`. Only the owner stores, so `Relaxed` everywhere.
+    head: AtomicU64,
+    slots: [Slot; RING_LEN],
+}
+
+impl ThreadRing {
+    /// Called only by the owning thread.
+    fn record(&self, label: &'static str, arg: u64) {
+        let timestamp_ns = monotonic_ns();
+        let n = self.head.load(Ordering::Relaxed);
+        let slot = &self.slots[(n % RING_LEN as u64) as usize];
+
+        // Seqlock write: odd seq marks the slot torn for the duration.
+        let seq = slot.seq.load(Ordering::Relaxed);
+        slot.seq.store(seq.wrapping_add(1), Ordering::Relaxed);
+        fence(Ordering::Release);
+        slot.timestamp_ns.store(timestamp_ns, Ordering::Relaxed);
+        slot.label_ptr
+            .store(label.as_ptr() as usize, Ordering::Relaxed);
+        slot.label_len.store(label.len(), Ordering::Relaxed);
+        slot.arg.store(arg, Ordering::Relaxed);
+        slot.seq.store(seq.wrapping_add(2), Ordering::Release);
+
+        self.head.store(n.wrapping_add(1), Ordering::Relaxed);
+    }
+
+    /// Seqlock read: `None` if the owner was mid-write (torn slot).
+    fn read_slot(&self, index: u64) -> Option<Event> {
+        let slot = &self.slots[(index % RING_LEN as u64) as usize];
+        let seq_before = slot.seq.load(Ordering::Acquire);
+        if seq_before & 1 != 0 {
+            return None;
+        }
+        let timestamp_ns = slot.timestamp_ns.load(Ordering::Relaxed);
+        let label_ptr = slot.label_ptr.load(Ordering::Relaxed);
+        let label_len = slot.label_len.load(Ordering::Relaxed);
+        let arg = slot.arg.load(Ordering::Relaxed);
+        fence(Ordering::Acquire);
+        if slot.seq.load(Ordering::Relaxed) != seq_before || label_ptr == 0 {
+            return None;
+        }
+        // SAFETY: the seq check proves ptr/len were stored together by
+        // `record`, which took them from one `&'static str`.
+        let label = unsafe {
+            core::str::from_utf8_unchecked(core::slice::from_raw_parts(
+                label_ptr as *const u8,
+                label_len,
+            ))
+        };
+        Some(Event {
+            timestamp_ns,
+            label,
+            arg,
+        })
+    }
+}
+
+thread_local! {
+    /// This thread's ring, allocated and registered on first [`record`].
+    static RING: Cell<Option<&'static ThreadRing>> = const { Cell::new(None) };
+}
+
+// Rings are leaked deliberately: a ring must stay readable by a crashing
+// thread even while its owner is exiting, and deregistration would reintroduce
+// exactly the teardown race this sidesteps. The cost is bounded by the number
+// of threads that ever record (~10 KB each).
+static RINGS: bun_threading::Guarded<Vec<&'static ThreadRing>> =
+    bun_threading::Guarded::new(Vec::new());
+
+/// Record one event on the calling thread's ring. `label` names the event
+/// ("gc", "http request start", a task-tag name, ...); `arg` is one free
+/// integer of context (heap size, correlation pointer, 0 if unused) printed
+/// verbatim in the dump.
+#[inline]
+pub fn record(label: &'static str, arg: u64) {
+    RING.with(|cell| {
+        let ring = match cell.get() {
+            Some(ring) => ring,
+            None => {
+                let ring: &'static ThreadRing = Box::leak(Box::new(ThreadRing {
+                    thread_id: bun_threading::current_thread_id(),
+                    head: AtomicU64::new(0),
+                    slots: [const { Slot::new() }; RING_LEN],
+                }));
+                RINGS.lock().push(ring);
+                cell.set(Some(ring));
+                ring
+            }
+        };
+        ring.record(label, arg);
+    });
+}
+
+/// Dump every thread's last [`DUMP_WINDOW_NS`] of events, oldest first per
+/// thread. Called from the crash handler after the "Crashed while" line;
+/// prints nothing when no thread recorded inside the window. Best-effort: a
+/// contended registry lock or slots overwritten mid-dump are skipped, never
+/// waited on.
+pub fn dump(writer: &mut impl Write) -> crate::Result<()> {
+    // Registration holds this lock only to push; if it is contended anyway,
+    // losing the dump beats deadlocking the crash handler in signal context.
+    let Some(rings) = RINGS.try_lock() else {
+        return Ok(());
+    };
+    let now = monotonic_ns();
+    let cutoff = now.saturating_sub(DUMP_WINDOW_NS);
+    let current_thread = bun_threading::current_thread_id();
+
+    let mut printed_header = false;
+    for ring in rings.iter() {
+        let head = ring.head.load(Ordering::Relaxed);
+        let oldest = head.saturating_sub(RING_LEN as u64);
+        let mut printed_thread = false;
+        for index in oldest..head {
+            let Some(event) = ring.read_slot(index) else {
+                continue;
+            };
+            if event.timestamp_ns < cutoff || event.timestamp_ns > now {
+                continue;
+            }
+            if !printed_header {
+                printed_header = true;
+                writeln!(
+                    writer,
+                    "Flight recorder (last {}ms):",
+                    DUMP_WINDOW_NS / bun_core::time::NS_PER_MS
+                )?;
+            }
+            if !printed_thread {
+                printed_thread = true;
+                if ring.thread_id == current_thread {
+                    writeln!(writer, "thread {} (crashed):", ring.thread_id)?;
+                } else {
+                    writeln!(writer, "thread {}:", ring.thread_id)?;
+                }
+            }
+            let behind_us = (now - event.timestamp_ns) / bun_core::time::NS_PER_US;
+            if event.arg != 0 {
+                writeln!(
+                    writer,
+                    "  -{}.{:03}ms {} ({})",
+                    behind_us / 1000,
+                    behind_us % 1000,
+                    event.label,
+                    event.arg
+                )?;
+            } else {
+                writeln!(
+                    writer,
+                    "  -{}.{:03}ms {}",
+                    behind_us / 1000,
+                    behind_us % 1000,
+                    event.label
+                )?;
+            }
+        }
+    }
+    Ok(())
+}
@@ -30,6 +30,7 @@ pub mod cpu_features;
 pub mod handle_oom;
 
 pub mod error;
+pub mod flight_recorder;
 pub use error::{Error, Result};
 
 /// Link-time target for `bun_alloc::out_of_memory()` — declared
@@ -1119,6 +1120,10 @@ mod draft {
                         }
                     }
 
+                    if crate::flight_recorder::dump(writer).is_err() {
+                        abort();
+                    }
+
                     let mut addr_buf: [usize; 20] = [0; 20];
                     let trace_buf: StackTrace;
 
@@ -1909,6 +1914,8 @@ mod draft {
                 let _ = writeln!(writer, "Crashed while {}", action);
             }
 
+            let _ = crate::flight_recorder::dump(writer);
+
             let mut addr_buf: [usize; 20] = [0; 20];
             let idx = debug::capture_stack_trace(debug::return_address(), &mut addr_buf);
             let trace = StackTrace {
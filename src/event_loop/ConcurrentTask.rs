@@ -50,6 +50,9 @@ pub mod task_tag {
             /// Number of task tags. `bun_runtime::dispatch::run_task` asserts
             /// exhaustiveness against this.
             pub const COUNT: u8 = tags!(@count 0u8, $($name,)*);
+            /// Tag → identifier name, for diagnostics (the crash-handler
+            /// flight recorder labels each dispatched task with this).
+            pub const NAMES: [&str; COUNT as usize] = [$(stringify!($name)),*];
         };
         (@ $n:expr, $head:ident, $($rest:ident,)*) => {
             pub const $head: TaskTag = TaskTag($n);
@@ -158,6 +161,12 @@ pub mod task_tag {
         WriteFileTask,
         Writev,
     }
+
+    /// Diagnostic name for a tag (`"FetchTasklet"`), `"?"` if out of range.
+    #[inline]
+    pub fn name(tag: TaskTag) -> &'static str {
+        NAMES.get(tag.0 as usize).copied().unwrap_or("?")
+    }
 }
 
 #[derive(Copy, Clone)]
@@ -74,6 +74,8 @@ pub enum InHeap {
     None,
     Regular,
     Fake,
+    /// In one of the hashed wheel's slot heaps (`bun_runtime::timer::TimerWheel`).
+    Wheel,
 }
 
 impl EventLoopTimer {
@@ -9,6 +9,7 @@
 //! |----------------|-----------------------------------------------|---------------|
 //! | `adler32`      | [`Adler32::hash`] (no seed)                   | — → u32       |
 //! | `cityHash32`   | [`CityHash32::hash`] (no seed)                | — → u32       |
+//! | `crc32c`       | [`Crc32c::hash_with_seed`]                    | u32 → u32     |
 //! | `cityHash64`   | [`CityHash64::hash_with_seed`]                | u64 → u64     |
 //! | `xxHash32`     | [`XxHash32::hash`]                            | u32 → u32     |
 //! | `xxHash64`     | [`XxHash64::hash`]                            | u64 → u64     |
@@ -23,12 +24,14 @@
 #![allow(clippy::many_single_char_names)]
 pub mod adler32;
 pub mod cityhash;
+pub mod crc32c;
 pub mod murmur;
 pub mod rapidhash;
 pub mod xxhash;
 
 pub use adler32::Adler32;
 pub use cityhash::{CityHash32, CityHash64};
+pub use crc32c::Crc32c;
 pub use murmur::{Murmur2_32, Murmur2_64, Murmur3_32};
 pub use rapidhash::RapidHash;
 pub use xxhash::{XxHash32, XxHash64, XxHash64Streaming};
@@ -68,6 +68,8 @@ unsafe extern "C" {
 
     fn highway_decode_hex16(input: *const u16, output: *mut u8, out_len: usize) -> usize;
 
+    fn highway_timing_safe_equal(a: *const u8, b: *const u8, len: usize) -> bool;
+
     fn highway_xxhash3_64(input: *const u8, len: usize, seed: u64) -> u64;
 
     fn highway_xxhash32(input: *const u8, len: usize, seed: u32) -> u32;
@@ -412,6 +414,22 @@ pub fn decode_hex_u16(src: &[u16], dst: &mut [u8]) -> usize {
     written
 }
 
+/// Constant-time equality for equal-length secrets: a fixed-stride vector
+/// XOR-accumulate with no early exit, so the byte contents never influence
+/// control flow or iteration count. Only the length is observable through
+/// timing, and the length is treated as public — this panics on a mismatch
+/// rather than leaking anything by comparing prefixes.
+#[inline(always)]
+pub fn timing_safe_equal(a: &[u8], b: &[u8]) -> bool {
+    assert_eq!(a.len(), b.len(), "timing_safe_equal: length mismatch");
+    if a.is_empty() {
+        return true;
+    }
+
+    // SAFETY: both ptr/len pairs are valid readable ranges of equal length.
+    unsafe { highway_timing_safe_equal(a.as_ptr(), b.as_ptr(), a.len()) }
+}
+
 /// Apply a WebSocket mask to data using SIMD acceleration
 /// If skip_mask is true, data is copied without masking
 #[inline(always)]
@@ -683,6 +683,15 @@ impl<'a> AsyncHTTP<'a> {
             let callback = (*this).result_callback;
             (*this).elapsed = http_thread_timer_read().saturating_sub((*this).elapsed);
 
+            bun_crash_handler::flight_recorder::record(
+                if result.is_success() {
+                    "http done"
+                } else {
+                    "http failed"
+                },
+                async_http as u64,
+            );
+
             if result.is_success() {
                 (*this).err = None;
                 if let Some(metadata) = &result.metadata {
@@ -844,6 +853,9 @@ pub unsafe fn start_async_http(task: *mut Task) {
 impl<'a> AsyncHTTP<'a> {
     pub fn on_start(&mut self) {
         let _ = ACTIVE_REQUESTS_COUNT.fetch_add(1, Ordering::Relaxed);
+        // The pointer doubles as a correlation id pairing this line with the
+        // matching "http done"/"http failed" event in a crash dump.
+        bun_crash_handler::flight_recorder::record("http start", self.as_erased_ptr() as u64);
         self.err = None;
         self.client.result_callback = HTTPClientResultCallback::new::<AsyncHTTP<'static>>(
             self.as_erased_ptr(),
@@ -20,6 +20,29 @@ bun_core::declare_scope!(HTTPContext, hidden);
 const POOL_SIZE: usize = 64;
 const MAX_KEEPALIVE_HOSTNAME: usize = 128;
 
+/// Connection-reuse telemetry, summed across the plain and TLS contexts.
+/// "Reused" counts requests served without a fresh dial: a pooled keep-alive
+/// socket, an active h2 session with headroom, or coalescing onto an in-flight
+/// h2 connect. Written on the HTTP thread, read from the JS thread via
+/// `bun:internal-for-testing`'s `httpAgentStats()` — hence atomics; Relaxed
+/// suffices for monotonic counters.
+pub static FRESH_CONNECTIONS: core::sync::atomic::AtomicU64 = core::sync::atomic::AtomicU64::new(0);
+pub static REUSED_CONNECTIONS: core::sync::atomic::AtomicU64 =
+    core::sync::atomic::AtomicU64::new(0);
+
+#[inline]
+fn count_reuse() {
+    REUSED_CONNECTIONS.fetch_add(1, core::sync::atomic::Ordering::Relaxed);
+}
+
+/// Pool idle timeout in uws minutes, clamped to the `c_uint` uws takes.
+/// 0 disables pooling entirely (see [`HTTPContext::release_socket`]).
+#[inline]
+fn keepalive_idle_minutes() -> core::ffi::c_uint {
+    bun_core::env_var::BUN_CONFIG_HTTP_KEEPALIVE_IDLE_MINUTES::get()
+        .min(u64::from(core::ffi::c_uint::MAX)) as core::ffi::c_uint
+}
+
 /// The const-generic `SSL` is load-bearing for monomorphization (gates hot
 /// inner-loop branches); do not demote to a runtime bool.
 #[derive(bun_ptr::CellRefCounted)]
@@ -582,7 +605,9 @@ impl<const SSL: bool> HTTPContext<SSL> {
         debug_assert!(!hostname.is_empty());
         debug_assert!(port > 0);
 
-        if hostname.len() <= MAX_KEEPALIVE_HOSTNAME
+        let idle_minutes = keepalive_idle_minutes();
+        if idle_minutes > 0
+            && hostname.len() <= MAX_KEEPALIVE_HOSTNAME
             && !(socket.is_closed() || socket.is_shutdown() || socket.get_error() != 0)
             && socket.is_established()
         {
@@ -605,7 +630,7 @@ impl<const SSL: bool> HTTPContext<SSL> {
                 );
                 socket.flush();
                 socket.timeout(0);
-                socket.set_timeout_minutes(5);
+                socket.set_timeout_minutes(idle_minutes);
 
                 let had_tunnel = tunnel.is_some();
                 let mut hostname_buf = [0u8; MAX_KEEPALIVE_HOSTNAME];
@@ -884,6 +909,7 @@ impl<const SSL: bool> HTTPContext<SSL> {
                             || s.established_with_reject_unauthorized)
                     {
                         s.adopt(client);
+                        count_reuse();
                         return Ok(None);
                     }
                 }
@@ -899,6 +925,7 @@ impl<const SSL: bool> HTTPContext<SSL> {
                         // client outlives the pending connect (resolved before
                         // its terminal callback fires).
                         pc.waiters.push(client.as_erased_ptr());
+                        count_reuse();
                         return Ok(None);
                     }
                 }
@@ -946,6 +973,7 @@ impl<const SSL: bool> HTTPContext<SSL> {
                     AlpnOffer::H1
                 },
             ) {
+                count_reuse();
                 let sock = found.socket;
                 Self::set_socket_ext(
                     sock,
@@ -1017,6 +1045,7 @@ impl<const SSL: bool> HTTPContext<SSL> {
             .ptr(),
             false,
         )?;
+        FRESH_CONNECTIONS.fetch_add(1, core::sync::atomic::Ordering::Relaxed);
         client.allow_retry = false;
         if SSL {
             if client.can_offer_h2() {
@@ -1189,7 +1218,7 @@ impl<const SSL: bool> Handler<SSL> {
             if active.is::<PooledSocket<SSL>>() {
                 // Allow pooled sockets to be reused if the handshake was successful.
                 socket.set_timeout(0);
-                socket.set_timeout_minutes(5);
+                socket.set_timeout_minutes(keepalive_idle_minutes());
                 return;
             }
         }
@@ -952,6 +952,15 @@ impl HttpThread {
         if cfg!(debug_assertions) && count > 0 {
             bun_core::scoped_log!(HTTPThread_log, "Processed {} tasks\n", count);
         }
+
+        if !self.deferred_tasks.is_empty() {
+            bun_core::scoped_log!(
+                HTTPThread_log,
+                "{} tasks queued behind max_simultaneous_requests ({} active)\n",
+                self.deferred_tasks.len(),
+                active,
+            );
+        }
     }
 
     pub fn schedule_receive_resume(&mut self, async_http_id: u32) {
@@ -188,6 +188,11 @@ pub struct Flags {
     /// Set by `fetch(url, { protocol: "http2" })`: ALPN advertises only h2
     /// and the request fails if the server selects anything else.
     pub force_http2: bool,
+    /// Per-request opt-in to offering h2 in ALPN (falling back to HTTP/1.1 if
+    /// the server declines), independent of the process-wide experimental
+    /// fetch() flags. Set by `bun install` for registry requests when
+    /// `BUN_FEATURE_FLAG_EXPERIMENTAL_HTTP2_INSTALL` is enabled.
+    pub allow_http2: bool,
     /// Set by `fetch(url, { protocol: "http1.1" })`: opt out of h2 even when
     /// the experimental env flag would otherwise advertise it.
     pub force_http1: bool,
@@ -217,6 +222,7 @@ impl Default for Flags {
             upgrade_state: HTTPUpgradeState::None,
             protocol: Protocol::Http1_1,
             force_http2: false,
+            allow_http2: false,
             force_http1: false,
             force_http3: false,
             h3_retried: false,
@@ -1848,8 +1854,9 @@ impl<'a> HTTPClient<'a> {
     /// Whether to advertise "h2" in the TLS ALPN list. Restricted to request
     /// shapes the HTTP/2 path currently handles end-to-end (no proxy/Upgrade,
     /// no sendfile). Enabled by `--experimental-http2-fetch`, the
-    /// `BUN_FEATURE_FLAG_EXPERIMENTAL_HTTP2_CLIENT` env var, or
-    /// `protocol: "http2"` on the fetch options.
+    /// `BUN_FEATURE_FLAG_EXPERIMENTAL_HTTP2_CLIENT` env var,
+    /// `protocol: "http2"` on the fetch options, or per-request via
+    /// `flags.allow_http2`.
     pub fn can_offer_h2(&self) -> bool {
         // The h2 session transmits from `attach()` without consulting the
         // `is_waiting_for_cert_check` park gate, so requests with a JS
@@ -1876,6 +1883,7 @@ impl<'a> HTTPClient<'a> {
             return false;
         }
         self.flags.force_http2
+            || self.flags.allow_http2
             || EXPERIMENTAL_HTTP2_CLIENT_FROM_CLI.load(Ordering::Relaxed)
             || bun_core::env_var::feature_flag::BUN_FEATURE_FLAG_EXPERIMENTAL_HTTP2_CLIENT
                 .get()
@@ -36,6 +36,8 @@ pub struct SSLConfig {
 
     pub secure_options: u32,
     pub session_timeout: i32,
+    /// Server-side session-ID cache capacity (entries); 0 = cache disabled.
+    pub session_cache_size: u32,
     pub allow_partial_trust_chain: bool,
     pub sigalgs: CStrPtr,
     /// Minimum/maximum TLS protocol version (TLS1_VERSION..TLS1_3_VERSION); 0 = unset/default.
@@ -112,6 +114,7 @@ impl SSLConfig {
         crl: None,
         secure_options: 0,
         session_timeout: 0,
+        session_cache_size: 0,
         allow_partial_trust_chain: false,
         sigalgs: core::ptr::null(),
         ssl_min_version: 0,
@@ -219,6 +222,7 @@ impl SSLConfig {
         ctx_opts.client_renegotiation_limit = self.client_renegotiation_limit;
         ctx_opts.client_renegotiation_window = self.client_renegotiation_window;
         ctx_opts.session_timeout = self.session_timeout;
+        ctx_opts.session_cache_size = self.session_cache_size;
         ctx_opts.allow_partial_trust_chain = i32::from(self.allow_partial_trust_chain);
         if !self.sigalgs.is_null() {
             ctx_opts.sigalgs = self.sigalgs;
@@ -295,6 +299,9 @@ impl SSLConfig {
         if self.session_timeout != other.session_timeout {
             return false;
         }
+        if self.session_cache_size != other.session_cache_size {
+            return false;
+        }
         if self.allow_partial_trust_chain != other.allow_partial_trust_chain {
             return false;
         }
@@ -371,6 +378,7 @@ impl SSLConfig {
         hash_slice!(crl);
         hasher.update(&self.secure_options.to_ne_bytes());
         hasher.update(&self.session_timeout.to_ne_bytes());
+        hasher.update(&self.session_cache_size.to_ne_bytes());
         hasher.update(&[self.allow_partial_trust_chain as u8]);
         hash_cstr!(sigalgs);
         hasher.update(&self.ssl_min_version.to_ne_bytes());
@@ -468,6 +476,7 @@ impl Clone for SSLConfig {
             crl: clone_strings(&self.crl),
             secure_options: self.secure_options,
             session_timeout: self.session_timeout,
+            session_cache_size: self.session_cache_size,
             allow_partial_trust_chain: self.allow_partial_trust_chain,
             sigalgs: clone_string(self.sigalgs),
             ssl_min_version: self.ssl_min_version,
@@ -31,9 +31,107 @@ impl Params {
     pub const MIN_WINDOW_BITS: u8 = 8;
 }
 
+/// Thread-local pools of raw-DEFLATE zlib streams shared across WebSocket
+/// connections. The sliding window plus deflate state dominates per-connection
+/// memory (~300KB per compressing connection at 15 window bits); checking
+/// streams out lazily — and returning them after every message when the
+/// negotiated params reset the context anyway — makes that memory scale with
+/// concurrently-(de)compressing sockets instead of total connections.
+///
+/// Only default-window streams are pooled: the window size is fixed at
+/// `deflateInit2`/`inflateInit2` time, and non-default negotiated windows are
+/// rare enough that a fresh stream per checkout is fine.
+mod stream_pool {
+    use core::cell::RefCell;
+    use core::ffi::c_int;
+
+    use super::{libdeflate_sys, zlib, Params};
+
+    /// Enough for a burst of concurrently-active streams on one loop
+    /// iteration; beyond this, returned streams are dropped and freed.
+    const POOL_CAP: usize = 16;
+
+    thread_local! {
+        static ENCODERS: RefCell<Vec<zlib::DeflateEncoder>> = const { RefCell::new(Vec::new()) };
+        static DECODERS: RefCell<Vec<zlib::InflateDecoder>> = const { RefCell::new(Vec::new()) };
+        /// libdeflate decompressors carry no state between calls, so one
+        /// thread-local instance serves every connection on this loop.
+        static LIBDEFLATE_DECOMPRESSOR: RefCell<Option<libdeflate_sys::OwnedDecompressor>> =
+            const { RefCell::new(None) };
+    }
+
+    fn poolable(window_bits: u8) -> bool {
+        window_bits == Params::MAX_WINDOW_BITS
+    }
+
+    pub(super) fn checkout_encoder(
+        window_bits: u8,
+    ) -> Result<zlib::DeflateEncoder, zlib::ZlibError> {
+        if poolable(window_bits) {
+            if let Some(encoder) = ENCODERS.with(|p| p.borrow_mut().pop()) {
+                return Ok(encoder);
+            }
+        }
+        zlib::DeflateEncoder::new(
+            super::Z_DEFAULT_COMPRESSION,
+            // Negative window bits select raw DEFLATE, as required by RFC 7692.
+            -(window_bits as c_int),
+            super::Z_DEFAULT_MEM_LEVEL,
+            super::Z_DEFAULT_STRATEGY,
+        )
+    }
+
+    /// `encoder` must already be reset; pooled streams start fresh.
+    pub(super) fn recycle_encoder(encoder: zlib::DeflateEncoder, window_bits: u8) {
+        if poolable(window_bits) {
+            ENCODERS.with(|p| {
+                let mut p = p.borrow_mut();
+                if p.len() < POOL_CAP {
+                    p.push(encoder);
+                }
+                // else: drop — the allocator frees it.
+            });
+        }
+    }
+
+    pub(super) fn checkout_decoder(
+        window_bits: u8,
+    ) -> Result<zlib::InflateDecoder, zlib::ZlibError> {
+        if poolable(window_bits) {
+            if let Some(decoder) = DECODERS.with(|p| p.borrow_mut().pop()) {
+                return Ok(decoder);
+            }
+        }
+        zlib::InflateDecoder::new(-(window_bits as c_int))
+    }
+
+    /// `decoder` must already be reset; pooled streams start fresh.
+    pub(super) fn recycle_decoder(decoder: zlib::InflateDecoder, window_bits: u8) {
+        if poolable(window_bits) {
+            DECODERS.with(|p| {
+                let mut p = p.borrow_mut();
+                if p.len() < POOL_CAP {
+                    p.push(decoder);
+                }
+            });
+        }
+    }
+
+    pub(super) fn with_libdeflate_decompressor<R>(
+        f: impl FnOnce(&mut libdeflate_sys::Decompressor) -> R,
+    ) -> Option<R> {
+        LIBDEFLATE_DECOMPRESSOR.with(|slot| {
+            let mut slot = slot.borrow_mut();
+            if slot.is_none() {
+                *slot = libdeflate_sys::OwnedDecompressor::new();
+            }
+            slot.as_deref_mut().map(f)
+        })
+    }
+}
+
 #[derive(Default)]
 pub struct RareData {
-    libdeflate_decompressor: Option<libdeflate_sys::OwnedDecompressor>,
     // PERF: a 128KB inline buffer reused as scratch for (de)compression
     // output could avoid per-call allocation — profile if hot.
 }
@@ -45,13 +143,6 @@ impl RareData {
         // PERF: allocates a fresh heap Vec per call — profile if hot.
         Vec::with_capacity(Self::STACK_BUFFER_SIZE)
     }
-
-    pub fn decompressor(&mut self) -> Option<&mut libdeflate_sys::Decompressor> {
-        if self.libdeflate_decompressor.is_none() {
-            self.libdeflate_decompressor = libdeflate_sys::OwnedDecompressor::new();
-        }
-        self.libdeflate_decompressor.as_deref_mut()
-    }
 }
 
 /// Parent module references this type as `WebSocketDeflate`.
@@ -61,14 +152,16 @@ pub type WebSocketDeflate = PerMessageDeflate;
 pub type Error = DecompressError;
 
 pub struct PerMessageDeflate {
-    pub compress_stream: zlib::DeflateEncoder,
-    pub decompress_stream: zlib::InflateDecoder,
+    /// `None` until the first compressed message, and again between messages
+    /// when `client_no_context_takeover` lets the stream be returned to
+    /// [`stream_pool`]. With context takeover (the default) the stream stays
+    /// checked out for the life of the connection — the sliding window must
+    /// persist across messages.
+    compress_stream: Option<zlib::DeflateEncoder>,
+    /// Same lifecycle as `compress_stream`, gated on
+    /// `server_no_context_takeover`.
+    decompress_stream: Option<zlib::InflateDecoder>,
     pub params: Params,
-    // VM `bun_jsc::RareData` would be the natural owner (pooled libdeflate
-    // handles, shared across connections), but the concrete type is *this*
-    // `RareData`, which `bun_jsc` cannot name without a dep cycle, so each
-    // connection owns a fresh instance instead: a per-connection libdeflate
-    // allocation, not a correctness divergence.
     pub rare_data: RareData,
 }
 
@@ -106,26 +199,13 @@ pub enum CompressError {
 
 impl PerMessageDeflate {
     pub(crate) fn init(params: Params) -> crate::Result<Box<Self>> {
-        // Initialize compressor (deflate)
-        // We use negative window bits for raw DEFLATE, as required by RFC 7692.
-        let compress_stream = zlib::DeflateEncoder::new(
-            Z_DEFAULT_COMPRESSION,
-            -(params.client_max_window_bits as c_int),
-            Z_DEFAULT_MEM_LEVEL,
-            Z_DEFAULT_STRATEGY,
-        )
-        .map_err(|_| crate::Error::DeflateInitFailed)?;
-
-        // Initialize decompressor (inflate)
-        let decompress_stream =
-            zlib::InflateDecoder::new(-(params.server_max_window_bits as c_int))
-                .map_err(|_| crate::Error::InflateInitFailed)?;
-
+        // Streams are checked out of the pool on first use, so a connection
+        // that negotiated permessage-deflate but never exchanges a compressed
+        // message holds no zlib state at all.
         Ok(Box::new(Self {
             params,
-            compress_stream,
-            decompress_stream,
-            // Fresh per-connection instance; see the `rare_data` field note.
+            compress_stream: None,
+            decompress_stream: None,
             rare_data: RareData::default(),
         }))
     }
@@ -147,15 +227,16 @@ impl PerMessageDeflate {
 
         // First we try with libdeflate, which is both faster and doesn't need the trailing deflate bytes
         if Self::can_use_libdeflate(in_buf.len()) {
-            if let Some(decompressor) = self.rare_data.decompressor() {
+            let ok = stream_pool::with_libdeflate_decompressor(|decompressor| {
                 let result =
                     decompressor.decompress_to_vec(in_buf, out, libdeflate_sys::Encoding::Deflate);
-                if result.status == libdeflate_sys::Status::Success {
-                    if out.len() - initial_len > MAX_DECOMPRESSED_SIZE {
-                        return Err(DecompressError::TooLarge);
-                    }
-                    return Ok(());
+                result.status == libdeflate_sys::Status::Success
+            });
+            if ok == Some(true) {
+                if out.len() - initial_len > MAX_DECOMPRESSED_SIZE {
+                    return Err(DecompressError::TooLarge);
                 }
+                return Ok(());
             }
         }
 
@@ -163,10 +244,16 @@ impl PerMessageDeflate {
         in_with_trailer.extend_from_slice(in_buf);
         in_with_trailer.extend_from_slice(&DEFLATE_TRAILER);
 
+        let mut stream = match self.decompress_stream.take() {
+            Some(stream) => stream,
+            None => stream_pool::checkout_decoder(self.params.server_max_window_bits)
+                .map_err(|_| DecompressError::OutOfMemory)?,
+        };
+
         let mut remaining = in_with_trailer.as_slice();
         let mut saw_stream_end = false;
         loop {
-            let (consumed, rc) = self.decompress_stream.step(
+            let (consumed, rc) = stream.step(
                 remaining,
                 out,
                 COMPRESSION_BUFFER_SIZE,
@@ -176,6 +263,8 @@ impl PerMessageDeflate {
 
             // Check for decompression bomb
             if out.len() - initial_len > MAX_DECOMPRESSED_SIZE {
+                // A failed stream must not be reused or pooled; drop it and
+                // the next message checks out a fresh one.
                 return Err(DecompressError::TooLarge);
             }
 
@@ -186,7 +275,7 @@ impl PerMessageDeflate {
             if rc != zlib::ReturnCode::Ok {
                 return Err(DecompressError::InflateFailed);
             }
-            if self.decompress_stream.avail_out() == 0 && !remaining.is_empty() {
+            if stream.avail_out() == 0 && !remaining.is_empty() {
                 // Need more output buffer space, continue loop
                 continue;
             }
@@ -201,7 +290,15 @@ impl PerMessageDeflate {
         // finished inflater returns Z_STREAM_END with 0 bytes on every later
         // message, silently delivering empty payloads.
         if saw_stream_end || self.params.server_no_context_takeover == 1 {
-            self.decompress_stream.reset();
+            stream.reset();
+        }
+
+        if self.params.server_no_context_takeover == 1 {
+            // The context is discarded after every message anyway, so release
+            // the sliding window instead of holding it while idle.
+            stream_pool::recycle_decoder(stream, self.params.server_max_window_bits);
+        } else {
+            self.decompress_stream = Some(stream);
         }
 
         Ok(())
@@ -212,9 +309,15 @@ impl PerMessageDeflate {
         in_buf: &[u8],
         out: &mut Vec<u8>,
     ) -> Result<(), CompressError> {
+        let mut stream = match self.compress_stream.take() {
+            Some(stream) => stream,
+            None => stream_pool::checkout_encoder(self.params.client_max_window_bits)
+                .map_err(|_| CompressError::OutOfMemory)?,
+        };
+
         let mut remaining = in_buf;
         loop {
-            let (consumed, rc) = self.compress_stream.step(
+            let (consumed, rc) = stream.step(
                 remaining,
                 out,
                 COMPRESSION_BUFFER_SIZE,
@@ -222,11 +325,13 @@ impl PerMessageDeflate {
             );
             remaining = &remaining[consumed..];
             if rc != zlib::ReturnCode::Ok {
+                // Drop the failed stream; the caller falls back to sending
+                // uncompressed and a later message checks out a fresh one.
                 return Err(CompressError::DeflateFailed);
             }
 
             // exit only when zlib is truly finished
-            if remaining.is_empty() && self.compress_stream.avail_out() != 0 {
+            if remaining.is_empty() && stream.avail_out() != 0 {
                 break;
             }
         }
@@ -237,9 +342,29 @@ impl PerMessageDeflate {
         }
 
         if self.params.client_no_context_takeover == 1 {
-            self.compress_stream.reset();
+            stream.reset();
+            stream_pool::recycle_encoder(stream, self.params.client_max_window_bits);
+        } else {
+            self.compress_stream = Some(stream);
         }
 
         Ok(())
     }
 }
+
+impl Drop for PerMessageDeflate {
+    fn drop(&mut self) {
+        // Context-takeover streams are still checked out at teardown; reset
+        // them back to a fresh state and return them for the next connection.
+        if let Some(mut encoder) = self.compress_stream.take() {
+            if encoder.reset() == zlib::ReturnCode::Ok {
+                stream_pool::recycle_encoder(encoder, self.params.client_max_window_bits);
+            }
+        }
+        if let Some(mut decoder) = self.decompress_stream.take() {
+            if decoder.reset() == zlib::ReturnCode::Ok {
+                stream_pool::recycle_decoder(decoder, self.params.server_max_window_bits);
+            }
+        }
+    }
+}
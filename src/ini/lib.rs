@@ -809,7 +809,10 @@ mod draft {
                     Usage::Key => {
                         let thestr: &[u8] = 'thestr: {
                             if !did_any_escape {
-                                break 'thestr bump.alloc_slice_copy(val);
+                                // `val` is a subslice of the `&'a` source, same
+                                // as the Value arm and the quoted fallthrough
+                                // below — no need to copy into the arena.
+                                break 'thestr val;
                             }
                             if unesc.len() <= STACK_BUF_SIZE {
                                 break 'thestr bump.alloc_slice_copy(&unesc);
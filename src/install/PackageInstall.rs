@@ -2395,6 +2395,10 @@ impl<'a> PackageInstall<'a> {
         resolution_tag: resolution::Tag,
     ) -> InstallResult {
         let _tracer = bun_core::perf::trace("PackageInstaller.install");
+        let _profile = crate::install_profile::span(
+            crate::install_profile::Phase::Link,
+            self.package_name.slice(&self.lockfile.buffers.string_bytes),
+        );
 
         // If this fails, we don't care.
         // we'll catch it the next error
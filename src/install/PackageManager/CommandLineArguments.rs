@@ -82,6 +82,9 @@ const SHARED_PARAMS: &[ParamType] = &[
     clap::param!("--verbose                             Excessively verbose logging"),
     clap::param!("--no-progress                         Disable the progress bar"),
     clap::param!("--no-summary                          Don't print a summary"),
+    clap::param!(
+        "--profile                             Save a Chrome-trace JSON of install phases to bun-install-profile.json"
+    ),
     clap::param!(
         "--no-verify                           Skip verifying integrity of newly downloaded packages"
     ),
@@ -384,6 +387,7 @@ pub struct CommandLineArguments {
     pub ignore_scripts: bool,
     pub trusted: bool,
     pub no_summary: bool,
+    pub profile: bool,
     pub latest: bool,
     pub interactive: bool,
     pub json_output: bool,
@@ -471,6 +475,7 @@ impl Default for CommandLineArguments {
             ignore_scripts: false,
             trusted: false,
             no_summary: false,
+            profile: false,
             latest: false,
             interactive: false,
             json_output: false,
@@ -1047,6 +1052,7 @@ Full documentation is available at <magenta>https://bun.com/docs/cli/pm#scan<r>.
         cli.ignore_scripts = args.flag(b"--ignore-scripts");
         cli.trusted = args.flag(b"--trust");
         cli.no_summary = args.flag(b"--no-summary");
+        cli.profile = args.flag(b"--profile");
         cli.ca = args.options(b"--ca");
         cli.lockfile_only = args.flag(b"--lockfile-only");
 
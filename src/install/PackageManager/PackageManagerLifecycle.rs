@@ -42,6 +42,10 @@ pub struct LifecycleScriptTimeLogEntry {
     pub script_id: u8,
     /// nanosecond duration
     pub duration: u64,
+    /// user+system CPU nanoseconds from the child's `Rusage`; 0 when the
+    /// platform reported none. Wall >> CPU means the script waited (network,
+    /// subprocess spawn storms), not computed.
+    pub cpu_time: u64,
 }
 
 impl LifecycleScriptTimeLog {
@@ -50,6 +54,32 @@ impl LifecycleScriptTimeLog {
         self.list.push(entry);
         self.mutex.unlock();
     }
+
+    /// Verbose-mode install summary: one line per slow script (anything over
+    /// `MIN_MILLISECONDS_TO_LOG`), slowest first, with wall and CPU time.
+    pub fn print_and_clear(&mut self) {
+        self.mutex.lock();
+        let mut list = core::mem::take(&mut self.list);
+        self.mutex.unlock();
+        if list.is_empty() {
+            return;
+        }
+        list.sort_unstable_by(|a, b| b.duration.cmp(&a.duration));
+        for entry in &list {
+            let script_name = crate::lockfile_real::Scripts::NAMES
+                .get(entry.script_id as usize)
+                .copied()
+                .unwrap_or("?");
+            bun_core::pretty_errorln!(
+                "<d>[Scripts]<r> <b>{}<r> {} took {} <d>({} CPU)<r>",
+                BStr::new(&entry.package_name),
+                script_name,
+                bun_fmt::fmt_duration_one_decimal(entry.duration),
+                bun_fmt::fmt_duration_one_decimal(entry.cpu_time),
+            );
+        }
+        Output::flush();
+    }
 }
 
 impl PackageManager {
@@ -700,6 +700,10 @@ impl Options {
                 self.do_.set(Do::SUMMARY, false);
             }
 
+            if cli.profile {
+                crate::install_profile::enable();
+            }
+
             self.filter_patterns = cli.filters;
             self.pack_destination = cli.pack_destination;
             self.pack_filename = cli.pack_filename;
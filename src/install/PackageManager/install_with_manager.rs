@@ -504,6 +504,9 @@ pub fn install_with_manager(
                     }
 
                     if manager.summary.catalogs_changed {
+                        // `enqueue_dependency_with_main` needs `&mut manager`,
+                        // so snapshot the changed-entry hashes up front.
+                        let changed_catalog_deps = manager.summary.changed_catalog_deps.clone();
                         let dependencies_len = manager.lockfile.buffers.dependencies.len();
                         for _dep_id in 0..dependencies_len {
                             let dep_id: DependencyID = u32::try_from(_dep_id).expect("int cast");
@@ -513,6 +516,16 @@ pub fn install_with_manager(
                                 continue;
                             }
 
+                            // Per-entry dirty set: a non-empty list pins the
+                            // invalidation to dependencies referencing a
+                            // changed catalog entry; everything else keeps its
+                            // existing resolution.
+                            if !changed_catalog_deps.is_empty()
+                                && !changed_catalog_deps.contains(&dep.name_hash)
+                            {
+                                continue;
+                            }
+
                             manager.lockfile.buffers.resolutions[dep_id as usize] =
                                 invalid_package_id;
                             if let Err(err) = enqueue_dependency_with_main(
@@ -893,6 +906,8 @@ pub fn install_with_manager(
         manager.any_failed_to_install = true;
     }
 
+    crate::install_profile::write_if_enabled();
+
     Output::flush();
     Ok(())
 }
@@ -1030,6 +1045,10 @@ fn print_install_summary(
 ) -> crate::Result<()> {
     let _flush_guard = Output::flush_guard();
 
+    if log_level.is_verbose() {
+        this.lifecycle_script_time_log.print_and_clear();
+    }
+
     let mut printed_timestamp = false;
     if this.options.do_.summary() {
         print_summary_tree(this, install_summary, log_level)?;
@@ -527,6 +527,18 @@ pub fn run_tasks<C: RunTasksCallbacks>(
                     Output::flush();
                 }
 
+                if crate::install_profile::is_enabled() {
+                    // SAFETY: `unsafe_http_client` was initialized by
+                    // `for_manifest` before `schedule()` (same as the verbose
+                    // branch above).
+                    let elapsed = unsafe { task.unsafe_http_client.assume_init_ref() }.elapsed;
+                    crate::install_profile::fetch_complete(
+                        name,
+                        elapsed,
+                        task.response_buffer.list.len() as u64,
+                    );
+                }
+
                 if response.status_code == 304 {
                     // The HTTP request was cached
                     if let Some(mut manifest) = loaded_manifest.take() {
@@ -881,6 +893,18 @@ pub fn run_tasks<C: RunTasksCallbacks>(
                     Output::flush();
                 }
 
+                if crate::install_profile::is_enabled() {
+                    // SAFETY: `unsafe_http_client` was initialized by
+                    // `for_tarball` before `schedule()` (same as the verbose
+                    // branch above).
+                    let elapsed = unsafe { task.unsafe_http_client.assume_init_ref() }.elapsed;
+                    crate::install_profile::fetch_complete(
+                        extract.name.slice(),
+                        elapsed,
+                        task.response_buffer.list.len() as u64,
+                    );
+                }
+
                 if log_level.show_progress() {
                     if !has_updated_this_run.get() {
                         manager.set_node_name::<true>(
@@ -235,6 +235,8 @@ impl ExtractTarball {
         // wide at the `open_dir_at_windows_a` boundary, not here.
         let mut tmpname_buf = PathBuffer::uninit();
         let (name, basename) = self.name_and_basename();
+        let _profile =
+            bun_install::install_profile::span(bun_install::install_profile::Phase::Extract, name);
         let truncated_basename = &basename[0..basename.len().min(32)];
         let tmpname_suffix: &[u8] =
             if bun_install::dependency::is_safe_install_folder_name(truncated_basename) {
@@ -297,20 +299,29 @@ impl ExtractTarball {
             {
                 // Last 4 bytes of a gzip-compressed file are the uncompressed size.
                 if tgz_bytes.len() > 16 {
-                    // If the file claims to be larger than 16 bytes and smaller than 64 MB, we'll preallocate the buffer.
-                    // If it's larger than that, we'll do it incrementally. We want to avoid OOMing.
                     let last_4_bytes: u32 = u32::from_ne_bytes(
                         tgz_bytes[tgz_bytes.len() - 4..][..4]
                             .try_into()
                             .expect("infallible: size matches"),
                     );
-                    if last_4_bytes > 16 && last_4_bytes < 64 * 1024 * 1024 {
+                    let claimed = last_4_bytes as usize;
+                    // ISIZE comes from the tarball, so a lying value could make
+                    // us preallocate gigabytes across every extract worker at
+                    // once. Trust it outright up to 64 MB; past that, only when
+                    // it is a plausible deflate ratio for the compressed size
+                    // (real tarballs stay well under 64x). Anything implausible
+                    // streams through zlib below, which allocates incrementally
+                    // and enforces MAX_DECOMPRESSED_TARBALL_SIZE.
+                    let plausible = claimed < 64 * 1024 * 1024
+                        || (claimed < MAX_DECOMPRESSED_TARBALL_SIZE
+                            && claimed / 64 <= tgz_bytes.len());
+                    if claimed > 16 && plausible {
                         // It's okay if this fails. We will just allocate as we go and that will error if we run out of memory.
-                        esimated_output_size = last_4_bytes as usize;
+                        esimated_output_size = claimed;
                         if zlib_pool.list.capacity() == 0 {
-                            let _ = zlib_pool.list.try_reserve_exact(last_4_bytes as usize);
+                            let _ = zlib_pool.list.try_reserve_exact(claimed);
                         } else {
-                            let _ = zlib_pool.ensure_unused_capacity(last_4_bytes as usize);
+                            let _ = zlib_pool.ensure_unused_capacity(claimed);
                         }
                     }
                 }
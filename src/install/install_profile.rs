@@ -0,0 +1,239 @@
+//! `bun install --profile` — phase-level install timing, written as Chrome
+//! trace JSON (`bun-install-profile.json`, loadable in `chrome://tracing` or
+//! https://ui.perfetto.dev). Spans are recorded per package for the resolve,
+//! fetch, extract, link, and scripts phases, plus whole-install counters
+//! (bytes downloaded, manifest cache hits/misses) in the trace's `otherData`.
+//!
+//! Mirrors the `bun_core::perf` shape (Relaxed-load fast path, `Span` guard
+//! with `Drop`) but collects into a process-global list instead of emitting to
+//! a system profiler, since ftrace/os_signpost output cannot carry the
+//! per-package args a trace viewer needs. Everything here is a no-op unless
+//! `--profile` was passed.
+
+use core::sync::atomic::{AtomicBool, AtomicU64, Ordering};
+
+use bun_core::Mutex;
+
+#[derive(Clone, Copy)]
+pub enum Phase {
+    Resolve,
+    Fetch,
+    Extract,
+    Link,
+    Scripts,
+}
+
+impl Phase {
+    fn as_str(self) -> &'static str {
+        match self {
+            Phase::Resolve => "resolve",
+            Phase::Fetch => "fetch",
+            Phase::Extract => "extract",
+            Phase::Link => "link",
+            Phase::Scripts => "scripts",
+        }
+    }
+}
+
+struct Event {
+    phase: Phase,
+    /// Package name; owned because most producers run on pool threads whose
+    /// name buffers do not outlive the task.
+    name: Box<[u8]>,
+    start_ns: u64,
+    duration_ns: u64,
+    tid: u64,
+    /// Bytes downloaded, fetch events only.
+    bytes: u64,
+}
+
+static IS_ENABLED: AtomicBool = AtomicBool::new(false);
+/// Timestamp origin, set once by `enable()` so event `ts` values start near 0.
+static EPOCH_NS: AtomicU64 = AtomicU64::new(0);
+static EVENTS: Mutex<Vec<Event>> = Mutex::new(Vec::new());
+static BYTES_DOWNLOADED: AtomicU64 = AtomicU64::new(0);
+static MANIFEST_CACHE_HITS: AtomicU64 = AtomicU64::new(0);
+static MANIFEST_CACHE_MISSES: AtomicU64 = AtomicU64::new(0);
+
+pub fn enable() {
+    EPOCH_NS.store(now_ns(), Ordering::Relaxed);
+    IS_ENABLED.store(true, Ordering::Relaxed);
+}
+
+#[inline]
+pub fn is_enabled() -> bool {
+    IS_ENABLED.load(Ordering::Relaxed)
+}
+
+#[inline]
+fn now_ns() -> u64 {
+    bun_core::Timespec::now(bun_core::TimespecMockMode::AllowMockedTime).ns()
+}
+
+/// Scope guard for a phase span; records on drop. No allocation when
+/// profiling is disabled.
+#[must_use = "bind to a local (`let _p = install_profile::span(..)`) so the span has nonzero duration"]
+pub struct Span {
+    inner: Option<(Phase, Box<[u8]>, u64)>,
+}
+
+impl Drop for Span {
+    fn drop(&mut self) {
+        if let Some((phase, name, start_ns)) = self.inner.take() {
+            push(Event {
+                phase,
+                name,
+                start_ns,
+                duration_ns: now_ns().saturating_sub(start_ns),
+                tid: bun_core::thread_id::current() as u64,
+                bytes: 0,
+            });
+        }
+    }
+}
+
+pub fn span(phase: Phase, name: &[u8]) -> Span {
+    if !is_enabled() {
+        return Span { inner: None };
+    }
+    Span {
+        inner: Some((phase, Box::from(name), now_ns())),
+    }
+}
+
+/// Record a span whose timing was measured externally (e.g. lifecycle scripts,
+/// which already track `started_at`). `start_ns` is on the
+/// `Timespec::now(AllowMockedTime)` clock.
+pub fn complete(phase: Phase, name: &[u8], start_ns: u64, duration_ns: u64) {
+    if !is_enabled() {
+        return;
+    }
+    push(Event {
+        phase,
+        name: Box::from(name),
+        start_ns,
+        duration_ns,
+        tid: bun_core::thread_id::current() as u64,
+        bytes: 0,
+    });
+}
+
+/// Record a completed network download. `elapsed_ns` is the HTTP client's
+/// request duration; the span is back-dated by it so fetches appear in
+/// timeline order.
+pub fn fetch_complete(name: &[u8], elapsed_ns: u64, bytes: u64) {
+    if !is_enabled() {
+        return;
+    }
+    BYTES_DOWNLOADED.fetch_add(bytes, Ordering::Relaxed);
+    push(Event {
+        phase: Phase::Fetch,
+        name: Box::from(name),
+        start_ns: now_ns().saturating_sub(elapsed_ns),
+        duration_ns: elapsed_ns,
+        tid: bun_core::thread_id::current() as u64,
+        bytes,
+    });
+}
+
+pub fn record_manifest_cache_hit() {
+    if is_enabled() {
+        MANIFEST_CACHE_HITS.fetch_add(1, Ordering::Relaxed);
+    }
+}
+
+pub fn record_manifest_cache_miss() {
+    if is_enabled() {
+        MANIFEST_CACHE_MISSES.fetch_add(1, Ordering::Relaxed);
+    }
+}
+
+fn push(event: Event) {
+    EVENTS.lock().push(event);
+}
+
+/// JSON string-escape a package name into `out`. npm names are already
+/// URL-safe, but scoped git/tarball specifiers can carry arbitrary bytes.
+fn append_json_escaped(out: &mut Vec<u8>, bytes: &[u8]) {
+    for &b in bytes {
+        match b {
+            b'"' => out.extend_from_slice(b"\\\""),
+            b'\\' => out.extend_from_slice(b"\\\\"),
+            0..=0x1f => {
+                let _ = std::io::Write::write_fmt(out, format_args!("\\u{:04x}", b));
+            }
+            _ => out.push(b),
+        }
+    }
+}
+
+pub const PROFILE_FILE_NAME: &[u8] = b"bun-install-profile.json";
+
+/// Serialize the collected events and write `bun-install-profile.json` into
+/// the current directory. Called once at the end of the install.
+pub fn write_if_enabled() {
+    if !is_enabled() {
+        return;
+    }
+    let events = core::mem::take(&mut *EVENTS.lock());
+    let epoch_ns = EPOCH_NS.load(Ordering::Relaxed);
+
+    let mut out: Vec<u8> = Vec::with_capacity(256 + events.len() * 128);
+    out.extend_from_slice(b"{\"traceEvents\":[");
+    for (i, event) in events.iter().enumerate() {
+        if i > 0 {
+            out.push(b',');
+        }
+        out.extend_from_slice(b"{\"name\":\"");
+        append_json_escaped(&mut out, &event.name);
+        let _ = std::io::Write::write_fmt(
+            &mut out,
+            format_args!(
+                "\",\"cat\":\"{}\",\"ph\":\"X\",\"ts\":{},\"dur\":{},\"pid\":1,\"tid\":{}",
+                event.phase.as_str(),
+                event.start_ns.saturating_sub(epoch_ns) / bun_core::time::NS_PER_US,
+                event.duration_ns / bun_core::time::NS_PER_US,
+                event.tid,
+            ),
+        );
+        if event.bytes > 0 {
+            let _ = std::io::Write::write_fmt(
+                &mut out,
+                format_args!(",\"args\":{{\"bytes\":{}}}", event.bytes),
+            );
+        }
+        out.push(b'}');
+    }
+    let _ = std::io::Write::write_fmt(
+        &mut out,
+        format_args!(
+            "],\"otherData\":{{\"bytesDownloaded\":{},\"manifestCacheHits\":{},\"manifestCacheMisses\":{}}}}}",
+            BYTES_DOWNLOADED.load(Ordering::Relaxed),
+            MANIFEST_CACHE_HITS.load(Ordering::Relaxed),
+            MANIFEST_CACHE_MISSES.load(Ordering::Relaxed),
+        ),
+    );
+
+    let result = bun_sys::File::openat(
+        bun_core::Fd::cwd(),
+        PROFILE_FILE_NAME,
+        bun_sys::O::WRONLY | bun_sys::O::CREAT | bun_sys::O::TRUNC,
+        0o644,
+    )
+    .and_then(|file| file.write_all(&out));
+    match result {
+        Ok(_) => {
+            bun_core::pretty_errorln!(
+                "<d>Saved install profile to <r><b>{}<r> <d>({} events)<r>",
+                bstr::BStr::new(PROFILE_FILE_NAME),
+                events.len(),
+            );
+        }
+        Err(err) => {
+            bun_core::pretty_errorln!(
+                "<r><yellow>warn<r>: failed to write install profile: {}",
+                err,
+            );
+        }
+    }
+}
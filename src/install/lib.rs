@@ -113,6 +113,7 @@ pub use lockfile_real::{DEFAULT_TRUSTED_DEPENDENCIES_LIST, default_trusted_depen
 #[path = "bin.rs"]
 pub mod bin_real;
 pub mod hoisted_install;
+pub mod install_profile;
 pub mod isolated_install;
 pub mod lifecycle_script_runner;
 pub mod migration;
@@ -275,6 +275,10 @@ pub struct LifecycleScriptSubprocess<'a> {
     pub shell_bin: Option<&'a ZStr>,
 
     pub timer: Option<Timer>,
+    /// Accumulated user+system CPU nanoseconds across the script chain, from
+    /// the `Rusage` delivered with each process exit. Mirrors the cumulative
+    /// wall `timer` so the time-log entry reports both.
+    pub cpu_time_ns: u64,
 
     pub has_incremented_alive_count: bool,
 
@@ -873,6 +877,17 @@ impl<'a> LifecycleScriptSubprocess<'a> {
             Status::Exited(exit) => {
                 let maybe_duration = self.timer.as_mut().map(|t| t.read());
 
+                if crate::install_profile::is_enabled() {
+                    let now =
+                        bun_core::Timespec::now(bun_core::TimespecMockMode::AllowMockedTime).ns();
+                    crate::install_profile::complete(
+                        crate::install_profile::Phase::Scripts,
+                        &self.package_name,
+                        self.started_at,
+                        now.saturating_sub(self.started_at),
+                    );
+                }
+
                 if exit.code > 0 {
                     if self.optional {
                         if let Some(ctx) = &self.ctx {
@@ -922,6 +937,7 @@ impl<'a> LifecycleScriptSubprocess<'a> {
                             package_name: self.package_name.clone(),
                             script_id: self.current_script_index,
                             duration: nanos,
+                            cpu_time: self.cpu_time_ns,
                         };
                         // SAFETY: see [`Self::manager_mut`].
                         unsafe { self.manager_mut() }
@@ -1060,13 +1076,19 @@ impl<'a> LifecycleScriptSubprocess<'a> {
     }
 
     /// This function may free the *LifecycleScriptSubprocess
-    pub fn on_process_exit(&mut self, proc: *mut Process, _: Status, _: &Rusage) {
+    pub fn on_process_exit(&mut self, proc: *mut Process, _: Status, rusage: &Rusage) {
         if self.process != proc {
             bun_core::debug_warn!(
                 "<d>[LifecycleScriptSubprocess]<r> onProcessExit called with wrong process"
             );
             return;
         }
+        use bun_spawn::RusageFields as _;
+        self.cpu_time_ns = self.cpu_time_ns.saturating_add(
+            ((rusage.utime_sec() + rusage.stime_sec()) as u64)
+                .saturating_mul(bun_core::time::NS_PER_S)
+                + ((rusage.utime_usec() + rusage.stime_usec()) as u64) * bun_core::time::NS_PER_US,
+        );
         self.has_called_process_exit = true;
         self.maybe_finished();
     }
@@ -1156,7 +1178,8 @@ impl<'a> LifecycleScriptSubprocess<'a> {
             stdout: OutputReader::init::<Self>(),
             stderr: OutputReader::init::<Self>(),
             has_called_process_exit: false,
-            timer: None,
+            timer: Some(Timer::start()),
+            cpu_time_ns: 0,
             has_incremented_alive_count: false,
             started_at: 0,
             heap: io_heap::IntrusiveField::default(),
@@ -906,6 +906,13 @@ pub struct DiffSummary {
     pub overrides_changed: bool,
     pub catalogs_changed: bool,
 
+    /// Name hashes of catalog entries whose pinned version changed, so the
+    /// install path can re-resolve only the `catalog:` dependencies that
+    /// reference them. Empty while `catalogs_changed` is set means the change
+    /// could not be attributed to specific entries (a group or entry was
+    /// added, removed, or renamed) and every catalog dependency re-resolves.
+    pub changed_catalog_deps: Vec<PackageNameHash>,
+
     pub added_trusted_dependencies:
         ArrayHashMap<TruncatedPackageNameHash, AddedTrustedDependency, ArrayIdentityContext>,
     pub removed_trusted_dependencies: TrustedDependenciesSet,
@@ -1052,7 +1059,10 @@ impl Diff {
                         from_lockfile.buffers.string_bytes.as_slice(),
                         to_lockfile.buffers.string_bytes.as_slice(),
                     ) {
+                        // Entry added/removed/renamed — can't attribute, so
+                        // fall back to invalidating every catalog dependency.
                         summary.catalogs_changed = true;
+                        summary.changed_catalog_deps.clear();
                         break 'catalogs;
                     }
 
@@ -1063,7 +1073,7 @@ impl Diff {
                         to_lockfile.buffers.string_bytes.as_slice(),
                     ) {
                         summary.catalogs_changed = true;
-                        break 'catalogs;
+                        summary.changed_catalog_deps.push(to_dep.name_hash);
                     }
                 }
 
@@ -1084,11 +1094,13 @@ impl Diff {
                         to_lockfile.buffers.string_bytes.as_slice(),
                     ) {
                         summary.catalogs_changed = true;
+                        summary.changed_catalog_deps.clear();
                         break 'catalogs;
                     }
 
                     if from_catalog_deps.count() != to_catalog_deps.count() {
                         summary.catalogs_changed = true;
+                        summary.changed_catalog_deps.clear();
                         break 'catalogs;
                     }
 
@@ -1106,6 +1118,7 @@ impl Diff {
                             to_lockfile.buffers.string_bytes.as_slice(),
                         ) {
                             summary.catalogs_changed = true;
+                            summary.changed_catalog_deps.clear();
                             break 'catalogs;
                         }
 
@@ -1116,7 +1129,7 @@ impl Diff {
                             to_lockfile.buffers.string_bytes.as_slice(),
                         ) {
                             summary.catalogs_changed = true;
-                            break 'catalogs;
+                            summary.changed_catalog_deps.push(to_dep.name_hash);
                         }
                     }
                 }
@@ -1405,6 +1405,7 @@ pub mod package_manifest {
                 return Ok(None);
             }
 
+            crate::install_profile::record_manifest_cache_hit();
             Ok(Some(manifest))
         }
 
@@ -1944,6 +1945,11 @@ impl PackageManifest {
         public_max_age: u32,
         is_extended_manifest: bool,
     ) -> Result<Option<PackageManifest>, Error> {
+        // A network manifest parse means the binary cache did not serve this
+        // package this run.
+        crate::install_profile::record_manifest_cache_miss();
+        let _profile =
+            crate::install_profile::span(crate::install_profile::Phase::Resolve, expected_name);
         // `bun_ast::Source::init_path_string` accepts borrowed `&[u8]` via
         // `IntoStr`; the Source only lives for the duration of this function,
         // so pass the caller's buffers through directly without manufacturing
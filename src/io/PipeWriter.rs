@@ -604,6 +604,11 @@ pub struct PosixStreamingWriter<Parent: PosixStreamingWriterParent> {
     pub is_done: bool,
     pub closed_without_reporting: bool,
     pub force_sync: bool,
+    /// Buffering threshold: writes accumulate in `outgoing` until this many
+    /// bytes are queued, then drain in one syscall. 0 = the page-size default
+    /// ([`Self::CHUNK_SIZE`]); `FileSink` overrides it with the user's
+    /// `highWaterMark` so high-rate small writes batch into fewer syscalls.
+    pub chunk_size: usize,
 }
 
 impl<Parent: PosixStreamingWriterParent> Default for PosixStreamingWriter<Parent> {
@@ -615,6 +620,7 @@ impl<Parent: PosixStreamingWriterParent> Default for PosixStreamingWriter<Parent
             is_done: false,
             closed_without_reporting: false,
             force_sync: false,
+            chunk_size: 0,
         }
     }
 }
@@ -716,8 +722,18 @@ impl<Parent: PosixStreamingWriterParent> PosixStreamingWriter<Parent> {
         self.outgoing.size()
     }
 
+    /// The effective buffering threshold (see the `chunk_size` field).
+    #[inline]
+    fn buffer_threshold(&self) -> usize {
+        if self.chunk_size == 0 {
+            Self::CHUNK_SIZE
+        } else {
+            self.chunk_size
+        }
+    }
+
     pub fn should_buffer(&self, addition: usize) -> bool {
-        !self.force_sync && self.outgoing.size() + addition < Self::CHUNK_SIZE
+        !self.force_sync && self.outgoing.size() + addition < self.buffer_threshold()
     }
 
     pub fn get_buffer(&self) -> &[u8] {
@@ -64,6 +64,49 @@ impl Write for DiscardingWriter {
     }
 }
 
+// ════════════════════════════════════════════════════════════════════════════
+// CappedWriter — growable sink with a hard byte budget
+// ════════════════════════════════════════════════════════════════════════════
+
+/// Appends to a borrowed `Vec<u8>` until `budget` bytes are stored, then
+/// silently discards the rest. Writes never fail, so a formatter driving this
+/// sink completes its walk instead of taking an error path; `truncated` records
+/// whether anything was dropped.
+pub struct CappedWriter<'a> {
+    pub buf: &'a mut Vec<u8>,
+    pub budget: usize,
+    /// Set once any byte has been discarded.
+    pub truncated: bool,
+}
+
+impl<'a> CappedWriter<'a> {
+    #[inline]
+    pub fn new(buf: &'a mut Vec<u8>, budget: usize) -> Self {
+        Self {
+            buf,
+            budget,
+            truncated: false,
+        }
+    }
+}
+
+impl Write for CappedWriter<'_> {
+    fn write_all(&mut self, src: &[u8]) -> Result<()> {
+        let remain = self.budget.saturating_sub(self.buf.len());
+        if src.len() > remain {
+            self.truncated = true;
+        }
+        if remain > 0 {
+            self.buf.extend_from_slice(&src[..src.len().min(remain)]);
+        }
+        Ok(())
+    }
+    #[inline]
+    fn written_len(&self) -> usize {
+        self.buf.len()
+    }
+}
+
 // ════════════════════════════════════════════════════════════════════════════
 // FixedBufferStream — cursor over an in-memory buffer
 // ════════════════════════════════════════════════════════════════════════════
@@ -319,6 +362,19 @@ mod tests {
         assert_eq!(v, b"hello !!!\x01\x02");
     }
 
+    #[test]
+    fn capped_writer() {
+        let mut v = Vec::new();
+        let mut w = CappedWriter::new(&mut v, 8);
+        w.write_all(b"hello").unwrap();
+        assert!(!w.truncated);
+        w.write_all(b" world").unwrap();
+        assert!(w.truncated);
+        w.write_all(b"!").unwrap();
+        assert_eq!(w.written_len(), 8);
+        assert_eq!(v, b"hello wo");
+    }
+
     #[test]
     fn fmt_adapter() {
         let mut s = String::new();
@@ -1,4 +1,14 @@
-export function initializeCompressionStream(this, format) {
+export function initializeCompressionStream(this, format, options) {
+  // "zstd" and "brotli" compress natively: the transform/flush algorithms run entirely in
+  // C++ (TransformerKind::Compression), so chunks never bounce through a JS duplex adapter.
+  if (format === "zstd" || format === "brotli") {
+    const createTransform = $newCppFunction("JSCompressionTransformState.cpp", "jsCreateCompressionStreamTransform", 2);
+    const transform = createTransform(format, options?.dictionary);
+    $putByIdDirectPrivate(this, "readable", transform.readable);
+    $putByIdDirectPrivate(this, "writable", transform.writable);
+    return this;
+  }
+
   const zlib = require("node:zlib");
   const { newBufferSourceTransformPairFromDuplex } = require("internal/webstreams_adapters");
 
@@ -6,14 +16,15 @@ export function initializeCompressionStream(this, format) {
     "deflate": zlib.createDeflate,
     "deflate-raw": zlib.createDeflateRaw,
     "gzip": zlib.createGzip,
-    "brotli": zlib.createBrotliCompress,
-    "zstd": zlib.createZstdCompress,
   };
 
   if (!(format in builders))
-    throw $ERR_INVALID_ARG_VALUE("format", format, "must be one of: " + Object.keys(builders).join(", "));
+    throw $ERR_INVALID_ARG_VALUE("format", format, "must be one of: deflate, deflate-raw, gzip, brotli, zstd");
 
-  const transform = newBufferSourceTransformPairFromDuplex(builders[format]());
+  const dictionary = options?.dictionary;
+  const transform = newBufferSourceTransformPairFromDuplex(
+    builders[format](dictionary !== undefined ? { dictionary } : undefined),
+  );
   $putByIdDirectPrivate(this, "readable", transform.readable);
   $putByIdDirectPrivate(this, "writable", transform.writable);
 
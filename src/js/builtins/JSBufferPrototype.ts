@@ -1,5 +1,10 @@
 // The fastest way as of April 2022 is to use DataView.
-// DataView has intrinsics that cause inlining
+// DataView has intrinsics that cause inlining: DFG/FTL compiles the
+// get*/set* calls down to bounds-checked loads/stores, so the fixed-width
+// read/write family never leaves JIT code on the hot path. Re-implementing
+// them as native host functions — with or without DOMJIT unchecked
+// variants — was measured slower (see the DOMJIT note in JSBuffer.cpp):
+// it trades an inlined load for a JS→C++ transition per call.
 
 interface BufferExt extends Buffer {
   $dataView?: DataView;
@@ -0,0 +1,61 @@
+export function lines(input: ReadableStream<Uint8Array> | Blob): AsyncIterableIterator<string> {
+  let stream: ReadableStream<Uint8Array>;
+  if ($inheritsReadableStream(input)) {
+    stream = input as ReadableStream<Uint8Array>;
+  } else if ($inheritsBlob(input)) {
+    stream = (input as Blob).stream();
+  } else {
+    throw new TypeError("Bun.lines expects a ReadableStream or Blob");
+  }
+
+  const decoder = new TextDecoder("utf-8", { fatal: false });
+  const indexOf = Bun.indexOfLine;
+
+  async function* BunLinesIterator() {
+    const reader = stream.getReader();
+    let pending: Uint8Array | undefined;
+    try {
+      while (true) {
+        let done: boolean, value: Uint8Array[];
+        const result = reader.readMany();
+        if ($isPromise(result)) {
+          ({ done, value } = await result);
+        } else {
+          ({ done, value } = result);
+        }
+
+        if (done) {
+          if (pending && pending.length !== 0) {
+            yield decoder.decode(pending);
+          }
+          return;
+        }
+
+        for (let idx = 0, len = value.length; idx < len; idx++) {
+          let chunk = value[idx];
+          if (pending) {
+            chunk = Buffer.concat([pending, chunk]);
+            pending = undefined;
+          }
+
+          let last = 0;
+          let i = indexOf(chunk, last);
+          while (i !== -1) {
+            // lines may be "\r\n"-terminated regardless of platform
+            yield decoder.decode(chunk.subarray(last, i > 0 && chunk[i - 1] === 0x0d ? i - 1 : i));
+            last = i + 1;
+            i = indexOf(chunk, last);
+          }
+
+          if (last !== chunk.length) {
+            pending = chunk.subarray(last);
+          }
+        }
+      }
+    } finally {
+      reader.releaseLock();
+    }
+  }
+
+  return BunLinesIterator();
+}
@@ -97,12 +97,14 @@ const constants = {
 // This is interface is the JS equivalent of what JSSQLStatement.cpp defines
 interface CppSQLStatement {
   run: (...args: TODO[]) => TODO;
+  runBatch: (...args: TODO[]) => TODO;
   get: (...args: TODO[]) => TODO;
   all: (...args: TODO[]) => TODO;
   iterate: (...args: TODO[]) => TODO;
   as: (...args: TODO[]) => TODO;
   values: (...args: TODO[]) => TODO;
   raw: (...args: TODO[]) => TODO;
+  columnar: (...args: TODO[]) => TODO;
   finalize: (...args: TODO[]) => TODO;
   toString: (...args: TODO[]) => TODO;
   columns: string[];
@@ -121,12 +123,88 @@ interface CppSQL {
   deserialize(serialized: NodeJS.TypedArray | ArrayBufferLike, openFlags: number, deserializeFlags: number): TODO;
   fcntl(handle: TODO, ...args: TODO[]): TODO;
   close(handle: TODO, throwOnError: boolean): void;
+  blobOpen(handle: TODO, table: string, column: string, rowid: number | bigint, write: boolean): number;
+  blobBytes(blobHandle: number): number;
+  blobRead(blobHandle: number, offset: number, length: number): Uint8Array;
+  blobWrite(blobHandle: number, data: NodeJS.TypedArray | DataView, offset: number): void;
+  blobClose(blobHandle: number): void;
+  enableResultCache(handle: TODO, maxEntries: number): void;
   setCustomSQLite(path: string): void;
 }
 
 let SQL: CppSQL;
 let controllers: WeakMap<Database, any> | undefined;
 
+class SQLiteBlob {
+  #id = -1;
+  #size;
+  // The owning Database's set of open blobs, so db.close() can close us
+  // first — a connection with open blob handles refuses to close.
+  #openBlobs;
+
+  constructor(id, size, openBlobs) {
+    this.#id = id;
+    this.#size = size;
+    this.#openBlobs = openBlobs;
+    openBlobs.add(this);
+  }
+
+  get byteLength() {
+    return this.#size;
+  }
+
+  get closed() {
+    return this.#id === -1;
+  }
+
+  readAt(offset, length) {
+    if (this.#id === -1) {
+      throw new Error("Blob has closed");
+    }
+
+    return SQL.blobRead(this.#id, offset, length);
+  }
+
+  writeAt(data, offset = 0) {
+    if (this.#id === -1) {
+      throw new Error("Blob has closed");
+    }
+
+    SQL.blobWrite(this.#id, data, offset);
+  }
+
+  stream(chunkSize = 64 * 1024) {
+    let offset = 0;
+    return new ReadableStream({
+      pull: controller => {
+        const length = Math.min(chunkSize, this.#size - offset);
+        if (length > 0) {
+          controller.enqueue(this.readAt(offset, length));
+          offset += length;
+        }
+        if (offset >= this.#size) {
+          controller.close();
+        }
+      },
+    });
+  }
+
+  close() {
+    if (this.#id === -1) {
+      return;
+    }
+
+    const id = this.#id;
+    this.#id = -1;
+    this.#openBlobs.delete(this);
+    SQL.blobClose(id);
+  }
+
+  [Symbol.dispose]() {
+    this.close();
+  }
+}
+
 class Statement {
   constructor(raw: CppSQLStatement) {
     this.#raw = raw;
@@ -138,6 +216,7 @@ class Statement {
         this.iterate = this.#iterateNoArgs;
         this.values = this.#valuesNoArgs;
         this.raw = this.#rawNoArgs;
+        this.columnar = this.#columnarNoArgs;
         this.run = this.#runNoArgs;
         break;
       }
@@ -147,6 +226,7 @@ class Statement {
         this.iterate = this.#iterate;
         this.values = this.#values;
         this.raw = this.#rawValues;
+        this.columnar = this.#columnar;
         this.run = this.#run;
         break;
       }
@@ -160,6 +240,7 @@ class Statement {
   iterate: SqliteTypes.Statement["iterate"];
   values: SqliteTypes.Statement["values"];
   raw: SqliteTypes.Statement["raw"];
+  columnar: SqliteTypes.Statement["columnar"];
   run: SqliteTypes.Statement["run"];
   isFinalized = false;
 
@@ -206,6 +287,10 @@ class Statement {
     return this.#raw.raw();
   }
 
+  #columnarNoArgs() {
+    return this.#raw.columnar();
+  }
+
   #runNoArgs() {
     this.#raw.run(internalFieldTuple);
 
@@ -227,6 +312,12 @@ class Statement {
     return this;
   }
 
+  runBatch(rows) {
+    this.#raw.runBatch(internalFieldTuple, rows);
+
+    return createChangesObject();
+  }
+
   #get(...args) {
     if (args.length === 0) return this.#getNoArgs();
     var arg0 = args[0];
@@ -291,6 +382,18 @@ class Statement {
       : this.#raw.raw(...args);
   }
 
+  #columnar(...args) {
+    if (args.length === 0) return this.#columnarNoArgs();
+    var arg0 = args[0];
+    // ["foo"] => ["foo"]
+    // ("foo") => ["foo"]
+    // (Uint8Array(1024)) => [Uint8Array]
+    // (123) => [123]
+    return !isArray(arg0) && (!arg0 || typeof arg0 !== "object" || isTypedArray(arg0))
+      ? this.#raw.columnar(args)
+      : this.#raw.columnar(...args);
+  }
+
   #run(...args) {
     if (args.length === 0) {
       this.#runNoArgs();
@@ -368,6 +471,10 @@ class Database implements SqliteTypes.Database {
         this.#handle = Database.#deserialize(filenameGiven, this.#internalFlags, deserializeFlags);
         this.filename = ":memory:";
 
+        if (options && typeof options === "object" && options.resultCache) {
+          SQL.enableResultCache(this.#handle, typeof options.resultCache === "number" ? options.resultCache : 0);
+        }
+
         return;
       }
 
@@ -422,6 +529,10 @@ class Database implements SqliteTypes.Database {
 
     this.#handle = SQL.open(anonymous ? ":memory:" : filename, flags, this);
     this.filename = filename;
+
+    if (typeof options === "object" && options && options.resultCache) {
+      SQL.enableResultCache(this.#handle, typeof options.resultCache === "number" ? options.resultCache : 0);
+    }
   }
 
   #internalFlags = 0;
@@ -429,6 +540,7 @@ class Database implements SqliteTypes.Database {
   #cachedQueriesKeys: string[] = [];
   #cachedQueriesLengths: number[] = [];
   #cachedQueriesValues: Statement[] = [];
+  #openBlobs = new Set<SQLiteBlob>();
   filename;
   #hasClosed = false;
   get handle() {
@@ -451,6 +563,11 @@ class Database implements SqliteTypes.Database {
     return SQL.serialize(this.#handle, optionalName || "main");
   }
 
+  openBlob(table, column, rowid, options?) {
+    const id = SQL.blobOpen(this.#handle, table, column, rowid, !!options?.write);
+    return new SQLiteBlob(id, SQL.blobBytes(id), this.#openBlobs);
+  }
+
   static #deserialize(serialized: NodeJS.TypedArray | ArrayBufferLike, openFlags: number, deserializeFlags: number) {
     if (!SQL) {
       initializeSQL();
@@ -516,6 +633,11 @@ class Database implements SqliteTypes.Database {
         }
       }
     }
+    // Close any open incremental blob handles; with them open,
+    // sqlite3_close refuses the connection.
+    for (const blob of this.#openBlobs) {
+      blob.close();
+    }
     this.#hasClosed = true;
     return SQL.close(this.#handle, throwOnError);
   }
@@ -52,6 +52,18 @@ const shellParse = $newRustFunction("shell.rs", "TestingAPIs.shellParse", 2);
 
 export const sslCtxLiveCount = $newRustFunction("SecureContext.rs", "jsLiveCount", 0);
 
+export const httpAgentStats = $newRustFunction("fetch.rs", "jsHttpAgentStats", 0) as () => {
+  freshConnections: number;
+  reusedConnections: number;
+};
+
+export const spawnStats = $newRustFunction("subprocess.rs", "jsSpawnStats", 0) as () => {
+  spawns: number;
+  totalSpawnNanos: number;
+  pathCacheHits: number;
+  pathCacheMisses: number;
+};
+
 export const napiThreadsafeFunctionLiveCount = $newRustFunction("napi_body.rs", "jsThreadsafeFunctionLiveCount", 0);
 
 export const escapeRegExp = $newRustFunction("escapeRegExp.rs", "jsEscapeRegExp", 1);
@@ -16,7 +16,9 @@ const {
   sign,
   Verify: _Verify,
   verify,
+  verifyBatch: _verifyBatch,
   Hmac: _Hmac,
+  hmac: _hmacOneShot,
   Hash: _Hash,
   ECDH,
   DiffieHellman,
@@ -248,6 +250,19 @@ Object.assign(Verify.prototype, {
 crypto_exports.Verify = Verify;
 crypto_exports.verify = verify;
 
+// Verifies a batch of Ed25519 `{ key, data, signature }` entries in a single
+// async work-pool job. Resolves to a Uint8Array bitmask where bit i (byte
+// i >> 3, bit i & 7) is set iff entry i verified.
+crypto_exports.verifyBatch = function verifyBatch(entries) {
+  return new Promise((resolve, reject) => {
+    try {
+      _verifyBatch(entries, (err, bitmask) => (err ? reject(err) : resolve(bitmask)));
+    } catch (err) {
+      reject(err);
+    }
+  });
+};
+
 function createVerify(algorithm, options?) {
   return new Verify(algorithm, options);
 }
@@ -324,6 +339,9 @@ crypto_exports.Hmac = deprecate(Hmac, "crypto.Hmac constructor is deprecated.",
 crypto_exports.createHmac = function createHmac(hmac, key, options) {
   return new Hmac(hmac, key, options);
 };
+crypto_exports.hmac = function hmac(algorithm, key, input, outputEncoding = "hex") {
+  return _hmacOneShot(algorithm, key, input, outputEncoding);
+};
 
 crypto_exports.getHashes = getHashes;
 
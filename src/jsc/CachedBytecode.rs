@@ -139,8 +139,19 @@ pub(crate) fn __bun_jsc_generate_cached_bytecode(
     source: &[u8],
     source_provider_url: &mut BunString,
 ) -> Option<Box<[u8]>> {
-    crate::virtual_machine::IS_BUNDLER_THREAD_FOR_BYTECODE_CACHE.set(true);
     crate::initialize(false);
+    generate_cached_bytecode_on_worker(format, source, source_provider_url)
+}
+
+/// Same as `__bun_jsc_generate_cached_bytecode` minus `initialize()`: for
+/// runtime worker threads (transpiler-cache bytecode sidecar) where JSC is
+/// already initialized by the main thread and must not be re-initialized.
+pub(crate) fn generate_cached_bytecode_on_worker(
+    format: Format,
+    source: &[u8],
+    source_provider_url: &mut BunString,
+) -> Option<Box<[u8]>> {
+    crate::virtual_machine::IS_BUNDLER_THREAD_FOR_BYTECODE_CACHE.set(true);
     let (bytes, handle) = CachedBytecode::generate(format, source, source_provider_url)?;
     let owned = Box::<[u8]>::from(bytes);
     // `handle` was just produced by C++ and is valid until deref;
@@ -227,6 +227,7 @@ impl GarbageCollectionController {
                 } else {
                     self.gc_timer_state = GCTimerState::Pending;
                 }
+                bun_crash_handler::flight_recorder::record("gc (timer)", this_heap_size as u64);
                 vm.collect_async();
                 self.gc_last_heap_size = this_heap_size;
             }
@@ -255,6 +256,7 @@ impl GarbageCollectionController {
             return;
         }
         let vm = VirtualMachine::get().jsc_vm();
+        bun_crash_handler::flight_recorder::record("gc", vm.block_bytes_allocated() as u64);
         vm.collect_async();
         self.gc_last_heap_size = vm.block_bytes_allocated();
     }
@@ -55,6 +55,14 @@ const EXPECTED_VERSION: u32 = 23;
 /// `is_stale`), so shrinking this does not weaken staleness detection.
 const MINIMUM_CACHE_SIZE: usize = 4 * 1024;
 
+/// Set from CLI parsing when `--hot` / `--watch` is active. A `--watch` restart
+/// is a full process re-exec and `--hot` clears the in-memory module cache, so
+/// either way the whole graph is re-transpiled on every edit; the on-disk cache
+/// is the only transpile state that survives. Waiving [`MINIMUM_CACHE_SIZE`]
+/// means an edit re-runs the parser for the edited file only — everything else,
+/// however small, restores from disk.
+pub static CACHE_SMALL_FILES: AtomicBool = AtomicBool::new(false);
+
 // When making parser changes, it gets extremely confusing.
 #[cfg(bun_debug)]
 static BUN_DEBUG_RESTORE_FROM_CACHE: AtomicBool = AtomicBool::new(false);
@@ -587,6 +595,97 @@ impl Entry {
     }
 }
 
+// ───────────────────────── Bytecode sidecar (".pile-bc") ─────────────────────────
+//
+// `<hash>.pile-bc` next to the `<hash>.pile` entry: the serialized JSC
+// `CachedBytecode` for the transpiled output, generated off the JS thread on a
+// cache miss and handed to the SourceProvider (`ResolvedSource.bytecode_cache`)
+// on a hit, so repeat cold starts skip JSC's parse + codegen for the module.
+// Opt-in via `BUN_RUNTIME_TRANSPILER_CACHE_BYTECODE=1` — generation costs one
+// extra codegen pass on the first (miss) run.
+//
+// JSC validates bytecode against a `SourceCodeKey` that includes the source
+// origin URL, so the sidecar records the path the bytecode was generated with;
+// a hit on the same content from a *different* path skips the bytecode and
+// falls back to the plain transpiled-output entry.
+
+/// ** Update when the sidecar layout changes. ** (JSC bumps its own
+/// `CachedBytecode` version tag internally; stale bytecode is rejected by JSC
+/// at decode time, not here.)
+/// Version 1: initial layout.
+const BYTECODE_CACHE_VERSION: u32 = 1;
+
+#[derive(Copy, Clone, PartialEq, Eq)]
+struct BytecodeMetadata {
+    cache_version: u32,
+    module_type: ModuleType,
+
+    input_hash: u64,
+    features_hash: u64,
+
+    origin_byte_length: u64,
+    bytecode_byte_length: u64,
+    bytecode_hash: u64,
+}
+
+impl Default for BytecodeMetadata {
+    fn default() -> Self {
+        Self {
+            cache_version: BYTECODE_CACHE_VERSION,
+            module_type: ModuleType::None,
+            input_hash: 0,
+            features_hash: 0,
+            origin_byte_length: 0,
+            bytecode_byte_length: 0,
+            bytecode_hash: 0,
+        }
+    }
+}
+
+impl BytecodeMetadata {
+    // 1×u32 + 1×u8 + 5×u64 = 4 + 1 + 40 = 45
+    const SIZE: usize = 4 + 1 + 5 * 8;
+
+    fn encode<W: bun_io::Write>(&self, writer: &mut W) -> crate::CrateResult<()> {
+        writer.write_int_le::<u32>(self.cache_version)?;
+        writer.write_int_le::<u8>(self.module_type as u8)?;
+
+        writer.write_int_le::<u64>(self.input_hash)?;
+        writer.write_int_le::<u64>(self.features_hash)?;
+
+        writer.write_int_le::<u64>(self.origin_byte_length)?;
+        writer.write_int_le::<u64>(self.bytecode_byte_length)?;
+        writer.write_int_le::<u64>(self.bytecode_hash)?;
+        Ok(())
+    }
+
+    fn decode(&mut self, reader: &mut bun_io::FixedBufferStream<&[u8]>) -> crate::CrateResult<()> {
+        self.cache_version = reader.read_int_le::<u32>()?;
+        if self.cache_version != BYTECODE_CACHE_VERSION {
+            return Err(crate::CrateError::StaleCache);
+        }
+
+        let module_type_raw = reader.read_int_le::<u8>()?;
+
+        self.input_hash = reader.read_int_le::<u64>()?;
+        self.features_hash = reader.read_int_le::<u64>()?;
+
+        self.origin_byte_length = reader.read_int_le::<u64>()?;
+        self.bytecode_byte_length = reader.read_int_le::<u64>()?;
+        self.bytecode_hash = reader.read_int_le::<u64>()?;
+
+        self.module_type = match module_type_raw {
+            1 => ModuleType::Esm,
+            2 => ModuleType::Cjs,
+            _ => return Err(crate::CrateError::InvalidModuleType),
+        };
+
+        Ok(())
+    }
+}
+
+const _: () = assert!(BytecodeMetadata::SIZE == 4 + 1 + 5 * 8);
+
 pub struct RuntimeTranspilerCache {
     pub input_hash: Option<u64>,
     pub input_byte_length: Option<u64>,
@@ -914,6 +1013,214 @@ impl RuntimeTranspilerCache {
         IS_DISABLED.load(Ordering::Relaxed)
     }
 
+    pub fn bytecode_enabled() -> bool {
+        env_var::BUN_RUNTIME_TRANSPILER_CACHE_BYTECODE.get().unwrap_or(false)
+    }
+
+    /// Like `get_cache_file_path`, with the sidecar suffix ("<hex>.pile-bc").
+    fn get_bytecode_cache_file_path(
+        buf: &mut PathBuffer,
+        input_hash: u64,
+    ) -> crate::CrateResult<&ZStr> {
+        let cache_dir_len = Self::get_cache_dir(buf)?;
+        buf[cache_dir_len] = SEP;
+        let cache_filename_len =
+            Self::write_cache_filename(&mut buf[cache_dir_len + 1..], input_hash)?;
+        let mut total = cache_dir_len + 1 + cache_filename_len;
+        const SUFFIX: &[u8] = b"-bc";
+        buf[total..total + SUFFIX.len()].copy_from_slice(SUFFIX);
+        total += SUFFIX.len();
+        buf[total] = 0;
+
+        // SAFETY: we wrote a NUL at buf[total] above.
+        Ok(ZStr::from_buf(&buf[..], total))
+    }
+
+    /// Atomically persist the bytecode sidecar for `input_hash` (tmpfile +
+    /// rename, mirroring `Entry::save`).
+    pub fn bytecode_to_file(
+        input_hash: u64,
+        features_hash: u64,
+        module_type: ModuleType,
+        origin_path: &[u8],
+        bytecode: &[u8],
+    ) -> crate::CrateResult<()> {
+        let _tracer = bun_core::perf::trace("RuntimeTranspilerCache.bytecodeToFile");
+
+        if origin_path.is_empty() || bytecode.is_empty() {
+            return Err(crate::CrateError::MissingData);
+        }
+
+        let mut cache_file_path_buf = PathBuffer::uninit();
+        let cache_file_path =
+            Self::get_bytecode_cache_file_path(&mut cache_file_path_buf, input_hash)?;
+
+        let cache_dir_fd: Fd = 'brk: {
+            let dirname = path_handler::dirname::<platform::Auto>(cache_file_path.as_bytes());
+            if !dirname.is_empty() {
+                let dir =
+                    sys::Dir::cwd().make_open_path(dirname, sys::OpenDirOptions::default())?;
+                let dfd = dir.into_raw();
+                break 'brk match dfd.make_lib_uv_owned() {
+                    Ok(f) => f,
+                    Err(e) => {
+                        dfd.close();
+                        return Err(e.into());
+                    }
+                };
+            }
+
+            break 'brk Fd::cwd();
+        };
+        let _dir_guard = scopeguard::guard(cache_dir_fd, |fd| {
+            if fd != Fd::cwd() {
+                fd.close();
+            }
+        });
+
+        let mut tmpname_buf = PathBuffer::uninit();
+        let tmpfilename = FileSystem::tmpname(
+            paths::extension(cache_file_path.as_bytes()),
+            &mut tmpname_buf[..],
+            input_hash,
+        )?;
+        let tmpfilename: &ZStr = &*tmpfilename;
+
+        let mut tmpfile = sys::Tmpfile::create(cache_dir_fd, tmpfilename)?;
+        let _close_guard = sys::CloseOnDrop::new(tmpfile.fd);
+        {
+            let errdefer = scopeguard::guard(tmpfile.using_tmpfile, |using_tmpfile| {
+                if !using_tmpfile {
+                    let _ = sys::unlinkat(cache_dir_fd, tmpfilename);
+                }
+            });
+
+            let metadata = BytecodeMetadata {
+                cache_version: BYTECODE_CACHE_VERSION,
+                module_type,
+                input_hash,
+                features_hash,
+                origin_byte_length: origin_path.len() as u64,
+                bytecode_byte_length: bytecode.len() as u64,
+                bytecode_hash: hash(bytecode),
+            };
+
+            let mut metadata_buf = [0u8; BytecodeMetadata::SIZE * 2];
+            let metadata_bytes_len = {
+                let mut metadata_stream = bun_io::FixedBufferStream::new_mut(&mut metadata_buf[..]);
+                metadata.encode(&mut metadata_stream)?;
+                metadata_stream.pos
+            };
+            let metadata_bytes: &[u8] = &metadata_buf[0..metadata_bytes_len];
+
+            let mut vecs_buf: [sys::PlatformIoVecConst; 3] = bun_core::ffi::zeroed();
+            vecs_buf[0] = sys::platform_iovec_const_create(metadata_bytes);
+            vecs_buf[1] = sys::platform_iovec_const_create(origin_path);
+            vecs_buf[2] = sys::platform_iovec_const_create(bytecode);
+            let vecs: &[sys::PlatformIoVecConst] = &vecs_buf[..];
+
+            let end_position = BytecodeMetadata::SIZE + origin_path.len() + bytecode.len();
+            let _ = sys::preallocate_file(
+                tmpfile.fd.cast(),
+                0,
+                i64::try_from(end_position).expect("int cast"),
+            );
+
+            let mut position: i64 = 0;
+            while (position as usize) < end_position {
+                let written = sys::pwritev(tmpfile.fd, vecs, position)?;
+                if written == 0 {
+                    return Err(crate::CrateError::WriteFailed);
+                }
+
+                position += i64::try_from(written).expect("int cast");
+            }
+
+            let _ = scopeguard::ScopeGuard::into_inner(errdefer);
+        }
+
+        let dest_slice = cache_file_path.as_bytes();
+        let base = paths::basename(dest_slice);
+        // SAFETY: `base` is a suffix of `cache_file_path`, which is
+        // NUL-terminated at `dest_slice.len()` (see `Entry::save`).
+        let base_z = unsafe { ZStr::from_raw(base.as_ptr(), base.len()) };
+        tmpfile.finish(base_z)?;
+        Ok(())
+    }
+
+    /// Load and validate the bytecode sidecar for `input_hash`. Returns the
+    /// serialized `CachedBytecode` bytes; the caller hands them to the
+    /// SourceProvider via `ResolvedSource.bytecode_cache`.
+    ///
+    /// Corrupt or stale sidecars are deleted. An origin/module-type mismatch
+    /// (same content reachable from a different path) keeps the file and just
+    /// reports a miss — JSC would reject the bytecode anyway.
+    pub fn bytecode_from_file(
+        input_hash: u64,
+        features_hash: u64,
+        module_type: ModuleType,
+        origin_path: &[u8],
+    ) -> crate::CrateResult<Box<[u8]>> {
+        let _tracer = bun_core::perf::trace("RuntimeTranspilerCache.bytecodeFromFile");
+
+        let mut cache_file_path_buf = PathBuffer::uninit();
+        let cache_file_path =
+            Self::get_bytecode_cache_file_path(&mut cache_file_path_buf, input_hash)?;
+
+        let cache_fd = sys::open(cache_file_path, sys::O::RDONLY, 0)?;
+        let file = sys::File::from_fd(cache_fd);
+        // On any error below, delete the sidecar (disarmed for the mismatch
+        // cases, which are not corruption).
+        let unlink_guard = scopeguard::guard(cache_file_path, |p| {
+            let _ = sys::unlink(p);
+        });
+
+        let mut metadata_bytes_buf = [0u8; BytecodeMetadata::SIZE * 2];
+        let metadata_bytes = file.pread_all(&mut metadata_bytes_buf, 0)?;
+        let mut reader = bun_io::FixedBufferStream::new(&metadata_bytes_buf[0..metadata_bytes]);
+
+        let mut metadata = BytecodeMetadata::default();
+        metadata.decode(&mut reader)?;
+        if metadata.input_hash != input_hash {
+            return Err(crate::CrateError::InvalidInputHash);
+        }
+        if metadata.features_hash != features_hash {
+            return Err(crate::CrateError::MismatchedFeatureHash);
+        }
+        if metadata.bytecode_byte_length == 0 || metadata.origin_byte_length == 0 {
+            return Err(crate::CrateError::MissingData);
+        }
+
+        if metadata.module_type != module_type
+            || metadata.origin_byte_length as usize != origin_path.len()
+        {
+            let _ = scopeguard::ScopeGuard::into_inner(unlink_guard);
+            return Err(crate::CrateError::MismatchedBytecodeOrigin);
+        }
+
+        let origin = pread_box(
+            &file,
+            metadata.origin_byte_length as usize,
+            BytecodeMetadata::SIZE as u64,
+        )?;
+        if &*origin != origin_path {
+            let _ = scopeguard::ScopeGuard::into_inner(unlink_guard);
+            return Err(crate::CrateError::MismatchedBytecodeOrigin);
+        }
+
+        let bytecode = pread_box(
+            &file,
+            metadata.bytecode_byte_length as usize,
+            (BytecodeMetadata::SIZE as u64) + metadata.origin_byte_length,
+        )?;
+        if hash(&bytecode) != metadata.bytecode_hash {
+            return Err(crate::CrateError::InvalidHash);
+        }
+
+        let _ = scopeguard::ScopeGuard::into_inner(unlink_guard);
+        Ok(bytecode)
+    }
+
     pub fn get(
         &mut self,
         source: &Source,
@@ -928,7 +1235,8 @@ impl RuntimeTranspilerCache {
             return true;
         }
 
-        if source.contents.len() < MINIMUM_CACHE_SIZE {
+        if source.contents.len() < MINIMUM_CACHE_SIZE && !CACHE_SMALL_FILES.load(Ordering::Relaxed)
+        {
             return false;
         }
 
@@ -11,9 +11,9 @@ use bun_ast::Loader;
 use bun_ast::{ASTMemoryAllocator, ExportsKind};
 use bun_ast::{ImportRecord, ImportRecordFlags};
 use bun_bundler::analyze_transpiled_module;
-use bun_bundler::options::ModuleType;
+use bun_bundler::options::{BundleOptions, ModuleType, bundle_options_defaults};
 use bun_bundler::transpiler::{self as transpiler, AlreadyBundled, ParseOptions, Transpiler};
-use bun_collections::HiveArrayFallback;
+use bun_collections::{HashMap, HiveArrayFallback};
 use bun_core::{MutableString, String, strings};
 use bun_event_loop::{TaskTag, Taskable, task_tag};
 use bun_io::posix_event_loop::get_vm_ctx;
@@ -203,6 +203,11 @@ pub struct RuntimeTranspilerStore {
     pub store: TranspilerJobStore,
     pub enabled: bool,
     pub queue: Queue,
+    /// Speculatively pre-transpiled modules, keyed by absolute path. JS-thread
+    /// only (`transpile` consumes, `finish_speculative` delivers via the task
+    /// queue), so no lock; see the "Speculative module-graph pre-loading"
+    /// section below.
+    speculative: HashMap<Box<[u8]>, Speculation>,
 }
 
 pub type Queue = UnboundedQueue<TranspilerJob>;
@@ -214,6 +219,7 @@ impl Default for RuntimeTranspilerStore {
             store: TranspilerJobStore::init(),
             enabled: true,
             queue: Queue::new(),
+            speculative: HashMap::new(),
         }
     }
 }
@@ -307,6 +313,20 @@ impl RuntimeTranspilerStore {
             }
         }
 
+        // Speculative pre-load consume: a worker may have already transpiled
+        // this path off its importer's import list. A validated hit skips the
+        // worker round-trip entirely and rides the completion queue, so the
+        // promise still resolves through `run_from_js_thread`.
+        let speculative_hit = self.take_speculative(path.text, loader, resolved_source.get().tag);
+        let is_speculative_hit = speculative_hit.is_some();
+        let (resolved_source, log) = match speculative_hit {
+            Some(mut hit) => (
+                core::mem::take(&mut hit.resolved_source),
+                core::mem::replace(&mut hit.log, bun_ast::Log::init()),
+            ),
+            None => (resolved_source, bun_ast::Log::init()),
+        };
+
         // Build the job by value and `get_init` it into the hive — the `Box`
         // alloc, `JSInternalPromise::create`, and `StrongOptional::create`
         // above all happen *before* the slot is claimed, so an OOM/throw on
@@ -321,7 +341,7 @@ impl RuntimeTranspilerStore {
                 global_this: BackRef::new(global_object),
                 non_threadsafe_referrer: OwnedString::new(referrer),
                 vm,
-                log: bun_ast::Log::init(),
+                log,
                 loader,
                 promise: StrongOptional::create(JSValue::from_cell(promise), global_object),
                 poll_ref: KeepAlive::default(),
@@ -329,6 +349,8 @@ impl RuntimeTranspilerStore {
                 resolved_source,
                 generation_number: self.generation_number.load(Ordering::SeqCst),
                 parse_error: None,
+                is_speculative: false,
+                speculative_deps: Vec::new(),
                 work_task: WorkPoolTask {
                     node: Default::default(),
                     callback: TranspilerJob::run_from_worker_thread,
@@ -339,18 +361,216 @@ impl RuntimeTranspilerStore {
         if cfg!(debug_assertions) {
             bun_core::scoped_log!(
                 RuntimeTranspilerStore,
-                "transpile({}, {}, async)",
+                "transpile({}, {}, async{})",
                 bstr::BStr::new(path.text),
                 // SAFETY: job fully initialized above
-                <&'static str>::from(unsafe { (*job).loader })
+                <&'static str>::from(unsafe { (*job).loader }),
+                if is_speculative_hit {
+                    ", speculative hit"
+                } else {
+                    ""
+                }
             );
         }
-        // SAFETY: job fully initialized above
-        unsafe { (*job).schedule() };
+        if is_speculative_hit {
+            // SAFETY: job fully initialized above. The result is already
+            // final; skip the worker and enqueue the completion directly
+            // (`run_from_js_thread` unrefs the matching `ref_`).
+            unsafe {
+                (*job).poll_ref.ref_(get_vm_ctx(AllocatorType::Js));
+                (*job).dispatch_to_main_thread();
+            }
+        } else {
+            // SAFETY: job fully initialized above
+            unsafe { (*job).schedule() };
+        }
         promise.cast::<c_void>()
     }
 }
 
+// ──────────────────────────────────────────────────────────────────────────
+// Speculative module-graph pre-loading
+// ──────────────────────────────────────────────────────────────────────────
+//
+// The on-demand path is a serial chain: parse module A on a worker, evaluate
+// it on the JS thread, discover the import of B, parse B on a worker, … — one
+// module in flight at a time while the rest of the pool sits idle. To overlap
+// the chain, a worker that finishes parsing a module records its relative
+// JS-like imports (`collect_speculative_deps`); when the job completes on the
+// JS thread, `spawn_speculative` enqueues a `TranspilerJob` per new candidate,
+// so by the time the module registry asks, `transpile()` usually finds the
+// result `Ready` and skips the worker round-trip.
+//
+// A speculation is a *guess*: resolution here is extension probing only (no
+// index files, package exports, browser-field or tsconfig-path remaps) and
+// the module type is seeded from the importer. `transpile()` re-validates
+// loader, module-type tag and generation before consuming, so a wrong guess
+// costs only the wasted parse — never correctness. Kill switch:
+// `BUN_FEATURE_FLAG_DISABLE_SPECULATIVE_TRANSPILE=1`.
+
+fn speculative_preload_enabled() -> bool {
+    !bun_core::env_var::feature_flag::BUN_FEATURE_FLAG_DISABLE_SPECULATIVE_TRANSPILE::get()
+        .unwrap_or(false)
+}
+
+/// A dependency candidate collected on a worker thread in `run()`.
+pub struct SpeculativeDep {
+    path: Box<[u8]>,
+    loader: Loader,
+}
+
+enum Speculation {
+    /// Job spawned; the worker has not delivered yet.
+    InFlight,
+    Ready(SpeculativeResult),
+}
+
+struct SpeculativeResult {
+    resolved_source: OwnedResolvedSource,
+    log: bun_ast::Log,
+    loader: Loader,
+    generation_number: u32,
+}
+
+impl Drop for SpeculativeResult {
+    fn drop(&mut self) {
+        // `OwnedResolvedSource::drop` derefs the strings but leaves
+        // `bytecode_cache` alone (normally C++ takes it via `into_ffi`). A
+        // discarded speculation never crosses the FFI, and the pointer is a
+        // known `heap::into_raw(Box<[u8]>)` product from `run()`, so reclaim
+        // it here.
+        let rs = self.resolved_source.as_mut();
+        if !rs.bytecode_cache.is_null() {
+            // SAFETY: produced by `heap::into_raw` on the worker; this is the
+            // unique owner (the result was never handed to C++).
+            drop(unsafe {
+                bun_core::heap::take(ptr::slice_from_raw_parts_mut(
+                    rs.bytecode_cache,
+                    rs.bytecode_cache_size,
+                ))
+            });
+            rs.bytecode_cache = ptr::null_mut();
+            rs.bytecode_cache_size = 0;
+        }
+    }
+}
+
+impl RuntimeTranspilerStore {
+    /// JS thread. Try to consume a speculative result for `path`. The entry is
+    /// removed on any lookup: a still-`InFlight` entry means the real request
+    /// overtook the worker, and clearing it tells the arrival to discard
+    /// itself; an invalid `Ready` entry is dropped here.
+    fn take_speculative(
+        &mut self,
+        path: &[u8],
+        loader: Loader,
+        expected_tag: ResolvedSourceTag,
+    ) -> Option<SpeculativeResult> {
+        let result = match self.speculative.remove(path)? {
+            Speculation::InFlight => return None,
+            Speculation::Ready(result) => result,
+        };
+        if result.loader != loader
+            || result.generation_number != self.generation_number.load(Ordering::SeqCst)
+            || result.resolved_source.get().tag != expected_tag
+        {
+            // Guessed wrong (or stale); `SpeculativeResult::drop` cleans up.
+            return None;
+        }
+        Some(result)
+    }
+
+    /// JS thread (from `finish_speculative`). Deliver a finished speculative
+    /// result. A missing entry means `transpile()` claimed the path while the
+    /// worker ran — drop the result.
+    fn arrive_speculative(&mut self, path: &[u8], result: SpeculativeResult) {
+        if let Some(slot) = self.speculative.get_mut(path) {
+            if matches!(slot, Speculation::InFlight) {
+                *slot = Speculation::Ready(result);
+            }
+        }
+    }
+
+    /// JS thread. Spawn speculative transpile jobs for `deps` (collected on a
+    /// worker from an importer's import records). Paths already tracked — in
+    /// flight or ready — are skipped, which also bounds re-speculation across
+    /// a diamond-shaped graph.
+    fn spawn_speculative(
+        &mut self,
+        vm: *mut VirtualMachine,
+        global_this: BackRef<JSGlobalObject>,
+        deps: Vec<SpeculativeDep>,
+        parent_tag: ResolvedSourceTag,
+    ) {
+        if deps.is_empty() || !self.enabled || !speculative_preload_enabled() {
+            return;
+        }
+        let generation_number = self.generation_number.load(Ordering::SeqCst);
+        for dep in deps {
+            if self.speculative.contains_key(dep.path.as_ref()) {
+                continue;
+            }
+
+            // Module-type guess: a relative import usually shares the
+            // importer's package.json scope; validated against the real
+            // lookup in `take_speculative`.
+            let mut resolved_source = OwnedResolvedSource::default();
+            if parent_tag == ResolvedSourceTag::PackageJsonTypeCommonjs {
+                resolved_source.as_mut().tag = parent_tag;
+                resolved_source.as_mut().is_commonjs_module = true;
+            } else if parent_tag == ResolvedSourceTag::PackageJsonTypeModule {
+                resolved_source.as_mut().tag = parent_tag;
+            }
+
+            bun_core::scoped_log!(
+                RuntimeTranspilerStore,
+                "speculate({}, {})",
+                bstr::BStr::new(&dep.path),
+                <&'static str>::from(dep.loader)
+            );
+
+            // Same ownership scheme as `transpile()`: the job's `path.text` is
+            // its own Box freed in `reset_for_pool`; `dep.path` becomes the
+            // map key, freed when the entry is removed.
+            let owned_text: *mut [u8] =
+                bun_core::heap::into_raw(Box::<[u8]>::from(dep.path.as_ref()));
+            // SAFETY: see `transpile()` — the Box lives until `reset_for_pool`
+            // reconstructs and drops it.
+            let owned_path = bun_paths::fs::Path::init(unsafe { &*owned_text.cast_const() });
+            let job: *mut TranspilerJob = self
+                .store
+                .get_init(TranspilerJob {
+                    non_threadsafe_input_specifier: OwnedString::new(String::empty()),
+                    path: owned_path,
+                    global_this,
+                    non_threadsafe_referrer: OwnedString::new(String::empty()),
+                    vm,
+                    log: bun_ast::Log::init(),
+                    loader: dep.loader,
+                    // No importer waiting — `finish_speculative` stashes the
+                    // result instead of resolving a promise.
+                    promise: StrongOptional::empty(),
+                    poll_ref: KeepAlive::default(),
+                    fetcher: Fetcher::File,
+                    resolved_source,
+                    generation_number,
+                    parse_error: None,
+                    is_speculative: true,
+                    speculative_deps: Vec::new(),
+                    work_task: WorkPoolTask {
+                        node: Default::default(),
+                        callback: TranspilerJob::run_from_worker_thread,
+                    },
+                    next: unbounded_queue::Link::new(),
+                })
+                .as_ptr();
+            bun_core::handle_oom(self.speculative.put(dep.path, Speculation::InFlight));
+            // SAFETY: job fully initialized above
+            unsafe { (*job).schedule() };
+        }
+    }
+}
+
 // ──────────────────────────────────────────────────────────────────────────
 // TranspilerJob
 // ──────────────────────────────────────────────────────────────────────────
@@ -388,6 +608,12 @@ pub struct TranspilerJob {
     /// `into_ffi()`s to C++. Dropped (via `HiveArray::put` → `drop_in_place`)
     /// on any path that skips `run_from_js_thread` derefs them.
     pub resolved_source: OwnedResolvedSource,
+    /// No promise/specifier to resolve; the result is delivered to the
+    /// store's `speculative` map via `finish_speculative`.
+    pub is_speculative: bool,
+    /// Relative-import candidates collected in `run()`; drained on the JS
+    /// thread into `spawn_speculative` (drop glue via `put` otherwise).
+    pub speculative_deps: Vec<SpeculativeDep>,
     pub work_task: WorkPoolTask,
     /// INTRUSIVE — `UnboundedQueue<TranspilerJob>` link.
     pub next: unbounded_queue::Link<TranspilerJob>,
@@ -499,6 +725,11 @@ impl TranspilerJob {
     }
 
     pub(crate) fn run_from_js_thread(&mut self) -> JsResult<()> {
+        if self.is_speculative {
+            self.finish_speculative();
+            return Ok(());
+        }
+
         let vm = self.vm;
         let promise = self.promise.swap();
         // Copy the BackRef out (it is `Copy`) so the borrow of `*self` ends
@@ -530,6 +761,7 @@ impl TranspilerJob {
         };
 
         let parse_error = self.parse_error;
+        let speculative_deps = core::mem::take(&mut self.speculative_deps);
 
         self.promise.deinit();
         self.reset_for_pool();
@@ -542,6 +774,20 @@ impl TranspilerJob {
                 .put(std::ptr::from_mut::<TranspilerJob>(self))
         };
 
+        if !speculative_deps.is_empty() {
+            // SAFETY: JS thread; `vm` outlives the job (BACKREF), and `self`
+            // was recycled above so the store receiver borrow does not alias
+            // a live job — same pattern as the `put` above.
+            unsafe {
+                (*vm).transpiler_store.spawn_speculative(
+                    vm,
+                    global_this,
+                    speculative_deps,
+                    owned_resolved_source.get().tag,
+                )
+            };
+        }
+
         let mut resolved_source = owned_resolved_source.into_ffi();
         AsyncModule::fulfill(
             &global_this,
@@ -554,6 +800,62 @@ impl TranspilerJob {
         )
     }
 
+    /// JS-thread completion for a speculative job: no promise to resolve —
+    /// stash the result in the store's map (or clear the in-flight marker on
+    /// failure) and spawn the next layer of the graph.
+    fn finish_speculative(&mut self) {
+        let vm = self.vm;
+        self.poll_ref.unref(get_vm_ctx(AllocatorType::Js));
+
+        let global_this = self.global_this;
+        let key = Box::<[u8]>::from(self.path.text);
+        let loader = self.loader;
+        let generation_number = self.generation_number;
+        let parse_error = self.parse_error;
+        let log = core::mem::replace(&mut self.log, bun_ast::Log::init());
+        let resolved_source = core::mem::take(&mut self.resolved_source);
+        let deps = core::mem::take(&mut self.speculative_deps);
+        let parent_tag = resolved_source.get().tag;
+
+        self.promise.deinit();
+        self.reset_for_pool();
+
+        // SAFETY: vm outlives the job; transpiler_store.store.put recycles the slot.
+        unsafe {
+            (*vm)
+                .transpiler_store
+                .store
+                .put(std::ptr::from_mut::<TranspilerJob>(self))
+        };
+
+        if parse_error.is_none() {
+            // SAFETY: JS thread; `vm` outlives the job (BACKREF), and `self`
+            // was recycled above — same pattern as the `put` above.
+            unsafe {
+                (*vm).transpiler_store.arrive_speculative(
+                    &key,
+                    SpeculativeResult {
+                        resolved_source,
+                        log,
+                        loader,
+                        generation_number,
+                    },
+                );
+                (*vm)
+                    .transpiler_store
+                    .spawn_speculative(vm, global_this, deps, parent_tag);
+            }
+        } else {
+            // Parse failure or generation mismatch: clear the marker so the
+            // next importer retries through the normal path, which reports
+            // the error against a real promise.
+            // SAFETY: JS thread; see above.
+            unsafe {
+                let _ = (*vm).transpiler_store.speculative.remove(key.as_ref());
+            }
+        }
+    }
+
     pub(crate) fn schedule(&mut self) {
         // Note: the KeepAlive takes an
         // `EventLoopCtx` vtable; resolve it via the `get_vm_ctx` hook (registered by
@@ -971,6 +1273,37 @@ impl TranspilerJob {
                 ptr::null_mut()
             };
 
+            // Bytecode sidecar: on a hit, also hand JSC the serialized
+            // bytecode so the evaluate phase skips parse + codegen. A sidecar
+            // miss of any kind just falls back to the transpiled output.
+            let (bytecode_cache, bytecode_cache_size) = 'bc: {
+                if !JscRuntimeTranspilerCache::bytecode_enabled() {
+                    break 'bc (ptr::null_mut(), 0);
+                }
+                match JscRuntimeTranspilerCache::bytecode_from_file(
+                    cache.input_hash.unwrap(),
+                    cache.features_hash.unwrap(),
+                    entry.metadata.module_type,
+                    path.text,
+                ) {
+                    Ok(bytes) => {
+                        let len = bytes.len();
+                        // Freed by the SourceProvider's bytecode destructor
+                        // (`defaultAllocatorFree`), same as `already_bundled`.
+                        (bun_core::heap::into_raw(bytes).cast::<u8>(), len)
+                    }
+                    Err(err) => {
+                        bun_core::scoped_log!(
+                            RuntimeTranspilerStore,
+                            "bytecode_from_file(\"{}\") = {}",
+                            bstr::BStr::new(path.text),
+                            err.name()
+                        );
+                        break 'bc (ptr::null_mut(), 0);
+                    }
+                }
+            };
+
             self.resolved_source = OwnedResolvedSource::from(ResolvedSource {
                 source_code: match &mut entry.output_code {
                     OutputCode::String(s) => *s,
@@ -982,6 +1315,8 @@ impl TranspilerJob {
                 },
                 is_commonjs_module: entry.metadata.module_type == CacheModuleType::Cjs,
                 module_info,
+                bytecode_cache,
+                bytecode_cache_size,
                 tag: this_tag,
                 ..Default::default()
             });
@@ -1044,6 +1379,13 @@ impl TranspilerJob {
             }
         }
 
+        if speculative_preload_enabled() {
+            self.collect_speculative_deps(
+                parse_result.ast.import_records.as_slice(),
+                &transpiler.options,
+            );
+        }
+
         let source_code_printer = tls_get_or_leak(&SOURCE_CODE_PRINTER, || {
             let writer = BufferWriter::init();
             let mut bp = Box::new(BufferPrinter::init(writer));
@@ -1172,6 +1514,52 @@ impl TranspilerJob {
 
             break 'brk result;
         };
+
+        // Bytecode sidecar: on a miss, compile the printed output to JSC
+        // bytecode and persist it next to the `.pile` entry, so the next cold
+        // start's evaluate phase skips parse + codegen for this module.
+        // `cache.input_hash` is only `Some` when `cache.get()` ran (so the
+        // module is `.pile`-eligible and a `put()` was attempted above).
+        if JscRuntimeTranspilerCache::bytecode_enabled()
+            && cache.input_hash.is_some()
+            && loader.is_java_script_like()
+        {
+            let format = if is_commonjs_module {
+                bun_options_types::Format::Cjs
+            } else {
+                bun_options_types::Format::Esm
+            };
+            // `path.text` is what `run_from_js_thread` late-fills as the
+            // provider's `source_url` (`create_if_different(specifier,
+            // path.text)`), and JSC's SourceCodeKey embeds that origin URL —
+            // generating against any other URL would never match on load.
+            let mut source_provider_url = OwnedString::new(String::clone_utf8(path.text));
+            if let Some(bytecode) = crate::cached_bytecode::generate_cached_bytecode_on_worker(
+                format,
+                source_code.latin1(),
+                &mut source_provider_url,
+            ) {
+                if let Err(err) = JscRuntimeTranspilerCache::bytecode_to_file(
+                    cache.input_hash.unwrap(),
+                    cache.features_hash.unwrap(),
+                    if is_commonjs_module {
+                        CacheModuleType::Cjs
+                    } else {
+                        CacheModuleType::Esm
+                    },
+                    path.text,
+                    &bytecode,
+                ) {
+                    bun_core::scoped_log!(
+                        RuntimeTranspilerStore,
+                        "bytecode_to_file(\"{}\") = {}",
+                        bstr::BStr::new(path.text),
+                        err.name()
+                    );
+                }
+            }
+        }
+
         self.resolved_source = OwnedResolvedSource::from(ResolvedSource {
             source_code,
             is_commonjs_module,
@@ -1190,4 +1578,77 @@ impl TranspilerJob {
         // / AST allocation made by this call. Nothing references them past
         // this point — `source_code` above is a fresh WTF::String copy.
     }
+
+    /// Worker thread. Record this module's relative JS-like imports as
+    /// speculative-transpile candidates. Resolution is deliberately shallow —
+    /// extension probing only, no index files, package exports or
+    /// tsconfig-path remaps — because a miss or wrong guess only forfeits the
+    /// speculation (`take_speculative` re-validates), never correctness.
+    fn collect_speculative_deps(
+        &mut self,
+        import_records: &[ImportRecord],
+        options: &BundleOptions<'_>,
+    ) {
+        let path = self.path;
+        let Some(dir) = bun_paths::dirname(path.text) else {
+            return;
+        };
+        let extension_order = if strings::contains(path.text, b"node_modules") {
+            bundle_options_defaults::node_modules::MODULE_EXTENSION_ORDER
+        } else {
+            bundle_options_defaults::MODULE_EXTENSION_ORDER
+        };
+        let mut joined_buf = bun_paths::path_buffer_pool::get();
+        let mut candidate_buf = bun_paths::path_buffer_pool::get();
+
+        for import_record in import_records {
+            let specifier = import_record.path.text;
+            if !(strings::has_prefix_comptime(specifier, b"./")
+                || strings::has_prefix_comptime(specifier, b"../"))
+                || !import_record.path.namespace.is_empty()
+                || import_record
+                    .flags
+                    .intersects(ImportRecordFlags::IS_INTERNAL | ImportRecordFlags::IS_UNUSED)
+            {
+                continue;
+            }
+
+            let joined = bun_paths::resolve_path::join_string_buf::<
+                bun_paths::resolve_path::platform::Auto,
+            >(&mut joined_buf.0[..], &[dir, specifier]);
+
+            let ext = bun_paths::extension(joined);
+            if !ext.is_empty() {
+                let loader = options.loader(ext);
+                if loader.is_java_script_like() && bun_sys::exists(joined) {
+                    self.speculative_deps.push(SpeculativeDep {
+                        path: Box::from(joined),
+                        loader,
+                    });
+                }
+                continue;
+            }
+
+            for ext in extension_order {
+                let len = joined.len() + ext.len();
+                if len >= candidate_buf.0.len() {
+                    break;
+                }
+                let loader = options.loader(ext);
+                if !loader.is_java_script_like() {
+                    continue;
+                }
+                candidate_buf.0[..joined.len()].copy_from_slice(joined);
+                candidate_buf.0[joined.len()..len].copy_from_slice(ext);
+                let candidate = &candidate_buf.0[..len];
+                if bun_sys::exists(candidate) {
+                    self.speculative_deps.push(SpeculativeDep {
+                        path: Box::from(candidate),
+                        loader,
+                    });
+                    break;
+                }
+            }
+        }
+    }
 }
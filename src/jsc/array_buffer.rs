@@ -96,6 +96,14 @@ unsafe extern "C" {
         ptr: *const c_void,
         len: usize,
     ) -> JSValue;
+    fn Bun__createBufferChunkPool(global: *const JSGlobalObject, len: usize) -> JSValue;
+    fn Bun__createBufferFromChunkPool(
+        global: *const JSGlobalObject,
+        pool: JSValue,
+        offset: usize,
+        ptr: *const c_void,
+        len: usize,
+    ) -> JSValue;
     fn JSArrayBuffer__fromDefaultAllocator(
         global: *const JSGlobalObject,
         ptr: *mut u8,
@@ -326,6 +334,47 @@ impl ArrayBuffer {
         })
     }
 
+    /// Size of the per-VM pool ArrayBuffer backing small socket read chunks.
+    pub const CHUNK_POOL_SIZE: usize = 64 * 1024;
+
+    /// Like [`Self::create_buffer`], but small copies land in a shared per-VM
+    /// pool ArrayBuffer (`RareData::socket_chunk_pool`) and the returned
+    /// Buffer is a view over that region, so one pool allocation amortizes
+    /// many `'data'` events instead of paying one ArrayBuffer each. Regions
+    /// are never reused — a retained chunk pins its (at most 64 KiB) slab,
+    /// the same trade `Buffer.allocUnsafe`'s pool makes. Chunks of half the
+    /// pool size or more get a dedicated buffer.
+    pub fn create_buffer_pooled(global: &JSGlobalObject, bytes: &[u8]) -> JsResult<JSValue> {
+        crate::mark_binding!();
+        if bytes.len() >= Self::CHUNK_POOL_SIZE / 2 {
+            return Self::create_buffer(global, bytes);
+        }
+        // SAFETY: bun_vm() returns the live thread-local VM for a Bun-owned global.
+        let rare = global.bun_vm().as_mut().rare_data();
+        let mut offset = rare.socket_chunk_pool_offset;
+        let pool = match rare.socket_chunk_pool.get() {
+            Some(pool) if offset + bytes.len() <= Self::CHUNK_POOL_SIZE => pool,
+            _ => {
+                // SAFETY: FFI — `global` is a live opaque ZST handle (coerces to *const).
+                let pool = crate::host_fn::from_js_host_call(global, || unsafe {
+                    Bun__createBufferChunkPool(global, Self::CHUNK_POOL_SIZE)
+                })?;
+                rare.socket_chunk_pool = crate::strong::Optional::create(pool, global);
+                offset = 0;
+                pool
+            }
+        };
+        // SAFETY: FFI — `pool` is the live pool JSArrayBuffer kept alive by the
+        // Strong above; `offset + bytes.len()` fits its byteLength (checked in
+        // the match); bytes ptr/len come from a live slice, copied by callee.
+        let view = crate::host_fn::from_js_host_call(global, || unsafe {
+            Bun__createBufferFromChunkPool(global, pool, offset, bytes.as_ptr().cast(), bytes.len())
+        })?;
+        // Keep later chunks 8-byte aligned, like `Buffer.allocUnsafe`'s pool.
+        rare.socket_chunk_pool_offset = (offset + bytes.len() + 7) & !7;
+        Ok(view)
+    }
+
     pub fn create_uint8_array(global: &JSGlobalObject, bytes: &[u8]) -> JsResult<JSValue> {
         crate::mark_binding!();
         // SAFETY: FFI — `global` is a live opaque ZST handle (coerces to *const); bytes ptr/len
@@ -434,6 +483,8 @@ impl ArrayBuffer {
             // TODO: others
         }
 
+        crate::array_buffer_accounting::track(ctx, self.ptr, self.byte_len);
+
         if self.typed_array_type == JSType::ArrayBuffer {
             // SAFETY: this method's contract (see `from_owned_bytes`): the
             // descriptor's `ptr` is the live backing allocation of `byte_len`
@@ -749,6 +800,17 @@ impl BinaryType {
         Ok(None)
     }
 
+    /// [`Self::to_js`], but `Buffer` chunks are carved out of the per-VM
+    /// read-chunk pool ([`ArrayBuffer::create_buffer_pooled`]) instead of
+    /// each getting their own ArrayBuffer. For hot receive paths (socket
+    /// `'data'` events) where `Buffer` is the default binary type.
+    pub fn to_js_pooled(self, bytes: &[u8], global: &JSGlobalObject) -> JsResult<JSValue> {
+        match self {
+            BinaryType::Buffer => ArrayBuffer::create_buffer_pooled(global, bytes),
+            _ => self.to_js(bytes, global),
+        }
+    }
+
     /// This clones bytes
     pub fn to_js(self, bytes: &[u8], global: &JSGlobalObject) -> JsResult<JSValue> {
         match self {
@@ -932,6 +994,7 @@ impl MarkedArrayBuffer {
                 )
             };
         }
+        crate::array_buffer_accounting::track(global, self.buffer.ptr, self.buffer.byte_len);
         // SAFETY: this type's contract: `buffer.ptr` is the live backing
         // allocation of `byte_len` bytes, mimalloc-owned (`from_string`/
         // `from_bytes`); ownership moves to JSC, which frees it exactly once
@@ -953,8 +1016,15 @@ impl MarkedArrayBuffer {
 // Deallocators
 // ──────────────────────────────────────────────────────────────────────────
 
-// `no_mangle` dropped: 0 C++ refs (phase_c_exports.rs mention is a comment).
-pub use bun_alloc::c_thunks::mi_free_bytes as MarkedArrayBuffer_deallocator;
+/// GC finalizer for mimalloc-owned backing stores handed to JSC: forgets the
+/// pointer in the process-wide accounting table
+/// (`crate::array_buffer_accounting`), then frees it.
+pub unsafe extern "C" fn MarkedArrayBuffer_deallocator(bytes: *mut c_void, ctx: *mut c_void) {
+    crate::array_buffer_accounting::untrack(bytes);
+    // SAFETY: forwarded verbatim — `bytes` is the mimalloc allocation this
+    // deallocator was installed with.
+    unsafe { bun_alloc::c_thunks::mi_free_bytes(bytes, ctx) };
+}
 
 // LAYERING: `BlobArrayBuffer_deallocator` releases a
 // `Blob::Store` ref. `Store` is a `bun_runtime` type, so the `#[no_mangle]`
@@ -0,0 +1,147 @@
+//! Process-wide accounting for mimalloc-backed `ArrayBuffer` backing stores.
+//!
+//! Backing stores handed to JSC through `ArrayBuffer::to_js` and friends are
+//! invisible to heap-snapshot attribution: the snapshot sees a small wrapper
+//! cell while the bytes live off-heap in mimalloc. Every such hand-off is
+//! registered here and unregistered by the shared GC finalizer
+//! (`MarkedArrayBuffer_deallocator` in array_buffer.rs). Allocations at or
+//! above [`SAMPLE_SIZE_THRESHOLD`] additionally capture their top JS frames
+//! every [`SAMPLE_INTERVAL`]-th time, so sustained off-heap growth can be
+//! attributed to an allocation site. Queried from JS as
+//! `Bun.memory.arrayBuffers()`.
+
+use core::ffi::c_void;
+use core::fmt::Write as _;
+use core::sync::atomic::{AtomicU64, Ordering};
+use std::collections::HashMap;
+use std::sync::Arc;
+
+use bun_threading::Guarded;
+
+use crate::{JSGlobalObject, ZigStackFrame, ZigStackTrace};
+
+/// Capture a JS allocation site on every Nth eligible allocation. Stack
+/// capture walks JSC frames and formats a label, so it is sampled rather than
+/// paid on every buffer.
+const SAMPLE_INTERVAL: u64 = 64;
+/// Allocations below this size are counted in the totals but never sampled.
+const SAMPLE_SIZE_THRESHOLD: usize = 16 * 1024;
+/// Frames kept per sampled site — enough to see through a wrapper layer or
+/// two without formatting whole stacks.
+const MAX_SITE_FRAMES: usize = 4;
+
+struct Entry {
+    size: usize,
+    /// `None` when this allocation was not sampled.
+    site: Option<Arc<str>>,
+}
+
+static LIVE: Guarded<Option<HashMap<usize, Entry>>> = Guarded::new(None);
+static ELIGIBLE: AtomicU64 = AtomicU64::new(0);
+
+unsafe extern "C" {
+    /// `ZigException.cpp` — walks the current VM's stack into `trace`
+    /// (positions only, no source lines).
+    fn Bun__captureCurrentStackTrace(
+        global: &JSGlobalObject,
+        trace: *mut ZigStackTrace,
+        frames_to_skip: usize,
+    );
+}
+
+fn capture_site(global: &JSGlobalObject) -> Option<Arc<str>> {
+    let mut frames = [ZigStackFrame::ZERO; MAX_SITE_FRAMES];
+    let mut trace = ZigStackTrace::from_frames(&mut frames);
+    // SAFETY: FFI — `global` is a live handle on its JS thread; `trace`'s
+    // frame buffer outlives the call.
+    unsafe { Bun__captureCurrentStackTrace(global, &mut trace, 1) };
+
+    let mut label = String::new();
+    for frame in trace.frames_mutable() {
+        if !frame.source_url.is_empty() {
+            if !label.is_empty() {
+                label.push_str(" < ");
+            }
+            let url = frame.source_url.to_utf8();
+            label.push_str(&String::from_utf8_lossy(url.slice()));
+            if frame.position.line.is_valid() {
+                let _ = write!(label, ":{}", frame.position.line.one_based());
+                if frame.position.column.is_valid() {
+                    let _ = write!(label, ":{}", frame.position.column.one_based());
+                }
+            }
+        }
+        frame.deinit();
+    }
+
+    if label.is_empty() {
+        None
+    } else {
+        Some(Arc::from(label.into_boxed_str()))
+    }
+}
+
+/// Registers a backing store that was just handed to JSC. Runs on the JS
+/// thread (the only place the `to_js` family runs), which is what makes the
+/// stack capture sound.
+pub fn track(global: &JSGlobalObject, ptr: *const u8, size: usize) {
+    if ptr.is_null() || size == 0 {
+        return;
+    }
+    let site = if size >= SAMPLE_SIZE_THRESHOLD
+        && ELIGIBLE
+            .fetch_add(1, Ordering::Relaxed)
+            .is_multiple_of(SAMPLE_INTERVAL)
+    {
+        capture_site(global)
+    } else {
+        None
+    };
+    LIVE.lock()
+        .get_or_insert_with(HashMap::new)
+        .insert(ptr as usize, Entry { size, site });
+}
+
+/// Forgets a backing store; called by the GC finalizer just before the bytes
+/// are freed. Misses are expected — only hand-offs that install
+/// `MarkedArrayBuffer_deallocator` register.
+pub fn untrack(ptr: *mut c_void) {
+    if ptr.is_null() {
+        return;
+    }
+    if let Some(live) = LIVE.lock().as_mut() {
+        live.remove(&(ptr as usize));
+    }
+}
+
+/// One row of `Bun.memory.arrayBuffers()`.
+pub struct SiteTotal {
+    /// Formatted allocation site, or `None` for the aggregate of unsampled
+    /// allocations.
+    pub site: Option<Arc<str>>,
+    pub count: usize,
+    pub bytes: usize,
+}
+
+/// Live tracked backing stores aggregated per sampled site, largest first.
+pub fn site_totals() -> Vec<SiteTotal> {
+    let live = LIVE.lock();
+    let Some(live) = live.as_ref() else {
+        return Vec::new();
+    };
+    let mut by_site: HashMap<Option<&str>, SiteTotal> = HashMap::new();
+    for entry in live.values() {
+        let total = by_site
+            .entry(entry.site.as_deref())
+            .or_insert_with(|| SiteTotal {
+                site: entry.site.clone(),
+                count: 0,
+                bytes: 0,
+            });
+        total.count += 1;
+        total.bytes += entry.size;
+    }
+    let mut totals: Vec<SiteTotal> = by_site.into_values().collect();
+    totals.sort_unstable_by(|a, b| b.bytes.cmp(&a.bytes));
+    totals
+}
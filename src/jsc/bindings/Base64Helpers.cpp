@@ -16,20 +16,26 @@ ExceptionOr<String> atob(const String& encodedString)
         return String();
 
     if (!encodedString.is8Bit()) {
+        // simdutf decodes base64 straight from UTF-16 — no intermediate
+        // Latin-1 copy. Any unit outside the alphabet (including all
+        // code units > 0xFF) fails the decode, which matches the
+        // InvalidCharacterError the old convert-then-recurse path threw.
         const auto span = encodedString.span16();
-        size_t expected_length = simdutf::latin1_length_from_utf16(span.size());
+        size_t result_length = simdutf::maximal_binary_length_from_base64(span.data(), span.size());
         std::span<Latin1Character> ptr;
-        WTF::String convertedString = WTF::String::tryCreateUninitialized(expected_length, ptr);
-        if (convertedString.isNull()) [[unlikely]] {
+        WTF::String outString = WTF::String::tryCreateUninitialized(result_length, ptr);
+        if (outString.isNull()) [[unlikely]] {
             return WebCore::Exception { OutOfMemoryError };
         }
-
-        auto result = simdutf::convert_utf16le_to_latin1_with_errors(span.data(), span.size(), reinterpret_cast<char*>(ptr.data()));
-
-        if (result.error) {
+        auto result = simdutf::base64_to_binary(span.data(), span.size(), reinterpret_cast<char*>(ptr.data()), simdutf::base64_default);
+        if (result.error != simdutf::error_code::SUCCESS) {
             return WebCore::Exception { InvalidCharacterError };
         }
-        return atob(convertedString);
+        if (result.count != result_length) {
+            return outString.substringSharingImpl(0, result.count);
+        }
+
+        return outString;
     }
 
     const auto span = encodedString.span8();
@@ -36,8 +36,10 @@
     macro(hash) \
     macro(inspect) \
     macro(isStandaloneExecutable) \
+    macro(memory) \
     macro(origin) \
     macro(s3) \
+    macro(scheduler) \
     macro(semver) \
     macro(unsafe) \
     macro(valkey) \
@@ -31,6 +31,7 @@
 #include "DOMJITIDLConvert.h"
 #include "DOMJITIDLType.h"
 #include "DOMJITIDLTypeFilter.h"
+#include <JavaScriptCore/DOMJITAbstractHeap.h>
 #include "Exception.h"
 #include "JSDOMException.h"
 #include "JSDOMConvert.h"
@@ -86,6 +87,7 @@ namespace Bun {
 JSC_DECLARE_HOST_FUNCTION(jsFunctionBunStripANSI);
 JSC_DECLARE_HOST_FUNCTION(jsFunctionBunWrapAnsi);
 JSC_DECLARE_HOST_FUNCTION(jsFunctionBunStringWidth);
+JSC::JSValue constructBunStringWidthFunction(JSC::VM&, JSC::JSObject* bunObject);
 }
 
 using namespace JSC;
@@ -102,6 +104,7 @@ static JSValue BunObject_lazyPropCb_wrap_ArrayBufferSink(VM& vm, JSObject* bunOb
 
 static JSValue constructCookieObject(VM& vm, JSObject* bunObject);
 static JSValue constructCookieMapObject(VM& vm, JSObject* bunObject);
+static JSValue constructNanosecondsFunction(VM& vm, JSObject* bunObject);
 static JSValue constructSecretsObject(VM& vm, JSObject* bunObject);
 static JSValue constructWebViewObject(VM& vm, JSObject* bunObject);
 
@@ -644,6 +647,12 @@ static JSValue constructJSONLObject(VM& vm, JSObject* bunObject)
     return jsonlObject;
 }
 
+static JSValue constructBunLinesFunction(VM& vm, JSObject* bunObject)
+{
+    JSGlobalObject* globalObject = bunObject->globalObject();
+    return JSFunction::create(vm, globalObject, linesLinesCodeGenerator(vm), globalObject->globalScope());
+}
+
 static JSValue constructBunPeekObject(VM& vm, JSObject* bunObject)
 {
     JSGlobalObject* globalObject = bunObject->globalObject();
@@ -748,10 +757,32 @@ JSC_DEFINE_HOST_FUNCTION(functionBunDeepMatch, (JSGlobalObject * globalObject, J
     return JSValue::encode(jsBoolean(match));
 }
 
+extern "C" {
+static JSC_DECLARE_JIT_OPERATION_WITHOUT_WTF_INTERNAL(functionBunNanosecondsWithoutTypeCheck, JSC::EncodedJSValue, (JSC::JSGlobalObject*, JSC::JSObject*));
+}
+
+static inline JSC::EncodedJSValue functionBunNanosecondsBody(JSGlobalObject* globalObject)
+{
+    double time = static_cast<double>(Bun__readOriginTimer(bunVM(globalObject)));
+    // Must be EncodeAsDouble because the DOMJIT signature has SpecDoubleReal
+    // (same constraint as performance.now, see oven-sh/bun#5604).
+    return JSValue::encode(jsDoubleNumber(time));
+}
+
 JSC_DEFINE_HOST_FUNCTION(functionBunNanoseconds, (JSGlobalObject * globalObject, JSC::CallFrame* callFrame))
 {
-    uint64_t time = Bun__readOriginTimer(bunVM(globalObject));
-    return JSValue::encode(jsNumber(time));
+    return functionBunNanosecondsBody(globalObject);
+}
+
+JSC_DEFINE_JIT_OPERATION(functionBunNanosecondsWithoutTypeCheck, JSC::EncodedJSValue, (JSC::JSGlobalObject * lexicalGlobalObject, JSC::JSObject* castedThis))
+{
+    auto& vm = JSC::getVM(lexicalGlobalObject);
+    IGNORE_WARNINGS_BEGIN("frame-address")
+    CallFrame* callFrame = DECLARE_CALL_FRAME(vm);
+    IGNORE_WARNINGS_END
+    JSC::JITOperationPrologueCallFrameTracer tracer(vm, callFrame);
+    UNUSED_PARAM(castedThis);
+    return { functionBunNanosecondsBody(lexicalGlobalObject) };
 }
 
 JSC_DEFINE_HOST_FUNCTION(functionPathToFileURL, (JSC::JSGlobalObject * lexicalGlobalObject, JSC::CallFrame* callFrame))
@@ -979,11 +1010,13 @@ JSC_DEFINE_HOST_FUNCTION(functionFileURLToPath, (JSC::JSGlobalObject * globalObj
     isMainThread                                   constructIsMainThread                                               ReadOnly|DontDelete|PropertyCallback
     isStandaloneExecutable                         BunObject_lazyPropCb_wrap_isStandaloneExecutable                    ReadOnly|DontDelete|PropertyCallback
     jest                                           BunObject_callback_jest                                             DontEnum|DontDelete|Function 1
+    lines                                          constructBunLinesFunction                                           DontDelete|PropertyCallback
     listen                                         BunObject_callback_listen                                           DontDelete|Function 1
     udpSocket                                      BunObject_callback_udpSocket                                        DontDelete|Function 1
     main                                           bunObjectMain                                                       DontDelete|CustomAccessor
+    memory                                         BunObject_lazyPropCb_wrap_memory                                    DontDelete|PropertyCallback
     mmap                                           BunObject_callback_mmap                                             DontDelete|Function 1
-    nanoseconds                                    functionBunNanoseconds                                              DontDelete|Function 0
+    nanoseconds                                    constructNanosecondsFunction                                        DontDelete|PropertyCallback
     openInEditor                                   BunObject_callback_openInEditor                                     DontDelete|Function 1
     origin                                         BunObject_lazyPropCb_wrap_origin                                    DontEnum|ReadOnly|DontDelete|PropertyCallback
     version_with_sha                               constructBunVersionWithSha                                          DontEnum|ReadOnly|DontDelete|PropertyCallback
@@ -1004,6 +1037,7 @@ JSC_DEFINE_HOST_FUNCTION(functionFileURLToPath, (JSC::JSGlobalObject * globalObj
     resolve                                        BunObject_callback_resolve                                          DontDelete|Function 1
     resolveSync                                    BunObject_callback_resolveSync                                      DontDelete|Function 1
     revision                                       constructBunRevision                                                ReadOnly|DontDelete|PropertyCallback
+    scheduler                                      BunObject_lazyPropCb_wrap_scheduler                                 DontDelete|PropertyCallback
     semver                                         BunObject_lazyPropCb_wrap_semver                                    ReadOnly|DontDelete|PropertyCallback
     sql                                            defaultBunSQLObject                                                 DontDelete|PropertyCallback
     postgres                                       defaultBunSQLObject                                                 DontDelete|PropertyCallback
@@ -1019,7 +1053,7 @@ JSC_DEFINE_HOST_FUNCTION(functionFileURLToPath, (JSC::JSGlobalObject * globalObj
     stderr                                         BunObject_lazyPropCb_wrap_stderr                                    DontDelete|PropertyCallback
     stdin                                          BunObject_lazyPropCb_wrap_stdin                                     DontDelete|PropertyCallback
     stdout                                         BunObject_lazyPropCb_wrap_stdout                                    DontDelete|PropertyCallback
-    stringWidth                                    jsFunctionBunStringWidth                                            DontDelete|Function 2
+    stringWidth                                    constructBunStringWidthFunction                                     DontDelete|PropertyCallback
     stripANSI                                      jsFunctionBunStripANSI                                              DontDelete|Function 1
     wrapAnsi                                       jsFunctionBunWrapAnsi                                               DontDelete|Function 3
     Terminal                                       BunObject_lazyPropCb_wrap_Terminal                                  DontDelete|PropertyCallback
@@ -1124,6 +1158,27 @@ static JSValue constructCookieObject(VM& vm, JSObject* bunObject)
     return WebCore::JSCookie::getConstructor(vm, zigGlobalObject);
 }
 
+// Lazily built so the JSFunction can carry a DOMJIT signature (the static
+// hash table only supports plain host functions). The DFG/FTL then inline
+// Bun.nanoseconds() to a direct clock read with no call frame or allocation,
+// the same treatment performance.now() gets in JSPerformance.cpp.
+static JSValue constructNanosecondsFunction(VM& vm, JSObject* bunObject)
+{
+    static const JSC::DOMJIT::Signature DOMJITSignatureForBunNanoseconds(
+        functionBunNanosecondsWithoutTypeCheck,
+        JSBunObject::info(),
+        JSC::DOMJIT::Effect::forWriteKinds(DFG::AbstractHeapKind::SideState),
+        SpecDoubleReal);
+
+    return JSFunction::create(
+        vm,
+        bunObject->globalObject(),
+        0,
+        String("nanoseconds"_s),
+        functionBunNanoseconds, ImplementationVisibility::Public, NoIntrinsic, callHostFunctionAsConstructor,
+        &DOMJITSignatureForBunNanoseconds);
+}
+
 static JSValue constructCookieMapObject(VM& vm, JSObject* bunObject)
 {
     auto* zigGlobalObject = uncheckedDowncast<Zig::GlobalObject>(bunObject->globalObject());
@@ -99,6 +99,12 @@ extern "C" [[ZIG_EXPORT(zero_is_throw)]] JSC::EncodedJSValue BunString__createUT
         return JSValue::encode(jsEmptyString(vm));
     }
     if (simdutf::validate_ascii(ptr, length)) {
+        if (length == 1) {
+            // The VM caches every single-character string < 0x100 — no
+            // StringImpl allocation for the delimiters and one-letter
+            // segments that cross the boundary constantly.
+            return JSValue::encode(jsSingleCharacterString(vm, static_cast<char16_t>(static_cast<unsigned char>(*ptr))));
+        }
         return JSValue::encode(jsString(vm, WTF::String(std::span<const Latin1Character>(reinterpret_cast<const Latin1Character*>(ptr), length))));
     }
 
@@ -223,13 +229,19 @@ extern "C" [[ZIG_EXPORT(nothrow)]] void BunString__toThreadSafe(BunString* str)
 {
     if (str->tag == BunStringTag::WTFStringImpl) {
         auto* existing = str->impl.wtf;
-        // StringImpl::isolatedCopy() always returns a freshly-allocated impl,
-        // so when we replace the pointer we must release the ref we were
-        // holding to the original; otherwise every call leaks one ref.
-        auto impl = existing->isolatedCopy();
-        if (impl.ptr() != existing) {
-            str->impl.wtf = &impl.leakRef();
+        // Long plain impls qualify for in-place sharing (pre-hashed,
+        // never-atomize) and keep a single refcounted allocation across
+        // threads; everything else — atoms, symbols, substrings, short
+        // strings — still gets an isolated copy. See toCrossThreadShareable
+        // below for the rules.
+        Ref<WTF::StringImpl> shared = Bun::toCrossThreadShareable(Ref { *existing });
+        if (shared.ptr() != existing) {
+            str->impl.wtf = &shared.leakRef();
             existing->deref();
+        } else {
+            // Same impl came back: drop the extra ref the Ref{} above took so
+            // `str` goes on holding exactly one.
+            shared.leakRef().deref();
         }
     }
 }
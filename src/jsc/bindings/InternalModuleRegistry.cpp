@@ -178,6 +178,30 @@ JSValue InternalModuleRegistry::requireId(JSGlobalObject* globalObject, VM& vm,
     return value;
 }
 
+extern "C" void* Bun__PerfTrace__internalModuleStart();
+extern "C" void Bun__PerfTrace__internalModuleEnd(void* ctx, const char* name);
+
+// Brackets one builtin's first materialization for the startup-phase perf
+// trace (src/perf). Start returns null when tracing is disabled, so the
+// common path pays two calls and a null check.
+class InternalModuleInitTracer {
+public:
+    ALWAYS_INLINE InternalModuleInitTracer(const char* name)
+        : m_ctx(Bun__PerfTrace__internalModuleStart())
+        , m_name(name)
+    {
+    }
+    ALWAYS_INLINE ~InternalModuleInitTracer()
+    {
+        if (m_ctx) [[unlikely]]
+            Bun__PerfTrace__internalModuleEnd(m_ctx, m_name);
+    }
+
+private:
+    void* m_ctx;
+    const char* m_name;
+};
+
 #include "InternalModuleRegistry+createInternalModuleById.h"
 
 // This is called like @getInternalField(@internalModuleRegistry, 1) ?? @createInternalModuleById(1)
@@ -2386,6 +2386,11 @@ static JSC::EncodedJSValue jsBufferPrototypeFunction_SliceWithEncoding(JSC::JSGl
 }
 
 // DOMJIT makes it slower! TODO: investigate why
+// This also applies to the fixed-width read/write family (readUInt32LE &
+// friends): those are JS builtins over a cached DataView
+// (JSBufferPrototype.ts) and the DataView intrinsics already inline to
+// bounds-checked loads/stores in DFG/FTL, which beats a DOMJIT call into
+// C++ for 1-8 byte accesses.
 // JSC_DECLARE_JIT_OPERATION_WITHOUT_WTF_INTERNAL(jsBufferPrototypeToStringWithoutTypeChecks, JSValue, (JSC::JSGlobalObject * lexicalGlobalObject, JSC::JSUint8Array* thisValue, JSC::JSString* encodingValue));
 
 // JSC_DEFINE_JIT_OPERATION(jsBufferPrototypeToStringWithoutTypeChecks, JSValue, (JSC::JSGlobalObject * lexicalGlobalObject, JSUint8Array* thisValue, JSString* encodingValue))
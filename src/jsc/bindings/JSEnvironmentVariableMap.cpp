@@ -246,7 +246,11 @@ JSC_DEFINE_CUSTOM_GETTER(jsNodeTLSRejectUnauthorizedGetter, (JSGlobalObject * gl
         return JSValue::encode(jsUndefined());
     }
 
-    return JSValue::encode(jsString(vm, Zig::toStringCopy(value)));
+    // Cache under the private name like the TZ getter; the env map entry only
+    // changes through the setter, which overwrites this.
+    JSValue out = jsString(vm, Zig::toStringCopy(value));
+    thisObject->putDirect(vm, privateName, out, 0);
+    return JSValue::encode(out);
 }
 
 JSC_DEFINE_CUSTOM_SETTER(jsNodeTLSRejectUnauthorizedSetter, (JSGlobalObject * globalObject, JSC::EncodedJSValue thisValue, JSC::EncodedJSValue value, PropertyName propertyName))
@@ -294,7 +298,11 @@ JSC_DEFINE_CUSTOM_GETTER(jsBunConfigVerboseFetchGetter, (JSGlobalObject * global
         return JSValue::encode(jsUndefined());
     }
 
-    return JSValue::encode(jsString(vm, Zig::toStringCopy(value)));
+    // Cache under the private name like the TZ getter; the env map entry only
+    // changes through the setter, which overwrites this.
+    JSValue out = jsString(vm, Zig::toStringCopy(value));
+    thisObject->putDirect(vm, privateName, out, 0);
+    return JSValue::encode(out);
 }
 
 JSC_DEFINE_CUSTOM_SETTER(jsBunConfigVerboseFetchSetter, (JSGlobalObject * globalObject, JSC::EncodedJSValue thisValue, JSC::EncodedJSValue value, PropertyName propertyName))
@@ -73,6 +73,21 @@ static JSNodePerformanceHooksHistogram* createHistogramInternal(JSGlobalObject*
     return JSNodePerformanceHooksHistogram::create(vm, structure, globalObject, lowest, highest, figures);
 }
 
+// Creation path for native code that owns a histogram without going through
+// JS arguments (e.g. `server.metrics()`). Returns an empty value with a
+// pending exception on failure.
+extern "C" JSC::EncodedJSValue JSNodePerformanceHooksHistogram_create(JSGlobalObject* globalObject, int64_t lowest, int64_t highest, int32_t figures)
+{
+    VM& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    auto* zigGlobalObject = defaultGlobalObject(globalObject);
+    Structure* structure = zigGlobalObject->m_JSNodePerformanceHooksHistogramClassStructure.get(zigGlobalObject);
+    RETURN_IF_EXCEPTION(scope, {});
+
+    return JSValue::encode(JSNodePerformanceHooksHistogram::create(vm, structure, globalObject, lowest, highest, figures));
+}
+
 JSC_DEFINE_HOST_FUNCTION(jsNodePerformanceHooksHistogramConstructorCall, (JSGlobalObject * globalObject, CallFrame* callFrame))
 {
     auto scope = DECLARE_THROW_SCOPE(globalObject->vm());
@@ -80,6 +80,49 @@ static ALWAYS_INLINE JSString* encodingToString(const uint8_t* input, size_t len
     return asString(JSValue::decode(encoded));
 }
 
+// Decodes the single completed UTF-8 sequence in `bytes` (2-4 bytes) without
+// the generic encoding round-trip. Returns nullptr when the sequence is not
+// strictly valid (bad continuation, overlong, surrogate, out of range) so the
+// caller falls back to the generic decoder's replacement-character behavior.
+static JSString* tryDecodeSingleUTF8Char(JSC::VM& vm, const uint8_t* bytes, uint32_t length)
+{
+    uint32_t codePoint;
+    switch (length) {
+    case 2:
+        if (!isContinuation(bytes[1]))
+            return nullptr;
+        codePoint = ((bytes[0] & 0x1F) << 6) | (bytes[1] & 0x3F);
+        if (codePoint < 0x80)
+            return nullptr;
+        break;
+    case 3:
+        if (!isContinuation(bytes[1]) || !isContinuation(bytes[2]))
+            return nullptr;
+        codePoint = ((bytes[0] & 0x0F) << 12) | ((bytes[1] & 0x3F) << 6) | (bytes[2] & 0x3F);
+        if (codePoint < 0x800 || (codePoint >= 0xD800 && codePoint <= 0xDFFF))
+            return nullptr;
+        break;
+    case 4:
+        if (!isContinuation(bytes[1]) || !isContinuation(bytes[2]) || !isContinuation(bytes[3]))
+            return nullptr;
+        codePoint = ((bytes[0] & 0x07) << 18) | ((bytes[1] & 0x3F) << 12) | ((bytes[2] & 0x3F) << 6) | (bytes[3] & 0x3F);
+        if (codePoint < 0x10000 || codePoint > 0x10FFFF)
+            return nullptr;
+        break;
+    default:
+        return nullptr;
+    }
+
+    if (codePoint < 0x10000)
+        return JSC::jsSingleCharacterString(vm, static_cast<char16_t>(codePoint));
+
+    const char16_t units[2] = {
+        static_cast<char16_t>(0xD800 + ((codePoint - 0x10000) >> 10)),
+        static_cast<char16_t>(0xDC00 + (codePoint & 0x3FF)),
+    };
+    return JSC::jsString(vm, WTF::String(std::span<const char16_t> { units, 2 }));
+}
+
 static inline JSStringDecoder* jsStringDecoderCast(JSGlobalObject* globalObject, JSValue stringDecoderValue, WTF::ASCIILiteral functionName)
 {
     ASSERT(stringDecoderValue);
@@ -182,6 +225,13 @@ JSC::JSString* JSStringDecoder::fillLast(JSC::VM& vm, JSC::JSGlobalObject* globa
     }
     if (m_lastNeed <= length) {
         memmove(m_lastChar + m_lastTotal - m_lastNeed, bufPtr, m_lastNeed);
+        if (m_encoding == BufferEncodingType::utf8) {
+            // The common straddle case is a single valid multi-byte character
+            // completing across chunks; decode it inline instead of paying the
+            // generic encoding round-trip for <= 4 bytes.
+            if (JSString* str = tryDecodeSingleUTF8Char(vm, m_lastChar, m_lastTotal))
+                RELEASE_AND_RETURN(throwScope, str);
+        }
         RELEASE_AND_RETURN(throwScope, encodingToString(m_lastChar, m_lastTotal, globalObject, m_encoding));
     }
 
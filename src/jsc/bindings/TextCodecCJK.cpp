@@ -217,14 +217,63 @@ String TextCodecCJK::decodeCommon(std::span<const uint8_t> bytes, bool flush, bo
     return result.toString();
 }
 
+// Decode is a dense pointer -> code point lookup, so a direct-index table
+// beats the per-character binary search over the sorted pairs in the
+// double-byte hot loop. Allocated at runtime for the same binary-size reason
+// as the encode indexes. U+0000 is not a mapping target in any of these
+// indexes, so it marks absent entries; where an index repeats a pointer the
+// first entry wins, matching findFirstInSortedPairs.
+template<typename SortedPairs> static auto makeDirectDecodeTable(const SortedPairs& index)
+{
+    using CharType = std::remove_const_t<decltype(std::begin(index)->second)>;
+    size_t size = std::rbegin(index)->first + 1;
+    auto* table = new CharType[size]();
+    for (auto& pair : index) {
+        if (!table[pair.first])
+            table[pair.first] = pair.second;
+    }
+    return std::span<const CharType> { table, size };
+}
+
+template<typename CharType> static std::optional<CharType> findInDirectDecodeTable(std::span<const CharType> table, uint16_t pointer)
+{
+    if (pointer >= table.size())
+        return std::nullopt;
+    if (CharType codePoint = table[pointer])
+        return codePoint;
+    return std::nullopt;
+}
+
 static std::optional<char16_t> codePointJIS0208(uint16_t pointer)
 {
-    return findFirstInSortedPairs(jis0208(), pointer);
+    static std::span<const char16_t> table;
+    static std::once_flag once;
+    std::call_once(once, [&] { table = makeDirectDecodeTable(jis0208()); });
+    return findInDirectDecodeTable(table, pointer);
 }
 
 static std::optional<char16_t> codePointJIS0212(uint16_t pointer)
 {
-    return findFirstInSortedPairs(jis0212(), pointer);
+    static std::span<const char16_t> table;
+    static std::once_flag once;
+    std::call_once(once, [&] { table = makeDirectDecodeTable(jis0212()); });
+    return findInDirectDecodeTable(table, pointer);
+}
+
+static std::optional<char16_t> codePointEUCKR(uint16_t pointer)
+{
+    static std::span<const char16_t> table;
+    static std::once_flag once;
+    std::call_once(once, [&] { table = makeDirectDecodeTable(eucKR()); });
+    return findInDirectDecodeTable(table, pointer);
+}
+
+static std::optional<char32_t> codePointBig5(uint16_t pointer)
+{
+    static std::span<const char32_t> table;
+    static std::once_flag once;
+    std::call_once(once, [&] { table = makeDirectDecodeTable(big5()); });
+    return findInDirectDecodeTable(table, pointer);
 }
 
 // https://encoding.spec.whatwg.org/#euc-jp-decoder
@@ -754,7 +803,7 @@ String TextCodecCJK::eucKRDecode(std::span<const uint8_t> bytes, bool flush, boo
     return decodeCommon(bytes, flush, stopOnError, sawError, [this](uint8_t byte, StringBuilder& result) {
         if (uint8_t lead = std::exchange(m_lead, 0x00)) {
             if (byte >= 0x41 && byte <= 0xFE) {
-                if (auto codePoint = findFirstInSortedPairs(eucKR(), (lead - 0x81) * 190 + byte - 0x41)) {
+                if (auto codePoint = codePointEUCKR((lead - 0x81) * 190 + byte - 0x41)) {
                     result.append(*codePoint);
                     return SawError::No;
                 }
@@ -1169,7 +1218,7 @@ String TextCodecCJK::big5Decode(std::span<const uint8_t> bytes, bool flush, bool
                 else if (pointer == 1166)
                     result.append(u'\u00EA', u'\u030C');
                 else {
-                    if (auto codePoint = findFirstInSortedPairs(big5(), pointer))
+                    if (auto codePoint = codePointBig5(pointer))
                         result.append(*codePoint);
                     else {
                         // https://encoding.spec.whatwg.org/#big5-decoder step 3.6:
@@ -831,6 +831,16 @@ extern "C" void JSC__Exception__getStackTrace(JSC::Exception* arg0, JSC::JSGloba
     populateStackTrace(arg0->vm(), arg0->stack(), *trace, global, PopulateStackTraceFlags::OnlyPosition);
 }
 
+// Walks the current VM stack (no Exception required) into `trace`, positions
+// only. Used by the Rust-side ArrayBuffer allocation-site accounting.
+extern "C" void Bun__captureCurrentStackTrace(JSC::JSGlobalObject* global, ZigStackTrace* trace, size_t framesToSkip)
+{
+    auto& vm = global->vm();
+    WTF::Vector<JSC::StackFrame> stackFrames;
+    vm.interpreter.getStackTrace(global, stackFrames, framesToSkip, trace->frames_cap);
+    populateStackTrace(vm, stackFrames, *trace, global, PopulateStackTraceFlags::OnlyPosition);
+}
+
 extern "C" [[ZIG_EXPORT(check_slow)]] void JSC__JSValue__toZigException(JSC::EncodedJSValue jsException, JSC::JSGlobalObject* global, ZigException* exception)
 {
     JSC::JSValue value = JSC::JSValue::decode(jsException);
@@ -1498,6 +1498,35 @@ extern "C" JSC::EncodedJSValue Bun__createUint8ArrayForCopy(JSC::JSGlobalObject*
     RELEASE_AND_RETURN(scope, JSValue::encode(array));
 }
 
+extern "C" JSC::EncodedJSValue Bun__createBufferChunkPool(JSC::JSGlobalObject* globalObject, size_t len)
+{
+    auto& vm = JSC::getVM(globalObject);
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    auto arrayBuffer = JSC::ArrayBuffer::tryCreateUninitialized(len, 1);
+    if (!arrayBuffer) [[unlikely]] {
+        JSC::throwOutOfMemoryError(globalObject, scope);
+        return {};
+    }
+
+    RELEASE_AND_RETURN(scope, JSValue::encode(JSC::JSArrayBuffer::create(vm, globalObject->arrayBufferStructure(JSC::ArrayBufferSharingMode::Default), WTF::move(arrayBuffer))));
+}
+
+extern "C" JSC::EncodedJSValue Bun__createBufferFromChunkPool(JSC::JSGlobalObject* globalObject, JSC::EncodedJSValue poolValue, size_t offset, const void* ptr, size_t len)
+{
+    auto& vm = JSC::getVM(globalObject);
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    auto* jsPool = JSC::jsCast<JSC::JSArrayBuffer*>(JSC::JSValue::decode(poolValue));
+    RefPtr<JSC::ArrayBuffer> buffer = jsPool->impl();
+    ASSERT(offset + len <= buffer->byteLength());
+    if (len > 0 && ptr != nullptr)
+        memcpy(static_cast<uint8_t*>(buffer->data()) + offset, ptr, len);
+
+    auto* subclassStructure = static_cast<Zig::GlobalObject*>(globalObject)->JSBufferSubclassStructure();
+    RELEASE_AND_RETURN(scope, JSValue::encode(JSC::JSUint8Array::create(globalObject, subclassStructure, WTF::move(buffer), offset, len)));
+}
+
 extern "C" JSC::EncodedJSValue Bun__makeArrayBufferWithBytesNoCopy(JSC::JSGlobalObject* globalObject, const void* ptr, size_t len, JSTypedArrayBytesDeallocator deallocator, void* deallocatorContext)
 {
     auto& vm = JSC::getVM(globalObject);
@@ -3275,6 +3304,20 @@ extern "C" uint8_t JSC__JSGlobalObject__drainMicrotasks(Zig::GlobalObject* globa
     return globalObject->drainMicrotasks();
 }
 
+// Probe backing the event loop's empty-checkpoint fast path: lets the Rust
+// side skip the drainMicrotasks() round trip when the last callback queued no
+// nextTick/microtask work. Deliberately per-global — the node:vm paths that
+// evaluate in other globals drain those explicitly
+// (drainMicrotasksForGlobalObject / drainOwnMicrotasks).
+extern "C" bool JSC__JSGlobalObject__hasPendingMicrotasks(Zig::GlobalObject* globalObject)
+{
+    if (auto* nextTickQueue = globalObject->m_nextTickQueue.get()) {
+        if (!nextTickQueue->isEmpty())
+            return true;
+    }
+    return !globalObject->microtaskQueue().isEmpty();
+}
+
 extern "C" EncodedJSValue JSC__JSGlobalObject__getHTTP2CommonString(Zig::GlobalObject* globalObject, uint32_t hpack_index)
 {
     auto value = globalObject->http2CommonStrings().getStringFromHPackIndex(hpack_index, globalObject);
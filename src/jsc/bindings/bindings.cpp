@@ -653,8 +653,49 @@ JSValue getIndexWithoutAccessors(JSGlobalObject* globalObject, JSObject* obj, ui
     return JSValue();
 }
 
+namespace {
+// Caches the comparison plan for a hidden class: the offsets of its enumerable,
+// non-private own properties in property-table order. A deep comparison of a
+// large fixture re-encounters the same Structure for every same-shaped element,
+// so the plan lets those objects compare slot-by-slot without re-walking (and
+// re-filtering) the property table each time. Cached Structures are appended to
+// m_roots so GC cannot recycle a key mid-comparison.
+class DeepEqualsStructureCache {
+public:
+    DeepEqualsStructureCache() = default;
+    DeepEqualsStructureCache(const DeepEqualsStructureCache&) = delete;
+
+    const Vector<JSC::PropertyOffset, 8>& offsetsFor(JSC::VM& vm, JSC::Structure* structure)
+    {
+        auto result = m_plans.add(structure, nullptr);
+        if (result.isNewEntry) {
+            m_roots.append(JSC::JSValue(structure));
+            auto plan = std::make_unique<Vector<JSC::PropertyOffset, 8>>();
+            structure->forEachProperty(vm, [&](const PropertyTableEntry& entry) -> bool {
+                if (entry.attributes() & PropertyAttribute::DontEnum || PropertyName(entry.key()).isPrivateName()) {
+                    return true;
+                }
+                plan->append(entry.offset());
+                return true;
+            });
+            result.iterator->value = WTF::move(plan);
+        }
+        return *result.iterator->value;
+    }
+
+private:
+    // unique_ptr keeps a plan's address stable across rehashes: nested
+    // comparisons add entries while an outer loop is still iterating its plan.
+    HashMap<JSC::Structure*, std::unique_ptr<Vector<JSC::PropertyOffset, 8>>> m_plans;
+    MarkedArgumentBuffer m_roots;
+};
+}
+
+template<bool isStrict, bool enableAsymmetricMatchers, bool skipPrototype>
+static bool Bun__deepEqualsImpl(JSC::JSGlobalObject* globalObject, JSValue v1, JSValue v2, MarkedArgumentBuffer& gcBuffer, Vector<std::pair<JSC::JSValue, JSC::JSValue>, 16>& stack, ThrowScope& scope, DeepEqualsStructureCache& structureCache, bool addToStack);
+
 template<bool isStrict, bool enableAsymmetricMatchers, bool skipPrototype>
-std::optional<bool> specialObjectsDequal(JSC::JSGlobalObject* globalObject, MarkedArgumentBuffer& gcBuffer, Vector<std::pair<JSC::JSValue, JSC::JSValue>, 16>& stack, ThrowScope& scope, JSCell* _Nonnull c1, JSCell* _Nonnull c2);
+std::optional<bool> specialObjectsDequal(JSC::JSGlobalObject* globalObject, MarkedArgumentBuffer& gcBuffer, Vector<std::pair<JSC::JSValue, JSC::JSValue>, 16>& stack, ThrowScope& scope, DeepEqualsStructureCache& structureCache, JSCell* _Nonnull c1, JSCell* _Nonnull c2);
 
 // Typed array elements and boxed string characters are synthesized by
 // getOwnPropertySlot instead of being stored in the structure, so a structure with
@@ -670,6 +711,15 @@ static ALWAYS_INLINE bool hasExtraOwnProperties(JSC::Structure* structure)
 
 template<bool isStrict, bool enableAsymmetricMatchers, bool skipPrototype>
 bool Bun__deepEquals(JSC::JSGlobalObject* globalObject, JSValue v1, JSValue v2, MarkedArgumentBuffer& gcBuffer, Vector<std::pair<JSC::JSValue, JSC::JSValue>, 16>& stack, ThrowScope& scope, bool addToStack)
+{
+    // The structure plan cache lives for one top-level comparison; the
+    // recursion below threads it through Bun__deepEqualsImpl.
+    DeepEqualsStructureCache structureCache;
+    return Bun__deepEqualsImpl<isStrict, enableAsymmetricMatchers, skipPrototype>(globalObject, v1, v2, gcBuffer, stack, scope, structureCache, addToStack);
+}
+
+template<bool isStrict, bool enableAsymmetricMatchers, bool skipPrototype>
+static bool Bun__deepEqualsImpl(JSC::JSGlobalObject* globalObject, JSValue v1, JSValue v2, MarkedArgumentBuffer& gcBuffer, Vector<std::pair<JSC::JSValue, JSC::JSValue>, 16>& stack, ThrowScope& scope, DeepEqualsStructureCache& structureCache, bool addToStack)
 {
     VM& vm = globalObject->vm();
     if (!vm.isSafeToRecurse()) [[unlikely]] {
@@ -747,10 +797,10 @@ bool Bun__deepEquals(JSC::JSGlobalObject* globalObject, JSValue v1, JSValue v2,
     JSCell* c2 = v2.asCell();
     ASSERT(c1);
     ASSERT(c2);
-    std::optional<bool> isSpecialEqual = specialObjectsDequal<isStrict, enableAsymmetricMatchers, skipPrototype>(globalObject, gcBuffer, stack, scope, c1, c2);
+    std::optional<bool> isSpecialEqual = specialObjectsDequal<isStrict, enableAsymmetricMatchers, skipPrototype>(globalObject, gcBuffer, stack, scope, structureCache, c1, c2);
     RETURN_IF_EXCEPTION(scope, false);
     if (isSpecialEqual.has_value()) return WTF::move(*isSpecialEqual);
-    isSpecialEqual = specialObjectsDequal<isStrict, enableAsymmetricMatchers, skipPrototype>(globalObject, gcBuffer, stack, scope, c2, c1);
+    isSpecialEqual = specialObjectsDequal<isStrict, enableAsymmetricMatchers, skipPrototype>(globalObject, gcBuffer, stack, scope, structureCache, c2, c1);
     RETURN_IF_EXCEPTION(scope, false);
     if (isSpecialEqual.has_value()) return WTF::move(*isSpecialEqual);
     JSObject* o1 = v1.getObject();
@@ -798,7 +848,7 @@ bool Bun__deepEquals(JSC::JSGlobalObject* globalObject, JSValue v1, JSValue v2,
                 }
             }
 
-            auto eql = Bun__deepEquals<isStrict, enableAsymmetricMatchers, skipPrototype>(globalObject, left, right, gcBuffer, stack, scope, true);
+            auto eql = Bun__deepEqualsImpl<isStrict, enableAsymmetricMatchers, skipPrototype>(globalObject, left, right, gcBuffer, stack, scope, structureCache, true);
             RETURN_IF_EXCEPTION(scope, false);
             if (!eql) return false;
         }
@@ -853,7 +903,7 @@ bool Bun__deepEquals(JSC::JSGlobalObject* globalObject, JSValue v1, JSValue v2,
                 return false;
             }
 
-            auto eql = Bun__deepEquals<isStrict, enableAsymmetricMatchers, skipPrototype>(globalObject, prop1, prop2, gcBuffer, stack, scope, true);
+            auto eql = Bun__deepEqualsImpl<isStrict, enableAsymmetricMatchers, skipPrototype>(globalObject, prop1, prop2, gcBuffer, stack, scope, structureCache, true);
             RETURN_IF_EXCEPTION(scope, false);
             if (!eql) return false;
         }
@@ -877,39 +927,35 @@ bool Bun__deepEquals(JSC::JSGlobalObject* globalObject, JSValue v1, JSValue v2,
             bool result = true;
             bool sameStructure = o2Structure->id() == o1Structure->id();
             if (sameStructure) {
-                o1Structure->forEachProperty(vm, [&](const PropertyTableEntry& entry) -> bool {
-                    if (entry.attributes() & PropertyAttribute::DontEnum || PropertyName(entry.key()).isPrivateName()) {
-                        return true;
-                    }
-
-                    JSValue left = o1->getDirect(entry.offset());
-                    JSValue right = o2->getDirect(entry.offset());
+                // Same hidden class: both objects store each property at the
+                // same offset, so compare straight from the cached plan.
+                for (PropertyOffset offset : structureCache.offsetsFor(vm, o1Structure)) {
+                    JSValue left = o1->getDirect(offset);
+                    JSValue right = o2->getDirect(offset);
 
                     if constexpr (!isStrict) {
                         if (left.isUndefined() && right.isEmpty()) {
-                            return true;
+                            continue;
                         }
                     }
 
                     if (!right) {
                         result = false;
-                        return false;
+                        break;
                     }
 
-                    if (left == right) return true;
+                    if (left == right) continue;
                     auto same = JSC::sameValue(globalObject, left, right);
                     RETURN_IF_EXCEPTION(scope, false);
-                    if (same) return true;
+                    if (same) continue;
 
-                    auto eql = Bun__deepEquals<isStrict, enableAsymmetricMatchers, skipPrototype>(globalObject, left, right, gcBuffer, stack, scope, true);
+                    auto eql = Bun__deepEqualsImpl<isStrict, enableAsymmetricMatchers, skipPrototype>(globalObject, left, right, gcBuffer, stack, scope, structureCache, true);
                     RETURN_IF_EXCEPTION(scope, false);
                     if (!eql) {
                         result = false;
-                        return false;
+                        break;
                     }
-
-                    return true;
-                });
+                }
             } else {
                 size_t count = 0;
                 o1Structure->forEachProperty(vm, [&](const PropertyTableEntry& entry) -> bool {
@@ -950,7 +996,7 @@ bool Bun__deepEquals(JSC::JSGlobalObject* globalObject, JSValue v1, JSValue v2,
                     RETURN_IF_EXCEPTION(scope, false);
                     if (same) return true;
 
-                    auto eql = Bun__deepEquals<isStrict, enableAsymmetricMatchers, skipPrototype>(globalObject, left, right, gcBuffer, stack, scope, true);
+                    auto eql = Bun__deepEqualsImpl<isStrict, enableAsymmetricMatchers, skipPrototype>(globalObject, left, right, gcBuffer, stack, scope, structureCache, true);
                     RETURN_IF_EXCEPTION(scope, false);
                     if (!eql) {
                         result = false;
@@ -1038,7 +1084,7 @@ bool Bun__deepEquals(JSC::JSGlobalObject* globalObject, JSValue v1, JSValue v2,
             return false;
         }
 
-        auto eql = Bun__deepEquals<isStrict, enableAsymmetricMatchers, skipPrototype>(globalObject, prop1, prop2, gcBuffer, stack, scope, true);
+        auto eql = Bun__deepEqualsImpl<isStrict, enableAsymmetricMatchers, skipPrototype>(globalObject, prop1, prop2, gcBuffer, stack, scope, structureCache, true);
         RETURN_IF_EXCEPTION(scope, false);
         if (!eql) return false;
     }
@@ -1060,7 +1106,7 @@ bool Bun__deepEquals(JSC::JSGlobalObject* globalObject, JSValue v1, JSValue v2,
 }
 
 template<bool isStrict, bool enableAsymmetricMatchers, bool skipPrototype>
-std::optional<bool> specialObjectsDequal(JSC::JSGlobalObject* globalObject, MarkedArgumentBuffer& gcBuffer, Vector<std::pair<JSC::JSValue, JSC::JSValue>, 16>& stack, ThrowScope& scope, JSCell* _Nonnull c1, JSCell* _Nonnull c2)
+std::optional<bool> specialObjectsDequal(JSC::JSGlobalObject* globalObject, MarkedArgumentBuffer& gcBuffer, Vector<std::pair<JSC::JSValue, JSC::JSValue>, 16>& stack, ThrowScope& scope, DeepEqualsStructureCache& structureCache, JSCell* _Nonnull c1, JSCell* _Nonnull c2)
 {
     VM& vm = globalObject->vm();
     uint8_t c1Type = c1->type();
@@ -1096,7 +1142,7 @@ std::optional<bool> specialObjectsDequal(JSC::JSGlobalObject* globalObject, Mark
             JSValue key2;
             bool foundMatchingKey = false;
             while (iter2->next(globalObject, key2)) {
-                bool equal = Bun__deepEquals<isStrict, enableAsymmetricMatchers, skipPrototype>(globalObject, key1, key2, gcBuffer, stack, scope, false);
+                bool equal = Bun__deepEqualsImpl<isStrict, enableAsymmetricMatchers, skipPrototype>(globalObject, key1, key2, gcBuffer, stack, scope, structureCache, false);
                 RETURN_IF_EXCEPTION(scope, {});
                 if (equal) {
                     foundMatchingKey = true;
@@ -1139,7 +1185,7 @@ std::optional<bool> specialObjectsDequal(JSC::JSGlobalObject* globalObject, Mark
                 JSValue key2;
                 bool foundMatchingKey = false;
                 while (iter2->nextKeyValue(globalObject, key2, value2)) {
-                    bool keysEqual = Bun__deepEquals<isStrict, enableAsymmetricMatchers, skipPrototype>(globalObject, key1, key2, gcBuffer, stack, scope, false);
+                    bool keysEqual = Bun__deepEqualsImpl<isStrict, enableAsymmetricMatchers, skipPrototype>(globalObject, key1, key2, gcBuffer, stack, scope, structureCache, false);
                     RETURN_IF_EXCEPTION(scope, {});
                     if (keysEqual) {
                         foundMatchingKey = true;
@@ -1154,7 +1200,7 @@ std::optional<bool> specialObjectsDequal(JSC::JSGlobalObject* globalObject, Mark
                 // Compare both values below.
             }
 
-            bool valuesEqual = Bun__deepEquals<isStrict, enableAsymmetricMatchers, skipPrototype>(globalObject, value1, value2, gcBuffer, stack, scope, false);
+            bool valuesEqual = Bun__deepEqualsImpl<isStrict, enableAsymmetricMatchers, skipPrototype>(globalObject, value1, value2, gcBuffer, stack, scope, structureCache, false);
             RETURN_IF_EXCEPTION(scope, {});
             if (!valuesEqual) {
                 return false;
@@ -1291,7 +1337,7 @@ std::optional<bool> specialObjectsDequal(JSC::JSGlobalObject* globalObject, Mark
             RETURN_IF_EXCEPTION(scope, {});
             auto rightCause = right->get(globalObject, cause);
             RETURN_IF_EXCEPTION(scope, {});
-            bool causesEqual = Bun__deepEquals<isStrict, enableAsymmetricMatchers, skipPrototype>(globalObject, leftCause, rightCause, gcBuffer, stack, scope, true);
+            bool causesEqual = Bun__deepEqualsImpl<isStrict, enableAsymmetricMatchers, skipPrototype>(globalObject, leftCause, rightCause, gcBuffer, stack, scope, structureCache, true);
             RETURN_IF_EXCEPTION(scope, {});
             if (!causesEqual) {
                 return false;
@@ -1341,7 +1387,7 @@ std::optional<bool> specialObjectsDequal(JSC::JSGlobalObject* globalObject, Mark
                     return false;
                 }
 
-                bool propertiesEqual = Bun__deepEquals<isStrict, enableAsymmetricMatchers, skipPrototype>(globalObject, prop1, prop2, gcBuffer, stack, scope, true);
+                bool propertiesEqual = Bun__deepEqualsImpl<isStrict, enableAsymmetricMatchers, skipPrototype>(globalObject, prop1, prop2, gcBuffer, stack, scope, structureCache, true);
                 RETURN_IF_EXCEPTION(scope, {});
                 if (!propertiesEqual) {
                     return false;
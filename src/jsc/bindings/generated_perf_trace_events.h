@@ -37,27 +37,28 @@
   macro(ExtractTarball.extract, 33) \
   macro(FolderResolver.readPackageJSONFromDisk.folder, 34) \
   macro(FolderResolver.readPackageJSONFromDisk.workspace, 35) \
-  macro(JSBundler.addPlugin, 36) \
-  macro(JSBundler.hasAnyMatches, 37) \
-  macro(JSBundler.matchOnLoad, 38) \
-  macro(JSBundler.matchOnResolve, 39) \
-  macro(JSGlobalObject.create, 40) \
-  macro(JSParser.analyze, 41) \
-  macro(JSParser.parse, 42) \
-  macro(JSParser.postvisit, 43) \
-  macro(JSParser.visit, 44) \
-  macro(JSPrinter.print, 45) \
-  macro(JSPrinter.printWithSourceMap, 46) \
-  macro(ModuleResolver.resolve, 47) \
-  macro(PackageInstaller.install, 48) \
-  macro(PackageManifest.Serializer.loadByFile, 49) \
-  macro(PackageManifest.Serializer.save, 50) \
-  macro(RuntimeTranspilerCache.fromFile, 51) \
-  macro(RuntimeTranspilerCache.save, 52) \
-  macro(RuntimeTranspilerCache.toFile, 53) \
-  macro(StandaloneModuleGraph.serialize, 54) \
-  macro(Symbols.followAll, 55) \
-  macro(TestCommand.printCodeCoverageLCov, 56) \
-  macro(TestCommand.printCodeCoverageLCovAndText, 57) \
-  macro(TestCommand.printCodeCoverageText, 58) \
+  macro(InternalModuleRegistry.createInternalModuleById, 36) \
+  macro(JSBundler.addPlugin, 37) \
+  macro(JSBundler.hasAnyMatches, 38) \
+  macro(JSBundler.matchOnLoad, 39) \
+  macro(JSBundler.matchOnResolve, 40) \
+  macro(JSGlobalObject.create, 41) \
+  macro(JSParser.analyze, 42) \
+  macro(JSParser.parse, 43) \
+  macro(JSParser.postvisit, 44) \
+  macro(JSParser.visit, 45) \
+  macro(JSPrinter.print, 46) \
+  macro(JSPrinter.printWithSourceMap, 47) \
+  macro(ModuleResolver.resolve, 48) \
+  macro(PackageInstaller.install, 49) \
+  macro(PackageManifest.Serializer.loadByFile, 50) \
+  macro(PackageManifest.Serializer.save, 51) \
+  macro(RuntimeTranspilerCache.fromFile, 52) \
+  macro(RuntimeTranspilerCache.save, 53) \
+  macro(RuntimeTranspilerCache.toFile, 54) \
+  macro(StandaloneModuleGraph.serialize, 55) \
+  macro(Symbols.followAll, 56) \
+  macro(TestCommand.printCodeCoverageLCov, 57) \
+  macro(TestCommand.printCodeCoverageLCovAndText, 58) \
+  macro(TestCommand.printCodeCoverageText, 59) \
   // end
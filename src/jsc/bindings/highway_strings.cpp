@@ -800,6 +800,32 @@ bool ContainsNewlineOrNonASCIIOrQuoteImpl(const uint8_t* HWY_RESTRICT text, size
     return false;
 }
 
+// Constant-time byte equality: fixed-stride XOR-accumulate over vector lanes
+// with no early exit. Only the fully-accumulated result is branched on, so
+// the byte contents never influence control flow or iteration count. The
+// length is treated as public — callers reject mismatched lengths up front.
+bool TimingSafeEqualImpl(const uint8_t* HWY_RESTRICT a, const uint8_t* HWY_RESTRICT b, size_t len)
+{
+    D8 d;
+    const size_t N = hn::Lanes(d);
+
+    auto acc = hn::Zero(d);
+    size_t i = 0;
+    const size_t simd_len = len - (len % N);
+
+    for (; i < simd_len; i += N) {
+        acc = hn::Or(acc, hn::Xor(hn::LoadU(d, a + i), hn::LoadU(d, b + i)));
+    }
+
+    uint8_t tail_acc = 0;
+    for (; i < len; ++i) {
+        tail_acc |= static_cast<uint8_t>(a[i] ^ b[i]);
+    }
+
+    // `&` (not `&&`) so the vector result does not short-circuit the tail.
+    return hn::AllTrue(d, hn::Eq(acc, hn::Zero(d))) & (tail_acc == 0);
+}
+
 template<bool is_backtick>
 static size_t IndexOfNeedsEscapeForJavaScriptStringImpl(const uint8_t* HWY_RESTRICT text, size_t text_len, uint8_t quote_char)
 {
@@ -894,34 +920,36 @@ uint8_t* MemMemImpl(const uint8_t* haystack, size_t haystack_len,
     const hn::ScalableTag<uint8_t> d;
     const size_t N = hn::Lanes(d);
     const uint8_t first_needle_char = needle[0];
+    const uint8_t last_needle_char = needle[needle_len - 1];
     const hn::Vec<decltype(d)> v_first_needle = hn::Set(d, first_needle_char);
+    const hn::Vec<decltype(d)> v_last_needle = hn::Set(d, last_needle_char);
     const size_t last_possible_start = haystack_len - needle_len;
 
     // --- SIMD Main Loop ---
+    // A lane is a candidate only when both the first and the last needle byte
+    // match at their respective offsets. Filtering on the first byte alone
+    // degrades badly for needles whose first byte is common in the haystack
+    // (delimiter scans over text funnel nearly every lane into memcmp).
+    //
+    // The loop bound keeps the second load in-bounds (its last byte is
+    // haystack[i + N - 1 + needle_len - 1] <= haystack[haystack_len - 1]) and
+    // every candidate lane <= last_possible_start, so no per-lane bounds
+    // check or remainder backtracking is needed.
     size_t i = 0;
-    while (i + N <= haystack_len && i <= last_possible_start) {
-        const hn::Vec<decltype(d)> haystack_vec = hn::LoadU(d, haystack + i);
-        hn::Mask<decltype(d)> m_starts = hn::Eq(haystack_vec, v_first_needle);
+    while (i + N <= last_possible_start + 1) {
+        const hn::Vec<decltype(d)> v_start = hn::LoadU(d, haystack + i);
+        const hn::Vec<decltype(d)> v_end = hn::LoadU(d, haystack + i + needle_len - 1);
+        hn::Mask<decltype(d)> m_starts = hn::And(hn::Eq(v_start, v_first_needle), hn::Eq(v_end, v_last_needle));
 
-        // Iterate through potential matches within this vector chunk using FindFirstTrue
+        // Iterate through candidates within this vector chunk using FindFirstTrue
         while (!hn::AllFalse(d, m_starts)) {
             const intptr_t bit_idx_ptr = hn::FindFirstTrue(d, m_starts);
             // Loop condition guarantees FindFirstTrue finds something
             HWY_ASSERT(bit_idx_ptr >= 0);
-            const size_t bit_idx = static_cast<size_t>(bit_idx_ptr);
+            const size_t potential_pos = i + static_cast<size_t>(bit_idx_ptr);
 
-            const size_t potential_pos = i + bit_idx;
-
-            // Double-check bounds (essential if N > needle_len, and correct otherwise)
-            if (potential_pos <= last_possible_start) {
-                if (memcmp(haystack + potential_pos, needle, needle_len) == 0) {
-                    return const_cast<uint8_t*>(haystack + potential_pos);
-                }
-            } else {
-                // Optimization: If the first match found in this chunk is already
-                // beyond the last possible start, no subsequent match in this
-                // chunk can be valid.
-                goto remainder_check; // Exit both loops and proceed to scalar remainder
+            if (memcmp(haystack + potential_pos, needle, needle_len) == 0) {
+                return const_cast<uint8_t*>(haystack + potential_pos);
             }
 
             // Clear the found bit to find the next one in the next iteration.
@@ -934,20 +962,13 @@ uint8_t* MemMemImpl(const uint8_t* haystack, size_t haystack_len,
         i += N;
     } // End SIMD loop
 
-remainder_check:
     // --- Scalar Remainder Loop ---
-    // Check any remaining bytes that couldn't form a full vector load
-    // or potential starts within the last vector load that weren't checked
-    // because they were past last_possible_start.
-    // Start `i` from where the SIMD loop *could* have last started a valid check.
-    size_t remainder_start = (i >= N) ? (i - N) : 0;
-    // Ensure we re-check any potential starts the SIMD loop might have skipped
-    // due to the bounds check optimization or being in the final partial vector.
-    for (; remainder_start <= last_possible_start; ++remainder_start) {
-        // Optimization: Check first character before expensive memcmp
-        if (haystack[remainder_start] == first_needle_char) {
-            if (memcmp(haystack + remainder_start, needle, needle_len) == 0) {
-                return const_cast<uint8_t*>(haystack + remainder_start);
+    // Fewer than N candidate positions left; every position before `i` was
+    // fully checked by the SIMD loop.
+    for (; i <= last_possible_start; ++i) {
+        if (haystack[i] == first_needle_char && haystack[i + needle_len - 1] == last_needle_char) {
+            if (memcmp(haystack + i, needle, needle_len) == 0) {
+                return const_cast<uint8_t*>(haystack + i);
             }
         }
     }
@@ -2011,6 +2032,7 @@ HWY_EXPORT(LowerAscii16Impl);
 HWY_EXPORT(LowerAsciiImpl);
 HWY_EXPORT(MemMemImpl);
 HWY_EXPORT(ScanCharFrequencyImpl);
+HWY_EXPORT(TimingSafeEqualImpl);
 HWY_EXPORT(VisibleLatin1WidthExcludeANSIImpl);
 HWY_EXPORT(VisibleLatin1WidthImpl);
 HWY_EXPORT(VisibleUTF16WidthImpl);
@@ -2229,6 +2251,11 @@ size_t highway_decode_hex16(const uint16_t* HWY_RESTRICT input, uint8_t* HWY_RES
     return HWY_DYNAMIC_DISPATCH(DecodeHex16Impl)(input, output, out_len);
 }
 
+bool highway_timing_safe_equal(const uint8_t* HWY_RESTRICT a, const uint8_t* HWY_RESTRICT b, size_t len)
+{
+    return HWY_DYNAMIC_DISPATCH(TimingSafeEqualImpl)(a, b, len);
+}
+
 } // extern "C"
 
 } // namespace bun
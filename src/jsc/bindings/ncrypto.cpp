@@ -4788,6 +4788,12 @@ bool HMACCtxPointer::init(const Buffer<const void>& buf, const Digest& md)
     return HMAC_Init_ex(ctx_.get(), buf.data, buf.len, md_ptr, nullptr) == 1;
 }
 
+bool HMACCtxPointer::initFrom(const HMACCtxPointer& other)
+{
+    if (!ctx_ || !other.ctx_) return false;
+    return HMAC_CTX_copy(ctx_.get(), other.ctx_.get()) == 1;
+}
+
 bool HMACCtxPointer::update(const Buffer<const void>& buf)
 {
     if (!ctx_) return false;
@@ -1498,6 +1498,7 @@ public:
     HMAC_CTX* release();
 
     bool init(const Buffer<const void>& buf, const Digest& md);
+    bool initFrom(const HMACCtxPointer& other);
     bool update(const Buffer<const void>& buf);
     DataPointer digest();
     bool digestInto(Buffer<void>* buf);
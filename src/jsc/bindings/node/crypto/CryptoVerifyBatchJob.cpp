@@ -0,0 +1,201 @@
+#include "CryptoVerifyBatchJob.h"
+#include "NodeValidator.h"
+#include "KeyObject.h"
+
+using namespace JSC;
+using namespace ncrypto;
+using namespace WebCore;
+
+namespace Bun {
+
+// `verifyBatch(entries, callback)` — verifies every `{ key, data, signature }`
+// entry in one work-pool job. BoringSSL has no shared-scalar batch Ed25519
+// primitive, so the win is parsing and crossing into native once per batch and
+// running the whole batch off the JS thread. Results come back as a Uint8Array
+// bitmask so the batch size is not limited by Number's bit width.
+JSC_DEFINE_HOST_FUNCTION(jsVerifyBatch, (JSGlobalObject * lexicalGlobalObject, CallFrame* callFrame))
+{
+    VM& vm = lexicalGlobalObject->vm();
+    ThrowScope scope = DECLARE_THROW_SCOPE(vm);
+
+    JSValue entriesValue = callFrame->argument(0);
+    JSValue callbackValue = callFrame->argument(1);
+
+    V::validateFunction(scope, lexicalGlobalObject, callbackValue, "callback"_s);
+    RETURN_IF_EXCEPTION(scope, {});
+
+    auto ctx = VerifyBatchJobCtx::fromJS(lexicalGlobalObject, scope, entriesValue);
+    RETURN_IF_EXCEPTION(scope, {});
+
+    VerifyBatchJob::createAndSchedule(lexicalGlobalObject, WTF::move(*ctx), callbackValue);
+    return JSValue::encode(jsUndefined());
+}
+
+std::optional<VerifyBatchJobCtx> VerifyBatchJobCtx::fromJS(JSGlobalObject* globalObject, ThrowScope& scope, JSValue entriesValue)
+{
+    VM& vm = globalObject->vm();
+
+    V::validateArray(scope, globalObject, entriesValue, "entries"_s, jsUndefined());
+    RETURN_IF_EXCEPTION(scope, std::nullopt);
+
+    Vector<Entry> entries;
+    size_t index = 0;
+
+    forEachInArrayLike(globalObject, entriesValue.getObject(), [&](JSValue entryValue) -> bool {
+        auto entryName = makeString("entries["_s, index, "]"_s);
+        index++;
+
+        JSObject* entryObject = entryValue.getObject();
+        if (!entryObject) {
+            ERR::INVALID_ARG_TYPE(scope, globalObject, entryName, "object"_s, entryValue);
+            return false;
+        }
+
+        JSValue keyValue = entryObject->get(globalObject, Identifier::fromString(vm, "key"_s));
+        RETURN_IF_EXCEPTION(scope, false);
+        JSValue dataValue = entryObject->get(globalObject, Identifier::fromString(vm, "data"_s));
+        RETURN_IF_EXCEPTION(scope, false);
+        JSValue signatureValue = entryObject->get(globalObject, Identifier::fromString(vm, "signature"_s));
+        RETURN_IF_EXCEPTION(scope, false);
+
+        auto dataView = getArrayBufferOrView2(globalObject, scope, dataValue, "data"_s, jsUndefined());
+        RETURN_IF_EXCEPTION(scope, false);
+        Vector<uint8_t> data;
+        data.append(std::span { dataView->data(), dataView->size() });
+
+        auto signatureView = getArrayBufferOrView2(globalObject, scope, signatureValue, "signature"_s, jsUndefined(), true);
+        RETURN_IF_EXCEPTION(scope, false);
+        Vector<uint8_t> signature;
+        signature.append(std::span { signatureView->data(), signatureView->size() });
+
+        auto prepareResult = KeyObject::preparePublicOrPrivateKey(globalObject, scope, keyValue);
+        RETURN_IF_EXCEPTION(scope, false);
+
+        ClearErrorOnReturn clearError;
+        KeyObject keyObject;
+        if (prepareResult.keyData) {
+            keyObject = KeyObject::create(CryptoKeyType::Public, WTF::move(*prepareResult.keyData));
+        } else {
+            keyObject = KeyObject::getPublicOrPrivateKey(
+                globalObject,
+                scope,
+                prepareResult.keyDataView,
+                CryptoKeyType::Public,
+                prepareResult.formatType,
+                prepareResult.encodingType,
+                prepareResult.cipher,
+                WTF::move(prepareResult.passphrase));
+            RETURN_IF_EXCEPTION(scope, false);
+        }
+
+        // Only the one-shot EdDSA variant (Ed25519 — BoringSSL has no Ed448)
+        // verifies without a digest; restricting the batch API to it keeps the
+        // entries free of per-entry algorithm/padding options.
+        if (!keyObject.asymmetricKey().isOneShotVariant()) {
+            ERR::CRYPTO_INVALID_KEYTYPE(scope, globalObject, "verifyBatch() only supports Ed25519 keys"_s);
+            return false;
+        }
+
+        entries.append(Entry {
+            .keyData = keyObject.data(),
+            .data = WTF::move(data),
+            .signature = WTF::move(signature),
+        });
+        return true;
+    });
+    RETURN_IF_EXCEPTION(scope, std::nullopt);
+
+    return VerifyBatchJobCtx(WTF::move(entries));
+}
+
+extern "C" void Bun__VerifyBatchJobCtx__deinit(VerifyBatchJobCtx* ctx)
+{
+    ctx->deinit();
+}
+void VerifyBatchJobCtx::deinit()
+{
+    delete this;
+}
+
+extern "C" void Bun__VerifyBatchJobCtx__runTask(VerifyBatchJobCtx* ctx, JSGlobalObject* globalObject)
+{
+    ctx->runTask(globalObject);
+}
+void VerifyBatchJobCtx::runTask(JSGlobalObject*)
+{
+    ClearErrorOnReturn clearError;
+
+    m_bitmask.grow((m_entries.size() + 7) / 8);
+    memset(m_bitmask.begin(), 0, m_bitmask.size());
+
+    for (size_t i = 0; i < m_entries.size(); i++) {
+        auto& entry = m_entries[i];
+
+        auto context = EVPMDCtxPointer::New();
+        if (!context) [[unlikely]] {
+            continue;
+        }
+        if (!context.verifyInit(entry.keyData->asymmetricKey, Digest {})) {
+            continue;
+        }
+
+        auto dataBuf = ncrypto::Buffer<const uint8_t> {
+            .data = entry.data.begin(),
+            .len = entry.data.size(),
+        };
+        auto sigBuf = ncrypto::Buffer<const uint8_t> {
+            .data = entry.signature.begin(),
+            .len = entry.signature.size(),
+        };
+
+        if (context.verify(dataBuf, sigBuf)) {
+            m_bitmask[i >> 3] |= 1 << (i & 7);
+        }
+    }
+}
+
+extern "C" void Bun__VerifyBatchJobCtx__runFromJS(VerifyBatchJobCtx* ctx, JSGlobalObject* globalObject, EncodedJSValue callback)
+{
+    ctx->runFromJS(globalObject, JSValue::decode(callback));
+}
+void VerifyBatchJobCtx::runFromJS(JSGlobalObject* lexicalGlobalObject, JSValue callback)
+{
+    auto& vm = lexicalGlobalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    auto* globalObject = defaultGlobalObject(lexicalGlobalObject);
+
+    auto maskBuf = ArrayBuffer::createUninitialized(m_bitmask.size(), 1);
+    memcpy(maskBuf->data(), m_bitmask.begin(), m_bitmask.size());
+    auto* bitmask = JSUint8Array::create(lexicalGlobalObject, globalObject->JSBufferSubclassStructure(), WTF::move(maskBuf), 0, m_bitmask.size());
+    RETURN_IF_EXCEPTION(scope, );
+
+    Bun__EventLoop__runCallback2(
+        lexicalGlobalObject,
+        JSValue::encode(callback),
+        JSValue::encode(jsUndefined()),
+        JSValue::encode(jsNull()),
+        JSValue::encode(bitmask));
+}
+
+extern "C" VerifyBatchJob* Bun__VerifyBatchJob__create(JSGlobalObject* globalObject, VerifyBatchJobCtx* ctx, EncodedJSValue callback);
+VerifyBatchJob* VerifyBatchJob::create(JSGlobalObject* globalObject, VerifyBatchJobCtx&& ctx, JSValue callback)
+{
+    VerifyBatchJobCtx* ctxCopy = new VerifyBatchJobCtx(WTF::move(ctx));
+    return Bun__VerifyBatchJob__create(globalObject, ctxCopy, JSValue::encode(callback));
+}
+
+extern "C" void Bun__VerifyBatchJob__schedule(VerifyBatchJob* job);
+void VerifyBatchJob::schedule()
+{
+    Bun__VerifyBatchJob__schedule(this);
+}
+
+extern "C" void Bun__VerifyBatchJob__createAndSchedule(JSGlobalObject* globalObject, VerifyBatchJobCtx* ctx, EncodedJSValue callback);
+void VerifyBatchJob::createAndSchedule(JSGlobalObject* globalObject, VerifyBatchJobCtx&& ctx, JSValue callback)
+{
+    VerifyBatchJobCtx* ctxCopy = new VerifyBatchJobCtx(WTF::move(ctx));
+    Bun__VerifyBatchJob__createAndSchedule(globalObject, ctxCopy, JSValue::encode(callback));
+}
+
+} // namespace Bun
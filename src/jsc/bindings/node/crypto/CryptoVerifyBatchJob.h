@@ -0,0 +1,47 @@
+#pragma once
+
+#include "root.h"
+#include "CryptoUtil.h"
+#include "KeyObject.h"
+
+namespace Bun {
+JSC_DECLARE_HOST_FUNCTION(jsVerifyBatch);
+
+struct VerifyBatchJobCtx {
+    WTF_MAKE_TZONE_ALLOCATED(VerifyBatchJobCtx);
+
+public:
+    struct Entry {
+        RefPtr<KeyObjectData> keyData;
+        Vector<uint8_t> data;
+        Vector<uint8_t> signature;
+    };
+
+    VerifyBatchJobCtx(Vector<Entry>&& entries)
+        : m_entries(WTF::move(entries))
+    {
+    }
+
+    VerifyBatchJobCtx(VerifyBatchJobCtx&& other)
+        : m_entries(WTF::move(other.m_entries))
+        , m_bitmask(WTF::move(other.m_bitmask))
+    {
+    }
+
+    static std::optional<VerifyBatchJobCtx> fromJS(JSC::JSGlobalObject*, JSC::ThrowScope&, JSValue entriesValue);
+
+    void runTask(JSC::JSGlobalObject*);
+    void runFromJS(JSC::JSGlobalObject*, JSC::JSValue callback);
+    void deinit();
+
+    Vector<Entry> m_entries;
+    // Bit i (byte i >> 3, bit i & 7) is set when entry i verified.
+    Vector<uint8_t> m_bitmask;
+};
+
+struct VerifyBatchJob {
+    static VerifyBatchJob* create(JSC::JSGlobalObject*, VerifyBatchJobCtx&&, JSC::JSValue callback);
+    static void createAndSchedule(JSC::JSGlobalObject*, VerifyBatchJobCtx&&, JSC::JSValue callback);
+    void schedule();
+};
+}
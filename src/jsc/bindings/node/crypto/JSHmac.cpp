@@ -13,9 +13,45 @@
 #include "NodeValidator.h"
 #include <JavaScriptCore/FunctionPrototype.h>
 #include "KeyObject.h"
+#include "JSKeyObject.h"
 
 namespace Bun {
 
+// Initializes `ctx` for `md` and `keyData`. When the key came from a
+// KeyObject, `keyCache` points at its shared KeyObjectData and we clone the
+// precomputed ipad/opad schedule cached there instead of re-deriving the
+// padded key block; a miss computes it once and populates the cache for the
+// next Hmac over the same key.
+static bool initHmacCtx(ncrypto::HMACCtxPointer& ctx, const EVP_MD* md, std::span<const uint8_t> keyData, KeyObjectData* keyCache)
+{
+    ncrypto::Buffer<const void> keyBuffer {
+        .data = keyData.data(),
+        .len = keyData.size(),
+    };
+
+    if (!keyCache) {
+        return ctx.init(keyBuffer, md);
+    }
+
+    WTF::Locker locker { keyCache->hmacCacheLock };
+
+    if (keyCache->hmacCacheDigest == md && keyCache->hmacCacheCtx && ctx.initFrom(keyCache->hmacCacheCtx)) {
+        return true;
+    }
+
+    if (!ctx.init(keyBuffer, md)) {
+        return false;
+    }
+
+    auto cached = ncrypto::HMACCtxPointer::New();
+    if (cached.initFrom(ctx)) {
+        keyCache->hmacCacheCtx = WTF::move(cached);
+        keyCache->hmacCacheDigest = md;
+    }
+
+    return true;
+}
+
 static const HashTableValue JSHmacPrototypeTableValues[] = {
     { "update"_s, static_cast<unsigned>(PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsHmacProtoFuncUpdate, 1 } },
     { "digest"_s, static_cast<unsigned>(PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsHmacProtoFuncDigest, 1 } },
@@ -77,7 +113,7 @@ JSHmac* JSHmac::create(JSC::VM& vm, JSC::Structure* structure)
     return instance;
 }
 
-void JSHmac::init(JSC::JSGlobalObject* globalObject, ThrowScope& scope, const StringView& algorithm, std::span<const uint8_t> keyData)
+void JSHmac::init(JSC::JSGlobalObject* globalObject, ThrowScope& scope, const StringView& algorithm, std::span<const uint8_t> keyData, KeyObjectData* keyCache)
 {
     // Get the digest algorithm from the algorithm name
     const EVP_MD* md = ncrypto::getDigestByName(algorithm);
@@ -89,13 +125,7 @@ void JSHmac::init(JSC::JSGlobalObject* globalObject, ThrowScope& scope, const St
     // Create the HMAC context
     m_ctx = ncrypto::HMACCtxPointer::New();
 
-    // Initialize HMAC with the key and algorithm
-    ncrypto::Buffer<const void> keyBuffer {
-        .data = keyData.data(),
-        .len = keyData.size(),
-    };
-
-    if (!m_ctx.init(keyBuffer, md)) {
+    if (!initHmacCtx(m_ctx, md, keyData, keyCache)) {
         m_ctx.reset();
         throwCryptoError(globalObject, scope, ERR_get_error(), "Failed to initialize HMAC context"_s);
         return;
@@ -299,12 +329,97 @@ JSC_DEFINE_HOST_FUNCTION(constructHmac, (JSC::JSGlobalObject * globalObject, JSC
     KeyObject keyObject = KeyObject::prepareSecretKey(globalObject, scope, key, encodingValue);
     RETURN_IF_EXCEPTION(scope, {});
 
-    hmac->init(globalObject, scope, algorithm, keyObject.symmetricKey().span());
+    // Only KeyObject-backed keys share their KeyObjectData across createHmac
+    // calls; string/Buffer keys get fresh data every time, so caching the
+    // schedule there would be wasted work.
+    KeyObjectData* keyCache = dynamicDowncast<JSKeyObject>(key) ? keyObject.data().get() : nullptr;
+
+    hmac->init(globalObject, scope, algorithm, keyObject.symmetricKey().span(), keyCache);
     RETURN_IF_EXCEPTION(scope, {});
 
     return JSC::JSValue::encode(hmac);
 }
 
+// One-shot `crypto.hmac(algorithm, key, data[, outputEncoding])`: computes the
+// mac in a single native call, skipping the streaming Hmac object. KeyObject
+// keys additionally reuse the cached key schedule.
+JSC_DEFINE_HOST_FUNCTION(jsHmacOneShot, (JSC::JSGlobalObject * lexicalGlobalObject, JSC::CallFrame* callFrame))
+{
+    JSC::VM& vm = lexicalGlobalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+    auto* globalObject = defaultGlobalObject(lexicalGlobalObject);
+
+    JSValue algorithmValue = callFrame->argument(0);
+    V::validateString(scope, globalObject, algorithmValue, "algorithm"_s);
+    RETURN_IF_EXCEPTION(scope, {});
+
+    WTF::String algorithm = algorithmValue.toWTFString(globalObject);
+    RETURN_IF_EXCEPTION(scope, {});
+
+    const EVP_MD* md = ncrypto::getDigestByName(algorithm);
+    if (!md) {
+        return Bun::ERR::CRYPTO_INVALID_DIGEST(scope, globalObject, algorithm);
+    }
+
+    JSValue key = callFrame->argument(1);
+    KeyObject keyObject = KeyObject::prepareSecretKey(globalObject, scope, key, jsUndefined());
+    RETURN_IF_EXCEPTION(scope, {});
+    KeyObjectData* keyCache = dynamicDowncast<JSKeyObject>(key) ? keyObject.data().get() : nullptr;
+
+    JSValue inputValue = callFrame->argument(2);
+    std::span<const uint8_t> input;
+    JSValue convertedInput;
+    if (inputValue.isString()) {
+        JSString* inputString = inputValue.toString(globalObject);
+        RETURN_IF_EXCEPTION(scope, {});
+        auto inputView = inputString->view(globalObject);
+        RETURN_IF_EXCEPTION(scope, {});
+        convertedInput = JSValue::decode(WebCore::constructFromEncoding(globalObject, inputView, WebCore::BufferEncodingType::utf8));
+        RETURN_IF_EXCEPTION(scope, {});
+        auto* convertedView = dynamicDowncast<JSC::JSArrayBufferView>(convertedInput);
+        input = std::span { reinterpret_cast<const uint8_t*>(convertedView->vector()), convertedView->byteLength() };
+    } else if (auto* view = dynamicDowncast<JSArrayBufferView>(inputValue)) {
+        input = std::span { reinterpret_cast<const uint8_t*>(view->vector()), view->byteLength() };
+    } else {
+        return Bun::ERR::INVALID_ARG_TYPE(scope, globalObject, "data"_s, "string or an instance of Buffer, TypedArray, or DataView"_s, inputValue);
+    }
+
+    JSValue encodingValue = callFrame->argument(3);
+    BufferEncodingType encoding = BufferEncodingType::buffer;
+    if (encodingValue.pureToBoolean() != TriState::False) {
+        WTF::String encodingString = encodingValue.toWTFString(globalObject);
+        RETURN_IF_EXCEPTION(scope, {});
+        encoding = parseEnumerationFromString<BufferEncodingType>(encodingString).value_or(BufferEncodingType::buffer);
+        RETURN_IF_EXCEPTION(scope, {});
+    }
+
+    auto ctx = ncrypto::HMACCtxPointer::New();
+    if (!initHmacCtx(ctx, md, keyObject.symmetricKey().span(), keyCache)) {
+        throwCryptoError(lexicalGlobalObject, scope, ERR_get_error(), "Failed to initialize HMAC context"_s);
+        return {};
+    }
+
+    ncrypto::Buffer<const void> inputBuffer {
+        .data = input.data(),
+        .len = input.size(),
+    };
+    if (!ctx.update(inputBuffer)) {
+        return Bun::ERR::CRYPTO_HASH_UPDATE_FAILED(scope, globalObject);
+    }
+
+    unsigned char mdValue[EVP_MAX_MD_SIZE];
+    ncrypto::Buffer<void> mdBuffer {
+        .data = mdValue,
+        .len = sizeof(mdValue),
+    };
+    if (!ctx.digestInto(&mdBuffer)) {
+        throwCryptoError(lexicalGlobalObject, scope, ERR_get_error(), "Failed to digest HMAC"_s);
+        return {};
+    }
+
+    RELEASE_AND_RETURN(scope, StringBytes::encode(lexicalGlobalObject, scope, std::span<const uint8_t> { reinterpret_cast<const uint8_t*>(mdBuffer.data), mdBuffer.len }, encoding));
+}
+
 JSC_DEFINE_HOST_FUNCTION(callHmac, (JSC::JSGlobalObject * globalObject, JSC::CallFrame* callFrame))
 {
     JSC::VM& vm = globalObject->vm();
@@ -12,6 +12,8 @@
 #include <JavaScriptCore/LazyProperty.h>
 #include <JavaScriptCore/LazyPropertyInlines.h>
 
+struct KeyObjectData;
+
 namespace Bun {
 
 JSC_DECLARE_HOST_FUNCTION(callHmac);
@@ -40,7 +42,7 @@ public:
     ~JSHmac();
 
     void finishCreation(JSC::VM& vm);
-    void init(JSC::JSGlobalObject* globalObject, ThrowScope& scope, const StringView& algorithm, std::span<const uint8_t> keyData);
+    void init(JSC::JSGlobalObject* globalObject, ThrowScope& scope, const StringView& algorithm, std::span<const uint8_t> keyData, KeyObjectData* keyCache = nullptr);
     bool update(std::span<const uint8_t> input);
 
     ncrypto::HMACCtxPointer m_ctx;
@@ -122,6 +124,7 @@ private:
 
 JSC_DECLARE_HOST_FUNCTION(jsHmacProtoFuncUpdate);
 JSC_DECLARE_HOST_FUNCTION(jsHmacProtoFuncDigest);
+JSC_DECLARE_HOST_FUNCTION(jsHmacOneShot);
 
 void setupJSHmacClassStructure(JSC::LazyClassStructure::Initializer& init);
 
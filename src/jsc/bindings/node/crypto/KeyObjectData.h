@@ -3,6 +3,7 @@
 #include "root.h"
 #include "ncrypto.h"
 #include "CryptoKeyType.h"
+#include <wtf/Lock.h>
 
 struct KeyObjectData : ThreadSafeRefCounted<KeyObjectData> {
     WTF_MAKE_TZONE_ALLOCATED(KeyObjectData);
@@ -32,4 +33,12 @@ public:
 
     WTF::Vector<uint8_t> symmetricKey;
     const ncrypto::EVPKeyPointer asymmetricKey;
+
+    // Single-entry HMAC schedule cache, keyed by digest: a ready-to-clone
+    // HMAC_CTX holding the precomputed ipad/opad state for `hmacCacheDigest`.
+    // Lock-guarded because KeyObjectData is thread-safe ref-counted and may
+    // be shared with workers.
+    WTF::Lock hmacCacheLock;
+    ncrypto::HMACCtxPointer hmacCacheCtx;
+    const EVP_MD* hmacCacheDigest { nullptr };
 };
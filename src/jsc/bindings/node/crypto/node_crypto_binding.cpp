@@ -56,6 +56,7 @@
 #include "CryptoKeys.h"
 #include "CryptoDhJob.h"
 #include "CryptoSignJob.h"
+#include "CryptoVerifyBatchJob.h"
 
 using namespace JSC;
 
@@ -349,9 +350,13 @@ JSValue createNodeCryptoBinding(Zig::GlobalObject* globalObject)
         globalObject->m_JSVerifyClassStructure.constructor(globalObject));
     obj->putDirect(vm, PropertyName(Identifier::fromString(vm, "verify"_s)),
         JSFunction::create(vm, globalObject, 4, "verify"_s, jsVerifyOneShot, ImplementationVisibility::Public, NoIntrinsic), 0);
+    obj->putDirect(vm, PropertyName(Identifier::fromString(vm, "verifyBatch"_s)),
+        JSFunction::create(vm, globalObject, 2, "verifyBatch"_s, jsVerifyBatch, ImplementationVisibility::Public, NoIntrinsic), 0);
 
     obj->putDirect(vm, PropertyName(Identifier::fromString(vm, "Hmac"_s)),
         globalObject->m_JSHmacClassStructure.constructor(globalObject));
+    obj->putDirect(vm, PropertyName(Identifier::fromString(vm, "hmac"_s)),
+        JSFunction::create(vm, globalObject, 3, "hmac"_s, jsHmacOneShot, ImplementationVisibility::Public, NoIntrinsic), 0);
 
     obj->putDirect(vm, PropertyName(Identifier::fromString(vm, "Hash"_s)),
         globalObject->m_JSHashClassStructure.constructor(globalObject));
@@ -536,6 +536,14 @@ int HTTPParser::onHeadersComplete()
     args.at(A_VERSION_MAJOR) = jsNumber(m_parserData.http_major);
     args.at(A_VERSION_MINOR) = jsNumber(m_parserData.http_minor);
 
+    // Both spans were consumed into JS values above. Resetting them keeps the
+    // end-of-execute save() from heap-copying strings nothing reads again —
+    // on the common headers-in-one-read request this removes the only
+    // allocations execute() still made. A later trailer flush sees an empty
+    // URL, which is what _http_common.js expects.
+    m_url.reset();
+    m_statusMessage.reset();
+
     bool shouldKeepAlive = llhttp_should_keep_alive(&m_parserData);
 
     args.at(A_SHOULD_KEEP_ALIVE) = jsBoolean(shouldKeepAlive);
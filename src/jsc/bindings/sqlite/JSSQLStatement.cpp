@@ -45,8 +45,11 @@
 #include "wtf/BitVector.h"
 #include "wtf/FastBitVector.h"
 #include "wtf/Vector.h"
+#include <wtf/HashMap.h>
+#include <wtf/text/CString.h>
 #include <wtf/Lock.h>
 #include <atomic>
+#include <optional>
 #include "wtf/LazyRef.h"
 #include "wtf/text/StringToIntegerConversion.h"
 #include <JavaScriptCore/InternalFieldTuple.h>
@@ -202,6 +205,127 @@ static inline JSC::JSValue jsBigIntFromSQLite(JSC::JSGlobalObject* globalObject,
         return {};                                                                                                 \
     }
 
+DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(SQLiteResultCache);
+
+// Opt-in per-connection cache of SELECT results (the `resultCache` Database
+// option). Keyed by sqlite3_expanded_sql() — the statement text with bound
+// parameters rendered inline — so a key covers both the statement fingerprint
+// and the argument values exactly, with no hash collisions to reason about.
+//
+// Invalidation is connection-global: a snapshot of (version, contentEpoch,
+// total_changes, data_version) is checked on every lookup/store and any
+// mismatch flushes the whole cache. Writes to an ATTACHed database from a
+// *different* connection are the one gap (data_version covers "main" only).
+class SQLiteResultCache {
+    WTF_DEPRECATED_MAKE_FAST_ALLOCATED_WITH_HEAP_IDENTIFIER(SQLiteResultCache, SQLiteResultCache);
+
+public:
+    static constexpr size_t kDefaultMaxEntries = 128;
+    // Oversized results and keys are simply not cached.
+    static constexpr size_t kMaxEntryBytes = 1 << 20;
+    static constexpr size_t kMaxKeyBytes = 1 << 13;
+
+    struct Cell {
+        uint8_t columnType { SQLITE_NULL };
+        int64_t integer { 0 };
+        double number { 0 };
+        WTF::Vector<uint8_t> bytes; // TEXT (UTF-8) or BLOB
+    };
+
+    struct Entry {
+        // All result columns, including duplicates — replay applies the
+        // statement's validColumns mask the same way the live path does.
+        size_t columnCount { 0 };
+        size_t rowCount { 0 };
+        size_t byteSize { 0 };
+        uint64_t lastUse { 0 };
+        WTF::Vector<Cell> cells; // row-major
+
+        const Cell& at(size_t row, size_t column) const { return cells[row * columnCount + column]; }
+    };
+
+    explicit SQLiteResultCache(size_t maxEntries)
+        : m_maxEntries(maxEntries)
+    {
+    }
+
+    ~SQLiteResultCache()
+    {
+        if (m_dataVersionStmt)
+            sqlite3_finalize(m_dataVersionStmt);
+    }
+
+    // PRAGMA data_version changes when *another* connection commits. The
+    // pragma (unlike SQLITE_FCNTL_DATA_VERSION) begins a read transaction,
+    // which is what makes the pager notice those commits — a pure cache-hit
+    // workload otherwise never re-reads the database header.
+    int64_t currentDataVersion(sqlite3* db)
+    {
+        if (!m_dataVersionStmt) {
+            if (sqlite3_prepare_v3(db, "PRAGMA data_version", -1, SQLITE_PREPARE_PERSISTENT, &m_dataVersionStmt, nullptr) != SQLITE_OK)
+                return -1;
+        }
+        int64_t value = -1;
+        if (sqlite3_step(m_dataVersionStmt) == SQLITE_ROW)
+            value = sqlite3_column_int64(m_dataVersionStmt, 0);
+        sqlite3_reset(m_dataVersionStmt);
+        return value;
+    }
+
+    // Flush everything if any invalidation signal moved since the last call.
+    void revalidate(uint64_t version, uint64_t contentEpoch, int64_t totalChanges, int64_t dataVersion)
+    {
+        if (version == m_version && contentEpoch == m_contentEpoch && totalChanges == m_totalChanges && dataVersion == m_dataVersion)
+            return;
+        m_entries.clear();
+        m_version = version;
+        m_contentEpoch = contentEpoch;
+        m_totalChanges = totalChanges;
+        m_dataVersion = dataVersion;
+    }
+
+    Entry* lookup(const WTF::CString& key)
+    {
+        auto it = m_entries.find(key);
+        if (it == m_entries.end())
+            return nullptr;
+        it->value.lastUse = ++m_useCounter;
+        return &it->value;
+    }
+
+    void store(WTF::CString&& key, Entry&& entry)
+    {
+        if (m_entries.size() >= m_maxEntries && !m_entries.contains(key)) {
+            // Capacity is small enough that a scan for the LRU entry beats
+            // maintaining a linked list.
+            const WTF::CString* oldestKey = nullptr;
+            uint64_t oldestUse = std::numeric_limits<uint64_t>::max();
+            for (auto& it : m_entries) {
+                if (it.value.lastUse <= oldestUse) {
+                    oldestUse = it.value.lastUse;
+                    oldestKey = &it.key;
+                }
+            }
+            if (oldestKey)
+                m_entries.remove(*oldestKey);
+        }
+        entry.lastUse = ++m_useCounter;
+        m_entries.set(WTFMove(key), WTFMove(entry));
+    }
+
+private:
+    size_t m_maxEntries;
+    uint64_t m_useCounter { 0 };
+    uint64_t m_version { 0 };
+    uint64_t m_contentEpoch { 0 };
+    int64_t m_totalChanges { -1 };
+    int64_t m_dataVersion { -1 };
+    sqlite3_stmt* m_dataVersionStmt { nullptr };
+    WTF::HashMap<WTF::CString, Entry> m_entries;
+};
+
+DEFINE_ALLOCATOR_WITH_HEAP_IDENTIFIER(SQLiteResultCache);
+
 DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(VersionSqlite3);
 
 class VersionSqlite3 {
@@ -217,12 +341,18 @@ public:
     sqlite3* db;
     std::atomic<uint64_t> version;
     size_t reference_count;
+    std::unique_ptr<SQLiteResultCache> resultCache;
+    // Bumped by writes that don't go through a prepared statement of ours
+    // (exec(), incremental blob writes), which never touch `version`. Only
+    // the result cache reads it.
+    std::atomic<uint64_t> contentEpoch { 0 };
 
     void release()
     {
         ASSERT(reference_count > 0);
         --reference_count;
         if (reference_count == 0) {
+            resultCache = nullptr;
             if (!db) {
                 return;
             }
@@ -321,11 +451,13 @@ JSC_DECLARE_HOST_FUNCTION(jsSQLStatementLoadExtensionFunction);
 
 JSC_DECLARE_HOST_FUNCTION(jsSQLStatementExecuteStatementFunction);
 JSC_DECLARE_HOST_FUNCTION(jsSQLStatementExecuteStatementFunctionRun);
+JSC_DECLARE_HOST_FUNCTION(jsSQLStatementExecuteStatementFunctionRunBatch);
 JSC_DECLARE_HOST_FUNCTION(jsSQLStatementExecuteStatementFunctionGet);
 JSC_DECLARE_HOST_FUNCTION(jsSQLStatementExecuteStatementFunctionAll);
 JSC_DECLARE_HOST_FUNCTION(jsSQLStatementExecuteStatementFunctionIterate);
 JSC_DECLARE_HOST_FUNCTION(jsSQLStatementExecuteStatementFunctionRows);
 JSC_DECLARE_HOST_FUNCTION(jsSQLStatementExecuteStatementFunctionRawRows);
+JSC_DECLARE_HOST_FUNCTION(jsSQLStatementExecuteStatementFunctionColumnar);
 
 JSC_DECLARE_CUSTOM_GETTER(jsSqlStatementGetColumnNames);
 JSC_DECLARE_CUSTOM_GETTER(jsSqlStatementGetColumnCount);
@@ -333,6 +465,13 @@ JSC_DECLARE_CUSTOM_GETTER(jsSqlStatementGetColumnCount);
 JSC_DECLARE_HOST_FUNCTION(jsSQLStatementSerialize);
 JSC_DECLARE_HOST_FUNCTION(jsSQLStatementDeserialize);
 
+JSC_DECLARE_HOST_FUNCTION(jsSQLStatementBlobOpenFunction);
+JSC_DECLARE_HOST_FUNCTION(jsSQLStatementBlobBytesFunction);
+JSC_DECLARE_HOST_FUNCTION(jsSQLStatementBlobReadFunction);
+JSC_DECLARE_HOST_FUNCTION(jsSQLStatementBlobWriteFunction);
+JSC_DECLARE_HOST_FUNCTION(jsSQLStatementBlobCloseFunction);
+JSC_DECLARE_HOST_FUNCTION(jsSQLStatementEnableResultCacheFunction);
+
 JSC_DECLARE_HOST_FUNCTION(jsSQLStatementSetPrototypeFunction);
 JSC_DECLARE_HOST_FUNCTION(jsSQLStatementFunctionFinalize);
 JSC_DECLARE_HOST_FUNCTION(jsSQLStatementToStringFunction);
@@ -651,14 +790,141 @@ static JSValue toJS(JSC::VM& vm, JSC::JSGlobalObject* globalObject, sqlite3_stmt
     return jsNull();
 }
 
+// The mode byte keeps get() and all() — which cache a different shape of
+// result for the same SQL — from colliding. A null return means "don't cache"
+// (OOM, over-long key, or a parameterless empty statement).
+static WTF::CString resultCacheKey(sqlite3_stmt* stmt, char mode)
+{
+    char* expanded = sqlite3_expanded_sql(stmt);
+    if (!expanded)
+        return {};
+    size_t length = strlen(expanded);
+    if (length == 0 || length > SQLiteResultCache::kMaxKeyBytes) {
+        sqlite3_free(expanded);
+        return {};
+    }
+    char* buffer = nullptr;
+    WTF::CString key = WTF::CString::newUninitialized(length + 1, buffer);
+    buffer[0] = mode;
+    memcpy(buffer + 1, expanded, length);
+    sqlite3_free(expanded);
+    return key;
+}
+
+static SQLiteResultCache* revalidatedResultCache(VersionSqlite3* versionDB)
+{
+    auto* cache = versionDB->resultCache.get();
+    if (!cache)
+        return nullptr;
+    cache->revalidate(versionDB->version.load(), versionDB->contentEpoch.load(), sqlite3_total_changes(versionDB->db), cache->currentDataVersion(versionDB->db));
+    return cache;
+}
+
+// Returns false once the entry outgrows kMaxEntryBytes; the caller abandons
+// recording but keeps executing normally.
+static bool appendRowToResultCacheEntry(SQLiteResultCache::Entry& entry, sqlite3_stmt* stmt)
+{
+    for (size_t i = 0; i < entry.columnCount; i++) {
+        SQLiteResultCache::Cell cell;
+        cell.columnType = static_cast<uint8_t>(sqlite3_column_type(stmt, i));
+        switch (cell.columnType) {
+        case SQLITE_INTEGER: {
+            cell.integer = sqlite3_column_int64(stmt, i);
+            break;
+        }
+        case SQLITE_FLOAT: {
+            cell.number = sqlite3_column_double(stmt, i);
+            break;
+        }
+        case SQLITE3_TEXT: {
+            size_t len = sqlite3_column_bytes(stmt, i);
+            const unsigned char* text = len > 0 ? sqlite3_column_text(stmt, i) : nullptr;
+            if (text && len > 0)
+                cell.bytes.append(std::span<const uint8_t> { reinterpret_cast<const uint8_t*>(text), len });
+            break;
+        }
+        case SQLITE_BLOB: {
+            size_t len = sqlite3_column_bytes(stmt, i);
+            const void* blob = len > 0 ? sqlite3_column_blob(stmt, i) : nullptr;
+            if (blob && len > 0)
+                cell.bytes.append(std::span<const uint8_t> { reinterpret_cast<const uint8_t*>(blob), len });
+            break;
+        }
+        default: {
+            break;
+        }
+        }
+        entry.byteSize += sizeof(SQLiteResultCache::Cell) + cell.bytes.size();
+        entry.cells.append(WTFMove(cell));
+    }
+    entry.rowCount++;
+    return entry.byteSize <= SQLiteResultCache::kMaxEntryBytes;
+}
+
+// Mirrors toJS(stmt, i) above, reading from a cached cell instead of the
+// statement. Any drift between the two is a correctness bug.
+template<bool useBigInt64>
+static JSValue toJS(JSC::VM& vm, JSC::JSGlobalObject* globalObject, const SQLiteResultCache::Cell& cell)
+{
+    auto throwScope = DECLARE_THROW_SCOPE(vm);
+    switch (cell.columnType) {
+    case SQLITE_INTEGER: {
+        if constexpr (!useBigInt64) {
+            return JSC::jsNumber(cell.integer);
+        } else {
+            auto bint = JSC::JSBigInt::createFrom(globalObject, cell.integer);
+            RETURN_IF_EXCEPTION(throwScope, {});
+            return bint;
+        }
+    }
+    case SQLITE_FLOAT: {
+        return jsNumber(cell.number);
+    }
+    case SQLITE3_TEXT: {
+        size_t len = cell.bytes.size();
+        if (len == 0) [[unlikely]] {
+            return jsEmptyString(vm);
+        }
+
+        if (len < 64) {
+            return jsString(vm, WTF::String::fromUTF8ReplacingInvalidSequences({ cell.bytes.data(), len }));
+        }
+
+        auto encoded = Bun__encoding__toStringUTF8(cell.bytes.data(), len, globalObject);
+        RETURN_IF_EXCEPTION(throwScope, {});
+        return JSC::JSValue::decode(encoded);
+    }
+    case SQLITE_BLOB: {
+        size_t len = cell.bytes.size();
+        if (len > 0) [[likely]] {
+            JSC::JSUint8Array* array = JSC::JSUint8Array::createUninitialized(globalObject, globalObject->m_typedArrayUint8.get(globalObject), len);
+            RETURN_IF_EXCEPTION(throwScope, {});
+            memcpy(array->vector(), cell.bytes.data(), len);
+            return array;
+        }
+
+        auto array = JSC::JSUint8Array::create(globalObject, globalObject->m_typedArrayUint8.get(globalObject), 0);
+        RETURN_IF_EXCEPTION(throwScope, {});
+        return array;
+    }
+    default: {
+        break;
+    }
+    }
+
+    return jsNull();
+}
+
 static const HashTableValue JSSQLStatementPrototypeTableValues[] = {
     { "run"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementExecuteStatementFunctionRun, 1 } },
+    { "runBatch"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementExecuteStatementFunctionRunBatch, 1 } },
     { "get"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementExecuteStatementFunctionGet, 1 } },
     { "all"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementExecuteStatementFunctionAll, 1 } },
     { "iterate"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementExecuteStatementFunctionIterate, 1 } },
     { "as"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementSetPrototypeFunction, 1 } },
     { "values"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementExecuteStatementFunctionRows, 1 } },
     { "raw"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementExecuteStatementFunctionRawRows, 1 } },
+    { "columnar"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementExecuteStatementFunctionColumnar, 1 } },
     { "finalize"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementFunctionFinalize, 0 } },
     { "toString"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementToStringFunction, 0 } },
     { "columns"_s, static_cast<unsigned>(JSC::PropertyAttribute::ReadOnly | JSC::PropertyAttribute::CustomAccessor), NoIntrinsic, { HashTableValue::GetterSetterType, jsSqlStatementGetColumnNames, 0 } },
@@ -1534,6 +1800,13 @@ JSC_DEFINE_HOST_FUNCTION(jsSQLStatementExecuteFunction, (JSC::JSGlobalObject * l
             continue;
         }
 
+        // exec() never bumps `version`, so give the result cache its own
+        // write signal. This also covers DDL and truncate-optimized DELETEs,
+        // which sqlite3_total_changes misses.
+        if (!sqlite3_stmt_readonly(sql.stmt)) {
+            versionDB->contentEpoch++;
+        }
+
         // First statement gets the bindings.
         if (!didSetBindings && !bindingsAliveScope.value().isUndefinedOrNull()) {
             if (bindingsAliveScope.value().isObject()) {
@@ -1847,6 +2120,10 @@ JSC_DEFINE_HOST_FUNCTION(jsSQLStatementCloseStatementFunction, (JSC::JSGlobalObj
         return JSValue::encode(jsUndefined());
     }
 
+    // Drop the result cache first: it owns a prepared statement, which would
+    // make the throwing sqlite3_close below fail with SQLITE_BUSY.
+    versionDB->resultCache = nullptr;
+
     // sqlite3_close_v2 is used for automatic GC cleanup
     int statusCode = shouldThrowOnError ? sqlite3_close(db) : sqlite3_close_v2(db);
     if (statusCode != SQLITE_OK) {
@@ -1858,6 +2135,35 @@ JSC_DEFINE_HOST_FUNCTION(jsSQLStatementCloseStatementFunction, (JSC::JSGlobalObj
     return JSValue::encode(jsUndefined());
 }
 
+JSC_DEFINE_HOST_FUNCTION(jsSQLStatementEnableResultCacheFunction, (JSC::JSGlobalObject * lexicalGlobalObject, JSC::CallFrame* callFrame))
+{
+    auto& vm = JSC::getVM(lexicalGlobalObject);
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    JSValue thisValue = callFrame->thisValue();
+    JSSQLStatementConstructor* thisObject = dynamicDowncast<JSSQLStatementConstructor>(thisValue.getObject());
+    if (!thisObject) [[unlikely]] {
+        throwException(lexicalGlobalObject, scope, createError(lexicalGlobalObject, "Expected SQLStatement"_s));
+        return {};
+    }
+
+    int32_t handle = callFrame->argument(0).toInt32(lexicalGlobalObject);
+    RETURN_IF_EXCEPTION(scope, {});
+    VersionSqlite3* versionDB = databaseForHandle(handle);
+    if (!versionDB || !versionDB->db) [[unlikely]] {
+        throwException(lexicalGlobalObject, scope, createError(lexicalGlobalObject, "Invalid database handle"_s));
+        return {};
+    }
+
+    int32_t maxEntries = callFrame->argument(1).toInt32(lexicalGlobalObject);
+    RETURN_IF_EXCEPTION(scope, {});
+    if (maxEntries <= 0)
+        maxEntries = SQLiteResultCache::kDefaultMaxEntries;
+
+    versionDB->resultCache = makeUnique<SQLiteResultCache>(static_cast<size_t>(maxEntries));
+    return JSValue::encode(jsUndefined());
+}
+
 JSC_DEFINE_HOST_FUNCTION(jsSQLStatementFcntlFunction, (JSC::JSGlobalObject * lexicalGlobalObject, JSC::CallFrame* callFrame))
 {
     auto& vm = JSC::getVM(lexicalGlobalObject);
@@ -1949,6 +2255,218 @@ JSC_DEFINE_HOST_FUNCTION(jsSQLStatementFcntlFunction, (JSC::JSGlobalObject * lex
     return JSValue::encode(jsNumber(statusCode));
 }
 
+// Incremental blob I/O (sqlite3_blob_open). Open handles are keyed by a small
+// integer id handed to JS, mirroring database handles. Unlike databases, blob
+// handles are only ever touched from the JS thread, so no lock. The JS
+// Database wrapper closes its open blobs before closing the connection — a
+// connection with unfinalized blob handles refuses sqlite3_close.
+struct OpenSQLiteBlob {
+    sqlite3_blob* blob { nullptr };
+    VersionSqlite3* version_db { nullptr };
+};
+
+static Vector<OpenSQLiteBlob>& openBlobs()
+{
+    static Vector<OpenSQLiteBlob>* blobs = new Vector<OpenSQLiteBlob>();
+    return *blobs;
+}
+
+static OpenSQLiteBlob* blobForHandle(int32_t handle)
+{
+    auto& blobs = openBlobs();
+    if (handle < 0 || static_cast<size_t>(handle) >= blobs.size() || !blobs[static_cast<size_t>(handle)].blob)
+        return nullptr;
+    return &blobs[static_cast<size_t>(handle)];
+}
+
+JSC_DEFINE_HOST_FUNCTION(jsSQLStatementBlobOpenFunction, (JSC::JSGlobalObject * lexicalGlobalObject, JSC::CallFrame* callFrame))
+{
+    auto& vm = JSC::getVM(lexicalGlobalObject);
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    JSValue thisValue = callFrame->thisValue();
+    JSSQLStatementConstructor* thisObject = dynamicDowncast<JSSQLStatementConstructor>(thisValue.getObject());
+    if (!thisObject) [[unlikely]] {
+        throwException(lexicalGlobalObject, scope, createError(lexicalGlobalObject, "Expected SQL"_s));
+        return {};
+    }
+
+    int32_t dbIndex = callFrame->argument(0).toInt32(lexicalGlobalObject);
+    RETURN_IF_EXCEPTION(scope, {});
+    VersionSqlite3* versionDB = databaseForHandle(dbIndex);
+    if (!versionDB) [[unlikely]] {
+        throwException(lexicalGlobalObject, scope, createError(lexicalGlobalObject, "Invalid database handle"_s));
+        return {};
+    }
+
+    WTF::String table = callFrame->argument(1).toWTFString(lexicalGlobalObject);
+    RETURN_IF_EXCEPTION(scope, {});
+    WTF::String column = callFrame->argument(2).toWTFString(lexicalGlobalObject);
+    RETURN_IF_EXCEPTION(scope, {});
+
+    JSValue rowidValue = callFrame->argument(3);
+    int64_t rowid;
+    if (rowidValue.isBigInt()) {
+        rowid = JSBigInt::toBigInt64(rowidValue);
+    } else {
+        double rowidDouble = rowidValue.toNumber(lexicalGlobalObject);
+        RETURN_IF_EXCEPTION(scope, {});
+        rowid = static_cast<int64_t>(rowidDouble);
+    }
+
+    bool openForWrite = callFrame->argument(4).toBoolean(lexicalGlobalObject);
+    RETURN_IF_EXCEPTION(scope, {});
+
+    // Read after toWTFString: a user toString() may have closed the database.
+    sqlite3* db = versionDB->db;
+    if (!db) [[unlikely]] {
+        throwException(lexicalGlobalObject, scope, createError(lexicalGlobalObject, "Can't do this on a closed database"_s));
+        return {};
+    }
+
+    sqlite3_blob* blob = nullptr;
+    int rc = sqlite3_blob_open(db, "main", table.utf8().data(), column.utf8().data(), rowid, openForWrite ? 1 : 0, &blob);
+    if (rc != SQLITE_OK) [[unlikely]] {
+        throwException(lexicalGlobalObject, scope, createSQLiteError(lexicalGlobalObject, db));
+        return {};
+    }
+
+    auto& blobs = openBlobs();
+    size_t index = 0;
+    for (; index < blobs.size(); index++) {
+        if (!blobs[index].blob)
+            break;
+    }
+    if (index == blobs.size()) {
+        blobs.append(OpenSQLiteBlob {});
+    }
+    blobs[index].blob = blob;
+    blobs[index].version_db = versionDB;
+
+    RELEASE_AND_RETURN(scope, JSValue::encode(jsNumber(index)));
+}
+
+JSC_DEFINE_HOST_FUNCTION(jsSQLStatementBlobBytesFunction, (JSC::JSGlobalObject * lexicalGlobalObject, JSC::CallFrame* callFrame))
+{
+    auto& vm = JSC::getVM(lexicalGlobalObject);
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    int32_t handle = callFrame->argument(0).toInt32(lexicalGlobalObject);
+    RETURN_IF_EXCEPTION(scope, {});
+    OpenSQLiteBlob* entry = blobForHandle(handle);
+    if (!entry) [[unlikely]] {
+        throwException(lexicalGlobalObject, scope, createError(lexicalGlobalObject, "Invalid blob handle"_s));
+        return {};
+    }
+
+    return JSValue::encode(jsNumber(sqlite3_blob_bytes(entry->blob)));
+}
+
+JSC_DEFINE_HOST_FUNCTION(jsSQLStatementBlobReadFunction, (JSC::JSGlobalObject * lexicalGlobalObject, JSC::CallFrame* callFrame))
+{
+    auto& vm = JSC::getVM(lexicalGlobalObject);
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    int32_t handle = callFrame->argument(0).toInt32(lexicalGlobalObject);
+    RETURN_IF_EXCEPTION(scope, {});
+    OpenSQLiteBlob* entry = blobForHandle(handle);
+    if (!entry) [[unlikely]] {
+        throwException(lexicalGlobalObject, scope, createError(lexicalGlobalObject, "Invalid blob handle"_s));
+        return {};
+    }
+
+    int32_t offset = callFrame->argument(1).toInt32(lexicalGlobalObject);
+    RETURN_IF_EXCEPTION(scope, {});
+    int32_t length = callFrame->argument(2).toInt32(lexicalGlobalObject);
+    RETURN_IF_EXCEPTION(scope, {});
+
+    if (offset < 0 || length < 0) [[unlikely]] {
+        throwException(lexicalGlobalObject, scope, createRangeError(lexicalGlobalObject, "Expected a non-negative offset and length"_s));
+        return {};
+    }
+
+    JSC::JSUint8Array* array = JSC::JSUint8Array::createUninitialized(lexicalGlobalObject, lexicalGlobalObject->m_typedArrayUint8.get(lexicalGlobalObject), length);
+    RETURN_IF_EXCEPTION(scope, {});
+
+    if (length > 0) {
+        int rc = sqlite3_blob_read(entry->blob, array->typedVector(), length, offset);
+        if (rc != SQLITE_OK) [[unlikely]] {
+            throwException(lexicalGlobalObject, scope, createSQLiteError(lexicalGlobalObject, entry->version_db->db));
+            return {};
+        }
+    }
+
+    RELEASE_AND_RETURN(scope, JSValue::encode(array));
+}
+
+JSC_DEFINE_HOST_FUNCTION(jsSQLStatementBlobWriteFunction, (JSC::JSGlobalObject * lexicalGlobalObject, JSC::CallFrame* callFrame))
+{
+    auto& vm = JSC::getVM(lexicalGlobalObject);
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    int32_t handle = callFrame->argument(0).toInt32(lexicalGlobalObject);
+    RETURN_IF_EXCEPTION(scope, {});
+    OpenSQLiteBlob* entry = blobForHandle(handle);
+    if (!entry) [[unlikely]] {
+        throwException(lexicalGlobalObject, scope, createError(lexicalGlobalObject, "Invalid blob handle"_s));
+        return {};
+    }
+
+    auto* view = dynamicDowncast<JSC::JSArrayBufferView>(callFrame->argument(1));
+    if (!view || view->isDetached()) [[unlikely]] {
+        throwException(lexicalGlobalObject, scope, createTypeError(lexicalGlobalObject, "Expected a TypedArray or DataView"_s));
+        return {};
+    }
+
+    int32_t offset = callFrame->argument(2).toInt32(lexicalGlobalObject);
+    RETURN_IF_EXCEPTION(scope, {});
+    if (offset < 0) [[unlikely]] {
+        throwException(lexicalGlobalObject, scope, createRangeError(lexicalGlobalObject, "Expected a non-negative offset"_s));
+        return {};
+    }
+
+    size_t byteLength = view->byteLength();
+    if (byteLength > 0) {
+        int rc = sqlite3_blob_write(entry->blob, view->vector(), byteLength, offset);
+        if (rc != SQLITE_OK) [[unlikely]] {
+            throwException(lexicalGlobalObject, scope, createSQLiteError(lexicalGlobalObject, entry->version_db->db));
+            return {};
+        }
+        // Incremental blob writes fire no hook and change no counter the
+        // result cache otherwise watches.
+        entry->version_db->contentEpoch++;
+    }
+
+    RELEASE_AND_RETURN(scope, JSValue::encode(jsUndefined()));
+}
+
+JSC_DEFINE_HOST_FUNCTION(jsSQLStatementBlobCloseFunction, (JSC::JSGlobalObject * lexicalGlobalObject, JSC::CallFrame* callFrame))
+{
+    auto& vm = JSC::getVM(lexicalGlobalObject);
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    int32_t handle = callFrame->argument(0).toInt32(lexicalGlobalObject);
+    RETURN_IF_EXCEPTION(scope, {});
+    OpenSQLiteBlob* entry = blobForHandle(handle);
+    if (!entry) [[unlikely]] {
+        throwException(lexicalGlobalObject, scope, createError(lexicalGlobalObject, "Invalid blob handle"_s));
+        return {};
+    }
+
+    // sqlite3_blob_close always frees the handle; a non-OK return only
+    // reports a delayed write error, which we surface.
+    int rc = sqlite3_blob_close(entry->blob);
+    sqlite3* db = entry->version_db->db;
+    entry->blob = nullptr;
+    entry->version_db = nullptr;
+    if (rc != SQLITE_OK && db) [[unlikely]] {
+        throwException(lexicalGlobalObject, scope, createSQLiteError(lexicalGlobalObject, db));
+        return {};
+    }
+
+    RELEASE_AND_RETURN(scope, JSValue::encode(jsUndefined()));
+}
+
 /* Hash table for constructor */
 static const HashTableValue JSSQLStatementConstructorTableValues[] = {
     { "open"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementOpenStatementFunction, 2 } },
@@ -1961,6 +2479,12 @@ static const HashTableValue JSSQLStatementConstructorTableValues[] = {
     { "serialize"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementSerialize, 1 } },
     { "deserialize"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementDeserialize, 2 } },
     { "fcntl"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementFcntlFunction, 2 } },
+    { "blobOpen"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementBlobOpenFunction, 5 } },
+    { "blobBytes"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementBlobBytesFunction, 1 } },
+    { "blobRead"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementBlobReadFunction, 3 } },
+    { "blobWrite"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementBlobWriteFunction, 3 } },
+    { "blobClose"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementBlobCloseFunction, 1 } },
+    { "enableResultCache"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementEnableResultCacheFunction, 2 } },
 };
 
 const ClassInfo JSSQLStatementConstructor::s_info = { "SQLStatement"_s, &Base::s_info, nullptr, nullptr, CREATE_METHOD_TABLE(JSSQLStatementConstructor) };
@@ -2034,7 +2558,57 @@ static inline JSC::JSValue constructResultObject(JSC::JSGlobalObject* lexicalGlo
     RELEASE_AND_RETURN(scope, result);
 }
 
-static inline JSC::JSArray* constructResultRowRaw(JSC::VM& vm, JSC::JSGlobalObject* lexicalGlobalObject, JSSQLStatement* castedThis, size_t columnCount)
+// constructResultObject, but replaying one cached row. The caller has already
+// run initializeColumnNames and checked that the entry's column count still
+// matches the statement's.
+template<bool useBigInt64>
+static inline JSC::JSValue constructResultObjectFromCache(JSC::JSGlobalObject* lexicalGlobalObject, JSSQLStatement* castedThis, const SQLiteResultCache::Entry& entry, size_t row)
+{
+    auto& columnNames = castedThis->columnNames->data()->propertyNameVector();
+    int count = columnNames.size();
+    auto& vm = JSC::getVM(lexicalGlobalObject);
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    JSC::JSObject* result;
+
+    if (auto* structure = castedThis->_structure.get()) {
+        result = JSC::constructEmptyObject(vm, structure);
+
+        for (int i = 0, j = 0; j < count; i++, j++) {
+            if (!castedThis->validColumns.get(i)) {
+                // this column is duplicate, skip
+                j -= 1;
+                continue;
+            }
+            auto value = toJS<useBigInt64>(vm, lexicalGlobalObject, entry.at(row, i));
+            RETURN_IF_EXCEPTION(scope, {});
+            result->putDirectOffset(vm, j, value);
+        }
+
+    } else {
+        if (count <= JSFinalObject::maxInlineCapacity) {
+            result = JSC::JSFinalObject::create(vm, castedThis->_prototype.get()->structure());
+        } else {
+            JSObject* prototype = castedThis->userPrototype ? castedThis->userPrototype.get() : lexicalGlobalObject->objectPrototype();
+            result = JSC::JSFinalObject::create(vm, JSC::JSFinalObject::createStructure(vm, lexicalGlobalObject, prototype, JSFinalObject::maxInlineCapacity));
+        }
+
+        for (int i = 0, j = 0; j < count; i++, j++) {
+            if (!castedThis->validColumns.get(i)) {
+                j -= 1;
+                continue;
+            }
+            const auto& name = columnNames[j];
+            auto value = toJS<useBigInt64>(vm, lexicalGlobalObject, entry.at(row, i));
+            RETURN_IF_EXCEPTION(scope, {});
+            result->putDirect(vm, name, value, 0);
+        }
+    }
+
+    RELEASE_AND_RETURN(scope, result);
+}
+
+static inline JSC::JSArray* constructResultRowRaw(JSC::VM& vm, JSC::JSGlobalObject* lexicalGlobalObject, JSSQLStatement* castedThis, size_t columnCount)
 {
     auto throwScope = DECLARE_THROW_SCOPE(vm);
     auto* stmt = castedThis->stmt;
@@ -2226,6 +2800,35 @@ JSC_DEFINE_HOST_FUNCTION(jsSQLStatementExecuteStatementFunctionAll, (JSC::JSGlob
         DO_REBIND(arg0);
     }
 
+    WTF::CString cacheKey;
+    SQLiteResultCache* resultCache = nullptr;
+    if (castedThis->version_db->resultCache && sqlite3_stmt_readonly(stmt)) {
+        cacheKey = resultCacheKey(stmt, 'A');
+        if (!cacheKey.isNull()) {
+            resultCache = revalidatedResultCache(castedThis->version_db);
+            if (auto* entry = resultCache->lookup(cacheKey)) {
+                if (!castedThis->hasExecuted || castedThis->need_update()) {
+                    initializeColumnNames(lexicalGlobalObject, castedThis);
+                    RETURN_IF_EXCEPTION(scope, {});
+                }
+                if (entry->columnCount == static_cast<size_t>(sqlite3_column_count(stmt)) && castedThis->columnNames->size() > 0) {
+                    JSC::JSArray* resultArray = JSC::constructEmptyArray(lexicalGlobalObject, static_cast<ArrayAllocationProfile*>(nullptr), 0);
+                    RETURN_IF_EXCEPTION(scope, {});
+                    const bool useBigInt64 = castedThis->useBigInt64;
+                    for (size_t row = 0; row < entry->rowCount; row++) {
+                        JSC::JSValue rowObject = useBigInt64
+                            ? constructResultObjectFromCache<true>(lexicalGlobalObject, castedThis, *entry, row)
+                            : constructResultObjectFromCache<false>(lexicalGlobalObject, castedThis, *entry, row);
+                        RETURN_IF_EXCEPTION(scope, {});
+                        resultArray->push(lexicalGlobalObject, rowObject);
+                        RETURN_IF_EXCEPTION(scope, {});
+                    }
+                    RELEASE_AND_RETURN(scope, JSValue::encode(resultArray));
+                }
+            }
+        }
+    }
+
     int status = sqlite3_step(stmt);
     if (!sqlite3_stmt_readonly(stmt)) {
         castedThis->version_db->version++;
@@ -2238,6 +2841,14 @@ JSC_DEFINE_HOST_FUNCTION(jsSQLStatementExecuteStatementFunctionAll, (JSC::JSGlob
 
     size_t columnCount = castedThis->columnNames->size();
     JSValue result = jsUndefined();
+
+    // Results observed inside an open transaction could be rolled back
+    // without moving any invalidation counter, so only record in autocommit.
+    std::optional<SQLiteResultCache::Entry> recording;
+    if (resultCache && columnCount > 0 && sqlite3_get_autocommit(castedThis->version_db->db)) {
+        recording.emplace();
+        recording->columnCount = static_cast<size_t>(sqlite3_column_count(stmt));
+    }
     if (status == SQLITE_ROW) {
         // this is a count from UPDATE or another query like that
         if (columnCount == 0) {
@@ -2252,6 +2863,8 @@ JSC_DEFINE_HOST_FUNCTION(jsSQLStatementExecuteStatementFunctionAll, (JSC::JSGlob
             RETURN_IF_EXCEPTION(scope, {});
             if (useBigInt64) {
                 do {
+                    if (recording && !appendRowToResultCacheEntry(*recording, stmt))
+                        recording.reset();
                     JSC::JSValue result = constructResultObject<true>(lexicalGlobalObject, castedThis);
                     RETURN_IF_EXCEPTION(scope, {});
                     resultArray->push(lexicalGlobalObject, result);
@@ -2264,6 +2877,8 @@ JSC_DEFINE_HOST_FUNCTION(jsSQLStatementExecuteStatementFunctionAll, (JSC::JSGlob
                 } while (status == SQLITE_ROW);
             } else {
                 do {
+                    if (recording && !appendRowToResultCacheEntry(*recording, stmt))
+                        recording.reset();
                     JSC::JSValue result = constructResultObject<false>(lexicalGlobalObject, castedThis);
                     RETURN_IF_EXCEPTION(scope, {});
                     resultArray->push(lexicalGlobalObject, result);
@@ -2288,6 +2903,9 @@ JSC_DEFINE_HOST_FUNCTION(jsSQLStatementExecuteStatementFunctionAll, (JSC::JSGlob
         return {};
     }
 
+    if (recording && status == SQLITE_DONE)
+        resultCache->store(WTFMove(cacheKey), WTFMove(*recording));
+
     int64_t memoryChange = sqlite_malloc_amount - currentMemoryUsage;
     if (memoryChange > 255) {
         vm.heap.deprecatedReportExtraMemory(memoryChange);
@@ -2319,6 +2937,31 @@ JSC_DEFINE_HOST_FUNCTION(jsSQLStatementExecuteStatementFunctionGet, (JSC::JSGlob
         DO_REBIND(arg0);
     }
 
+    WTF::CString cacheKey;
+    SQLiteResultCache* resultCache = nullptr;
+    if (castedThis->version_db->resultCache && sqlite3_stmt_readonly(stmt)) {
+        cacheKey = resultCacheKey(stmt, 'G');
+        if (!cacheKey.isNull()) {
+            resultCache = revalidatedResultCache(castedThis->version_db);
+            if (auto* entry = resultCache->lookup(cacheKey)) {
+                if (!castedThis->hasExecuted || castedThis->need_update()) {
+                    initializeColumnNames(lexicalGlobalObject, castedThis);
+                    RETURN_IF_EXCEPTION(scope, {});
+                }
+                if (entry->columnCount == static_cast<size_t>(sqlite3_column_count(stmt)) && castedThis->columnNames->size() > 0) {
+                    if (entry->rowCount == 0) {
+                        RELEASE_AND_RETURN(scope, JSValue::encode(jsNull()));
+                    }
+                    JSC::JSValue rowObject = castedThis->useBigInt64
+                        ? constructResultObjectFromCache<true>(lexicalGlobalObject, castedThis, *entry, 0)
+                        : constructResultObjectFromCache<false>(lexicalGlobalObject, castedThis, *entry, 0);
+                    RETURN_IF_EXCEPTION(scope, {});
+                    RELEASE_AND_RETURN(scope, JSValue::encode(rowObject));
+                }
+            }
+        }
+    }
+
     int status = sqlite3_step(stmt);
     if (!sqlite3_stmt_readonly(stmt)) {
         castedThis->version_db->version++;
@@ -2329,10 +2972,19 @@ JSC_DEFINE_HOST_FUNCTION(jsSQLStatementExecuteStatementFunctionGet, (JSC::JSGlob
         RETURN_IF_EXCEPTION(scope, {});
     }
 
+    // See the matching guard in all(): don't record inside a transaction.
+    std::optional<SQLiteResultCache::Entry> recording;
+    if (resultCache && castedThis->columnNames->size() > 0 && sqlite3_get_autocommit(castedThis->version_db->db)) {
+        recording.emplace();
+        recording->columnCount = static_cast<size_t>(sqlite3_column_count(stmt));
+    }
+
     JSValue result = jsNull();
     if (status == SQLITE_ROW) {
         bool useBigInt64 = castedThis->useBigInt64;
 
+        if (recording && !appendRowToResultCacheEntry(*recording, stmt))
+            recording.reset();
         result = useBigInt64 ? constructResultObject<true>(lexicalGlobalObject, castedThis)
                              : constructResultObject<false>(lexicalGlobalObject, castedThis);
         RETURN_IF_EXCEPTION(scope, {});
@@ -2342,6 +2994,8 @@ JSC_DEFINE_HOST_FUNCTION(jsSQLStatementExecuteStatementFunctionGet, (JSC::JSGlob
     }
 
     if (status == SQLITE_DONE || status == SQLITE_OK) {
+        if (recording && status == SQLITE_DONE)
+            resultCache->store(WTFMove(cacheKey), WTFMove(*recording));
         RELEASE_AND_RETURN(scope, JSValue::encode(result));
     } else {
         throwException(lexicalGlobalObject, scope, createSQLiteError(lexicalGlobalObject, castedThis->version_db->db));
@@ -2537,6 +3191,222 @@ JSC_DEFINE_HOST_FUNCTION(jsSQLStatementExecuteStatementFunctionRawRows, (JSC::JS
     RELEASE_AND_RETURN(scope, JSC::JSValue::encode(result));
 }
 
+// Accumulator for one output column of columnar(). Numeric values stay in a
+// flat native buffer until the statement finishes; the first text, blob, NULL,
+// or mixed-type value demotes the column to a plain JS array.
+enum class ColumnarKind : uint8_t {
+    Int64,
+    Float64,
+    Generic,
+};
+
+struct ColumnarColumn {
+    ColumnarKind kind { ColumnarKind::Float64 };
+    WTF::Vector<int64_t> ints;
+    WTF::Vector<double> doubles;
+    JSC::JSArray* generic { nullptr };
+};
+
+JSC_DEFINE_HOST_FUNCTION(jsSQLStatementExecuteStatementFunctionColumnar, (JSC::JSGlobalObject * lexicalGlobalObject, JSC::CallFrame* callFrame))
+{
+    auto& vm = JSC::getVM(lexicalGlobalObject);
+    auto scope = DECLARE_THROW_SCOPE(vm);
+    auto castedThis = dynamicDowncast<JSSQLStatement>(callFrame->thisValue());
+
+    CHECK_THIS;
+
+    auto* stmt = castedThis->stmt;
+    CHECK_PREPARED
+
+    int statusCode = sqlite3_reset(stmt);
+    if (statusCode != SQLITE_OK) [[unlikely]] {
+        throwException(lexicalGlobalObject, scope, createSQLiteError(lexicalGlobalObject, castedThis->version_db->db));
+        sqlite3_reset(stmt);
+        return {};
+    }
+
+    int count = callFrame->argumentCount();
+    if (count > 0) {
+        auto arg0 = callFrame->argument(0);
+        DO_REBIND(arg0);
+    }
+
+    int status = sqlite3_step(stmt);
+    if (!sqlite3_stmt_readonly(stmt)) {
+        castedThis->version_db->version++;
+    }
+
+    if (!castedThis->hasExecuted || castedThis->need_update()) {
+        initializeColumnNames(lexicalGlobalObject, castedThis);
+        if (scope.exception()) [[unlikely]] {
+            sqlite3_reset(stmt);
+            RELEASE_AND_RETURN(scope, {});
+        }
+    }
+
+    auto& columnNames = castedThis->columnNames->data()->propertyNameVector();
+    size_t columnCount = sqlite3_column_count(stmt);
+    const bool useBigInt64 = castedThis->useBigInt64;
+
+    // this is a count from UPDATE or another query like that
+    if (columnNames.size() == 0) {
+        while (status == SQLITE_ROW) {
+            status = sqlite3_step(stmt);
+        }
+
+        if (status != SQLITE_DONE && status != SQLITE_OK) [[unlikely]] {
+            throwException(lexicalGlobalObject, scope, createSQLiteError(lexicalGlobalObject, castedThis->version_db->db));
+            sqlite3_reset(stmt);
+            return {};
+        }
+
+        RELEASE_AND_RETURN(scope, JSValue::encode(JSC::constructEmptyObject(lexicalGlobalObject)));
+    }
+
+    WTF::Vector<ColumnarColumn, 8> columns;
+    columns.grow(columnCount);
+    if (useBigInt64) {
+        for (auto& column : columns)
+            column.kind = ColumnarKind::Int64;
+    }
+
+    // Keeps the demoted columns' arrays alive while we step; native Vectors
+    // aren't scanned by GC.
+    MarkedArgumentBuffer genericArrays;
+
+    while (status == SQLITE_ROW) {
+        for (size_t i = 0; i < columnCount; i++) {
+            auto& column = columns[i];
+            int columnType = sqlite3_column_type(stmt, i);
+
+            switch (column.kind) {
+            case ColumnarKind::Int64: {
+                if (columnType == SQLITE_INTEGER) {
+                    column.ints.append(sqlite3_column_int64(stmt, i));
+                    continue;
+                }
+                break;
+            }
+            case ColumnarKind::Float64: {
+                if (columnType == SQLITE_INTEGER) {
+                    column.doubles.append(static_cast<double>(sqlite3_column_int64(stmt, i)));
+                    continue;
+                }
+                if (columnType == SQLITE_FLOAT) {
+                    column.doubles.append(sqlite3_column_double(stmt, i));
+                    continue;
+                }
+                break;
+            }
+            case ColumnarKind::Generic: {
+                break;
+            }
+            }
+
+            if (column.kind != ColumnarKind::Generic) {
+                // First value this column can't hold natively: replay the
+                // buffered numbers into a plain array and stay generic.
+                column.generic = JSC::constructEmptyArray(lexicalGlobalObject, static_cast<ArrayAllocationProfile*>(nullptr), 0);
+                if (scope.exception()) [[unlikely]] {
+                    sqlite3_reset(stmt);
+                    RELEASE_AND_RETURN(scope, {});
+                }
+                genericArrays.append(column.generic);
+
+                if (column.kind == ColumnarKind::Int64) {
+                    for (int64_t buffered : column.ints) {
+                        JSValue value = JSC::JSBigInt::createFrom(lexicalGlobalObject, buffered);
+                        if (!scope.exception()) [[likely]]
+                            column.generic->push(lexicalGlobalObject, value);
+                        if (scope.exception()) [[unlikely]] {
+                            sqlite3_reset(stmt);
+                            RELEASE_AND_RETURN(scope, {});
+                        }
+                    }
+                    column.ints.clear();
+                } else {
+                    for (double buffered : column.doubles) {
+                        column.generic->push(lexicalGlobalObject, jsNumber(buffered));
+                        if (scope.exception()) [[unlikely]] {
+                            sqlite3_reset(stmt);
+                            RELEASE_AND_RETURN(scope, {});
+                        }
+                    }
+                    column.doubles.clear();
+                }
+                column.kind = ColumnarKind::Generic;
+            }
+
+            JSValue value = useBigInt64 ? toJS<true>(vm, lexicalGlobalObject, stmt, i)
+                                        : toJS<false>(vm, lexicalGlobalObject, stmt, i);
+            if (!scope.exception()) [[likely]]
+                column.generic->push(lexicalGlobalObject, value);
+            if (scope.exception()) [[unlikely]] {
+                sqlite3_reset(stmt);
+                RELEASE_AND_RETURN(scope, {});
+            }
+        }
+
+        if (castedThis->stmt != stmt) [[unlikely]] {
+            throwException(lexicalGlobalObject, scope, createError(lexicalGlobalObject, "Statement has finalized"_s));
+            return {};
+        }
+
+        status = sqlite3_step(stmt);
+    }
+
+    if (status != SQLITE_DONE && status != SQLITE_OK) [[unlikely]] {
+        throwException(lexicalGlobalObject, scope, createSQLiteError(lexicalGlobalObject, castedThis->version_db->db));
+        sqlite3_reset(stmt);
+        return {};
+    }
+
+    JSC::JSObject* result = JSC::constructEmptyObject(lexicalGlobalObject);
+    RETURN_IF_EXCEPTION(scope, {});
+
+    // i: the index of columns returned from SQLite
+    // j: the index of object property
+    int nameCount = columnNames.size();
+    for (int i = 0, j = 0; j < nameCount; i++, j++) {
+        if (!castedThis->validColumns.get(i)) {
+            // this column is duplicate, skip
+            j -= 1;
+            continue;
+        }
+
+        auto& column = columns[i];
+        JSValue columnValue;
+        switch (column.kind) {
+        case ColumnarKind::Int64: {
+            auto* array = JSC::JSBigInt64Array::createUninitialized(lexicalGlobalObject, lexicalGlobalObject->typedArrayStructureWithTypedArrayType<TypedArrayType::TypeBigInt64>(), column.ints.size());
+            RETURN_IF_EXCEPTION(scope, {});
+            if (column.ints.size() > 0) {
+                memcpy(array->vector(), column.ints.span().data(), column.ints.size() * sizeof(int64_t));
+            }
+            columnValue = array;
+            break;
+        }
+        case ColumnarKind::Float64: {
+            auto* array = JSC::JSFloat64Array::createUninitialized(lexicalGlobalObject, lexicalGlobalObject->typedArrayStructureWithTypedArrayType<TypedArrayType::TypeFloat64>(), column.doubles.size());
+            RETURN_IF_EXCEPTION(scope, {});
+            if (column.doubles.size() > 0) {
+                memcpy(array->vector(), column.doubles.span().data(), column.doubles.size() * sizeof(double));
+            }
+            columnValue = array;
+            break;
+        }
+        case ColumnarKind::Generic: {
+            columnValue = column.generic;
+            break;
+        }
+        }
+
+        result->putDirect(vm, columnNames[j], columnValue, 0);
+    }
+
+    RELEASE_AND_RETURN(scope, JSC::JSValue::encode(result));
+}
+
 JSC_DEFINE_HOST_FUNCTION(jsSQLStatementExecuteStatementFunctionRun, (JSC::JSGlobalObject * lexicalGlobalObject, JSC::CallFrame* callFrame))
 {
 
@@ -2609,6 +3479,130 @@ JSC_DEFINE_HOST_FUNCTION(jsSQLStatementExecuteStatementFunctionRun, (JSC::JSGlob
     RELEASE_AND_RETURN(scope, JSC::JSValue::encode(jsUndefined()));
 }
 
+// `stmt.runBatch(rows)` — bind/step/reset every row of an array in one native
+// loop, so a 10k-row insert crosses the JS→native boundary once instead of 10k
+// times. The whole batch runs under a single transaction when the caller
+// hasn't already opened one; any failing row rolls the batch back.
+JSC_DEFINE_HOST_FUNCTION(jsSQLStatementExecuteStatementFunctionRunBatch, (JSC::JSGlobalObject * lexicalGlobalObject, JSC::CallFrame* callFrame))
+{
+    auto& vm = JSC::getVM(lexicalGlobalObject);
+    auto scope = DECLARE_THROW_SCOPE(vm);
+    auto castedThis = dynamicDowncast<JSSQLStatement>(callFrame->thisValue());
+
+    CHECK_THIS
+
+    auto* stmt = castedThis->stmt;
+    CHECK_PREPARED
+
+    int statusCode = sqlite3_reset(stmt);
+    if (statusCode != SQLITE_OK) [[unlikely]] {
+        throwException(lexicalGlobalObject, scope, createSQLiteError(lexicalGlobalObject, castedThis->version_db->db));
+        return {};
+    }
+
+    JSValue diffValue = callFrame->argument(0);
+
+    JSValue rowsValue = callFrame->argument(1);
+    if (!rowsValue.isObject()) [[unlikely]] {
+        throwException(lexicalGlobalObject, scope, createTypeError(lexicalGlobalObject, "Expected an array of rows"_s));
+        return {};
+    }
+    JSC::JSObject* rowsObject = rowsValue.getObject();
+
+    if (!castedThis->version_db->db) [[unlikely]] {
+        throwException(lexicalGlobalObject, scope, createError(lexicalGlobalObject, "Database has closed"_s));
+        return {};
+    }
+
+    auto* db = castedThis->version_db->db;
+    int total_changes_before = sqlite3_total_changes(db);
+
+    // Wrap the batch in our own transaction only when the caller isn't
+    // already inside one; nesting a BEGIN would fail outright.
+    const bool ownTransaction = sqlite3_get_autocommit(db);
+    if (ownTransaction) {
+        if (sqlite3_exec(db, "BEGIN", nullptr, nullptr, nullptr) != SQLITE_OK) [[unlikely]] {
+            throwException(lexicalGlobalObject, scope, createSQLiteError(lexicalGlobalObject, db));
+            return {};
+        }
+    }
+
+    JSC::forEachInArrayLike(lexicalGlobalObject, rowsObject, [&](JSValue row) -> bool {
+        if (!row.isObject()) [[unlikely]] {
+            throwException(lexicalGlobalObject, scope, createTypeError(lexicalGlobalObject, "Expected object or array"_s));
+            return false;
+        }
+
+        JSC::JSValue reb = castedThis->rebind(lexicalGlobalObject, row, db);
+        if (scope.exception()) [[unlikely]]
+            return false;
+        if (!reb.isNumber()) [[unlikely]] {
+            throwException(lexicalGlobalObject, scope, reb);
+            return false;
+        }
+
+        int status = sqlite3_step(stmt);
+        while (status == SQLITE_ROW) {
+            status = sqlite3_step(stmt);
+        }
+
+        if (status != SQLITE_DONE && status != SQLITE_OK) [[unlikely]] {
+            throwException(lexicalGlobalObject, scope, createSQLiteError(lexicalGlobalObject, db));
+            return false;
+        }
+
+        // rebind() can run user code (toString on bound values), which can
+        // finalize the statement out from under us.
+        if (castedThis->stmt != stmt) [[unlikely]] {
+            throwException(lexicalGlobalObject, scope, createError(lexicalGlobalObject, "Statement has finalized"_s));
+            return false;
+        }
+
+        sqlite3_reset(stmt);
+        return true;
+    });
+
+    if (scope.exception()) [[unlikely]] {
+        sqlite3_reset(stmt);
+        if (ownTransaction) {
+            sqlite3_exec(db, "ROLLBACK", nullptr, nullptr, nullptr);
+        }
+        RELEASE_AND_RETURN(scope, {});
+    }
+
+    if (ownTransaction) {
+        if (sqlite3_exec(db, "COMMIT", nullptr, nullptr, nullptr) != SQLITE_OK) [[unlikely]] {
+            sqlite3_exec(db, "ROLLBACK", nullptr, nullptr, nullptr);
+            throwException(lexicalGlobalObject, scope, createSQLiteError(lexicalGlobalObject, db));
+            return {};
+        }
+    }
+
+    if (!sqlite3_stmt_readonly(stmt)) {
+        castedThis->version_db->version++;
+    }
+
+    if (!castedThis->hasExecuted || castedThis->need_update()) {
+        initializeColumnNames(lexicalGlobalObject, castedThis);
+        RETURN_IF_EXCEPTION(scope, {});
+    }
+
+    if (auto* diff = dynamicDowncast<JSC::InternalFieldTuple>(diffValue)) {
+        const int total_changes_after = sqlite3_total_changes(db);
+        int64_t last_insert_rowid = sqlite3_last_insert_rowid(db);
+        diff->putInternalField(vm, 0, JSC::jsNumber(total_changes_after - total_changes_before));
+        if (castedThis->useBigInt64) {
+            JSValue lastRowIdBigInt = JSBigInt::createFrom(lexicalGlobalObject, last_insert_rowid);
+            RETURN_IF_EXCEPTION(scope, {});
+            diff->putInternalField(vm, 1, lastRowIdBigInt);
+        } else {
+            diff->putInternalField(vm, 1, JSC::jsNumber(last_insert_rowid));
+        }
+    }
+
+    RELEASE_AND_RETURN(scope, JSC::JSValue::encode(jsUndefined()));
+}
+
 JSC_DEFINE_HOST_FUNCTION(jsSQLStatementToStringFunction, (JSC::JSGlobalObject * lexicalGlobalObject, JSC::CallFrame* callFrame))
 {
     auto& vm = JSC::getVM(lexicalGlobalObject);
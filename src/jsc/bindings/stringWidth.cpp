@@ -32,6 +32,8 @@
 #include <array>
 #include <optional>
 #include <span>
+#include <JavaScriptCore/JSObjectInlines.h>
+#include <JavaScriptCore/ObjectConstructor.h>
 #include <wtf/text/WTFString.h>
 #include <unicode/utf16.h>
 
@@ -1031,6 +1033,50 @@ static void applyTruthyBooleanOption(JSC::JSGlobalObject* globalObject, JSC::JSV
     out = value.toBoolean(globalObject);
 }
 
+// Parses `{ countAnsiEscapeCodes, ambiguousIsNarrow }`, leaving the defaults
+// in place for anything missing. May throw (option getters can run JS).
+static void parseStringWidthOptions(JSC::JSGlobalObject* globalObject, JSC::JSValue optionsValue, bool& countAnsiEscapeCodes, bool& ambiguousIsNarrow)
+{
+    if (!optionsValue.isObject())
+        return;
+
+    auto& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+    JSC::JSObject* optionsObject = JSC::asObject(optionsValue);
+
+    // Same prototype-pollution-mitigated lookup the previous implementation
+    // (and the other Bun option parsers) use: stops before Object.prototype.
+    JSC::JSValue countAnsiValue = getIfPropertyExistsPrototypePollutionMitigation(globalObject, optionsObject, JSC::Identifier::fromString(vm, "countAnsiEscapeCodes"_s));
+    RETURN_IF_EXCEPTION(scope, void());
+    applyTruthyBooleanOption(globalObject, countAnsiValue, countAnsiEscapeCodes);
+
+    JSC::JSValue ambiguousIsNarrowValue = getIfPropertyExistsPrototypePollutionMitigation(globalObject, optionsObject, JSC::Identifier::fromString(vm, "ambiguousIsNarrow"_s));
+    RETURN_IF_EXCEPTION(scope, void());
+    applyTruthyBooleanOption(globalObject, ambiguousIsNarrowValue, ambiguousIsNarrow);
+}
+
+// Dispatch to the encoding-specific counters for one materialized string.
+static size_t computeStringWidth(WTF::StringView view, bool countAnsiEscapeCodes, bool ambiguousAsWide)
+{
+    if (view.isEmpty())
+        return 0;
+    if (view.is8Bit()) {
+        // 8-bit JSC strings are Latin-1.
+        const auto span = view.span8();
+        const std::span<const uint8_t> bytes { reinterpret_cast<const uint8_t*>(span.data()), span.size() };
+        if (ambiguousAsWide) {
+            return countAnsiEscapeCodes
+                ? StringWidth::visibleLatin1WidthAmbiguousAsWide(bytes)
+                : StringWidth::visibleLatin1WidthExcludeANSIAmbiguousAsWide(bytes);
+        }
+        return countAnsiEscapeCodes
+            ? StringWidth::visibleLatin1Width(bytes)
+            : StringWidth::visibleLatin1WidthExcludeANSI(bytes);
+    }
+    const auto span = view.span16();
+    return StringWidth::visibleUTF16Width({ span.data(), span.size() }, !countAnsiEscapeCodes, ambiguousAsWide);
+}
+
 JSC_DEFINE_HOST_FUNCTION(jsFunctionBunStringWidth, (JSC::JSGlobalObject * globalObject, JSC::CallFrame* callFrame))
 {
     auto& vm = globalObject->vm();
@@ -1049,43 +1095,66 @@ JSC_DEFINE_HOST_FUNCTION(jsFunctionBunStringWidth, (JSC::JSGlobalObject * global
 
     bool countAnsiEscapeCodes = false;
     bool ambiguousIsNarrow = true;
+    parseStringWidthOptions(globalObject, callFrame->argument(1), countAnsiEscapeCodes, ambiguousIsNarrow);
+    RETURN_IF_EXCEPTION(scope, {});
 
-    const JSC::JSValue optionsValue = callFrame->argument(1);
-    if (optionsValue.isObject()) {
-        JSC::JSObject* optionsObject = JSC::asObject(optionsValue);
+    const size_t width = computeStringWidth(view, countAnsiEscapeCodes, !ambiguousIsNarrow);
+    return JSC::JSValue::encode(JSC::jsNumber(static_cast<double>(width)));
+}
 
-        // Same prototype-pollution-mitigated lookup the previous implementation
-        // (and the other Bun option parsers) use: stops before Object.prototype.
-        JSC::JSValue countAnsiValue = getIfPropertyExistsPrototypePollutionMitigation(globalObject, optionsObject, JSC::Identifier::fromString(vm, "countAnsiEscapeCodes"_s));
-        RETURN_IF_EXCEPTION(scope, {});
-        applyTruthyBooleanOption(globalObject, countAnsiValue, countAnsiEscapeCodes);
+// `Bun.stringWidth.batch(strings, options)` — widths of every element of an
+// array-like in one call. The options are parsed once and the per-call
+// overhead (call frame, argument coercion, two option lookups) is paid once
+// instead of per cell, which is what dominates when a TUI re-measures
+// thousands of short cells per frame.
+JSC_DEFINE_HOST_FUNCTION(jsFunctionBunStringWidthBatch, (JSC::JSGlobalObject * globalObject, JSC::CallFrame* callFrame))
+{
+    auto& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
 
-        JSC::JSValue ambiguousIsNarrowValue = getIfPropertyExistsPrototypePollutionMitigation(globalObject, optionsObject, JSC::Identifier::fromString(vm, "ambiguousIsNarrow"_s));
-        RETURN_IF_EXCEPTION(scope, {});
-        applyTruthyBooleanOption(globalObject, ambiguousIsNarrowValue, ambiguousIsNarrow);
+    JSC::JSObject* const array = callFrame->argument(0).getObject();
+    if (!array) {
+        throwTypeError(globalObject, scope, "Bun.stringWidth.batch expects an array of strings"_s);
+        return {};
     }
 
+    bool countAnsiEscapeCodes = false;
+    bool ambiguousIsNarrow = true;
+    parseStringWidthOptions(globalObject, callFrame->argument(1), countAnsiEscapeCodes, ambiguousIsNarrow);
+    RETURN_IF_EXCEPTION(scope, {});
     const bool ambiguousAsWide = !ambiguousIsNarrow;
-    size_t width;
-    if (view->is8Bit()) {
-        // 8-bit JSC strings are Latin-1.
-        const auto span = view->span8();
-        const std::span<const uint8_t> bytes { reinterpret_cast<const uint8_t*>(span.data()), span.size() };
-        if (ambiguousAsWide) {
-            width = countAnsiEscapeCodes
-                ? StringWidth::visibleLatin1WidthAmbiguousAsWide(bytes)
-                : StringWidth::visibleLatin1WidthExcludeANSIAmbiguousAsWide(bytes);
-        } else {
-            width = countAnsiEscapeCodes
-                ? StringWidth::visibleLatin1Width(bytes)
-                : StringWidth::visibleLatin1WidthExcludeANSI(bytes);
+
+    JSC::JSArray* const result = JSC::constructEmptyArray(globalObject, nullptr);
+    RETURN_IF_EXCEPTION(scope, {});
+
+    unsigned index = 0;
+    JSC::forEachInArrayLike(globalObject, array, [&](JSC::JSValue element) -> bool {
+        size_t width = 0;
+        if (!element.isUndefined()) {
+            JSC::JSString* const jsString = element.toString(globalObject);
+            RETURN_IF_EXCEPTION(scope, false);
+            const auto view = jsString->view(globalObject);
+            RETURN_IF_EXCEPTION(scope, false);
+            width = computeStringWidth(view, countAnsiEscapeCodes, ambiguousAsWide);
         }
-    } else {
-        const auto span = view->span16();
-        width = StringWidth::visibleUTF16Width({ span.data(), span.size() }, !countAnsiEscapeCodes, ambiguousAsWide);
-    }
+        result->putDirectIndex(globalObject, index++, JSC::jsNumber(static_cast<double>(width)));
+        RETURN_IF_EXCEPTION(scope, false);
+        return true;
+    });
+    RETURN_IF_EXCEPTION(scope, {});
 
-    return JSC::JSValue::encode(JSC::jsNumber(static_cast<double>(width)));
+    return JSC::JSValue::encode(result);
+}
+
+// Lazy `Bun.stringWidth` property: the function itself plus the `batch`
+// companion, mirroring how `Bun.fetch` carries `preconnect`.
+JSC::JSValue constructBunStringWidthFunction(JSC::VM& vm, JSC::JSObject* bunObject)
+{
+    auto* globalObject = bunObject->globalObject();
+    JSC::JSFunction* stringWidthFn = JSC::JSFunction::create(vm, globalObject, 2, "stringWidth"_s, jsFunctionBunStringWidth, JSC::ImplementationVisibility::Public, JSC::NoIntrinsic);
+    stringWidthFn->putDirectNativeFunction(vm, globalObject, JSC::Identifier::fromString(vm, "batch"_s), 2, jsFunctionBunStringWidthBatch, JSC::ImplementationVisibility::Public, JSC::NoIntrinsic,
+        JSC::PropertyAttribute::ReadOnly | JSC::PropertyAttribute::DontDelete | 0);
+    return stringWidthFn;
 }
 
 } // namespace Bun
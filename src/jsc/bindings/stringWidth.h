@@ -8,6 +8,14 @@ namespace Bun {
 // `Bun.stringWidth(input, { countAnsiEscapeCodes, ambiguousIsNarrow })`
 JSC_DECLARE_HOST_FUNCTION(jsFunctionBunStringWidth);
 
+// `Bun.stringWidth.batch(strings, options)` — widths of every element of an
+// array-like, returned as an array of numbers. Options are parsed once.
+JSC_DECLARE_HOST_FUNCTION(jsFunctionBunStringWidthBatch);
+
+// Lazy property callback building the `Bun.stringWidth` function with its
+// `batch` companion attached.
+JSC::JSValue constructBunStringWidthFunction(JSC::VM&, JSC::JSObject* bunObject);
+
 namespace StringWidth {
 
 // Terminal column width of a single codepoint (0, 1 or 2).
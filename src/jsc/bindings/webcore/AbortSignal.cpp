@@ -129,22 +129,67 @@ JSValue AbortSignal::jsReason(JSC::JSGlobalObject& globalObject)
     return existingValue;
 }
 
+template<typename Func>
+void AbortSignal::forEachSourceSignal(Func&& func)
+{
+    for (auto& slot : m_inlineSourceSignals) {
+        if (RefPtr sourceSignal = slot.get())
+            func(*sourceSignal);
+    }
+    for (Ref sourceSignal : m_sourceSignals)
+        func(sourceSignal.get());
+}
+
+// Records `signal` in the first free inline slot, falling back to the spill
+// set. Returns false when `signal` is already tracked, matching the add-once
+// semantics of the WeakListHashSet this replaces for the common case.
+bool AbortSignal::appendSignalEdge(std::array<SignalWeakRef, inlineSignalCapacity>& inlineSlots, AbortSignalSet& spill, AbortSignal& signal)
+{
+    SignalWeakRef* freeSlot = nullptr;
+    for (auto& slot : inlineSlots) {
+        auto* existing = slot.get();
+        if (existing == &signal)
+            return false;
+        if (!existing && !freeSlot)
+            freeSlot = &slot;
+    }
+    if (spill.contains(signal))
+        return false;
+    if (freeSlot) {
+        *freeSlot = SignalWeakRef { signal };
+        return true;
+    }
+    spill.add(signal);
+    return true;
+}
+
 void AbortSignal::addSourceSignal(AbortSignal& signal)
 {
     if (signal.isDependent()) {
-        for (Ref sourceSignal : signal.sourceSignals())
+        signal.forEachSourceSignal([&](AbortSignal& sourceSignal) {
             addSourceSignal(sourceSignal);
+        });
         return;
     }
     ASSERT(!signal.aborted());
-    ASSERT(signal.sourceSignals().isEmptyIgnoringNullReferences());
-    m_sourceSignals.add(signal);
+    ASSERT(!signal.hasAliveSourceSignals());
+    if (!appendSignalEdge(m_inlineSourceSignals, m_sourceSignals, signal))
+        return;
     signal.addDependentSignal(*this);
 }
 
 void AbortSignal::addDependentSignal(AbortSignal& signal)
 {
-    m_dependentSignals.add(signal);
+    appendSignalEdge(m_inlineDependentSignals, m_dependentSignals, signal);
+}
+
+bool AbortSignal::hasAnyDependentSignals()
+{
+    for (auto& slot : m_inlineDependentSignals) {
+        if (slot.get())
+            return true;
+    }
+    return !m_dependentSignals.isEmptyIgnoringNullReferences();
 }
 
 void AbortSignal::cancelTimer()
@@ -157,6 +202,8 @@ void AbortSignal::cancelTimer()
 void AbortSignal::markAborted(JSC::JSValue reason)
 {
     applyFlags(static_cast<uint8_t>(AbortSignalFlags::Aborted) | static_cast<uint8_t>(AbortSignalFlags::IsFiringEventListeners));
+    for (auto& slot : m_inlineSourceSignals)
+        slot = nullptr;
     m_sourceSignals.clear();
 
     ASSERT(reason);
@@ -188,7 +235,7 @@ void AbortSignal::runAbortSteps()
     for (auto& algorithm : std::exchange(m_algorithms, {}))
         algorithm.second(reason);
 
-    Vector<std::pair<uint32_t, Ref<AbortAlgorithm>>> abortAlgorithms;
+    Vector<std::pair<uint32_t, Ref<AbortAlgorithm>>, 1> abortAlgorithms;
     {
         Locker locker { m_abortAlgorithmsLock };
         abortAlgorithms = std::exchange(m_abortAlgorithms, {});
@@ -222,6 +269,15 @@ void AbortSignal::signalAbort(JSC::JSValue reason)
 
     Vector<Ref<AbortSignal>> dependentSignalsToAbort;
 
+    for (auto& slot : m_inlineDependentSignals) {
+        RefPtr dependentSignal = slot.get();
+        slot = nullptr;
+        if (dependentSignal && !dependentSignal->aborted()) {
+            dependentSignal->markAborted(reason);
+            dependentSignalsToAbort.append(dependentSignal.releaseNonNull());
+        }
+    }
+
     for (Ref dependentSignal : std::exchange(m_dependentSignals, {})) {
         if (!dependentSignal->aborted()) {
             dependentSignal->markAborted(reason);
@@ -302,7 +358,7 @@ void AbortSignal::eventListenersDidChange()
     // be destroyed normally.
     if (!hasListeners && m_timeout && !aborted()
         && m_algorithms.isEmpty() && !hasPendingActivity()
-        && m_dependentSignals.isEmptyIgnoringNullReferences()) {
+        && !hasAnyDependentSignals()) {
         bool shouldDeref = false;
         {
             Locker locker { m_abortAlgorithmsLock };
@@ -40,6 +40,7 @@
 #include <wtf/RefCounted.h>
 #include <wtf/WeakListHashSet.h>
 #include <wtf/WeakPtr.h>
+#include <array>
 
 namespace WebCore {
 
@@ -120,13 +121,19 @@ public:
     void throwIfAborted(JSC::JSGlobalObject&);
 
     using AbortSignalSet = WeakListHashSet<AbortSignal, WeakPtrImplWithEventTargetData>;
-    const AbortSignalSet& sourceSignals() const { return m_sourceSignals; }
-    AbortSignalSet& sourceSignals() { return m_sourceSignals; }
 
     // Read-only emptiness probe for GC marker threads (JSAbortSignalOwner::isReachableFromOpaqueRoots).
     // WeakListHashSet::isEmptyIgnoringNullReferences() prunes dead entries, destroying WeakPtrs whose
     // single-threaded impls (and the nodes holding them) may only be released on the owning thread.
-    bool hasAliveSourceSignals() const { return m_sourceSignals.begin() != m_sourceSignals.end(); }
+    // Reading the inline slots only resolves WeakPtrs, which mutates nothing.
+    bool hasAliveSourceSignals() const
+    {
+        for (auto& slot : m_inlineSourceSignals) {
+            if (slot.get())
+                return true;
+        }
+        return m_sourceSignals.begin() != m_sourceSignals.end();
+    }
 
     // https://github.com/oven-sh/bun/issues/4517
     void incrementPendingActivityCount() { ++pendingActivityCount; }
@@ -145,9 +152,15 @@ private:
     };
     explicit AbortSignal(ScriptExecutionContext*, Aborted = Aborted::No, JSC::JSValue reason = JSC::jsUndefined());
 
+    static constexpr size_t inlineSignalCapacity = 2;
+    using SignalWeakRef = WeakPtr<AbortSignal, WeakPtrImplWithEventTargetData>;
+
     void markAsDependent() { setIsDependent(true); }
     void addSourceSignal(AbortSignal&);
     void addDependentSignal(AbortSignal&);
+    template<typename Func> void forEachSourceSignal(Func&&);
+    bool appendSignalEdge(std::array<SignalWeakRef, inlineSignalCapacity>&, AbortSignalSet&, AbortSignal&);
+    bool hasAnyDependentSignals();
     void cancelTimer();
 
     void applyFlags(uint8_t flags) { m_flags |= flags; }
@@ -191,14 +204,24 @@ private:
     void derefEventTarget() final { deref(); }
     void eventListenersDidChange() final;
 
-    Vector<std::pair<uint32_t, Algorithm>> m_algorithms;
+    // Inline capacity 1: signals overwhelmingly carry a single algorithm (one
+    // fetch follow, one pipeTo), so the first registration shouldn't touch the
+    // heap.
+    Vector<std::pair<uint32_t, Algorithm>, 1> m_algorithms;
     // Kept separate from m_algorithms so the GC thread can visit the weak JS
     // callbacks via visitAbortAlgorithms(). Erasing Ref<AbortAlgorithm> into
     // an Algorithm lambda would hide it from the GC and reintroduce the
     // Strong-ref cycle leak.
-    Vector<std::pair<uint32_t, Ref<AbortAlgorithm>>> m_abortAlgorithms WTF_GUARDED_BY_LOCK(m_abortAlgorithmsLock);
+    Vector<std::pair<uint32_t, Ref<AbortAlgorithm>>, 1> m_abortAlgorithms WTF_GUARDED_BY_LOCK(m_abortAlgorithmsLock);
     Lock m_abortAlgorithmsLock;
     WeakPtr<AbortSignal, WeakPtrImplWithEventTargetData> m_followingSignal;
+    // Composite signals (AbortSignal.any(), the per-request disconnect +
+    // timeout + deadline chains) rarely have more than two edges in either
+    // direction. The inline slots absorb those, so composing signals
+    // allocates no set nodes in the common case; further edges spill into
+    // the WeakListHashSets below.
+    std::array<SignalWeakRef, inlineSignalCapacity> m_inlineSourceSignals;
+    std::array<SignalWeakRef, inlineSignalCapacity> m_inlineDependentSignals;
     AbortSignalSet m_sourceSignals;
     AbortSignalSet m_dependentSignals;
     JSValueInWrappedObject m_reason;
@@ -284,6 +284,7 @@ public:
     std::unique_ptr<IsoSubspace> m_subspaceForPullIntoDescriptor;
     std::unique_ptr<IsoSubspace> m_subspaceForStreamTeeState;
     std::unique_ptr<IsoSubspace> m_subspaceForCrossRealmTransformState;
+    std::unique_ptr<IsoSubspace> m_subspaceForCompressionTransformState;
     std::unique_ptr<IsoSubspace> m_subspaceForStreamFromIterableContext;
     std::unique_ptr<IsoSubspace> m_subspaceForDirectStreamController;
     std::unique_ptr<IsoSubspace> m_subspaceForNativeStreamSourceAdapter;
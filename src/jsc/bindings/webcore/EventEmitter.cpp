@@ -198,11 +198,73 @@ bool EventEmitter::fireEventListeners(const Identifier& eventType, const MarkedA
 
     bool prevFiringEventListeners = data->isFiringEventListeners;
     data->isFiringEventListeners = true;
-    auto fired = innerInvokeEventListeners(eventType, *listenersVector, arguments);
+    bool fired;
+    if (listenersVector->size() == 1) {
+        // Hot emitters ('data' on sockets) overwhelmingly have exactly one
+        // listener; invoke it directly instead of taking the defensive vector
+        // copy the generic path makes. The Ref keeps the listener alive if the
+        // callback removes itself, and listeners added during the callback
+        // still don't run (same guarantee the copy provides).
+        Ref<EventEmitter> protectedThis(*this);
+        Ref<SimpleRegisteredEventListener> registeredListener = *listenersVector->at(0);
+        auto* thisObject = protectedThis->m_thisObject.get();
+        JSC::JSValue thisValue = thisObject ? thisObject : JSC::jsUndefined();
+        fired = invokeRegisteredListener(eventType, registeredListener.get(), arguments, thisValue, scriptExecutionContext()->vm());
+    } else
+        fired = innerInvokeEventListeners(eventType, *listenersVector, arguments);
     data->isFiringEventListeners = prevFiringEventListeners;
     return fired;
 }
 
+// The per-listener invoke shared by the single-listener fast path above and
+// the generic loop below. Returns true when a JS function was actually called.
+bool EventEmitter::invokeRegisteredListener(const Identifier& eventType, SimpleRegisteredEventListener& registeredListener, const MarkedArgumentBuffer& arguments, JSC::JSValue thisValue, VM& vm)
+{
+    auto& callback = registeredListener.callback();
+
+    // Make sure the JS wrapper and function stay alive until the end of this scope. Otherwise,
+    // event listeners with 'once' flag may get collected as soon as they get unregistered below,
+    // before we call the js function.
+    JSObject* jsFunction = callback.jsFunction();
+    JSC::EnsureStillAliveScope wrapperProtector(callback.wrapper());
+    JSC::EnsureStillAliveScope jsFunctionProtector(jsFunction);
+
+    // Do this before invocation to avoid reentrancy issues.
+    if (registeredListener.isOnce())
+        removeListener(eventType, callback);
+
+    if (!jsFunction) [[unlikely]]
+        return false;
+
+    JSC::JSGlobalObject* lexicalGlobalObject = jsFunction->globalObject();
+    auto callData = JSC::getCallData(jsFunction);
+    if (callData.type == JSC::CallData::Type::None) [[unlikely]]
+        return false;
+
+    WTF::NakedPtr<JSC::Exception> exceptionPtr;
+    call(lexicalGlobalObject, jsFunction, callData, thisValue, arguments, exceptionPtr);
+    auto* exception = exceptionPtr.get();
+
+    if (exception) [[unlikely]] {
+        auto errorIdentifier = vm.propertyNames->error;
+        auto hasErrorListener = this->hasActiveEventListeners(errorIdentifier);
+        if (!hasErrorListener || eventType == errorIdentifier) {
+            // If the event type is error, report the exception to the console.
+            Bun__reportUnhandledError(lexicalGlobalObject, JSValue::encode(JSValue(exception)));
+        } else if (hasErrorListener) {
+            MarkedArgumentBuffer expcep;
+            JSValue errorValue = exception->value();
+            if (!errorValue) {
+                errorValue = JSC::jsUndefined();
+            }
+            expcep.append(errorValue);
+            fireEventListeners(errorIdentifier, WTF::move(expcep));
+        }
+    }
+
+    return true;
+}
+
 // Intentionally creates a copy of the listeners vector to avoid event listeners added after this point from being run.
 // Note that removal still has an effect due to the removed field in RegisteredEventListener.
 // https://dom.spec.whatwg.org/#concept-event-listener-inner-invoke
@@ -225,48 +287,8 @@ bool EventEmitter::innerInvokeEventListeners(const Identifier& eventType, Simple
         // if (registeredListener->wasRemoved()) [[unlikely]]
         //     continue;
 
-        auto& callback = registeredListener->callback();
-
-        // Make sure the JS wrapper and function stay alive until the end of this scope. Otherwise,
-        // event listeners with 'once' flag may get collected as soon as they get unregistered below,
-        // before we call the js function.
-        JSObject* jsFunction = callback.jsFunction();
-        JSC::EnsureStillAliveScope wrapperProtector(callback.wrapper());
-        JSC::EnsureStillAliveScope jsFunctionProtector(jsFunction);
-
-        // Do this before invocation to avoid reentrancy issues.
-        if (registeredListener->isOnce())
-            removeListener(eventType, callback);
-
-        if (!jsFunction) [[unlikely]]
-            continue;
-
-        JSC::JSGlobalObject* lexicalGlobalObject = jsFunction->globalObject();
-        auto callData = JSC::getCallData(jsFunction);
-        if (callData.type == JSC::CallData::Type::None) [[unlikely]]
-            continue;
-
-        fired = true;
-        WTF::NakedPtr<JSC::Exception> exceptionPtr;
-        call(lexicalGlobalObject, jsFunction, callData, thisValue, arguments, exceptionPtr);
-        auto* exception = exceptionPtr.get();
-
-        if (exception) [[unlikely]] {
-            auto errorIdentifier = vm.propertyNames->error;
-            auto hasErrorListener = this->hasActiveEventListeners(errorIdentifier);
-            if (!hasErrorListener || eventType == errorIdentifier) {
-                // If the event type is error, report the exception to the console.
-                Bun__reportUnhandledError(lexicalGlobalObject, JSValue::encode(JSValue(exception)));
-            } else if (hasErrorListener) {
-                MarkedArgumentBuffer expcep;
-                JSValue errorValue = exception->value();
-                if (!errorValue) {
-                    errorValue = JSC::jsUndefined();
-                }
-                expcep.append(errorValue);
-                fireEventListeners(errorIdentifier, WTF::move(expcep));
-            }
-        }
+        if (invokeRegisteredListener(eventType, *registeredListener, arguments, thisValue, vm))
+            fired = true;
     }
 
     return fired;
@@ -108,6 +108,7 @@ private:
     }
 
     bool innerInvokeEventListeners(const Identifier&, SimpleEventListenerVector, const MarkedArgumentBuffer& arguments);
+    bool invokeRegisteredListener(const Identifier&, SimpleRegisteredEventListener&, const MarkedArgumentBuffer& arguments, JSC::JSValue thisValue, JSC::VM&);
     void invalidateEventListenerRegions();
 
     EventEmitterData m_eventTargetData;
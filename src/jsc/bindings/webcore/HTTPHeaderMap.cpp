@@ -33,6 +33,7 @@
 #include "HTTPHeaderMap.h"
 
 #include <utility>
+#include <wtf/ASCIICType.h>
 #include <wtf/CrossThreadCopier.h>
 #include <wtf/text/StringView.h>
 
@@ -76,6 +77,21 @@ String lowercaseHeaderName(const String& name)
     return result;
 }
 
+unsigned caseFoldedHeaderNameHash(const StringView name)
+{
+    // FNV-1a over ASCII-lowercased code units. Collisions only cost the
+    // equalIgnoringASCIICase fallthrough that used to run unconditionally.
+    unsigned hash = 2166136261u;
+    if (name.is8Bit()) {
+        for (auto character : name.span8())
+            hash = (hash ^ toASCIILower(character)) * 16777619u;
+    } else {
+        for (auto character : name.span16())
+            hash = (hash ^ (isASCII(character) ? static_cast<char16_t>(toASCIILower(character)) : character)) * 16777619u;
+    }
+    return hash;
+}
+
 HTTPHeaderMap::HTTPHeaderMap()
 {
 }
@@ -128,8 +144,9 @@ size_t HTTPHeaderMap::memoryCost() const
 
 String HTTPHeaderMap::getUncommonHeader(const StringView name) const
 {
+    unsigned nameHash = caseFoldedHeaderNameHash(name);
     auto index = m_uncommonHeaders.findIf([&](auto& header) {
-        return equalIgnoringASCIICase(header.key, name);
+        return header.keyHash == nameHash && equalIgnoringASCIICase(header.key, name);
     });
     return index != notFound ? m_uncommonHeaders[index].value : String();
 }
@@ -168,36 +185,39 @@ void HTTPHeaderMap::set(const String& name, const String& value)
 
 void HTTPHeaderMap::setUncommonHeader(const String& name, const String& value)
 {
+    unsigned nameHash = caseFoldedHeaderNameHash(name);
     auto index = m_uncommonHeaders.findIf([&](auto& header) {
-        return equalIgnoringASCIICase(header.key, name);
+        return header.keyHash == nameHash && equalIgnoringASCIICase(header.key, name);
     });
     if (index == notFound)
-        m_uncommonHeaders.append(UncommonHeader { name, value });
+        m_uncommonHeaders.append(UncommonHeader { name, value, nameHash });
     else
         m_uncommonHeaders[index].value = value;
 }
 
 void HTTPHeaderMap::addUncommonHeader(const String& name, const String& value)
 {
+    unsigned nameHash = caseFoldedHeaderNameHash(name);
     auto index = m_uncommonHeaders.findIf([&](auto& header) {
-        return equalIgnoringASCIICase(header.key, name);
+        return header.keyHash == nameHash && equalIgnoringASCIICase(header.key, name);
     });
     if (index == notFound)
-        m_uncommonHeaders.append(UncommonHeader { name, value });
+        m_uncommonHeaders.append(UncommonHeader { name, value, nameHash });
     else
         m_uncommonHeaders[index].value = makeString(m_uncommonHeaders[index].value, ", "_s, value);
 }
 
 void HTTPHeaderMap::addUncommonHeaderCloneName(const StringView name, const String& value)
 {
+    unsigned nameHash = caseFoldedHeaderNameHash(name);
     auto index = m_uncommonHeaders.findIf([&](auto& header) {
-        return equalIgnoringASCIICase(header.key, name);
+        return header.keyHash == nameHash && equalIgnoringASCIICase(header.key, name);
     });
     if (index == notFound) {
         std::span<Latin1Character> ptr;
         auto nameCopy = WTF::String::createUninitialized(name.length(), ptr);
         memcpy(ptr.data(), name.span8().data(), name.length());
-        m_uncommonHeaders.append(UncommonHeader { nameCopy, value });
+        m_uncommonHeaders.append(UncommonHeader { nameCopy, value, nameHash });
     } else
         m_uncommonHeaders[index].value = makeString(m_uncommonHeaders[index].value, ", "_s, value);
 }
@@ -209,11 +229,12 @@ void HTTPHeaderMap::add(const String& name, const String& value)
         add(headerName, value);
         return;
     }
+    unsigned nameHash = caseFoldedHeaderNameHash(name);
     auto index = m_uncommonHeaders.findIf([&](auto& header) {
-        return equalIgnoringASCIICase(header.key, name);
+        return header.keyHash == nameHash && equalIgnoringASCIICase(header.key, name);
     });
     if (index == notFound)
-        m_uncommonHeaders.append(UncommonHeader { name, value });
+        m_uncommonHeaders.append(UncommonHeader { name, value, nameHash });
     else
         m_uncommonHeaders[index].value = makeString(m_uncommonHeaders[index].value, ", "_s, value);
 }
@@ -229,7 +250,7 @@ void HTTPHeaderMap::append(const String& name, const String& value)
         else
             m_commonHeaders.append(CommonHeader { headerName, value });
     } else {
-        m_uncommonHeaders.append(UncommonHeader { name, value });
+        m_uncommonHeaders.append(UncommonHeader { name, value, caseFoldedHeaderNameHash(name) });
     }
 }
 
@@ -248,8 +269,9 @@ bool HTTPHeaderMap::contains(const StringView name) const
     if (findHTTPHeaderName(name, headerName))
         return contains(headerName);
 
+    unsigned nameHash = caseFoldedHeaderNameHash(name);
     return m_uncommonHeaders.findIf([&](auto& header) {
-        return equalIgnoringASCIICase(header.key, name);
+        return header.keyHash == nameHash && equalIgnoringASCIICase(header.key, name);
     }) != notFound;
 }
 
@@ -270,8 +292,9 @@ bool HTTPHeaderMap::removeUncommonHeader(const StringView name)
     ASSERT(!findHTTPHeaderName(name, headerName));
 #endif
 
+    unsigned nameHash = caseFoldedHeaderNameHash(name);
     return m_uncommonHeaders.removeFirstMatching([&](auto& header) {
-        return equalIgnoringASCIICase(header.key, name);
+        return header.keyHash == nameHash && equalIgnoringASCIICase(header.key, name);
     });
 }
 
@@ -313,8 +336,9 @@ HTTPHeaderMap::HeaderIndex HTTPHeaderMap::indexOf(HTTPHeaderName name) const
 
 HTTPHeaderMap::HeaderIndex HTTPHeaderMap::indexOf(const String& name) const
 {
+    unsigned nameHash = caseFoldedHeaderNameHash(name);
     auto index = m_uncommonHeaders.findIf([&](auto& header) {
-        return equalIgnoringASCIICase(header.key, name);
+        return header.keyHash == nameHash && equalIgnoringASCIICase(header.key, name);
     });
     return (HeaderIndex) { .index = index, .isCommon = false };
 }
@@ -41,6 +41,12 @@ namespace WebCore {
 // behavior.
 String lowercaseHeaderName(const String &);
 
+// ASCII-case-folded hash of a header name. 8-bit and 16-bit strings with equal
+// code unit values hash identically, so a 16-bit probe matches an 8-bit stored
+// key. Cached per uncommon header so lookups reject non-matching entries with
+// an integer compare instead of a full equalIgnoringASCIICase scan.
+WEBCORE_EXPORT unsigned caseFoldedHeaderNameHash(StringView);
+
 class HTTPHeaderMap {
 public:
     struct CommonHeader {
@@ -65,9 +71,11 @@ public:
     struct UncommonHeader {
         String key;
         String value;
+        // caseFoldedHeaderNameHash(key), computed once at insert.
+        unsigned keyHash { 0 };
 
-        UncommonHeader isolatedCopy() const & { return { key.isolatedCopy(), value.isolatedCopy() }; }
-        UncommonHeader isolatedCopy() && { return { WTF::move(key).isolatedCopy(), WTF::move(value).isolatedCopy() }; }
+        UncommonHeader isolatedCopy() const & { return { key.isolatedCopy(), value.isolatedCopy(), keyHash }; }
+        UncommonHeader isolatedCopy() && { return { WTF::move(key).isolatedCopy(), WTF::move(value).isolatedCopy(), keyHash }; }
         template<class Encoder> void encode(Encoder &) const;
         template<class Decoder> static std::optional<UncommonHeader> decode(Decoder &);
 
@@ -318,7 +326,8 @@ auto HTTPHeaderMap::UncommonHeader::decode(Decoder &decoder) -> std::optional<Un
     if (!decoder.decode(value))
         return std::nullopt;
 
-    return UncommonHeader { WTF::move(name), WTF::move(value) };
+    unsigned keyHash = caseFoldedHeaderNameHash(name);
+    return UncommonHeader { WTF::move(name), WTF::move(value), keyHash };
 }
 
 template<class Encoder>
@@ -132,9 +132,14 @@ bool IdentifierEventListenerMap::removeAll(const JSC::Identifier& eventType)
 
 SimpleEventListenerVector* IdentifierEventListenerMap::find(const JSC::Identifier& eventType)
 {
-    for (auto& entry : m_entries) {
-        if (entry.first == eventType)
-            return &entry.second;
+    if (m_lastFoundIndex < m_entries.size() && m_entries[m_lastFoundIndex].first == eventType)
+        return &m_entries[m_lastFoundIndex].second;
+
+    for (unsigned i = 0; i < m_entries.size(); ++i) {
+        if (m_entries[i].first == eventType) {
+            m_lastFoundIndex = i;
+            return &m_entries[i].second;
+        }
     }
 
     return nullptr;
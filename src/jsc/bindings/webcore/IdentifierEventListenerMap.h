@@ -65,6 +65,11 @@ public:
 
 private:
     EntriesVector m_entries;
+    // Index of the entry the last successful find() matched. Hot emitters fire
+    // the same type repeatedly ('data' on sockets), so back-to-back emits skip
+    // the scan. Never invalidated: find() re-checks the identifier before
+    // trusting it, so a stale index only costs a rescan.
+    unsigned m_lastFoundIndex { 0 };
     Lock m_lock;
 };
 
@@ -74,11 +74,16 @@ extern "C" size_t TextEncoder__encodeInto8(const Latin1Character* stringPtr, siz
 extern "C" size_t TextEncoder__encodeInto16(const char16_t* stringPtr, size_t stringLen, void* ptr, size_t len);
 extern "C" JSC::EncodedJSValue TextEncoder__encodeRopeString(JSC::JSGlobalObject* lexicalGlobalObject, JSC::JSString* str);
 
+// The encode() DOMJIT path stays disabled: its rope fast path defers GC while
+// allocating, so the correct side effects are unclear (oven-sh/bun#9226).
 // extern "C" {
 // static JSC_DECLARE_JIT_OPERATION_WITHOUT_WTF_INTERNAL(jsTextEncoderEncodeWithoutTypeCheck, JSC::EncodedJSValue, (JSC::JSGlobalObject*, JSTextEncoder*, DOMJIT::IDLJSArgumentType<IDLDOMString>));
-// static JSC_DECLARE_JIT_OPERATION_WITHOUT_WTF_INTERNAL(jsTextEncoderPrototypeFunction_encodeIntoWithoutTypeCheck, JSC::EncodedJSValue, (JSC::JSGlobalObject * lexicalGlobalObject, JSTextEncoder* castedThis, DOMJIT::IDLJSArgumentType<IDLDOMString> source, DOMJIT::IDLJSArgumentType<IDLUint8Array> destination));
 // }
 
+extern "C" {
+static JSC_DECLARE_JIT_OPERATION_WITHOUT_WTF_INTERNAL(jsTextEncoderPrototypeFunction_encodeIntoWithoutTypeCheck, JSC::EncodedJSValue, (JSC::JSGlobalObject * lexicalGlobalObject, JSTextEncoder* castedThis, DOMJIT::IDLJSArgumentType<IDLDOMString> source, DOMJIT::IDLJSArgumentType<IDLUint8Array> destination));
+}
+
 template<> TextEncoder::EncodeIntoResult convertDictionary<TextEncoder::EncodeIntoResult>(JSGlobalObject& lexicalGlobalObject, JSValue value)
 {
     auto& vm = JSC::getVM(&lexicalGlobalObject);
@@ -139,6 +144,7 @@ JSC::JSObject* convertDictionaryToJS(JSC::JSGlobalObject& lexicalGlobalObject, J
 
 static JSC_DECLARE_HOST_FUNCTION(jsTextEncoderPrototypeFunction_encode);
 static JSC_DECLARE_HOST_FUNCTION(jsTextEncoderPrototypeFunction_encodeInto);
+static JSC_DECLARE_HOST_FUNCTION(jsTextEncoderPrototypeFunction_encodePooled);
 
 // Attributes
 
@@ -224,15 +230,15 @@ template<> void JSTextEncoderDOMConstructor::initializeProperties(VM& vm, JSDOMG
 //     DOMJIT::IDLResultTypeFilter<IDLUint8Array>::value,
 //     DOMJIT::IDLArgumentTypeFilter<IDLDOMString>::value);
 
-// static const JSC::DOMJIT::Signature DOMJITSignatureForJSTextEncoderEncodeIntoWithoutTypeCheck(
-//     jsTextEncoderPrototypeFunction_encodeIntoWithoutTypeCheck,
-//     JSTextEncoder::info(),
-
-//     JSC::DOMJIT::Effect {},
-//     // JSC::DOMJIT::Effect::forReadWriteKinds(encodeIntoRead, encodeIntoWrite),
-//     DOMJIT::IDLResultTypeFilter<IDLObject>::value,
-//     DOMJIT::IDLArgumentTypeFilter<IDLDOMString>::value,
-//     DOMJIT::IDLArgumentTypeFilter<IDLUint8Array>::value);
+static const JSC::DOMJIT::Signature DOMJITSignatureForJSTextEncoderEncodeIntoWithoutTypeCheck(
+    jsTextEncoderPrototypeFunction_encodeIntoWithoutTypeCheck,
+    JSTextEncoder::info(),
+    // Writes through the destination's backing store and allocates the result
+    // object, so keep the effects conservative.
+    JSC::DOMJIT::Effect {},
+    DOMJIT::IDLResultTypeFilter<IDLObject>::value,
+    DOMJIT::IDLArgumentTypeFilter<IDLDOMString>::value,
+    DOMJIT::IDLArgumentTypeFilter<IDLUint8Array>::value);
 
 /* Hash table for prototype */
 
@@ -240,9 +246,9 @@ static const HashTableValue JSTextEncoderPrototypeTableValues[] = {
     { "constructor"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum), NoIntrinsic, { HashTableValue::GetterSetterType, jsTextEncoderConstructor, 0 } },
     { "encoding"_s, static_cast<unsigned>(JSC::PropertyAttribute::ReadOnly | JSC::PropertyAttribute::CustomAccessor | JSC::PropertyAttribute::DOMAttribute), NoIntrinsic, { HashTableValue::GetterSetterType, jsTextEncoder_encoding, 0 } },
     // { "encode"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsTextEncoderPrototypeFunction_encode, &DOMJITSignatureForJSTextEncoderEncodeWithoutTypeCheck } },
-    // { "encodeInto"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsTextEncoderPrototypeFunction_encodeInto, &DOMJITSignatureForJSTextEncoderEncodeIntoWithoutTypeCheck } },
     { "encode"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsTextEncoderPrototypeFunction_encode, 1 } },
-    { "encodeInto"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsTextEncoderPrototypeFunction_encodeInto, 2 } },
+    { "encodeInto"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsTextEncoderPrototypeFunction_encodeInto, &DOMJITSignatureForJSTextEncoderEncodeIntoWithoutTypeCheck } },
+    { "encodePooled"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsTextEncoderPrototypeFunction_encodePooled, 1 } },
 };
 
 // JSC_DEFINE_JIT_OPERATION(jsTextEncoderEncodeWithoutTypeCheck, JSC::EncodedJSValue, (JSC::JSGlobalObject * lexicalGlobalObject, JSTextEncoder* castedThis, DOMJIT::IDLJSArgumentType<IDLDOMString> input))
@@ -279,28 +285,35 @@ static const HashTableValue JSTextEncoderPrototypeTableValues[] = {
 //     RELEASE_AND_RETURN(throwScope, { res });
 // }
 
-// JSC_DEFINE_JIT_OPERATION(jsTextEncoderPrototypeFunction_encodeIntoWithoutTypeCheck, JSC::EncodedJSValue, (JSC::JSGlobalObject * lexicalGlobalObject, JSTextEncoder* castedThis, DOMJIT::IDLJSArgumentType<IDLDOMString> sourceStr, DOMJIT::IDLJSArgumentType<IDLUint8Array> destination))
-// {
-//     auto& vm = JSC::getVM(lexicalGlobalObject);
-//     IGNORE_WARNINGS_BEGIN("frame-address")
-//     CallFrame* callFrame = DECLARE_CALL_FRAME(vm);
-//     IGNORE_WARNINGS_END
-//     JSC::JITOperationPrologueCallFrameTracer tracer(vm, callFrame);
-//     String source = sourceStr->value(lexicalGlobalObject);
-//     size_t res = 0;
-//     if (!source.is8Bit()) {
-//         res = TextEncoder__encodeInto16(source.span16().data(), source.length(), destination->vector(), destination->byteLength());
-//     } else {
-//         res = TextEncoder__encodeInto8(source.span8().data(), source.length(), destination->vector(), destination->byteLength());
-//     }
+JSC_DEFINE_JIT_OPERATION(jsTextEncoderPrototypeFunction_encodeIntoWithoutTypeCheck, JSC::EncodedJSValue, (JSC::JSGlobalObject * lexicalGlobalObject, JSTextEncoder* castedThis, DOMJIT::IDLJSArgumentType<IDLDOMString> sourceStr, DOMJIT::IDLJSArgumentType<IDLUint8Array> destination))
+{
+    auto& vm = JSC::getVM(lexicalGlobalObject);
+    IGNORE_WARNINGS_BEGIN("frame-address")
+    CallFrame* callFrame = DECLARE_CALL_FRAME(vm);
+    IGNORE_WARNINGS_END
+    JSC::JITOperationPrologueCallFrameTracer tracer(vm, callFrame);
+    auto throwScope = DECLARE_THROW_SCOPE(vm);
+    UNUSED_PARAM(castedThis);
 
-//     Bun::GlobalScope* globalScope = reinterpret_cast<Bun::GlobalScope*>(lexicalGlobalObject);
-//     auto* result = JSC::constructEmptyObject(vm, globalScope->encodeIntoObjectStructure());
-//     result->putDirectOffset(vm, 0, JSC::jsNumber(static_cast<uint32_t>(res)));
-//     result->putDirectOffset(vm, 1, JSC::jsNumber(static_cast<uint32_t>(res >> 32)));
+    auto source = sourceStr->view(lexicalGlobalObject);
+    RETURN_IF_EXCEPTION(throwScope, {});
 
-//     return { JSValue::encode(result) };
-// }
+    size_t res = 0;
+    if (!source->is8Bit()) {
+        const auto span = source->span16();
+        res = TextEncoder__encodeInto16(span.data(), span.size(), destination->vector(), destination->byteLength());
+    } else {
+        const auto span = source->span8();
+        res = TextEncoder__encodeInto8(span.data(), span.size(), destination->vector(), destination->byteLength());
+    }
+
+    Bun::GlobalScope* globalScope = reinterpret_cast<Bun::GlobalScope*>(lexicalGlobalObject);
+    auto* result = JSC::constructEmptyObject(vm, globalScope->encodeIntoObjectStructure());
+    result->putDirectOffset(vm, 0, JSC::jsNumber(static_cast<uint32_t>(res)));
+    result->putDirectOffset(vm, 1, JSC::jsNumber(static_cast<uint32_t>(res >> 32)));
+
+    RELEASE_AND_RETURN(throwScope, JSValue::encode(result));
+}
 
 const ClassInfo JSTextEncoderPrototype::s_info = { "TextEncoder"_s, &Base::s_info, nullptr, nullptr, CREATE_METHOD_TABLE(JSTextEncoderPrototype) };
 
@@ -461,6 +474,56 @@ JSC_DEFINE_HOST_FUNCTION(jsTextEncoderPrototypeFunction_encodeInto, (JSGlobalObj
     return IDLOperation<JSTextEncoder>::call<jsTextEncoderPrototypeFunction_encodeIntoBody>(*lexicalGlobalObject, *callFrame, "encodeInto");
 }
 
+// Returns a Uint8Array view over a per-encoder scratch buffer. The view is
+// only valid until the next encodePooled() call on the same encoder, which
+// reuses (or replaces, when growing) the backing buffer.
+static inline JSC::EncodedJSValue jsTextEncoderPrototypeFunction_encodePooledBody(JSC::JSGlobalObject* lexicalGlobalObject, JSC::CallFrame* callFrame, typename IDLOperation<JSTextEncoder>::ClassParameter castedThis)
+{
+    auto& vm = JSC::getVM(lexicalGlobalObject);
+    auto throwScope = DECLARE_THROW_SCOPE(vm);
+
+    EnsureStillAliveScope argument0 = callFrame->argument(0);
+    JSC::JSString* input = argument0.value().toString(lexicalGlobalObject);
+    RETURN_IF_EXCEPTION(throwScope, {});
+    auto source = input->view(lexicalGlobalObject);
+    RETURN_IF_EXCEPTION(throwScope, {});
+
+    // Worst-case UTF-8 output: 2 bytes per Latin-1 byte, 3 bytes per UTF-16
+    // code unit (a surrogate pair is 4 bytes for 2 units; a lone surrogate
+    // becomes the 3-byte replacement character).
+    size_t worstCase = source->is8Bit() ? source->length() * 2 : source->length() * 3;
+
+    auto& pooled = castedThis->wrapped().pooledEncodeBuffer();
+    if (!pooled || pooled->byteLength() < worstCase) {
+        constexpr size_t minimumPooledCapacity = 256;
+        auto grown = JSC::ArrayBuffer::tryCreateUninitialized(std::max(worstCase, minimumPooledCapacity), 1);
+        if (!grown) [[unlikely]] {
+            throwOutOfMemoryError(lexicalGlobalObject, throwScope);
+            return {};
+        }
+        pooled = WTF::move(grown);
+    }
+
+    size_t res = 0;
+    if (!source->is8Bit()) {
+        const auto span = source->span16();
+        res = TextEncoder__encodeInto16(span.data(), span.size(), pooled->data(), pooled->byteLength());
+    } else {
+        const auto span = source->span8();
+        res = TextEncoder__encodeInto8(span.data(), span.size(), pooled->data(), pooled->byteLength());
+    }
+
+    size_t written = static_cast<uint32_t>(res >> 32);
+    RefPtr<JSC::ArrayBuffer> buffer = pooled;
+    auto* view = JSC::JSUint8Array::create(lexicalGlobalObject, lexicalGlobalObject->m_typedArrayUint8.get(lexicalGlobalObject), WTF::move(buffer), 0, written);
+    RELEASE_AND_RETURN(throwScope, JSValue::encode(view));
+}
+
+JSC_DEFINE_HOST_FUNCTION(jsTextEncoderPrototypeFunction_encodePooled, (JSGlobalObject * lexicalGlobalObject, CallFrame* callFrame))
+{
+    return IDLOperation<JSTextEncoder>::call<jsTextEncoderPrototypeFunction_encodePooledBody>(*lexicalGlobalObject, *callFrame, "encodePooled");
+}
+
 JSC::GCClient::IsoSubspace* JSTextEncoder::subspaceForImpl(JSC::VM& vm)
 {
     return WebCore::subspaceForImpl<JSTextEncoder, UseCustomHeapCellType::No>(
@@ -47,8 +47,13 @@ public:
     RefPtr<Uint8Array> encode(String&&) const;
     EncodeIntoResult encodeInto(String&&, Ref<Uint8Array>&& destination);
 
+    // Scratch buffer backing encodePooled() views; replaced when it grows.
+    RefPtr<JSC::ArrayBuffer>& pooledEncodeBuffer() { return m_pooledEncodeBuffer; }
+
 private:
     TextEncoder() {};
+
+    RefPtr<JSC::ArrayBuffer> m_pooledEncodeBuffer;
 };
 
 }
@@ -402,47 +402,61 @@ static JSValue concatenateChunks(JSC::VM& vm, JSGlobalObject* globalObject, JSAr
         throwOutOfMemoryError(globalObject, scope);
         return {};
     }
-    WTF::Vector<uint8_t> bytes;
-    bytes.reserveInitialCapacity(total.value());
+    // The sizing pass above already computed the exact byte length, so the
+    // accumulation buffer IS the result: write every chunk straight into an
+    // uninitialized ArrayBuffer, with no WTF::Vector staging and no final copy.
+    size_t totalSize = total.value();
+    RefPtr<JSC::ArrayBuffer> resultBuffer = JSC::ArrayBuffer::tryCreateUninitialized(totalSize, 1);
+    if (!resultBuffer) [[unlikely]] {
+        throwOutOfMemoryError(globalObject, scope);
+        return {};
+    }
+    auto* out = static_cast<uint8_t*>(resultBuffer->data());
+    size_t cursor = 0;
     for (unsigned i = 0; i < length; i++) {
         auto& [string, stringByteLength] = stringChunks[i];
         if (!string.isNull()) {
             if (stringByteLength) {
-                size_t oldSize = bytes.size();
-                bytes.grow(oldSize + stringByteLength);
-                size_t written = writeUTF8(string, bytes.mutableSpan().subspan(oldSize));
-                // The sizer and writer must agree; never expose ungrown (uninitialized) bytes.
+                size_t written = writeUTF8(string, { out + cursor, stringByteLength });
+                // The sizer and writer must agree; never expose unwritten (uninitialized) bytes.
                 ASSERT(written == stringByteLength);
-                if (written < stringByteLength) [[unlikely]]
-                    bytes.shrink(oldSize + written);
+                cursor += written;
             }
             continue;
         }
         JSValue chunk = values.at(i);
+        std::span<const uint8_t> span;
         if (auto* view = dynamicDowncast<JSC::JSArrayBufferView>(chunk)) {
             if (!view->isDetached())
-                bytes.append(view->span());
+                span = view->span();
         } else if (auto* jsBuffer = dynamicDowncast<JSC::JSArrayBuffer>(chunk)) {
             if (auto* impl = jsBuffer->impl(); impl && !impl->isDetached())
-                bytes.append(impl->span());
+                span = impl->span();
+        }
+        // A length-tracking view over a buffer resized by a read-pass getter may
+        // report more bytes than the sizing pass saw; never write past the end.
+        if (size_t n = std::min(span.size(), totalSize - cursor)) {
+            memcpy(out + cursor, span.data(), n);
+            cursor += n;
         }
     }
-    if (asUint8Array) {
-        // Buffer-backed from birth: a later `.buffer` access never has to change modes.
-        RefPtr<JSC::ArrayBuffer> resultBuffer = JSC::ArrayBuffer::tryCreate(bytes.span());
-        if (!resultBuffer) [[unlikely]] {
+    if (cursor < totalSize) [[unlikely]] {
+        // A chunk detached behind our back (a getter in the read pass) or the
+        // UTF-8 writer came up short: copy the written prefix into a right-sized
+        // buffer rather than exposing uninitialized tail bytes.
+        RefPtr<JSC::ArrayBuffer> shrunk = JSC::ArrayBuffer::tryCreate(std::span<const uint8_t> { out, cursor });
+        if (!shrunk) [[unlikely]] {
             throwOutOfMemoryError(globalObject, scope);
             return {};
         }
-        auto* structure = globalObject->typedArrayStructureWithTypedArrayType<JSC::TypeUint8>();
-        RELEASE_AND_RETURN(scope, JSC::JSUint8Array::create(globalObject, structure, WTF::move(resultBuffer), 0, bytes.size()));
+        resultBuffer = WTF::move(shrunk);
     }
-    auto buffer = JSC::ArrayBuffer::tryCreate(bytes.span());
-    if (!buffer) [[unlikely]] {
-        throwOutOfMemoryError(globalObject, scope);
-        return {};
+    if (asUint8Array) {
+        // Buffer-backed from birth: a later `.buffer` access never has to change modes.
+        auto* structure = globalObject->typedArrayStructureWithTypedArrayType<JSC::TypeUint8>();
+        RELEASE_AND_RETURN(scope, JSC::JSUint8Array::create(globalObject, structure, WTF::move(resultBuffer), 0, cursor));
     }
-    return JSC::JSArrayBuffer::create(vm, globalObject->arrayBufferStructure(JSC::ArrayBufferSharingMode::Default), WTF::move(buffer));
+    return JSC::JSArrayBuffer::create(vm, globalObject->arrayBufferStructure(JSC::ArrayBufferSharingMode::Default), WTF::move(resultBuffer));
 }
 
 // The toArrayBuffer chunk-array converter (RS:157-206).
@@ -800,6 +814,17 @@ JSValue readableStreamIntoArray(JSGlobalObject* globalObject, WebCore::JSReadabl
     auto scope = DECLARE_THROW_SCOPE(vm);
     stream->materializeIfNeeded(globalObject);
     RETURN_IF_EXCEPTION(scope, {});
+    // Exhausted-source fast path: a fully-buffered body consumed in one shot (the .text() /
+    // .json() request-body case) drains the controller queue directly, skipping the reader,
+    // JSReadRequest, and pump-operation allocations entirely.
+    if (!isReadableStreamLocked(stream)) {
+        auto* drained = constructEmptyArray(globalObject, nullptr);
+        RETURN_IF_EXCEPTION(scope, {});
+        bool exhausted = readableStreamDrainExhaustedQueue(globalObject, stream, drained);
+        RETURN_IF_EXCEPTION(scope, {});
+        if (exhausted)
+            RELEASE_AND_RETURN(scope, promiseFulfilledWith(globalObject, drained));
+    }
     auto* reader = acquireReadableStreamDefaultReader(globalObject, stream);
     RETURN_IF_EXCEPTION(scope, {});
     auto* chunks = constructEmptyArray(globalObject, nullptr);
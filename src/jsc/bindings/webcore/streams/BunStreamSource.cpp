@@ -21,6 +21,7 @@
 #include "WebStreamsHeapAnalyzer.h"
 #include "WebStreamsInternals.h"
 #include "ZigGlobalObject.h"
+#include "headers.h"
 #include <JavaScriptCore/AggregateError.h>
 #include <JavaScriptCore/ArgList.h>
 #include <JavaScriptCore/ErrorType.h>
@@ -972,12 +973,41 @@ static void rsisIssueRead(JSGlobalObject*, JSReadStreamIntoSinkOperation*);
 static void rsisFinish(JSGlobalObject*, JSReadStreamIntoSinkOperation*);
 static void rsisAbrupt(JSC::VM&, JSGlobalObject*, JSReadStreamIntoSinkOperation*, JSValue error);
 
+// sink.write(chunk), with a direct-write negotiation: when the [[Get]] still
+// resolves to the generated `write` builtin, hand the chunk straight to the
+// native sink (`${name}__writeValue`) instead of paying the host-call frame and
+// MarkedArgumentBuffer per chunk. A patched `write` — or a detached controller —
+// falls through to the generic call, preserving invokeMethod's semantics.
 static JSValue rsisSinkWrite(JSC::VM& vm, JSGlobalObject* globalObject, JSReadStreamIntoSinkOperation* op, JSValue chunk)
 {
+    auto scope = DECLARE_THROW_SCOPE(vm);
+    JSObject* sink = op->m_sink.get();
+    const auto& name = builtinNames(vm).writePublicName();
+    JSValue method = sink->get(globalObject, name);
+    RETURN_IF_EXCEPTION(scope, {});
+    auto* function = jsDynamicCast<JSFunction*>(method);
+    if (function && function->isHostFunction()) [[likely]] {
+#define BUN_RSIS_DIRECT_WRITE(SinkName)                                                                                         \
+    if (auto* controller = dynamicDowncast<WebCore::JSReadable##SinkName##Controller>(sink)) {                                  \
+        if (void* ptr = controller->wrapped(); ptr && function->nativeFunction() == TaggedNativeFunction(SinkName##__write))     \
+            RELEASE_AND_RETURN(scope, JSValue::decode(SinkName##__writeValue(globalObject, ptr, JSValue::encode(chunk))));       \
+    }
+        BUN_RSIS_DIRECT_WRITE(HTTPResponseSink)
+        BUN_RSIS_DIRECT_WRITE(HTTPSResponseSink)
+        BUN_RSIS_DIRECT_WRITE(NetworkSink)
+        BUN_RSIS_DIRECT_WRITE(H3ResponseSink)
+        BUN_RSIS_DIRECT_WRITE(FileSink)
+        BUN_RSIS_DIRECT_WRITE(ArrayBufferSink)
+#undef BUN_RSIS_DIRECT_WRITE
+    }
+    if (!method.isCallable()) [[unlikely]] {
+        throwTypeError(globalObject, scope, makeString(name.string(), " is not a function"_s));
+        return {};
+    }
     MarkedArgumentBuffer args;
     args.append(chunk);
     ASSERT(!args.hasOverflowed());
-    return invokeMethod(vm, globalObject, op->m_sink.get(), builtinNames(vm).writePublicName(), args);
+    RELEASE_AND_RETURN(scope, call(globalObject, method, getCallData(method), sink, args));
 }
 
 static JSValue rsisSinkFlushPending(JSC::VM& vm, JSGlobalObject* globalObject, JSReadStreamIntoSinkOperation* op)
@@ -0,0 +1,270 @@
+#include "config.h"
+#include "JSCompressionTransformState.h"
+
+#include "DOMClientIsoSubspaces.h"
+#include "DOMIsoSubspaces.h"
+#include "ErrorCode.h"
+#include "JSDOMBinding.h"
+#include "JSDOMGlobalObject.h"
+#include "JSStreamsRuntime.h"
+#include "JSTransformStream.h"
+#include "JSTransformStreamDefaultController.h"
+#include "WebStreamsInternals.h"
+#include "ZigGlobalObject.h"
+#include <JavaScriptCore/Error.h>
+#include <JavaScriptCore/JSArrayBuffer.h>
+#include <JavaScriptCore/JSCInlines.h>
+#include <JavaScriptCore/JSTypedArrays.h>
+#include <JavaScriptCore/ObjectConstructor.h>
+#include <JavaScriptCore/SlotVisitorMacros.h>
+#include <JavaScriptCore/SubspaceInlines.h>
+#include <JavaScriptCore/TopExceptionScope.h>
+
+#include <brotli/encode.h>
+#include <zstd.h>
+
+namespace WebCore {
+
+using namespace JSC;
+
+const ClassInfo JSCompressionTransformState::s_info = { "CompressionTransformState"_s, &Base::s_info, nullptr, nullptr, CREATE_METHOD_TABLE(JSCompressionTransformState) };
+
+JSCompressionTransformState::JSCompressionTransformState(VM& vm, Structure* structure)
+    : Base(vm, structure)
+{
+}
+
+JSCompressionTransformState::~JSCompressionTransformState()
+{
+    if (m_zstd)
+        ZSTD_freeCCtx(m_zstd);
+    if (m_brotli)
+        BrotliEncoderDestroyInstance(m_brotli);
+    if (m_brotliDictionary)
+        BrotliEncoderDestroyPreparedDictionary(m_brotliDictionary);
+}
+
+void JSCompressionTransformState::destroy(JSCell* cell)
+{
+    static_cast<JSCompressionTransformState*>(cell)->~JSCompressionTransformState();
+}
+
+void JSCompressionTransformState::finishCreation(VM& vm)
+{
+    Base::finishCreation(vm);
+    ASSERT(inherits(info()));
+}
+
+JSCompressionTransformState* JSCompressionTransformState::create(VM& vm, Structure* structure)
+{
+    auto* cell = new (NotNull, allocateCell<JSCompressionTransformState>(vm)) JSCompressionTransformState(vm, structure);
+    cell->finishCreation(vm);
+    return cell;
+}
+
+Structure* JSCompressionTransformState::createStructure(VM& vm, JSGlobalObject* globalObject, JSValue prototype)
+{
+    return Structure::create(vm, globalObject, prototype, TypeInfo(ObjectType, StructureFlags), info());
+}
+
+GCClient::IsoSubspace* JSCompressionTransformState::subspaceForImpl(VM& vm)
+{
+    return WebCore::subspaceForImpl<JSCompressionTransformState, UseCustomHeapCellType::No>(
+        vm,
+        [](auto& spaces) { return spaces.m_clientSubspaceForCompressionTransformState.get(); },
+        [](auto& spaces, auto&& space) { spaces.m_clientSubspaceForCompressionTransformState = std::forward<decltype(space)>(space); },
+        [](auto& spaces) { return spaces.m_subspaceForCompressionTransformState.get(); },
+        [](auto& spaces, auto&& space) { spaces.m_subspaceForCompressionTransformState = std::forward<decltype(space)>(space); });
+}
+
+bool JSCompressionTransformState::initialize(Format format, std::span<const uint8_t> dictionary)
+{
+    m_format = format;
+    if (format == Format::Zstd) {
+        m_zstd = ZSTD_createCCtx();
+        if (!m_zstd)
+            return false;
+        if (!dictionary.empty()) {
+            if (ZSTD_isError(ZSTD_CCtx_loadDictionary(m_zstd, dictionary.data(), dictionary.size())))
+                return false;
+        }
+        return true;
+    }
+
+    m_brotli = BrotliEncoderCreateInstance(nullptr, nullptr, nullptr);
+    if (!m_brotli)
+        return false;
+    if (!dictionary.empty()) {
+        m_dictionary.append(dictionary);
+        m_brotliDictionary = BrotliEncoderPrepareDictionary(BROTLI_SHARED_DICTIONARY_RAW, m_dictionary.size(), m_dictionary.span().data(), BROTLI_MAX_QUALITY, nullptr, nullptr, nullptr);
+        if (!m_brotliDictionary)
+            return false;
+        if (!BrotliEncoderAttachPreparedDictionary(m_brotli, m_brotliDictionary))
+            return false;
+    }
+    return true;
+}
+
+bool JSCompressionTransformState::compress(std::span<const uint8_t> input, bool finish, WTF::Vector<uint8_t>& output)
+{
+    uint8_t scratch[16 * 1024];
+
+    if (m_format == Format::Zstd) {
+        ZSTD_inBuffer in { input.data(), input.size(), 0 };
+        size_t remaining = 0;
+        do {
+            ZSTD_outBuffer out { scratch, sizeof(scratch), 0 };
+            remaining = ZSTD_compressStream2(m_zstd, &out, &in, finish ? ZSTD_e_end : ZSTD_e_continue);
+            if (ZSTD_isError(remaining))
+                return false;
+            if (out.pos)
+                output.append(std::span<const uint8_t> { scratch, out.pos });
+        } while (finish ? remaining != 0 : in.pos < in.size);
+        return true;
+    }
+
+    size_t availIn = input.size();
+    const uint8_t* nextIn = input.data();
+    do {
+        size_t availOut = sizeof(scratch);
+        uint8_t* nextOut = scratch;
+        if (!BrotliEncoderCompressStream(m_brotli, finish ? BROTLI_OPERATION_FINISH : BROTLI_OPERATION_PROCESS, &availIn, &nextIn, &availOut, &nextOut, nullptr))
+            return false;
+        if (size_t produced = sizeof(scratch) - availOut)
+            output.append(std::span<const uint8_t> { scratch, produced });
+    } while (availIn || BrotliEncoderHasMoreOutput(m_brotli) || (finish && !BrotliEncoderIsFinished(m_brotli)));
+    return true;
+}
+
+} // namespace WebCore
+
+namespace Bun {
+namespace WebStreams {
+
+using namespace JSC;
+using WebCore::JSCompressionTransformState;
+
+// The whole chunk is compressed synchronously here (chunk in, compressed chunk out — no JS
+// between the input bytes and the enqueue). An abrupt enqueue completion becomes a rejected
+// promise (a transform algorithm must never throw synchronously into
+// ProcessWrite/ProcessClose). Shared by the transform and flush arms.
+static JSPromise* compressAndEnqueue(JSGlobalObject* globalObject, JSCompressionTransformState* state, JSTransformStreamDefaultController* controller, std::span<const uint8_t> input, bool finish)
+{
+    auto& vm = getVM(globalObject);
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    WTF::Vector<uint8_t> output;
+    if (!state->compress(input, finish, output)) [[unlikely]]
+        RELEASE_AND_RETURN(scope, promiseRejectedWith(globalObject, createTypeError(globalObject, "CompressionStream encoder failed"_s)));
+
+    if (output.isEmpty())
+        RELEASE_AND_RETURN(scope, promiseFulfilledWith(globalObject, JSC::jsUndefined()));
+
+    auto buffer = ArrayBuffer::tryCreate(output.span());
+    if (!buffer) [[unlikely]]
+        RELEASE_AND_RETURN(scope, promiseRejectedWith(globalObject, createOutOfMemoryError(globalObject)));
+    size_t length = output.size();
+
+    JSValue thrown;
+    {
+        auto catchScope = DECLARE_TOP_EXCEPTION_SCOPE(vm);
+        auto* chunk = JSUint8Array::create(globalObject, globalObject->typedArrayStructureWithTypedArrayType<JSC::TypeUint8>(), WTF::move(buffer), 0, length);
+        if (!catchScope.exception())
+            transformStreamDefaultControllerEnqueue(globalObject, controller, chunk);
+        if (catchScope.exception()) [[unlikely]]
+            thrown = takeAbruptCompletion(globalObject, catchScope);
+    }
+    // takeAbruptCompletion leaves a VM termination pending and returns the empty value.
+    RETURN_IF_EXCEPTION(scope, nullptr);
+    if (!thrown.isEmpty())
+        RELEASE_AND_RETURN(scope, promiseRejectedWith(globalObject, thrown));
+    RELEASE_AND_RETURN(scope, promiseFulfilledWith(globalObject, JSC::jsUndefined()));
+}
+
+JSPromise* compressionStreamTransform(JSGlobalObject* globalObject, JSCompressionTransformState* state, JSTransformStreamDefaultController* controller, JSValue chunk)
+{
+    auto& vm = getVM(globalObject);
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    std::span<const uint8_t> input;
+    if (auto* view = dynamicDowncast<JSArrayBufferView>(chunk)) {
+        if (view->isDetached()) [[unlikely]]
+            RELEASE_AND_RETURN(scope, promiseRejectedWith(globalObject, Bun::createError(globalObject, Bun::ErrorCode::ERR_INVALID_STATE_TypeError, "Invalid state: The chunk is backed by a detached ArrayBuffer"_s)));
+        input = view->span();
+    } else if (auto* jsBuffer = dynamicDowncast<JSArrayBuffer>(chunk)) {
+        auto* impl = jsBuffer->impl();
+        if (!impl || impl->isDetached()) [[unlikely]]
+            RELEASE_AND_RETURN(scope, promiseRejectedWith(globalObject, Bun::createError(globalObject, Bun::ErrorCode::ERR_INVALID_STATE_TypeError, "Invalid state: The chunk is a detached ArrayBuffer"_s)));
+        input = impl->span();
+    } else
+        RELEASE_AND_RETURN(scope, promiseRejectedWith(globalObject, Bun::createError(globalObject, Bun::ErrorCode::ERR_INVALID_ARG_TYPE, "The \"chunk\" argument must be an instance of ArrayBuffer, TypedArray, or DataView"_s)));
+
+    if (input.empty())
+        RELEASE_AND_RETURN(scope, promiseFulfilledWith(globalObject, JSC::jsUndefined()));
+    RELEASE_AND_RETURN(scope, compressAndEnqueue(globalObject, state, controller, input, false));
+}
+
+JSPromise* compressionStreamFlush(JSGlobalObject* globalObject, JSCompressionTransformState* state, JSTransformStreamDefaultController* controller)
+{
+    return compressAndEnqueue(globalObject, state, controller, {}, true);
+}
+
+} // namespace WebStreams
+} // namespace Bun
+
+namespace Bun {
+
+using namespace JSC;
+using namespace Bun::WebStreams;
+using WebCore::JSCompressionTransformState;
+using WebCore::JSStreamsRuntime;
+
+JSC_DEFINE_HOST_FUNCTION(jsCreateCompressionStreamTransform, (JSGlobalObject * globalObject, CallFrame* callFrame))
+{
+    auto& vm = getVM(globalObject);
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    // CompressionStream.ts already validated the format string.
+    String format = callFrame->argument(0).toWTFString(globalObject);
+    RETURN_IF_EXCEPTION(scope, {});
+    JSCompressionTransformState::Format encoderFormat;
+    if (format == "zstd"_s)
+        encoderFormat = JSCompressionTransformState::Format::Zstd;
+    else if (format == "brotli"_s)
+        encoderFormat = JSCompressionTransformState::Format::Brotli;
+    else
+        return throwVMTypeError(globalObject, scope, "Unsupported CompressionStream format"_s);
+
+    std::span<const uint8_t> dictionary;
+    JSValue dictionaryValue = callFrame->argument(1);
+    if (!dictionaryValue.isUndefinedOrNull()) {
+        if (auto* view = dynamicDowncast<JSArrayBufferView>(dictionaryValue)) {
+            if (view->isDetached()) [[unlikely]]
+                return Bun::throwError(globalObject, scope, Bun::ErrorCode::ERR_INVALID_STATE_TypeError, "Invalid state: The dictionary is backed by a detached ArrayBuffer"_s);
+            dictionary = view->span();
+        } else if (auto* jsBuffer = dynamicDowncast<JSArrayBuffer>(dictionaryValue)) {
+            auto* impl = jsBuffer->impl();
+            if (!impl || impl->isDetached()) [[unlikely]]
+                return Bun::throwError(globalObject, scope, Bun::ErrorCode::ERR_INVALID_STATE_TypeError, "Invalid state: The dictionary is a detached ArrayBuffer"_s);
+            dictionary = impl->span();
+        } else
+            return Bun::throwError(globalObject, scope, Bun::ErrorCode::ERR_INVALID_ARG_TYPE, "The \"options.dictionary\" property must be an instance of ArrayBuffer, TypedArray, or DataView"_s);
+    }
+
+    auto* domGlobalObject = defaultGlobalObject(globalObject);
+    auto* runtime = JSStreamsRuntime::from(globalObject);
+    auto* state = JSCompressionTransformState::create(vm, runtime->compressionTransformStateStructure(domGlobalObject));
+    // The encoder copies the dictionary bytes during initialize; the JS buffer is released.
+    if (!state->initialize(encoderFormat, dictionary)) [[unlikely]]
+        return throwVMTypeError(globalObject, scope, "Failed to initialize CompressionStream encoder"_s);
+
+    auto* transform = createTransformStream(globalObject, TransformerKind::Compression, state, 1, nullptr, 0, nullptr);
+    RETURN_IF_EXCEPTION(scope, {});
+
+    auto* result = constructEmptyObject(globalObject);
+    result->putDirect(vm, Identifier::fromString(vm, "readable"_s), transform->m_readable.get(), 0);
+    result->putDirect(vm, Identifier::fromString(vm, "writable"_s), transform->m_writable.get(), 0);
+    return JSValue::encode(result);
+}
+
+} // namespace Bun
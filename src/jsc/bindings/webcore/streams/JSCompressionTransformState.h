@@ -0,0 +1,80 @@
+// JSCompressionTransformState — TransformerKind::Compression's algorithmContext: the native
+// streaming encoder behind `new CompressionStream("zstd" | "brotli")`. The transform and
+// flush algorithms run entirely in native code (chunk bytes in, compressed Uint8Array out,
+// no JS per chunk); only the readable-side enqueue can observe JS. The zlib-family formats
+// stay on the node:zlib duplex adapter (CompressionStream.ts).
+// Internal cell: no prototype, no constructor. Destructible (owns the C encoder contexts).
+#pragma once
+
+#include "root.h"
+#include "StreamsForward.h"
+
+#include <JavaScriptCore/JSDestructibleObject.h>
+#include <span>
+#include <wtf/Vector.h>
+
+struct ZSTD_CCtx_s;
+struct BrotliEncoderStateStruct;
+struct BrotliEncoderPreparedDictionaryStruct;
+
+namespace WebCore {
+
+class JSCompressionTransformState final : public JSC::JSDestructibleObject {
+public:
+    using Base = JSC::JSDestructibleObject;
+    static constexpr unsigned StructureFlags = Base::StructureFlags;
+    static constexpr JSC::DestructionMode needsDestruction = JSC::NeedsDestruction;
+
+    enum class Format : uint8_t { Zstd,
+        Brotli };
+
+    static JSCompressionTransformState* create(JSC::VM&, JSC::Structure*);
+    static JSC::Structure* createStructure(JSC::VM&, JSC::JSGlobalObject*, JSC::JSValue prototype);
+    static void destroy(JSC::JSCell*);
+
+    DECLARE_INFO;
+
+    template<typename, JSC::SubspaceAccess mode>
+    static JSC::GCClient::IsoSubspace* subspaceFor(JSC::VM& vm)
+    {
+        if constexpr (mode == JSC::SubspaceAccess::Concurrently)
+            return nullptr;
+        return subspaceForImpl(vm);
+    }
+    static JSC::GCClient::IsoSubspace* subspaceForImpl(JSC::VM&);
+
+    // Creates the encoder context and loads `dictionary` into it. zstd copies the bytes
+    // into the context; brotli's prepared dictionary BORROWS them, so the cell keeps its
+    // own copy (m_dictionary) — the JS buffer is never retained. false ⇒ allocation /
+    // dictionary failure; the cell stays inert.
+    bool initialize(Format, std::span<const uint8_t> dictionary);
+    // Feeds `input` (and, on `finish`, the end-of-stream trailer) through the encoder,
+    // appending every produced byte to `output`. false ⇒ encoder error.
+    bool compress(std::span<const uint8_t> input, bool finish, WTF::Vector<uint8_t>& output);
+
+    Format m_format { Format::Zstd };
+
+private:
+    JSCompressionTransformState(JSC::VM&, JSC::Structure*);
+    ~JSCompressionTransformState();
+    void finishCreation(JSC::VM&);
+
+    // Exactly one of the two contexts is non-null after a successful initialize().
+    ZSTD_CCtx_s* m_zstd { nullptr };
+    BrotliEncoderStateStruct* m_brotli { nullptr };
+    // Kept for the encoder's lifetime: brotli ATTACHES the prepared dictionary, it does not
+    // copy it into the state — and the prepared dictionary itself borrows m_dictionary.
+    BrotliEncoderPreparedDictionaryStruct* m_brotliDictionary { nullptr };
+    WTF::Vector<uint8_t> m_dictionary;
+};
+
+} // namespace WebCore
+
+namespace Bun {
+
+// `$newCppFunction("JSCompressionTransformState.cpp", "jsCreateCompressionStreamTransform", 2)`
+// — CompressionStream.ts's factory for the native formats: (format, dictionary) →
+// `{ readable, writable }` of a TransformerKind::Compression transform stream.
+JSC_DECLARE_HOST_FUNCTION(jsCreateCompressionStreamTransform);
+
+} // namespace Bun
@@ -52,6 +52,22 @@ static RefPtr<JSC::ArrayBuffer> cloneArrayBuffer(JSC::VM& vm, JSC::JSGlobalObjec
     return cloned;
 }
 
+// Re-establishes exclusive ownership of a queued block before it becomes JS-visible: a
+// shared (byte-tee'd) block still referenced by the other branch's queue is copied here;
+// the sole remaining holder adopts it as-is. null ⇒ exception pending. Adjusts `byteOffset`
+// on copy.
+RefPtr<JSC::ArrayBuffer> exclusiveQueueBuffer(JSC::JSGlobalObject* globalObject, RefPtr<JSC::ArrayBuffer>&& buffer, size_t& byteOffset, size_t byteLength)
+{
+    if (buffer->hasOneRef()) [[likely]]
+        return WTF::move(buffer);
+    auto& vm = JSC::getVM(globalObject);
+    auto scope = DECLARE_THROW_SCOPE(vm);
+    RefPtr<JSC::ArrayBuffer> copy = cloneArrayBuffer(vm, globalObject, *buffer, byteOffset, byteLength);
+    RETURN_IF_EXCEPTION(scope, nullptr);
+    byteOffset = 0;
+    return copy;
+}
+
 // Construct(viewConstructor, « buffer, byteOffset, length »). `length` is an element count for
 // typed arrays and a byte length for %DataView% (elementSize(TypeDataView) == 1).
 static JSC::JSArrayBufferView* constructViewOfType(JSC::JSGlobalObject* globalObject, JSC::TypedArrayType type, RefPtr<JSC::ArrayBuffer> buffer, size_t byteOffset, size_t length)
@@ -758,6 +774,21 @@ void readableByteStreamControllerEnqueue(JSGlobalObject* globalObject, JSReadabl
     }
     RefPtr<JSC::ArrayBuffer> transferredBuffer = transferArrayBufferImpl(globalObject, *buffer);
     RETURN_IF_EXCEPTION(scope, void());
+    RELEASE_AND_RETURN(scope, readableByteStreamControllerEnqueueSharedChunk(globalObject, controller, WTF::move(transferredBuffer), byteOffset, byteLength));
+}
+
+// The tail of readableByteStreamControllerEnqueue, from the already-transferred block on.
+// Also the byte tee's shared-chunk entry point: `buffer` may still be referenced by the
+// other branch's queue, so it is never transferred again here — it stays immutable while
+// shared, and exclusiveQueueBuffer() re-establishes sole ownership whenever a JS view is
+// materialized from it.
+void readableByteStreamControllerEnqueueSharedChunk(JSGlobalObject* globalObject, JSReadableByteStreamController* controller, RefPtr<JSC::ArrayBuffer>&& buffer, size_t byteOffset, size_t byteLength)
+{
+    auto& vm = getVM(globalObject);
+    auto scope = DECLARE_THROW_SCOPE(vm);
+    JSReadableStream* stream = controller->m_stream.get();
+    if (controller->m_closeRequested || stream->m_state != ReadableStreamState::Readable)
+        return;
     if (!controller->m_pendingPullIntos.isEmpty()) {
         JSPullIntoDescriptor* firstPendingPullInto = controller->m_pendingPullIntos.first().get();
         if (firstPendingPullInto->m_buffer->isDetached()) {
@@ -778,20 +809,22 @@ void readableByteStreamControllerEnqueue(JSGlobalObject* globalObject, JSReadabl
         RETURN_IF_EXCEPTION(scope, void());
         if (!readableStreamGetNumReadRequests(stream)) {
             ASSERT(controller->m_pendingPullIntos.isEmpty());
-            readableByteStreamControllerEnqueueChunkToQueue(controller, WTF::move(transferredBuffer), byteOffset, byteLength);
+            readableByteStreamControllerEnqueueChunkToQueue(controller, WTF::move(buffer), byteOffset, byteLength);
         } else {
             ASSERT(controller->m_queue.isEmpty());
             if (!controller->m_pendingPullIntos.isEmpty()) {
                 ASSERT(controller->m_pendingPullIntos.first()->m_readerType == ReaderType::Default);
                 readableByteStreamControllerShiftPendingPullInto(controller);
             }
-            JSArrayBufferView* transferredView = constructViewOfType(globalObject, JSC::TypeUint8, WTF::move(transferredBuffer), byteOffset, byteLength);
+            buffer = exclusiveQueueBuffer(globalObject, WTF::move(buffer), byteOffset, byteLength);
+            RETURN_IF_EXCEPTION(scope, void());
+            JSArrayBufferView* transferredView = constructViewOfType(globalObject, JSC::TypeUint8, WTF::move(buffer), byteOffset, byteLength);
             RETURN_IF_EXCEPTION(scope, void());
             readableStreamFulfillReadRequest(globalObject, stream, transferredView, false);
             RETURN_IF_EXCEPTION(scope, void());
         }
     } else if (readableStreamHasBYOBReader(stream)) {
-        readableByteStreamControllerEnqueueChunkToQueue(controller, WTF::move(transferredBuffer), byteOffset, byteLength);
+        readableByteStreamControllerEnqueueChunkToQueue(controller, WTF::move(buffer), byteOffset, byteLength);
         MarkedArgumentBuffer filledPullIntos;
         readableByteStreamControllerProcessPullIntoDescriptorsUsingQueue(controller, filledPullIntos);
         if (filledPullIntos.hasOverflowed()) [[unlikely]] {
@@ -804,7 +837,7 @@ void readableByteStreamControllerEnqueue(JSGlobalObject* globalObject, JSReadabl
         }
     } else {
         ASSERT(!isReadableStreamLocked(stream));
-        readableByteStreamControllerEnqueueChunkToQueue(controller, WTF::move(transferredBuffer), byteOffset, byteLength);
+        readableByteStreamControllerEnqueueChunkToQueue(controller, WTF::move(buffer), byteOffset, byteLength);
     }
     RELEASE_AND_RETURN(scope, readableByteStreamControllerCallPullIfNeeded(globalObject, controller));
 }
@@ -943,6 +976,8 @@ void readableByteStreamControllerFillReadRequestFromQueue(JSGlobalObject* global
     controller->m_queue.adjustTotalSize(-static_cast<double>(byteLength));
     readableByteStreamControllerHandleQueueDrain(globalObject, controller);
     RETURN_IF_EXCEPTION(scope, void());
+    buffer = exclusiveQueueBuffer(globalObject, WTF::move(buffer), byteOffset, byteLength);
+    RETURN_IF_EXCEPTION(scope, void());
     JSArrayBufferView* view = constructViewOfType(globalObject, JSC::TypeUint8, WTF::move(buffer), byteOffset, byteLength);
     RETURN_IF_EXCEPTION(scope, void());
     RELEASE_AND_RETURN(scope, readRequest->chunkSteps(globalObject, view));
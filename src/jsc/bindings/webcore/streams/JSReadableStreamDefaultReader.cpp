@@ -209,6 +209,8 @@ static double drainQueueEntriesInto(JSC::VM& vm, JSGlobalObject* globalObject, J
                 byteLength = entry.byteLength;
                 byteController->m_queue.removeFirst(locker);
             }
+            buffer = exclusiveQueueBuffer(globalObject, WTF::move(buffer), byteOffset, byteLength);
+            RETURN_IF_EXCEPTION(scope, size);
             bool resizable = buffer->isResizableOrGrowableShared();
             chunk = JSUint8Array::create(globalObject, globalObject->typedArrayStructure(TypeUint8, resizable), WTF::move(buffer), byteOffset, byteLength);
             RETURN_IF_EXCEPTION(scope, size);
@@ -264,6 +266,32 @@ static JSValue drainQueueForReadMany(JSC::VM& vm, JSGlobalObject* globalObject,
     return createReadManyResult(vm, globalObject, values, size, false);
 }
 
+// The reader-less consumer fast path. The hot server case — a fully-buffered request body
+// consumed exactly once by .text()/.json() — reaches the generic pump with the source
+// already exhausted, so the reader, JSReadRequest, and pump-operation cells it would
+// allocate are pure scaffolding. Draining the queue directly skips all three; the observable
+// state transitions (disturbed, closed, settled closed promise) are identical because no
+// pull algorithm can run once close has been requested.
+bool readableStreamDrainExhaustedQueue(JSGlobalObject* globalObject, JSReadableStream* stream, JSArray* chunks)
+{
+    auto& vm = getVM(globalObject);
+    auto scope = DECLARE_THROW_SCOPE(vm);
+    bool isByte = stream->m_controllerKind == ControllerKind::Byte;
+    if (!isByte && stream->m_controllerKind != ControllerKind::Default)
+        return false;
+    if (stream->m_state != ReadableStreamState::Closed) {
+        if (stream->m_state != ReadableStreamState::Readable)
+            return false;
+        bool closeRequested = isByte ? byteControllerOf(stream)->m_closeRequested : defaultControllerOf(stream)->m_closeRequested;
+        if (!closeRequested)
+            return false;
+    }
+    stream->m_disturbed = true;
+    drainQueueEntriesInto(vm, globalObject, stream, chunks, chunks->length());
+    RETURN_IF_EXCEPTION(scope, true);
+    return true;
+}
+
 // The buffered-consumer pump step: bulk-appends everything queued to `chunks`; when the
 // queue is empty and the stream is still readable, issues ONE spec read and hands its
 // promise back via `pendingRead`. Throws the stored error on an errored stream.
@@ -7,6 +7,7 @@
 #include "BunStreamSource.h"
 #include "DOMClientIsoSubspaces.h"
 #include "DOMIsoSubspaces.h"
+#include "JSCompressionTransformState.h"
 #include "JSCrossRealmTransformState.h"
 #include "JSDirectSinkCloseState.h"
 #include "JSAsyncIteratorSourceOperation.h"
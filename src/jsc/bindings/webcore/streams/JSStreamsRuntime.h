@@ -327,7 +327,8 @@ JSC_DECLARE_HOST_FUNCTION(jsWebStreamsCountQueuingStrategySize);
     V(resumableSinkPumpOperationStructure, JSResumableSinkPumpOperation)     \
     V(standaloneTextSinkStructure, JSBunStandaloneTextSink)                  \
     V(oneShotDirectSinkStructure, JSOneShotDirectSink)                       \
-    V(intoArrayOperationStructure, JSReadableStreamIntoArrayOperation)
+    V(intoArrayOperationStructure, JSReadableStreamIntoArrayOperation)       \
+    V(compressionTransformStateStructure, JSCompressionTransformState)
 
 // Non-destructible: LazyProperty members only (plus the end-of-tick flush list, a
 // WriteBarrier container mutated and visited under this cell's lock).
@@ -16,6 +16,7 @@
 #include "WebStreamsHeapAnalyzer.h"
 #include "WebStreamsInspectCustom.h"
 #include "WebStreamsInternals.h"
+#include "ZigGeneratedClasses.h"
 #include "ZigGlobalObject.h"
 #include <JavaScriptCore/Error.h>
 #include <JavaScriptCore/FunctionPrototype.h>
@@ -361,18 +362,32 @@ namespace WebStreams {
 using namespace JSC;
 using WebCore::JSTextDecoderStream;
 
-// `decoder.decode(input, { stream })` on the wrapped TextDecoder. Runs user JS: `decode`
-// is looked up on the public TextDecoder.prototype. Empty return = it threw.
+// Implemented in Rust (`TextDecoder.rs`). Feeds one chunk to the wrapped decoder's native
+// decode — same input validation and streaming state as `TextDecoder.prototype.decode`, minus
+// the options object, JS call frame, and argument re-parse. `flush` maps to `{ stream: !flush }`.
+extern "C" JSC::EncodedJSValue TextDecoder__decodeValue(JSGlobalObject*, JSC::EncodedJSValue decoder, JSC::EncodedJSValue input, bool flush);
+
+// `decoder.decode(input, { stream })` on the wrapped TextDecoder. `decode` is looked up on
+// the public TextDecoder.prototype every chunk, so a patched prototype is honored; when the
+// lookup resolves to the pristine builtin (compared by native entry point, so re-assigning
+// the builtin itself still matches) the call goes straight to the native decode, skipping
+// the options allocation and JS call machinery. Empty return = it threw.
 static JSValue invokeDecode(JSC::VM& vm, JSGlobalObject* globalObject, JSObject* decoder, JSValue input, bool streaming)
 {
     auto scope = DECLARE_THROW_SCOPE(vm);
     auto& names = WebCore::builtinNames(vm);
 
+    JSValue method = decoder->get(globalObject, names.decodePublicName());
+    RETURN_IF_EXCEPTION(scope, {});
+
+    auto* function = jsDynamicCast<JSFunction*>(method);
+    if (function && function->isHostFunction()
+        && function->nativeFunction() == TaggedNativeFunction(WebCore::TextDecoderPrototype__decodeCallback)) [[likely]]
+        RELEASE_AND_RETURN(scope, JSValue::decode(TextDecoder__decodeValue(globalObject, JSValue::encode(decoder), JSValue::encode(input), !streaming)));
+
     auto* decodeOptions = constructEmptyObject(globalObject);
     decodeOptions->putDirect(vm, names.streamPublicName(), jsBoolean(streaming));
 
-    JSValue method = decoder->get(globalObject, names.decodePublicName());
-    RETURN_IF_EXCEPTION(scope, {});
     auto callData = getCallData(method);
     if (callData.type == CallData::Type::None) [[unlikely]] {
         throwTypeError(globalObject, scope, "TextDecoder.prototype.decode is not callable"_s);
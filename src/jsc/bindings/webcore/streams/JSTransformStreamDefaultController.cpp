@@ -7,6 +7,7 @@
 #include "JSDOMGlobalObjectInlines.h"
 #include "JSDOMWrapperCache.h"
 #include "JSReadableStream.h"
+#include "JSCompressionTransformState.h"
 #include "JSReadableStreamDefaultController.h"
 #include "JSStreamsRuntime.h"
 #include "JSTextDecoderStream.h"
@@ -105,6 +106,8 @@ static JSPromise* performTransformAlgorithm(JSC::VM& vm, JSGlobalObject* globalO
         RELEASE_AND_RETURN(scope, textEncoderStreamTransform(globalObject, uncheckedDowncast<JSTextEncoderStream>(controller->m_algorithmContext.get()), controller, chunk));
     case TransformerKind::TextDecoder:
         RELEASE_AND_RETURN(scope, textDecoderStreamTransform(globalObject, uncheckedDowncast<JSTextDecoderStream>(controller->m_algorithmContext.get()), controller, chunk));
+    case TransformerKind::Compression:
+        RELEASE_AND_RETURN(scope, compressionStreamTransform(globalObject, uncheckedDowncast<JSCompressionTransformState>(controller->m_algorithmContext.get()), controller, chunk));
     }
     RELEASE_AND_RETURN(scope, defaultTransformAlgorithm(vm, globalObject, controller, chunk));
 }
@@ -1235,12 +1235,23 @@ static EncodedJSValue byteTeeChunkStepsMicrotask(JSGlobalObject* globalObject, J
     auto* controller1 = teeBranchByteController(teeState->m_branch1.get());
     auto* controller2 = teeBranchByteController(teeState->m_branch2.get());
     auto* chunk1 = uncheckedDowncast<JSArrayBufferView>(chunk);
-    JSArrayBufferView* chunk2 = chunk1;
     if (!teeState->m_canceled1 && !teeState->m_canceled2) {
-        JSUint8Array* cloneResult = nullptr;
+        // Both branches live: instead of the spec's CloneAsUint8Array for branch2, transfer
+        // the chunk's buffer ONCE and let both branch queues share the transferred block. It
+        // stays immutable while shared; exclusiveQueueBuffer() copies at JS-view
+        // materialization only if the other branch still holds a reference — so buffered,
+        // canceled-later, and pull-into consumers skip the per-chunk copy entirely.
+        RefPtr<JSC::ArrayBuffer> buffer = chunk1->possiblySharedBuffer();
+        size_t byteOffset = chunk1->byteOffset();
+        size_t byteLength = chunk1->byteLength();
+        if (!buffer || buffer->isDetached()) [[unlikely]] {
+            Bun::throwError(globalObject, scope, Bun::ErrorCode::ERR_INVALID_STATE_TypeError, "Invalid state: chunk ArrayBuffer is zero-length or detached"_s);
+            return {};
+        }
+        RefPtr<JSC::ArrayBuffer> transferredBuffer;
         {
             auto catchScope = DECLARE_TOP_EXCEPTION_SCOPE(vm);
-            cloneResult = cloneAsUint8Array(globalObject, chunk1);
+            transferredBuffer = transferArrayBufferImpl(globalObject, *buffer);
             if (catchScope.exception()) [[unlikely]] {
                 JSValue thrown = takeAbruptCompletion(globalObject, catchScope);
                 if (thrown.isEmpty())
@@ -1260,15 +1271,23 @@ static EncodedJSValue byteTeeChunkStepsMicrotask(JSGlobalObject* globalObject, J
                 return JSValue::encode(jsUndefined());
             }
         }
-        chunk2 = cloneResult;
-    }
-    if (!teeState->m_canceled1 && controller1) {
-        readableByteStreamControllerEnqueue(globalObject, controller1, chunk1);
-        RETURN_IF_EXCEPTION(scope, {});
-    }
-    if (!teeState->m_canceled2 && controller2) {
-        readableByteStreamControllerEnqueue(globalObject, controller2, chunk2);
-        RETURN_IF_EXCEPTION(scope, {});
+        if (controller1) {
+            readableByteStreamControllerEnqueueSharedChunk(globalObject, controller1, RefPtr { transferredBuffer }, byteOffset, byteLength);
+            RETURN_IF_EXCEPTION(scope, {});
+        }
+        if (controller2) {
+            readableByteStreamControllerEnqueueSharedChunk(globalObject, controller2, WTF::move(transferredBuffer), byteOffset, byteLength);
+            RETURN_IF_EXCEPTION(scope, {});
+        }
+    } else {
+        if (!teeState->m_canceled1 && controller1) {
+            readableByteStreamControllerEnqueue(globalObject, controller1, chunk1);
+            RETURN_IF_EXCEPTION(scope, {});
+        }
+        if (!teeState->m_canceled2 && controller2) {
+            readableByteStreamControllerEnqueue(globalObject, controller2, chunk1);
+            RETURN_IF_EXCEPTION(scope, {});
+        }
     }
     teeState->m_reading = false;
     if (teeState->m_readAgain1) {
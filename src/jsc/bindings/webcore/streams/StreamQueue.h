@@ -53,8 +53,11 @@ struct ValueWithSize {
 };
 
 // One entry of a readable byte stream queue. The buffer is the ArrayBuffer IMPL (always a
-// transferred, exclusively-owned block): no JSArrayBuffer wrapper cell exists for it unless
-// user code reads `.buffer` off a view handed out over it.
+// transferred block): no JSArrayBuffer wrapper cell exists for it unless user code reads
+// `.buffer` off a view handed out over it. The block is usually exclusively owned, but the
+// byte tee enqueues ONE transferred block into both branch queues — shared entries are
+// treated as immutable, and exclusiveQueueBuffer() (WebStreamsInternals.h) restores sole
+// ownership before any JS view is materialized over one.
 struct ByteQueueEntry {
     RefPtr<JSC::ArrayBuffer> buffer; // "buffer"
     size_t byteOffset; // "byte offset"
@@ -79,6 +79,7 @@ class JSReadStreamIntoSinkOperation;
 class JSResumableSinkPumpOperation;
 class JSTextEncoderStream;
 class JSTextDecoderStream;
+class JSCompressionTransformState; // CompressionStream's native zstd/brotli encoder
 
 } // namespace WebCore
 
@@ -133,6 +134,7 @@ enum class TransformerKind : uint8_t {
     Identity, // new TransformStream() with no `transform` member: enqueue the chunk unchanged
     TextEncoder, // TextEncoderStream (context = the JSTextEncoderStream cell)
     TextDecoder, // TextDecoderStream (context = the JSTextDecoderStream cell)
+    Compression, // CompressionStream "zstd"/"brotli" (context = the JSCompressionTransformState cell)
 };
 
 // JSReadableStream Bun-mode members
@@ -5,6 +5,7 @@
 #include "JSDOMGlobalObject.h"
 #include "JSDOMWrapperCache.h"
 #include "JSReadableStream.h"
+#include "JSCompressionTransformState.h"
 #include "JSReadableStreamDefaultController.h"
 #include "JSStreamsRuntime.h"
 #include "JSTextDecoderStream.h"
@@ -79,11 +80,14 @@ static JSPromise* performFlushAlgorithm(JSC::VM& vm, JSGlobalObject* globalObjec
         RELEASE_AND_RETURN(scope, textEncoderStreamFlush(globalObject, uncheckedDowncast<JSTextEncoderStream>(controller->m_algorithmContext.get()), controller));
     case TransformerKind::TextDecoder:
         RELEASE_AND_RETURN(scope, textDecoderStreamFlush(globalObject, uncheckedDowncast<JSTextDecoderStream>(controller->m_algorithmContext.get()), controller));
+    case TransformerKind::Compression:
+        RELEASE_AND_RETURN(scope, compressionStreamFlush(globalObject, uncheckedDowncast<JSCompressionTransformState>(controller->m_algorithmContext.get()), controller));
     }
     RELEASE_AND_RETURN(scope, promiseFulfilledWith(globalObject, JSC::jsUndefined()));
 }
 
-// [[cancelAlgorithm]] dispatch. The TextEncoder/TextDecoder kinds have no cancel algorithm.
+// [[cancelAlgorithm]] dispatch. The TextEncoder/TextDecoder/Compression kinds have no
+// cancel algorithm (the Compression encoder context dies with its cell).
 static JSPromise* performCancelAlgorithm(JSC::VM& vm, JSGlobalObject* globalObject, JSTransformStreamDefaultController* controller, JSValue reason)
 {
     auto scope = DECLARE_THROW_SCOPE(vm);
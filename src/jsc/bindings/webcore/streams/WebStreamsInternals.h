@@ -53,6 +53,7 @@ inline bool exceedsStringLimit(size_t length)
 }
 
 // Reduce noise: every class name below is a WebCore JS cell (StreamsForward.h).
+using WebCore::JSCompressionTransformState;
 using WebCore::JSCrossRealmTransformState;
 using WebCore::JSDirectSinkCloseState;
 using WebCore::JSDirectStreamController;
@@ -132,6 +133,9 @@ bool canTransferArrayBuffer(JSC::ArrayBuffer&); // userJS: no — WebStreamsMisc
 // spec CanTransferArrayBuffer(O) — pure.
 // spec CloneAsUint8Array(O) — allocation-throws only.
 JSC::JSUint8Array* cloneAsUint8Array(JSC::JSGlobalObject*, JSC::JSArrayBufferView*); // userJS: no — WebStreamsMisc.cpp
+// Copies a queued block that the other byte-tee branch still references (else adopts it);
+// null ⇒ exception pending. Adjusts `byteOffset` on copy.
+RefPtr<JSC::ArrayBuffer> exclusiveQueueBuffer(JSC::JSGlobalObject*, RefPtr<JSC::ArrayBuffer>&&, size_t& byteOffset, size_t byteLength); // userJS: no; allocation-throws — JSReadableByteStreamController.cpp
 // spec StructuredClone(v): use the EXISTING WebCore::structuredCloneForStream
 // (src/jsc/bindings/webcore/StructuredClone.h). No streams-local duplicate is declared.
 // spec CanCopyDataBlockBytes(toBuffer, toIndex, fromBuffer, fromIndex, count) — pure.
@@ -295,6 +299,11 @@ enum class ConsumerFillStep : uint8_t { Done,
 // The buffered-consumer pump step (BunStreamConsumers.cpp): bulk queue drain into `chunks`,
 // or one pending spec read when the queue is empty. Throws on an errored stream.
 ConsumerFillStep readableStreamDefaultReaderFillFromQueue(JSC::JSGlobalObject*, JSReadableStreamDefaultReader*, JSC::JSArray* chunks, JSC::JSPromise** pendingRead); // userJS: yes — JSReadableStreamDefaultReader.cpp
+// Reader-less bulk drain for a queue-backed stream whose source is already exhausted (closed,
+// or close requested with everything in [[queue]]): appends every chunk to `chunks`, marks the
+// stream disturbed, and closes it. Returns false — stream untouched — when a read could still
+// be needed, the stream is not queue-backed, or it is errored.
+bool readableStreamDrainExhaustedQueue(JSC::JSGlobalObject*, JSReadableStream*, JSC::JSArray* chunks); // userJS: no (no pull can run; close settles promises via microtasks) — JSReadableStreamDefaultReader.cpp
 JSC::JSValue readableStreamDefaultReaderReadMany(JSC::JSGlobalObject*, JSReadableStreamDefaultReader*); // userJS: yes — JSReadableStreamDefaultReader.cpp
 
 // JSReadableStreamBYOBReader.cpp
@@ -329,6 +338,9 @@ void readableByteStreamControllerClose(JSC::JSGlobalObject*, JSReadableByteStrea
 void readableByteStreamControllerCommitPullIntoDescriptor(JSC::JSGlobalObject*, JSReadableStream*, JSPullIntoDescriptor*); // userJS: yes (fulfill dispatch) — JSReadableByteStreamController.cpp
 JSC::JSArrayBufferView* readableByteStreamControllerConvertPullIntoDescriptor(JSC::JSGlobalObject*, JSPullIntoDescriptor*); // userJS: no (intrinsic view construction only) — JSReadableByteStreamController.cpp
 void readableByteStreamControllerEnqueue(JSC::JSGlobalObject*, JSReadableByteStreamController*, JSC::JSArrayBufferView* chunk); // userJS: yes; throws — JSReadableByteStreamController.cpp
+// The enqueue tail past the transfer step: the byte tee's shared-chunk entry point. `buffer`
+// may still sit in the other branch's queue and is treated as immutable while shared.
+void readableByteStreamControllerEnqueueSharedChunk(JSC::JSGlobalObject*, JSReadableByteStreamController*, RefPtr<JSC::ArrayBuffer>&&, size_t byteOffset, size_t byteLength); // userJS: yes; throws — JSReadableByteStreamController.cpp
 void readableByteStreamControllerEnqueueChunkToQueue(JSReadableByteStreamController*, RefPtr<JSC::ArrayBuffer>&&, size_t byteOffset, size_t byteLength); // userJS: no — JSReadableByteStreamController.cpp
 void readableByteStreamControllerEnqueueClonedChunkToQueue(JSC::JSGlobalObject*, JSReadableByteStreamController*, JSC::ArrayBuffer&, size_t byteOffset, size_t byteLength); // userJS: yes (a takeAbruptCompletion catch site; errors the controller then rethrows) — JSReadableByteStreamController.cpp
 void readableByteStreamControllerEnqueueDetachedPullIntoToQueue(JSC::JSGlobalObject*, JSReadableByteStreamController*, JSPullIntoDescriptor*); // userJS: yes; throws — JSReadableByteStreamController.cpp
@@ -458,6 +470,13 @@ JSC::JSPromise* textEncoderStreamFlush(JSC::JSGlobalObject*, JSTextEncoderStream
 JSC::JSPromise* textDecoderStreamTransform(JSC::JSGlobalObject*, JSTextDecoderStream*, JSTransformStreamDefaultController*, JSC::JSValue chunk); // userJS: yes — JSTextDecoderStream.cpp
 JSC::JSPromise* textDecoderStreamFlush(JSC::JSGlobalObject*, JSTextDecoderStream*, JSTransformStreamDefaultController*); // userJS: yes — JSTextDecoderStream.cpp
 
+// JSCompressionTransformState.cpp — the TransformerKind::Compression algorithm ARMS
+// (CompressionStream "zstd"/"brotli": the whole chunk is compressed natively before the
+// one enqueue). Same dispatch/bridge relationship as the TextEncoder arms above.
+
+JSC::JSPromise* compressionStreamTransform(JSC::JSGlobalObject*, JSCompressionTransformState*, JSTransformStreamDefaultController*, JSC::JSValue chunk); // userJS: yes (enqueue can hit a user size algorithm) — JSCompressionTransformState.cpp
+JSC::JSPromise* compressionStreamFlush(JSC::JSGlobalObject*, JSCompressionTransformState*, JSTransformStreamDefaultController*); // userJS: yes — JSCompressionTransformState.cpp
+
 // CrossRealmTransform.cpp — transferable streams are NOT implemented. These signatures are
 // FROZEN, but the .cpp may be a stub whose entry points assert / throw; the per-class
 // transfer / transfer-receiving steps have no declarations here.
@@ -141,6 +141,23 @@ void CryptoAlgorithm::dispatchOperationInWorkQueue(WorkQueue& workQueue, ScriptE
     dispatchAlgorithmOperation(workQueue, context, WTF::move(callback), WTF::move(exceptionCallback), WTF::move(operation));
 }
 
+void CryptoAlgorithm::dispatchOperationInWorkQueue(WorkQueue& workQueue, ScriptExecutionContext& context, size_t payloadSize, size_t inlineByteThreshold, VectorCallback&& callback, ExceptionCallback&& exceptionCallback, Function<ExceptionOr<Vector<uint8_t>>()>&& operation)
+{
+    if (payloadSize < inlineByteThreshold) {
+        // The caller's promise already exists; resolving it here only schedules
+        // microtasks, so completing synchronously is observationally equivalent
+        // to the offloaded path minus the thread hop.
+        auto result = operation();
+        if (result.hasException()) {
+            exceptionCallback(result.releaseException().code(), ""_s);
+            return;
+        }
+        callback(result.releaseReturnValue());
+        return;
+    }
+    dispatchAlgorithmOperation(workQueue, context, WTF::move(callback), WTF::move(exceptionCallback), WTF::move(operation));
+}
+
 }
 
 #endif
@@ -84,6 +84,11 @@ public:
 
     static void dispatchOperationInWorkQueue(WorkQueue&, ScriptExecutionContext&, VectorCallback&&, ExceptionCallback&&, Function<ExceptionOr<Vector<uint8_t>>()>&&);
     static void dispatchOperationInWorkQueue(WorkQueue&, ScriptExecutionContext&, BoolCallback&&, ExceptionCallback&&, Function<ExceptionOr<bool>()>&&);
+    // Threshold-aware variant: payloads under `inlineByteThreshold` complete inline on the
+    // calling thread — at those sizes the cipher finishes in microseconds, well under the cost
+    // of a work-pool round trip — while larger payloads are offloaded as above. Each algorithm
+    // picks its own threshold; pass 0 to always offload.
+    static void dispatchOperationInWorkQueue(WorkQueue&, ScriptExecutionContext&, size_t payloadSize, size_t inlineByteThreshold, VectorCallback&&, ExceptionCallback&&, Function<ExceptionOr<Vector<uint8_t>>()>&&);
 
     // Truncates `secret` to the first `length` bits, zeroing the unused trailing bits of the
     // final byte, per https://w3c.github.io/webcrypto/#SubtleCrypto-method-deriveBits. A null
@@ -48,36 +48,35 @@ CryptoAlgorithmRegistry::CryptoAlgorithmRegistry()
     platformRegisterAlgorithms();
 }
 
-std::optional<CryptoAlgorithmIdentifier> CryptoAlgorithmRegistry::identifier(const String& name)
+// The tables are immutable once the constructor returns (see the class
+// comment), so the lookups below run concurrently from worker threads without
+// locking or copying the lookup key.
+
+std::optional<CryptoAlgorithmIdentifier> CryptoAlgorithmRegistry::identifier(const String& name) const
 {
     if (name.isEmpty())
         return std::nullopt;
 
-    Locker locker { m_lock };
-
-    // FIXME: How is it helpful to call isolatedCopy on the argument to find?
-    auto identifier = m_identifiers.find(name.isolatedCopy());
+    auto identifier = m_identifiers.find(name);
     if (identifier == m_identifiers.end())
         return std::nullopt;
 
     return identifier->value;
 }
 
-String CryptoAlgorithmRegistry::name(CryptoAlgorithmIdentifier identifier)
+String CryptoAlgorithmRegistry::name(CryptoAlgorithmIdentifier identifier) const
 {
-    Locker locker { m_lock };
-
     auto contructor = m_constructors.find(static_cast<unsigned>(identifier));
     if (contructor == m_constructors.end())
         return {};
 
+    // The copy keeps callers from sharing one StringImpl refcount across
+    // threads; the stored name itself is never handed out.
     return contructor->value.first.isolatedCopy();
 }
 
-RefPtr<CryptoAlgorithm> CryptoAlgorithmRegistry::create(CryptoAlgorithmIdentifier identifier)
+RefPtr<CryptoAlgorithm> CryptoAlgorithmRegistry::create(CryptoAlgorithmIdentifier identifier) const
 {
-    Locker locker { m_lock };
-
     auto contructor = m_constructors.find(static_cast<unsigned>(identifier));
     if (contructor == m_constructors.end())
         return nullptr;
@@ -85,10 +84,10 @@ RefPtr<CryptoAlgorithm> CryptoAlgorithmRegistry::create(CryptoAlgorithmIdentifie
     return contructor->value.second();
 }
 
+// Construction-time only (called from platformRegisterAlgorithms inside the
+// constructor, before the singleton is published).
 void CryptoAlgorithmRegistry::registerAlgorithm(const String& name, CryptoAlgorithmIdentifier identifier, CryptoAlgorithmConstructor constructor)
 {
-    Locker locker { m_lock };
-
     ASSERT(!m_identifiers.contains(name));
     ASSERT(!m_constructors.contains(static_cast<unsigned>(identifier)));
 
@@ -28,7 +28,6 @@
 #include "CryptoAlgorithmIdentifier.h"
 #include <wtf/Forward.h>
 #include <wtf/HashMap.h>
-#include <wtf/Lock.h>
 #include <wtf/Noncopyable.h>
 #include <wtf/text/StringHash.h>
 
@@ -38,6 +37,10 @@ namespace WebCore {
 
 class CryptoAlgorithm;
 
+// Process-wide immutable snapshot: both tables are fully populated inside the
+// constructor (under `singleton()`'s call_once, which publishes them) and
+// never mutated afterwards, so lookups from every worker thread are lock-free
+// and allocation-free.
 class CryptoAlgorithmRegistry {
     WTF_MAKE_NONCOPYABLE(CryptoAlgorithmRegistry);
     friend class LazyNeverDestroyed<CryptoAlgorithmRegistry>;
@@ -45,10 +48,10 @@ class CryptoAlgorithmRegistry {
 public:
     static CryptoAlgorithmRegistry& singleton();
 
-    std::optional<CryptoAlgorithmIdentifier> identifier(const String&);
-    String name(CryptoAlgorithmIdentifier);
+    std::optional<CryptoAlgorithmIdentifier> identifier(const String&) const;
+    String name(CryptoAlgorithmIdentifier) const;
 
-    RefPtr<CryptoAlgorithm> create(CryptoAlgorithmIdentifier);
+    RefPtr<CryptoAlgorithm> create(CryptoAlgorithmIdentifier) const;
 
 private:
     CryptoAlgorithmRegistry();
@@ -62,9 +65,8 @@ private:
     }
     void registerAlgorithm(const String& name, CryptoAlgorithmIdentifier, CryptoAlgorithmConstructor);
 
-    Lock m_lock;
-    HashMap<String, CryptoAlgorithmIdentifier, ASCIICaseInsensitiveHash> m_identifiers WTF_GUARDED_BY_LOCK(m_lock);
-    HashMap<unsigned, std::pair<String, CryptoAlgorithmConstructor>> m_constructors WTF_GUARDED_BY_LOCK(m_lock);
+    HashMap<String, CryptoAlgorithmIdentifier, ASCIICaseInsensitiveHash> m_identifiers;
+    HashMap<unsigned, std::pair<String, CryptoAlgorithmConstructor>> m_constructors;
 };
 
 } // namespace WebCore
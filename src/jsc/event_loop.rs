@@ -147,6 +147,10 @@ mod drain_result {
 // the microtask queue through it is interior mutation invisible to Rust.
 unsafe extern "C" {
     safe fn JSC__JSGlobalObject__drainMicrotasks(global: &JSGlobalObject) -> u8;
+    /// Cheap nextTick/microtask-queue emptiness probe backing the
+    /// empty-checkpoint fast path in
+    /// [`EventLoop::drain_microtasks_with_global`].
+    safe fn JSC__JSGlobalObject__hasPendingMicrotasks(global: &JSGlobalObject) -> bool;
 }
 
 #[derive(thiserror::Error, strum::IntoStaticStr, Debug)]
@@ -325,10 +329,19 @@ impl EventLoop {
         jsc::mark_binding();
         jsc_vm.release_weak_refs();
 
-        match JSC__JSGlobalObject__drainMicrotasks(global_object) {
-            drain_result::SUCCESS => {}
-            drain_result::JS_TERMINATED => return Err(JsTerminated::JSTerminated),
-            _ => unreachable!(),
+        // Empty-checkpoint fast path: a large setImmediate/timer batch pays
+        // this drain after every callback, and most of those callbacks queue
+        // no nextTick/microtask work — skip the C++ round trip (exception
+        // scope setup + nextTick drain + VM queue walk) when there is provably
+        // nothing to run. A pending exception (including termination) takes
+        // the full path so it is reported/propagated exactly as before.
+        if global_object.has_exception() || JSC__JSGlobalObject__hasPendingMicrotasks(global_object)
+        {
+            match JSC__JSGlobalObject__drainMicrotasks(global_object) {
+                drain_result::SUCCESS => {}
+                drain_result::JS_TERMINATED => return Err(JsTerminated::JSTerminated),
+                _ => unreachable!(),
+            }
         }
 
         // `Cell` write through `&VirtualMachine` — no `&mut VM` formed (would
@@ -851,11 +864,38 @@ impl EventLoop {
         unsafe { (*this).immediate_tasks = core::mem::take(&mut (*this).next_immediate_tasks) };
 
         let mut exception_thrown = false;
-        for task in to_run_now.iter() {
+        // Stop dispatching when the VM is terminated mid-batch
+        // (worker.terminate() from a callback): each remaining dispatch would
+        // still pay the enter/exit + drain round trip only for
+        // `Bun__JSTimeout__call` to refuse it. The forbidden-execution probe
+        // is an FFI read, so amortize it — check when a callback reports an
+        // exception and every `TERMINATION_CHECK_INTERVAL` callbacks
+        // otherwise. Ordinary uncaught exceptions keep the batch running,
+        // same as before.
+        const TERMINATION_CHECK_INTERVAL: usize = 64;
+        // SAFETY: `virtual_machine` is the live per-thread VM (fn contract).
+        let jsc_vm = unsafe { (*virtual_machine).jsc_vm() };
+        let total = to_run_now.len();
+        let mut index = 0;
+        while index < total {
+            let task = to_run_now[index];
+            index += 1;
             // SAFETY: ImmediateObject pointers are kept alive by the JS heap
             // until `runImmediateTask` consumes them; `virtual_machine` is the
             // live owning VM per caller contract.
-            exception_thrown = unsafe { __bun_run_immediate_task(*task, virtual_machine) };
+            exception_thrown = unsafe { __bun_run_immediate_task(task, virtual_machine) };
+            if (exception_thrown || index % TERMINATION_CHECK_INTERVAL == 0)
+                && jsc_vm.execution_forbidden()
+            {
+                bun_core::hint::cold();
+                for task in &to_run_now[index..] {
+                    // SAFETY: each remaining pointer is a still-queued
+                    // `ImmediateObject` that was never dispatched; cancelling
+                    // releases the event loop's `+1` without running it.
+                    unsafe { __bun_cancel_pending_immediate(*task, virtual_machine) };
+                }
+                break;
+            }
         }
         // Re-escape `this` after the re-entrant loop so nothing about `*this`
         // is carried across it.
@@ -318,6 +318,7 @@ pub struct SSLConfig {
     pub crl: SSLConfigFile,
     pub allow_partial_trust_chain: bool,
     pub session_timeout: i32,
+    pub session_cache_size: u32,
     pub sigalgs: GenOpt<GenString>,
 }
 
@@ -568,6 +569,7 @@ struct ExternSSLConfig {
     crl: ExternSSLConfigFile,
     allow_partial_trust_chain: bool,
     session_timeout: i32,
+    session_cache_size: u32,
     sigalgs: RawWTFStringImpl,
 }
 
@@ -606,6 +608,7 @@ impl SSLConfig {
             crl: SSLConfigFile::convert_from_extern(ext.crl),
             allow_partial_trust_chain: ext.allow_partial_trust_chain,
             session_timeout: ext.session_timeout,
+            session_cache_size: ext.session_cache_size,
             sigalgs: adopt_opt_string(ext.sigalgs),
         }
     }
@@ -166,6 +166,8 @@ pub mod schema_api {
 }
 #[path = "array_buffer.rs"]
 pub mod array_buffer;
+
+pub mod array_buffer_accounting;
 #[path = "CommonStrings.rs"]
 pub mod common_strings;
 #[path = "ConsoleObject.rs"]
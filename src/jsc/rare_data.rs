@@ -279,6 +279,13 @@ pub struct RareData {
     pub s3_default_client: Strong,
     pub default_csrf_secret: Box<[u8]>,
 
+    /// Current pool ArrayBuffer for small socket `'data'` Buffers — see
+    /// `ArrayBuffer::create_buffer_pooled`. Holds only the slab being filled;
+    /// retired slabs stay alive exactly as long as chunk views reference them.
+    pub socket_chunk_pool: Strong,
+    /// Next free byte in `socket_chunk_pool` (8-byte aligned).
+    pub socket_chunk_pool_offset: usize,
+
     /// Owned NUL-terminated buffer. `len()` includes the trailing 0;
     /// [`Self::tls_default_ciphers`] strips it.
     pub tls_default_ciphers: Option<Box<[u8]>>,
@@ -329,6 +336,8 @@ impl Default for RareData {
             temp_pipe_read_buffer: None,
             s3_default_client: Strong::empty(),
             default_csrf_secret: Box::default(),
+            socket_chunk_pool: Strong::empty(),
+            socket_chunk_pool_offset: 0,
             tls_default_ciphers: None,
             spawn_sync_event_loop_: None,
             path_buf: PathBuf::default(),
@@ -1039,8 +1048,8 @@ fn get_tls_default_ciphers_from_js(
 impl Drop for RareData {
     fn drop(&mut self) {
         // temp_pipe_read_buffer / spawn_sync_event_loop_ / s3_default_client /
-        // default_csrf_secret / cleanup_hooks / cron_jobs / path_buf /
-        // tls_default_ciphers:
+        // socket_chunk_pool / default_csrf_secret / cleanup_hooks / cron_jobs /
+        // path_buf / tls_default_ciphers:
         // all dropped automatically via field Drop.
 
         if let Some(engine) = self.boring_ssl_engine.take() {
@@ -222,6 +222,9 @@ pub struct BundlerOptions {
     // Compile options
     pub compile: bool,
     pub compile_target: CompileTarget,
+    /// Additional targets from a comma-separated `--target` list; each builds
+    /// in its own worker process (see `build_command`).
+    pub compile_extra_targets: Vec<CompileTarget>,
     pub compile_exec_argv: Option<Box<[u8]>>,
     pub compile_autoload_dotenv: bool,
     pub compile_autoload_bunfig: bool,
@@ -272,6 +275,7 @@ impl Default for BundlerOptions {
             elide_lines: None,
             compile: false,
             compile_target: CompileTarget::default(),
+            compile_extra_targets: Vec::new(),
             compile_exec_argv: None,
             compile_autoload_dotenv: true,
             compile_autoload_bunfig: true,
@@ -10,9 +10,10 @@ pub enum PerfEvent {
     _Stub = -1,
     FolderResolverReadPackageJSONFromDiskFolder = 34,
     FolderResolverReadPackageJSONFromDiskWorkspace = 35,
-    ModuleResolverResolve = 47,
-    StandaloneModuleGraphSerialize = 54,
-    SymbolsFollowAll = 55,
+    InternalModuleRegistryCreateInternalModuleById = 36,
+    ModuleResolverResolve = 48,
+    StandaloneModuleGraphSerialize = 55,
+    SymbolsFollowAll = 56,
 }
 
 impl From<PerfEvent> for &'static str {
@@ -25,6 +26,9 @@ impl From<PerfEvent> for &'static str {
             PerfEvent::FolderResolverReadPackageJSONFromDiskWorkspace => {
                 "FolderResolver.readPackageJSONFromDisk.workspace"
             }
+            PerfEvent::InternalModuleRegistryCreateInternalModuleById => {
+                "InternalModuleRegistry.createInternalModuleById"
+            }
             PerfEvent::ModuleResolverResolve => "ModuleResolver.resolve",
             PerfEvent::StandaloneModuleGraphSerialize => "StandaloneModuleGraph.serialize",
             PerfEvent::SymbolsFollowAll => "Symbols.followAll",
@@ -44,6 +48,9 @@ impl PerfEvent {
             PerfEvent::FolderResolverReadPackageJSONFromDiskWorkspace => {
                 c"FolderResolver.readPackageJSONFromDisk.workspace"
             }
+            PerfEvent::InternalModuleRegistryCreateInternalModuleById => {
+                c"InternalModuleRegistry.createInternalModuleById"
+            }
             PerfEvent::ModuleResolverResolve => c"ModuleResolver.resolve",
             PerfEvent::StandaloneModuleGraphSerialize => c"StandaloneModuleGraph.serialize",
             PerfEvent::SymbolsFollowAll => c"Symbols.followAll",
@@ -124,6 +124,60 @@ pub fn trace(event: PerfEvent) -> Ctx {
     }
 }
 
+// ── C++ entry points ──────────────────────────────────────────────────────
+// The internal module registry materializes builtins lazily in C++
+// (`InternalModuleRegistry::createInternalModuleById`), so its per-builtin
+// startup spans are bracketed from there. Each span is recorded under the
+// umbrella `InternalModuleRegistry.createInternalModuleById` event (signpost
+// interval on macOS); on Linux the ftrace backend accepts free-form names, so
+// a second line carrying the builtin's own specifier is emitted alongside it.
+
+/// Begin a builtin-materialization span. Returns an opaque handle for
+/// [`Bun__PerfTrace__internalModuleEnd`], or null when tracing is disabled —
+/// the common path pays two calls and a null check.
+#[unsafe(no_mangle)]
+pub extern "C" fn Bun__PerfTrace__internalModuleStart() -> *mut Ctx {
+    if !is_enabled() {
+        return core::ptr::null_mut();
+    }
+    bun_core::heap::into_raw(Box::new(trace(
+        PerfEvent::InternalModuleRegistryCreateInternalModuleById,
+    )))
+}
+
+/// End a builtin-materialization span. `name` is the builtin's specifier.
+///
+/// # Safety
+/// `ctx` is null or a handle returned by the matching start call, passed
+/// exactly once; `name` is null or a valid NUL-terminated string.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn Bun__PerfTrace__internalModuleEnd(
+    ctx: *mut Ctx,
+    name: *const core::ffi::c_char,
+) {
+    if ctx.is_null() {
+        return;
+    }
+    // SAFETY: per the contract, `ctx` came from the matching start call and
+    // is not reused; dropping it emits the umbrella interval.
+    let ctx = unsafe { bun_core::heap::take(ctx) };
+    #[cfg(any(target_os = "linux", target_os = "android"))]
+    if let Ctx::Enabled(linux) = &*ctx {
+        if !name.is_null() && Linux::is_supported() {
+            let duration = bun_core::Timespec::now(bun_core::TimespecMockMode::ForceRealTime)
+                .ns()
+                .saturating_sub(linux.start_time);
+            // SAFETY: `name` is NUL-terminated per the contract.
+            let _ = unsafe {
+                Bun__linux_trace_emit(name, i64::try_from(duration).unwrap_or(i64::MAX))
+            };
+        }
+    }
+    #[cfg(not(any(target_os = "linux", target_os = "android")))]
+    let _ = name;
+    drop(ctx);
+}
+
 #[cfg(target_os = "macos")]
 pub use darwin_impl::Darwin;
 
@@ -1,5 +1,5 @@
 use bun_hash::XxHash64Streaming as XxHash64;
-use bun_http_types::ETag::wtf;
+use bun_http_types::ETag::{self, wtf};
 use bun_sys::{S, Stat, Timespec};
 
 #[derive(Default)]
@@ -9,7 +9,10 @@ pub struct StatHash {
     pub last_modified_u64: u64,
     pub last_modified_buffer: [u8; 32],
     pub last_modified_buffer_len: u8,
-    // TODO: add etag support here!
+    /// `value` formatted as a quoted strong entity tag (`ETag::format`).
+    /// Regular files only; `etag_buffer_len == 0` otherwise.
+    pub etag_buffer: [u8; 18],
+    pub etag_buffer_len: u8,
 }
 
 // `libc::stat` has no mtime method, so project the platform-specific fields
@@ -64,10 +67,26 @@ impl StatHash {
                 self.last_modified_buffer_len = 0;
                 self.last_modified_u64 = 0;
             }
+
+            // `value` already covers size + mtime + inode (+ path), which is
+            // exactly the change-detection a strong validator needs.
+            let mut etag_buf: ETag::FormatBuffer = [0; 40];
+            let etag = ETag::format(self.value, &mut etag_buf);
+            self.etag_buffer[..etag.len()].copy_from_slice(etag);
+            self.etag_buffer_len = u8::try_from(etag.len()).unwrap();
         } else if !S::ISREG(stat.st_mode as u32) {
             self.last_modified_buffer_len = 0;
             self.last_modified_u64 = 0;
+            self.etag_buffer_len = 0;
+        }
+    }
+
+    pub fn etag(&self) -> Option<&[u8]> {
+        if self.etag_buffer_len == 0 {
+            return None;
         }
+
+        Some(&self.etag_buffer[0..usize::from(self.etag_buffer_len)])
     }
 
     pub fn last_modified(&self) -> Option<&[u8]> {
@@ -21,6 +21,7 @@ pub mod error;
 mod fs_full;
 pub mod node_fallbacks;
 pub mod package_json;
+pub mod resolution_cache;
 pub mod tsconfig_json;
 
 pub use error::Error;
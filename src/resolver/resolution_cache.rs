@@ -0,0 +1,237 @@
+//! On-disk `require()` resolution cache (opt-in via `BUN_RESOLUTION_CACHE=1`).
+//!
+//! Resolving a bare specifier walks every parent `node_modules` directory and
+//! parses `package.json` exports along the way. The directory layout under
+//! `node_modules` only changes when the package manager runs, so the walk's
+//! answer is stable between installs — in large monorepos it dominates cold
+//! `require()` time. This cache persists `hash(source dir, specifier) →
+//! resolved absolute path` to `node_modules/.cache/bun/resolve.cache` under the
+//! project's top-level directory. The file is read once into memory on first
+//! use; later processes look up the recorded path and resolve it directly
+//! (absolute-path resolution — no walk), falling back to the full walk when
+//! the entry is stale.
+//!
+//! Invalidation is deliberately coarse: the header stores the mtime + size of
+//! the top-level `package.json` and lockfile, and any mismatch discards the
+//! whole file. Within one install generation a hit is additionally verified by
+//! actually resolving the recorded path, so a deleted target degrades to a
+//! normal walk rather than a wrong answer. What this cannot catch is a
+//! *shadowing* change made without touching `package.json` or the lockfile
+//! (e.g. hand-copying a package into a closer `node_modules`) — which is why
+//! the cache is opt-in.
+//!
+//! The file is an append-only record log after the fixed header. Records are
+//! written with a single `write` on an `O_APPEND` fd, so concurrent bun
+//! processes sharing the cache interleave only on record boundaries; a torn
+//! tail from a crashed writer is dropped at load time.
+
+use std::sync::LazyLock;
+
+use bun_collections::HashMap;
+use bun_core::ZStr;
+use bun_paths::path_buffer_pool;
+use bun_paths::resolve_path::{self, platform};
+use bun_sys::{File, O, PosixStat};
+use bun_threading::Guarded;
+
+use crate::fs::FileSystem;
+
+bun_core::define_scoped_log!(debuglog, ResolutionCache, hidden);
+
+/// Bump on any change to the header or record layout.
+const VERSION: u32 = 1;
+const MAGIC: u32 = u32::from_le_bytes(*b"BRsC");
+/// Seed for the `(source dir, specifier)` key hash.
+const SEED: u64 = 53;
+/// Project files whose mtime/size invalidate the whole cache.
+const VALIDATOR_FILES: [&[u8]; 3] = [b"package.json", b"bun.lock", b"bun.lockb"];
+/// magic + version, then an (mtime, size) pair per validator file.
+const HEADER_SIZE: usize = 8 + VALIDATOR_FILES.len() * 16;
+/// key + path length; the path bytes follow.
+const RECORD_HEADER_SIZE: usize = 8 + 4;
+
+/// `true` when the user opted in. Callers gate on this before touching the
+/// singleton so disabled runs never stat the project or open the cache file.
+#[inline]
+pub fn enabled() -> bool {
+    bun_core::env_var::BUN_RESOLUTION_CACHE::get()
+}
+
+pub struct ResolutionCache {
+    /// `hash(source dir, specifier)` → resolved absolute path. Append-only —
+    /// entries are never removed, which is what lets [`lookup`] hand out
+    /// `'static` slices (see the SAFETY note there).
+    map: HashMap<u64, Box<[u8]>>,
+    /// Cache file opened `O_APPEND`. `None` when it could not be opened or a
+    /// write failed (read-only filesystem, disk full) — the in-memory map
+    /// still serves this process.
+    file: Option<File>,
+}
+
+static INSTANCE: LazyLock<Guarded<ResolutionCache>> =
+    LazyLock::new(|| Guarded::init(ResolutionCache::load()));
+
+/// Chained (not concatenated) so no joint buffer is needed; the intermediate
+/// hash keeps the (dir, specifier) boundary unambiguous.
+fn key(source_dir: &[u8], specifier: &[u8]) -> u64 {
+    bun_wyhash::hash_with_seed(bun_wyhash::hash_with_seed(SEED, source_dir), specifier)
+}
+
+/// `(mtime ns, size)` of `top_level_dir/name`; zeros when missing, so a file
+/// appearing or disappearing also changes the header.
+fn validator(top_level_dir: &[u8], name: &[u8]) -> [u64; 2] {
+    let mut buf = path_buffer_pool::get();
+    let len =
+        resolve_path::join_string_buf::<platform::Auto>(&mut buf.0[..], &[top_level_dir, name])
+            .len();
+    if len == 0 || len + 1 >= buf.0.len() {
+        return [0, 0];
+    }
+    buf.0[len] = 0;
+    // SAFETY: NUL-terminated above.
+    let z = ZStr::from_buf(&buf.0[..], len);
+    match bun_sys::stat(z) {
+        Ok(st) => {
+            let st = PosixStat::init(&st);
+            let mtime = st.mtime();
+            [
+                (mtime.sec as u64)
+                    .wrapping_mul(1_000_000_000)
+                    .wrapping_add(mtime.nsec as u64),
+                st.size,
+            ]
+        }
+        Err(_) => [0, 0],
+    }
+}
+
+fn header(top_level_dir: &[u8]) -> [u8; HEADER_SIZE] {
+    let mut out = [0u8; HEADER_SIZE];
+    out[0..4].copy_from_slice(&MAGIC.to_le_bytes());
+    out[4..8].copy_from_slice(&VERSION.to_le_bytes());
+    let mut off = 8;
+    for name in VALIDATOR_FILES {
+        for word in validator(top_level_dir, name) {
+            out[off..off + 8].copy_from_slice(&word.to_le_bytes());
+            off += 8;
+        }
+    }
+    out
+}
+
+impl ResolutionCache {
+    fn load() -> Self {
+        let top_level_dir = FileSystem::get().top_level_dir;
+        let mut path_buf = path_buffer_pool::get();
+        let path = resolve_path::join_string_buf::<platform::Auto>(
+            &mut path_buf.0[..],
+            &[
+                top_level_dir,
+                b"node_modules",
+                b".cache",
+                b"bun",
+                b"resolve.cache",
+            ],
+        );
+
+        let empty = || Self {
+            map: HashMap::new(),
+            file: None,
+        };
+        let file = match File::make_open(path, O::RDWR | O::CREAT | O::APPEND | O::CLOEXEC, 0o644) {
+            Ok(file) => file,
+            Err(err) => {
+                debuglog!("failed to open {}: {}", bstr::BStr::new(path), err);
+                return empty();
+            }
+        };
+
+        let expected = header(top_level_dir);
+        let mut contents = Vec::new();
+        if file.read_to_end_into(&mut contents).is_err() {
+            return empty();
+        }
+
+        let mut map = HashMap::new();
+        if contents.len() < HEADER_SIZE || contents[..HEADER_SIZE] != expected {
+            // Brand new, from a different format version, or the project's
+            // package.json/lockfile changed: drop everything and reseed the
+            // header. `O_APPEND` writes always land at the new end.
+            debuglog!("reset ({} stale bytes)", contents.len());
+            if bun_sys::ftruncate(file.fd(), 0).is_err() || file.write_all(&expected).is_err() {
+                return empty();
+            }
+            return Self {
+                map,
+                file: Some(file),
+            };
+        }
+
+        let mut rest = &contents[HEADER_SIZE..];
+        while rest.len() >= RECORD_HEADER_SIZE {
+            let key = u64::from_le_bytes(rest[0..8].try_into().unwrap());
+            let len = u32::from_le_bytes(rest[8..12].try_into().unwrap()) as usize;
+            rest = &rest[RECORD_HEADER_SIZE..];
+            if rest.len() < len {
+                // Torn tail from a crashed writer.
+                break;
+            }
+            bun_core::handle_oom(map.put(key, Box::from(&rest[..len])));
+            rest = &rest[len..];
+        }
+        debuglog!("loaded {} entries", map.len());
+        Self {
+            map,
+            file: Some(file),
+        }
+    }
+
+    /// The previously recorded absolute path for `(source_dir, specifier)`,
+    /// or `None` on a miss. The caller re-resolves the returned path, so a
+    /// stale entry costs one failed probe, never a wrong answer.
+    pub fn lookup(source_dir: &[u8], specifier: &[u8]) -> Option<&'static [u8]> {
+        let guard = INSTANCE.lock();
+        let path = guard.map.get(&key(source_dir, specifier))?;
+        // SAFETY: `INSTANCE` is process-lifetime (`LazyLock`) and entries are
+        // never removed, so the boxed bytes outlive every caller; the heap
+        // address is stable across map rehashes.
+        Some(unsafe { bun_ptr::detach_lifetime(path.as_ref()) })
+    }
+
+    /// Records a successful walk, if it landed on a plain absolute file path
+    /// (external/standalone/virtual-namespace results are not re-resolvable
+    /// from a recorded path).
+    pub fn record(source_dir: &[u8], specifier: &[u8], result: &crate::Result) {
+        if result.flags.is_external() || result.flags.is_standalone_module() {
+            return;
+        }
+        let Some(path) = result.path_const() else {
+            return;
+        };
+        let resolved = path.text();
+        if !path.is_file()
+            || !bun_paths::is_absolute(resolved)
+            || resolved.len() > u32::MAX as usize
+        {
+            return;
+        }
+
+        let key = key(source_dir, specifier);
+        let mut guard = INSTANCE.lock();
+        if guard.map.contains_key(&key) {
+            return;
+        }
+        if let Some(file) = guard.file.as_ref() {
+            // One buffered write per record so concurrent writers interleave
+            // only on record boundaries.
+            let mut record = Vec::with_capacity(RECORD_HEADER_SIZE + resolved.len());
+            record.extend_from_slice(&key.to_le_bytes());
+            record.extend_from_slice(&(resolved.len() as u32).to_le_bytes());
+            record.extend_from_slice(resolved);
+            if file.write_all(&record).is_err() {
+                guard.file = None;
+            }
+        }
+        bun_core::handle_oom(guard.map.put(key, Box::from(resolved)));
+    }
+}
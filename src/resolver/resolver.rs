@@ -1394,8 +1394,57 @@ impl<'a> Resolver<'a> {
             return ResultUnion::NotFound;
         }
 
-        let mut tmp =
-            self.resolve_without_symlinks(source_dir_normalized, import_path, kind, global_cache);
+        // Opt-in on-disk resolution cache (see resolution_cache.rs): bare
+        // `require()` specifiers record their resolved absolute path so a
+        // later process can resolve that path directly instead of walking
+        // node_modules. A recorded path that no longer resolves falls back to
+        // the walk (and re-records).
+        let use_resolution_cache = crate::resolution_cache::enabled()
+            && matches!(
+                kind,
+                ast::ImportKind::Require | ast::ImportKind::RequireResolve
+            )
+            && is_package_path(import_path)
+            && bun_paths::is_absolute(source_dir_normalized);
+
+        let mut tmp = 'resolved: {
+            if use_resolution_cache {
+                if let Some(cached_path) = crate::resolution_cache::ResolutionCache::lookup(
+                    source_dir_normalized,
+                    import_path,
+                ) {
+                    let hit = self.resolve_without_symlinks(
+                        source_dir_normalized,
+                        cached_path,
+                        kind,
+                        global_cache,
+                    );
+                    if matches!(hit, ResultUnion::Success(_)) {
+                        if let Some(debug) = self.debug_logs.as_mut() {
+                            debug.add_note(b"Resolved from the on-disk resolution cache".to_vec());
+                        }
+                        break 'resolved hit;
+                    }
+                }
+            }
+
+            let result = self.resolve_without_symlinks(
+                source_dir_normalized,
+                import_path,
+                kind,
+                global_cache,
+            );
+            if use_resolution_cache {
+                if let ResultUnion::Success(result) = &result {
+                    crate::resolution_cache::ResolutionCache::record(
+                        source_dir_normalized,
+                        import_path,
+                        result,
+                    );
+                }
+            }
+            result
+        };
 
         // Fragments in URLs in CSS imports are technically expected to work
         if matches!(tmp, ResultUnion::NotFound) && kind.is_from_css() {
@@ -75,6 +75,8 @@ pub mod markdown_object;
 pub mod native_promise_context;
 #[path = "api/output_file_jsc.rs"]
 pub mod output_file_jsc;
+#[path = "api/scheduler.rs"]
+pub mod scheduler;
 #[path = "api/standalone_graph_jsc.rs"]
 pub mod standalone_graph_jsc;
 #[path = "api/TOMLObject.rs"]
@@ -336,6 +336,7 @@ pub mod bun_object {
         BunObject_lazyPropCb_SHA512_256 => Crypto::SHA512_256::getter,
         BunObject_lazyPropCb_JSONC => super::get_jsonc_object,
         BunObject_lazyPropCb_markdown => super::get_markdown_object,
+        BunObject_lazyPropCb_memory => super::get_memory_object,
         BunObject_lazyPropCb_TOML => super::get_toml_object,
         BunObject_lazyPropCb_JSON5 => super::get_json5_object,
         BunObject_lazyPropCb_YAML => super::get_yaml_object,
@@ -349,6 +350,7 @@ pub mod bun_object {
         BunObject_lazyPropCb_hash => super::get_hash_object,
         BunObject_lazyPropCb_inspect => super::get_inspect,
         BunObject_lazyPropCb_origin => super::get_origin,
+        BunObject_lazyPropCb_scheduler => super::get_scheduler_object,
         BunObject_lazyPropCb_semver => super::get_semver,
         BunObject_lazyPropCb_unsafe => super::get_unsafe,
         BunObject_lazyPropCb_S3Client => super::get_s3_client_constructor,
@@ -390,6 +392,10 @@ pub(crate) fn get_cron_object(global_this: &JSGlobalObject, obj: &JSObject) -> J
     crate::api::cron::get_cron_object(global_this, obj)
 }
 
+pub(crate) fn get_scheduler_object(global_this: &JSGlobalObject, obj: &JSObject) -> JSValue {
+    crate::api::scheduler::get_scheduler_object(global_this, obj)
+}
+
 #[bun_jsc::host_fn]
 pub(crate) fn shell_escape(
     global_this: &JSGlobalObject,
@@ -695,17 +701,61 @@ pub(crate) fn inspect(global_this: &JSGlobalObject, callframe: &CallFrame) -> Js
         format_options.from_js(global_this, &arguments[1..])?;
     }
 
+    // `maxBytes` is inspect-only (a hard cap on output size so dumping a huge
+    // object can't OOM), so it is parsed here instead of in `FormatOptions`.
+    let mut max_bytes: Option<usize> = None;
+    if arguments.len() > 1 && arguments[1].is_object() {
+        if let Some(opt) = arguments[1].get_truthy(global_this, "maxBytes")? {
+            if opt.is_int32() {
+                let arg = opt.to_int32();
+                if arg < 0 {
+                    return Err(global_this.throw_invalid_arguments(format_args!(
+                        "expected maxBytes to be greater than or equal to 0, got {arg}"
+                    )));
+                }
+                max_bytes = Some(arg as usize);
+            } else if opt.is_number() {
+                let v = opt.coerce_f64(global_this)?;
+                if !v.is_infinite() {
+                    return Err(global_this.throw_invalid_arguments(format_args!(
+                        "expected maxBytes to be an integer, got {v}"
+                    )));
+                }
+            }
+        }
+    }
+
     // very stable memory address
     let mut array: Vec<u8> = Vec::new();
     // we buffer this because it'll almost always be < 4096
     // when it's under 4096, we want to avoid the dynamic allocation
-    ConsoleObject::format2(
-        ConsoleObject::MessageLevel::Debug,
-        global_this,
-        &arguments[..1],
-        &mut array,
-        format_options,
-    )?;
+    if let Some(budget) = max_bytes {
+        let mut writer = bun_io::CappedWriter::new(&mut array, budget);
+        ConsoleObject::format2(
+            ConsoleObject::MessageLevel::Debug,
+            global_this,
+            &arguments[..1],
+            &mut writer,
+            format_options,
+        )?;
+        if writer.truncated && !array.is_empty() {
+            // The budget may have cut a multi-byte UTF-8 sequence; drop the
+            // partial tail so the result stays valid.
+            let tail_start = array.iter().rposition(|&b| b & 0xC0 != 0x80).unwrap_or(0);
+            let expected = bun_core::utf8_byte_sequence_length(array[tail_start]) as usize;
+            if expected != array.len() - tail_start {
+                array.truncate(tail_start);
+            }
+        }
+    } else {
+        ConsoleObject::format2(
+            ConsoleObject::MessageLevel::Debug,
+            global_this,
+            &arguments[..1],
+            &mut array,
+            format_options,
+        )?;
+    }
     if global_this.has_exception() {
         return Err(jsc::JsError::Thrown);
     }
@@ -2116,6 +2166,71 @@ impl CSRFObject {
     }
 }
 
+pub(crate) fn get_memory_object(global_object: &JSGlobalObject, _: &JSObject) -> JSValue {
+    MemoryObject::create(global_object)
+}
+
+pub(crate) struct MemoryObject;
+
+impl MemoryObject {
+    pub(crate) fn create(global_this: &JSGlobalObject) -> JSValue {
+        let object = JSValue::create_empty_object(global_this, 1);
+
+        bun_jsc::jsc_host_abi! {
+            unsafe fn memory_array_buffers_shim(
+                g: *mut JSGlobalObject,
+                _f: *mut CallFrame,
+            ) -> JSValue {
+                // SAFETY: JSC always passes valid pointers here.
+                let g = unsafe { &*g };
+                bun_jsc::to_js_host_call(g, || memory_array_buffers(g))
+            }
+        }
+
+        object.put(
+            global_this,
+            b"arrayBuffers",
+            JSFunction::create(
+                global_this,
+                "arrayBuffers",
+                memory_array_buffers_shim,
+                0,
+                Default::default(),
+            ),
+        );
+
+        object
+    }
+}
+
+/// `Bun.memory.arrayBuffers()` — live Rust-allocated ArrayBuffer backing
+/// stores aggregated per sampled allocation site (see
+/// `bun_jsc::array_buffer_accounting`). Rows are
+/// `{ site: string | null, count, bytes }`, largest first; `site: null`
+/// aggregates the allocations that were not sampled.
+fn memory_array_buffers(global: &JSGlobalObject) -> JsResult<JSValue> {
+    let totals = bun_jsc::array_buffer_accounting::site_totals();
+    JSValue::create_array_from_iter(global, totals.into_iter(), |total| {
+        let object = JSValue::create_empty_object(global, 3);
+        let site = match &total.site {
+            Some(site) => BunString::clone_utf8(site.as_bytes()).transfer_to_js(global)?,
+            None => JSValue::NULL,
+        };
+        object.put(global, b"site", site);
+        object.put(
+            global,
+            b"count",
+            JSValue::js_number_from_uint64(total.count as u64),
+        );
+        object.put(
+            global,
+            b"bytes",
+            JSValue::js_number_from_uint64(total.bytes as u64),
+        );
+        Ok(object)
+    })
+}
+
 // This is aliased to Bun.env
 pub mod environment_variables {
     use super::*;
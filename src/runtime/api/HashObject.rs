@@ -68,6 +68,15 @@ impl HashAlgorithm for Crc32 {
     }
 }
 
+/// CRC-32C (Castagnoli) — not the same polynomial as `crc32` above.
+pub(crate) struct Crc32c;
+impl HashAlgorithm for Crc32c {
+    type Output = u32;
+    fn hash(seed: u64, input: &[u8]) -> u32 {
+        bun_hash::Crc32c::hash_with_seed(input, seed as u32)
+    }
+}
+
 pub(crate) struct CityHash32;
 impl HashAlgorithm for CityHash32 {
     type Output = u32;
@@ -176,6 +185,11 @@ pub(crate) fn crc32(global: &JSGlobalObject, frame: &CallFrame) -> JsResult<JSVa
     hash_wrap::<Crc32>(global, frame)
 }
 
+#[bun_jsc::host_fn]
+pub(crate) fn crc32c(global: &JSGlobalObject, frame: &CallFrame) -> JsResult<JSValue> {
+    hash_wrap::<Crc32c>(global, frame)
+}
+
 #[bun_jsc::host_fn]
 pub(crate) fn city_hash32(global: &JSGlobalObject, frame: &CallFrame) -> JsResult<JSValue> {
     hash_wrap::<CityHash32>(global, frame)
@@ -231,6 +245,7 @@ pub(crate) fn create(global: &JSGlobalObject) -> JSValue {
             ("wyhash", __jsc_host_wyhash, 1),
             ("adler32", __jsc_host_adler32, 1),
             ("crc32", __jsc_host_crc32, 1),
+            ("crc32c", __jsc_host_crc32c, 1),
             ("cityHash32", __jsc_host_city_hash32, 1),
             ("cityHash64", __jsc_host_city_hash64, 1),
             ("xxHash32", __jsc_host_xx_hash32, 1),
@@ -121,6 +121,14 @@ unsafe extern "C" {
     safe static BUN_DEFAULT_PATH_FOR_SPAWN: *const c_char;
 }
 
+/// Spawn-latency counters for `Bun.spawn` / `Bun.spawnSync`, read by
+/// `subprocess::js_spawn_stats`. They time only the `spawn_process` call
+/// (posix_spawn / uv_spawn plus pipe setup), not JS argument marshalling.
+pub(crate) static SPAWN_COUNT: core::sync::atomic::AtomicU64 =
+    core::sync::atomic::AtomicU64::new(0);
+pub(crate) static SPAWN_TOTAL_NANOS: core::sync::atomic::AtomicU64 =
+    core::sync::atomic::AtomicU64::new(0);
+
 struct Argv0Result {
     /// Was arena-owned `[:0]const u8`; caller stashes in its `Vec<ZBox>` backing
     /// store so the pointer outlives `spawn_process`.
@@ -178,9 +186,12 @@ fn get_argv0(
     let actual_argv0: ZBox = if path_to_use.is_empty() {
         ZBox::from_bytes(argv0_to_use)
     } else {
-        let Some(resolved) =
-            bun_which::which_for_spawn(&mut path_buf, path_to_use, cwd, argv0_to_use)
-        else {
+        let Some(resolved) = bun_which::spawn_cache::which_for_spawn_cached(
+            &mut path_buf,
+            path_to_use,
+            cwd,
+            argv0_to_use,
+        ) else {
             return Err(throw_command_not_found(global_this, argv0_to_use));
         };
         ZBox::from_bytes(resolved.as_bytes())
@@ -1178,11 +1189,20 @@ pub(crate) fn spawn_maybe_sync<const IS_SYNC: bool>(
         ..Default::default()
     };
 
+    let spawn_started = std::time::Instant::now();
     // SAFETY: `argv`/`env_array` are local null-terminated C-string arrays
     // with argv[0] non-null; valid for this call.
-    let mut spawned = match unsafe {
-        spawn::spawn_process(&spawn_options, argv.as_ptr(), env_array.as_ptr())
-    } {
+    let spawn_result =
+        unsafe { spawn::spawn_process(&spawn_options, argv.as_ptr(), env_array.as_ptr()) };
+    {
+        use core::sync::atomic::Ordering;
+        SPAWN_COUNT.fetch_add(1, Ordering::Relaxed);
+        SPAWN_TOTAL_NANOS.fetch_add(
+            u64::try_from(spawn_started.elapsed().as_nanos()).unwrap_or(u64::MAX),
+            Ordering::Relaxed,
+        );
+    }
+    let mut spawned = match spawn_result {
         Err(err)
             if err == bun_spawn::Error::Sys(bun_errno::SystemErrno::EMFILE)
                 || err == bun_spawn::Error::Sys(bun_errno::SystemErrno::ENFILE) =>
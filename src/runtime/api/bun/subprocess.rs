@@ -1553,6 +1553,37 @@ pub extern "C" fn on_pipe_close(this: *mut bun_sys::windows::libuv::Pipe) {
     drop(unsafe { bun_core::heap::take(this) });
 }
 
+/// Exposed via `bun:internal-for-testing` so spawn-latency tests (and ad hoc
+/// diagnosis of spawn-heavy workloads) can read the process-wide spawn
+/// counters: how many processes were spawned, the time spent inside
+/// `spawn_process`, and the `$PATH`-resolution cache hit rate.
+#[bun_jsc::host_fn]
+pub(crate) fn js_spawn_stats(global: &JSGlobalObject, _callframe: &CallFrame) -> JsResult<JSValue> {
+    use core::sync::atomic::Ordering;
+    let obj = JSValue::create_empty_object(global, 4);
+    obj.put(
+        global,
+        b"spawns",
+        JSValue::js_number(js_bun_spawn_bindings::SPAWN_COUNT.load(Ordering::Relaxed) as f64),
+    );
+    obj.put(
+        global,
+        b"totalSpawnNanos",
+        JSValue::js_number(js_bun_spawn_bindings::SPAWN_TOTAL_NANOS.load(Ordering::Relaxed) as f64),
+    );
+    obj.put(
+        global,
+        b"pathCacheHits",
+        JSValue::js_number(bun_which::spawn_cache::HITS.load(Ordering::Relaxed) as f64),
+    );
+    obj.put(
+        global,
+        b"pathCacheMisses",
+        JSValue::js_number(bun_which::spawn_cache::MISSES.load(Ordering::Relaxed) as f64),
+    );
+    Ok(obj)
+}
+
 pub mod testing_apis {
     use super::*;
 
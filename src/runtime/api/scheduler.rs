@@ -0,0 +1,213 @@
+//! Bun.scheduler - priority-tiered task queues (W3C Scheduler-shaped).
+//!
+//! Bun.scheduler.postTask(fn, { priority }) - queue a callback; returns a
+//!     Promise that settles with the callback's return value (or rejection).
+//! Bun.scheduler.queueDepths()              - current queue depth per tier.
+//!
+//! Three tiers, highest first: `"user-blocking"`, `"user-visible"` (the
+//! default), `"background"`. Each posted task runs as its own event-loop
+//! task (one per tick), so I/O, timers, and microtasks interleave between
+//! tasks instead of a drain loop monopolizing the thread.
+//!
+//! Starvation protection is aging-based: every time a lower tier is passed
+//! over while non-empty its age counter ticks up, and once the counter
+//! reaches that tier's limit the next pick comes from it regardless of
+//! higher-priority backlog.
+
+use core::cell::RefCell;
+use std::collections::VecDeque;
+
+use bun_jsc::{
+    CallFrame, JSFunction, JSGlobalObject, JSObject, JSPromiseStrong, JSValue, JsResult, Strong,
+};
+
+const TIER_COUNT: usize = 3;
+
+/// Picks from a passed-over non-empty tier once its age counter reaches this.
+/// Index 0 (user-blocking) is the top tier; its limit is never consulted.
+const AGING_LIMIT: [u32; TIER_COUNT] = [0, 8, 32];
+
+const TIER_NAMES: [&[u8]; TIER_COUNT] = [b"user-blocking", b"user-visible", b"background"];
+
+struct PostedTask {
+    callback: Strong,
+    promise: JSPromiseStrong,
+}
+
+#[derive(Default)]
+struct SchedulerState {
+    queues: [VecDeque<PostedTask>; TIER_COUNT],
+    /// Times each tier was passed over while non-empty since it last ran.
+    age: [u32; TIER_COUNT],
+    /// A drain task is already sitting in the event-loop queue.
+    drain_scheduled: bool,
+}
+
+impl SchedulerState {
+    fn is_empty(&self) -> bool {
+        self.queues.iter().all(VecDeque::is_empty)
+    }
+
+    /// Tier to run next: the oldest starving tier if one aged out, otherwise
+    /// the highest-priority non-empty tier. Updates the age counters.
+    fn pick_tier(&mut self) -> Option<usize> {
+        let mut pick = (0..TIER_COUNT).find(|&tier| !self.queues[tier].is_empty())?;
+        // Starvation override: the highest lower tier that aged out runs
+        // instead of the priority pick.
+        for tier in pick + 1..TIER_COUNT {
+            if !self.queues[tier].is_empty() && self.age[tier] >= AGING_LIMIT[tier] {
+                pick = tier;
+                break;
+            }
+        }
+        for tier in 0..TIER_COUNT {
+            if tier == pick {
+                self.age[tier] = 0;
+            } else if !self.queues[tier].is_empty() {
+                self.age[tier] += 1;
+            }
+        }
+        Some(pick)
+    }
+}
+
+// One scheduler per JS thread; workers get their own (same per-thread model
+// as the VirtualMachine singleton itself).
+thread_local! {
+    static SCHEDULER: RefCell<SchedulerState> = RefCell::new(SchedulerState::default());
+}
+
+fn parse_priority(global: &JSGlobalObject, options: JSValue) -> JsResult<usize> {
+    if options.is_empty_or_undefined_or_null() {
+        return Ok(1);
+    }
+    if !options.is_object() {
+        return Err(
+            global.throw_invalid_arguments(format_args!("postTask options must be an object"))
+        );
+    }
+    let Some(priority) = options.get(global, b"priority")? else {
+        return Ok(1);
+    };
+    let slice = priority.to_slice_or_null(global)?;
+    TIER_NAMES
+        .iter()
+        .position(|&name| name == slice.slice())
+        .ok_or_else(|| {
+            global.throw_invalid_arguments(format_args!(
+                "priority must be \"user-blocking\", \"user-visible\", or \"background\""
+            ))
+        })
+}
+
+fn schedule_drain(global: &JSGlobalObject, state: &mut SchedulerState) {
+    if state.drain_scheduled {
+        return;
+    }
+    state.drain_scheduled = true;
+    // SAFETY: bun_vm() is live for the duration of a host call.
+    let vm = global.bun_vm().as_mut();
+    vm.enqueue_task(bun_event_loop::ManagedTask::ManagedTask::new(
+        core::ptr::from_ref(global).cast_mut(),
+        drain_one,
+    ));
+}
+
+/// Runs exactly one posted task, then re-enqueues itself while work remains.
+fn drain_one(global: *mut JSGlobalObject) -> JsResult<()> {
+    // SAFETY: the global object outlives every task queued on its event loop.
+    let global = unsafe { &*global };
+
+    let task = SCHEDULER.with(|cell| {
+        let mut state = cell.borrow_mut();
+        state.drain_scheduled = false;
+        let tier = state.pick_tier()?;
+        state.queues[tier].pop_front()
+    });
+
+    // Run outside the RefCell borrow: the callback can post more tasks.
+    if let Some(mut task) = task {
+        match task.callback.get().call_with_global_this(global, &[]) {
+            Ok(value) => {
+                let _ = task.promise.resolve(global, value);
+            }
+            Err(err) => {
+                // `reject` takes the pending exception itself on the Err arm.
+                let _ = task.promise.reject(global, Err(err));
+            }
+        }
+    }
+
+    SCHEDULER.with(|cell| {
+        let mut state = cell.borrow_mut();
+        if !state.is_empty() {
+            schedule_drain(global, &mut state);
+        }
+    });
+    Ok(())
+}
+
+#[bun_jsc::host_fn]
+fn post_task(global: &JSGlobalObject, frame: &CallFrame) -> JsResult<JSValue> {
+    let [callback, options] = frame.arguments_as_array::<2>();
+    if !callback.is_callable() {
+        return Err(global.throw_invalid_arguments(format_args!("postTask expects a function")));
+    }
+    let tier = parse_priority(global, options)?;
+
+    let promise = JSPromiseStrong::init(global);
+    let promise_value = promise.value();
+    SCHEDULER.with(|cell| {
+        let mut state = cell.borrow_mut();
+        state.queues[tier].push_back(PostedTask {
+            callback: Strong::create(callback.with_async_context_if_needed(global), global),
+            promise,
+        });
+        schedule_drain(global, &mut state);
+    });
+    Ok(promise_value)
+}
+
+#[bun_jsc::host_fn]
+fn queue_depths(global: &JSGlobalObject, _frame: &CallFrame) -> JsResult<JSValue> {
+    let object = JSValue::create_empty_object(global, TIER_COUNT);
+    SCHEDULER.with(|cell| {
+        let state = cell.borrow();
+        for (tier, name) in TIER_NAMES.iter().enumerate() {
+            object.put(
+                global,
+                name,
+                JSValue::js_number_from_uint64(state.queues[tier].len() as u64),
+            );
+        }
+    });
+    Ok(object)
+}
+
+pub fn get_scheduler_object(global_this: &JSGlobalObject, _obj: &JSObject) -> JSValue {
+    let object = JSValue::create_empty_object(global_this, 2);
+    // `#[bun_jsc::host_fn]` emits the C-ABI shim as `__jsc_host_<name>`.
+    object.put(
+        global_this,
+        b"postTask",
+        JSFunction::create(
+            global_this,
+            "postTask",
+            __jsc_host_post_task,
+            2,
+            Default::default(),
+        ),
+    );
+    object.put(
+        global_this,
+        b"queueDepths",
+        JSFunction::create(
+            global_this,
+            "queueDepths",
+            __jsc_host_queue_depths,
+            0,
+            Default::default(),
+        ),
+    );
+    object
+}
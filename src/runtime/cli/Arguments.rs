@@ -974,6 +974,13 @@ pub fn parse(cmd: CommandTag, ctx: Context<'_>) -> crate::Result<api::TransformO
             }
         }
 
+        if ctx.debug.hot_reload != HotReload::None {
+            // Reload modes re-transpile the whole graph on every edit, so cache
+            // even files below the usual size floor — see CACHE_SMALL_FILES.
+            bun_jsc::runtime_transpiler_cache::CACHE_SMALL_FILES
+                .store(true, std::sync::atomic::Ordering::Relaxed);
+        }
+
         if let Some(origin) = args.option(b"--origin") {
             opts.origin = Some(origin.into());
         }
@@ -1962,14 +1969,38 @@ fn parse_build_command_options(
             if cmd == CommandTag::BuildCommand {
                 if args.flag(b"--compile") {
                     if target.len() > 4 && strings::has_prefix(target, b"bun-") {
-                        ctx.bundler_options.compile_target =
-                            cli::Cli::CompileTarget::from(&target[3..]);
-                        if !ctx.bundler_options.compile_target.is_supported() {
-                            Output::err_generic(
-                                "Unsupported compile target: {}\n",
-                                format_args!("{}", ctx.bundler_options.compile_target),
-                            );
-                            Global::exit(1);
+                        // `--target` may be a comma-separated list; the first
+                        // entry builds in this process and the rest fan out to
+                        // worker processes (see `build_command`).
+                        let mut first = true;
+                        for part in target.split(|&c| c == b',') {
+                            if part.len() <= 4 || !strings::has_prefix(part, b"bun-") {
+                                Output::err_generic(
+                                    "Unsupported compile target: {}\n",
+                                    format_args!("{}", BStr::new(part)),
+                                );
+                                Global::exit(1);
+                            }
+                            let parsed = cli::Cli::CompileTarget::from(&part[3..]);
+                            if !parsed.is_supported() {
+                                Output::err_generic(
+                                    "Unsupported compile target: {}\n",
+                                    format_args!("{parsed}"),
+                                );
+                                Global::exit(1);
+                            }
+                            if first {
+                                ctx.bundler_options.compile_target = parsed;
+                                first = false;
+                            } else if !parsed.eql(&ctx.bundler_options.compile_target)
+                                && !ctx
+                                    .bundler_options
+                                    .compile_extra_targets
+                                    .iter()
+                                    .any(|t| t.eql(&parsed))
+                            {
+                                ctx.bundler_options.compile_extra_targets.push(parsed);
+                            }
                         }
                         opts.target = Some(api::Target::Bun);
                         break 'brk;
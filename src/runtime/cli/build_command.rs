@@ -82,6 +82,10 @@ impl BuildCommand {
             ctx.bundler_options.compile = false;
         }
 
+        if ctx.bundler_options.compile && !ctx.bundler_options.compile_extra_targets.is_empty() {
+            return Self::exec_multi_target(ctx);
+        }
+
         let compile_target = &ctx.bundler_options.compile_target;
 
         if ctx.bundler_options.compile {
@@ -1137,6 +1141,110 @@ impl BuildCommand {
             ctx.debug.hot_reload == HotReload::Watch,
         );
     }
+
+    /// `--compile` with a comma-separated `--target` list: one worker process
+    /// per target, all running concurrently. A shared parsed graph is not an
+    /// option — `process.platform`/`process.arch` defines are merged into the
+    /// parse (see `exec` above), so every target's graph is different.
+    #[cold]
+    #[inline(never)]
+    fn exec_multi_target(ctx: Context) -> Result<(), crate::Error> {
+        // Per-target output names: `<base>-<os>-<arch>[-musl][-baseline]`,
+        // where `<base>` follows the same derivation as the single-target
+        // default (entry basename, extension stripped, `index` renamed to its
+        // directory).
+        let outfile_base: Vec<u8> = if !ctx.bundler_options.outfile.is_empty() {
+            ctx.bundler_options.outfile.to_vec()
+        } else {
+            // Arguments.rs rejects `bun build` without entrypoints.
+            let first_entry_point = &ctx.args.entry_points[0];
+            let mut name = bun_paths::basename(first_entry_point);
+            let ext = bun_paths::extension(name);
+            if !ext.is_empty() {
+                name = &name[..name.len() - ext.len()];
+            }
+            if name == b"index" {
+                name =
+                    bun_paths::basename(bun_core::dirname(first_entry_point).unwrap_or(b"index"));
+            }
+            name.to_vec()
+        };
+
+        let Ok(self_exe) = bun_core::self_exe_path() else {
+            bun_core::pretty_errorln!(
+                "<r><red>error<r><d>:<r> could not determine the path to the bun executable"
+            );
+            Global::exit(1);
+        };
+
+        // Re-exec argv minus the original `--target`/`--outfile`; each worker
+        // gets its own. BUN_OPTIONS-injected tokens (spliced in right after
+        // argv[0]) are dropped because the workers re-splice them from the
+        // environment themselves.
+        let injected = bun_core::bun_options_argc();
+        let mut base_argv: Vec<Vec<u8>> = vec![self_exe.as_bytes().to_vec()];
+        let mut skip_next = false;
+        for (i, arg) in bun_core::argv().enumerate() {
+            if i == 0 || i <= injected {
+                continue;
+            }
+            if skip_next {
+                skip_next = false;
+                continue;
+            }
+            if arg == b"--target" || arg == b"--outfile" {
+                skip_next = true;
+                continue;
+            }
+            if strings::has_prefix(arg, b"--target=") || strings::has_prefix(arg, b"--outfile=") {
+                continue;
+            }
+            base_argv.push(arg.to_vec());
+        }
+
+        let targets: Vec<_> = core::iter::once(ctx.bundler_options.compile_target)
+            .chain(ctx.bundler_options.compile_extra_targets.iter().copied())
+            .collect();
+        let mut children = Vec::with_capacity(targets.len());
+        for target in &targets {
+            let mut argv = base_argv.clone();
+            let mut target_arg = Vec::with_capacity(48);
+            target_arg.extend_from_slice(b"--target=");
+            let _ = write!(target_arg, "{target}");
+            argv.push(target_arg);
+            let mut outfile = Vec::with_capacity(outfile_base.len() + 32);
+            outfile.extend_from_slice(b"--outfile=");
+            outfile.extend_from_slice(&outfile_base);
+            let _ = write!(
+                outfile,
+                "-{}-{}{}",
+                target.os.npm_name(),
+                target.arch.npm_name(),
+                target.libc,
+            );
+            if target.baseline {
+                outfile.extend_from_slice(b"-baseline");
+            }
+            argv.push(outfile);
+            children.push((*target, bun_core::util::spawn_inherit_no_stdin(&argv)));
+        }
+
+        let mut failed = false;
+        for (target, spawned) in children {
+            let ok = match spawned {
+                Ok(handle) => matches!(handle.wait(), Ok(status) if status.is_ok()),
+                Err(_) => false,
+            };
+            if !ok {
+                failed = true;
+                bun_core::pretty_errorln!(
+                    "<r><red>error<r><d>:<r> failed to build target {}",
+                    target
+                );
+            }
+        }
+        Global::exit(u32::from(failed));
+    }
 }
 
 fn exit_or_watch(code: u8, watch: bool) -> ! {
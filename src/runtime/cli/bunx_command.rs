@@ -282,6 +282,73 @@ impl BunxCommand {
             && strings::index_of_char(name, b'\\').is_none()
     }
 
+    /// Per-cache-entry file holding the resolved `bin` name, so repeat
+    /// invocations skip re-reading and re-parsing the installed package.json.
+    /// Lives next to the cache entry's package.json, so the staleness check
+    /// and `delete_tree` cover it too.
+    const BIN_NAME_CACHE_FILE: &'static [u8] = b".bunx-bin";
+
+    /// Read the cached `bin` name for a bunx cache entry. Best-effort: a
+    /// missing or malformed file just means the package.json gets parsed
+    /// again. The contents are as untrusted as a package.json in the shared
+    /// temp dir, so the same plain-file-name rule applies.
+    fn read_cached_bin_name(tempdir_name: &[u8]) -> Option<Box<[u8]>> {
+        let mut subpath = PathBuffer::uninit();
+        let len = {
+            let total = subpath.len();
+            let mut cursor: &mut [u8] = &mut subpath[..];
+            write!(
+                cursor,
+                "{}{}{}",
+                BStr::new(tempdir_name),
+                bun_paths::SEP as char,
+                BStr::new(Self::BIN_NAME_CACHE_FILE),
+            )
+            .ok()?;
+            total - cursor.len()
+        };
+        subpath[len] = 0;
+        // SAFETY: subpath[len] == 0 written above
+        let subpath_z = ZStr::from_buf(&subpath[..], len);
+        let fd = bun_sys::openat(Fd::cwd(), subpath_z, O::RDONLY, 0).ok()?;
+        let file = bun_sys::File::from_fd(fd);
+        let bytes = file.read_to_end_small().ok()?;
+        if bytes.len() > 512 || !Self::is_safe_bin_name(&bytes) {
+            return None;
+        }
+        Some(bytes.into_boxed_slice())
+    }
+
+    /// Best-effort companion to [`Self::read_cached_bin_name`]; a failed
+    /// write just means the next invocation parses package.json again.
+    fn write_cached_bin_name(tempdir_name: &[u8], bin_name: &[u8]) {
+        if !Self::is_safe_bin_name(bin_name) {
+            return;
+        }
+        let mut subpath = PathBuffer::uninit();
+        let len = {
+            let total = subpath.len();
+            let mut cursor: &mut [u8] = &mut subpath[..];
+            if write!(
+                cursor,
+                "{}{}{}",
+                BStr::new(tempdir_name),
+                bun_paths::SEP as char,
+                BStr::new(Self::BIN_NAME_CACHE_FILE),
+            )
+            .is_err()
+            {
+                return;
+            }
+            total - cursor.len()
+        };
+        if let Ok(file) =
+            bun_sys::File::create(Fd::cwd(), &subpath[..len], /* truncate */ true)
+        {
+            let _ = file.write_all(bin_name);
+        }
+    }
+
     fn get_bin_name_from_subpath(
         transpiler: &mut Transpiler,
         dir_fd: Fd,
@@ -468,6 +535,12 @@ impl BunxCommand {
                 return Err(crate::Error::NeedToInstall);
             }
             let _ = target_package_json.close();
+
+            // The entry is fresh; a cached bin name from a prior resolution
+            // saves the package.json read + JSON parse below.
+            if let Some(bin_name) = Self::read_cached_bin_name(tempdir_name) {
+                return Ok(bin_name);
+            }
         }
 
         let len = {
@@ -487,7 +560,9 @@ impl BunxCommand {
         // SAFETY: subpath[len] == 0 written above
         let subpath_z = ZStr::from_buf(&subpath[..], len);
 
-        Self::get_bin_name_from_subpath(transpiler, Fd::cwd(), subpath_z)
+        let bin_name = Self::get_bin_name_from_subpath(transpiler, Fd::cwd(), subpath_z)?;
+        Self::write_cached_bin_name(tempdir_name, &bin_name);
+        Ok(bin_name)
     }
 
     /// Check the enclosing package.json for a matching "bin"
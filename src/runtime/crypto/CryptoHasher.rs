@@ -5,8 +5,8 @@ use core::ffi::c_char;
 use bun_boringssl_sys as boring_ssl;
 use bun_core::ZigString;
 use bun_jsc::{
-    ArrayBuffer, CallFrame, ErrorCode, JSGlobalObject, JSObject, JSValue, JsCell, JsClass as _,
-    JsError, JsResult,
+    ArrayBuffer, CallFrame, ErrorCode, JSGlobalObject, JSObject, JSUint8Array, JSValue, JsCell,
+    JsClass as _, JsError, JsResult,
 };
 
 use crate::crypto::evp::{AlgorithmExt as _, EVP};
@@ -647,6 +647,44 @@ impl CryptoHasher {
         Ok(this_value)
     }
 
+    // DOMJIT fast path (`update.DOMJIT` in crypto.classes.ts): the DFG calls
+    // this directly once the argument is proven a Uint8Array, skipping
+    // CallFrame materialization and the string/blob/encoding decode above.
+    // Must stay observably identical to `update` for Uint8Array inputs.
+    pub fn update_without_type_checks(
+        this: &Self,
+        global: &JSGlobalObject,
+        this_value: JSValue,
+        input: *mut JSUint8Array,
+    ) -> JSValue {
+        // SAFETY: the JIT only emits this call for a live Uint8Array cell;
+        // the slice is borrowed for this frame only.
+        let bytes = unsafe { &mut *input }.slice();
+        let result = (|| -> JsResult<JSValue> {
+            match this {
+                CryptoHasher::Evp(inner) => inner.with_mut(|e| e.update(bytes)),
+                CryptoHasher::Hmac(inner) => {
+                    if inner.get().is_none() {
+                        return Err(Self::throw_hmac_consumed(global));
+                    }
+                    inner.with_mut(|opt| opt.as_mut().unwrap().update(bytes));
+                }
+                CryptoHasher::Zig(inner) => {
+                    inner.with_mut(|z| z.update(bytes));
+                    return Ok(this_value);
+                }
+            }
+            let err = boring_ssl::ERR_get_error();
+            if err != 0 {
+                let instance = create_crypto_error(global, err);
+                boring_ssl::ERR_clear_error();
+                return Err(global.throw_value(instance));
+            }
+            Ok(this_value)
+        })();
+        bun_jsc::host_fn::to_js_host_fn_result(global, result)
+    }
+
     #[bun_jsc::host_fn(method)]
     pub fn copy(this: &Self, global: &JSGlobalObject, _: &CallFrame) -> JsResult<JSValue> {
         let copied: CryptoHasher = match this {
@@ -17,7 +17,12 @@ use bun_jsc::ConcurrentTask::ConcurrentTask;
 use bun_jsc::ZigStringJsc as _;
 use bun_jsc::zig_string::ZigString as JscZigString;
 use bun_jsc::{JSPromise, JSPromiseStrong};
-use bun_threading::work_pool::WorkPool;
+use bun_threading::work_pool::{Batch, IntrusiveWorkTask as _, OwnedTask};
+use bun_threading::{Condition, Mutex, ThreadPool};
+
+use core::cell::UnsafeCell;
+use core::sync::atomic::{AtomicUsize, Ordering};
+use std::sync::OnceLock;
 
 use crate::node::StringOrBuffer;
 
@@ -419,7 +424,7 @@ impl fmt::Display for PascalToUpperUnderscoreCaseFormatter<'_> {
 
 #[unsafe(no_mangle)]
 pub(crate) extern "C" fn JSPasswordObject__create(global_object: &JSGlobalObject) -> JSValue {
-    let object = JSValue::create_empty_object(global_object, 4);
+    let object = JSValue::create_empty_object(global_object, 5);
     // `#[bun_jsc::host_fn]` emits an `extern "C"` shim named
     // `__jsc_host_<fn>`; pass that (not the safe Rust fn) to JSFunction.
     object.put(
@@ -433,6 +438,17 @@ pub(crate) extern "C" fn JSPasswordObject__create(global_object: &JSGlobalObject
             Default::default(),
         ),
     );
+    object.put(
+        global_object,
+        b"hashMany",
+        JSFunction::create(
+            global_object,
+            "hashMany",
+            __jsc_host_js_password_object_hash_many,
+            2,
+            Default::default(),
+        ),
+    );
     object.put(
         global_object,
         b"hashSync",
@@ -486,6 +502,12 @@ trait PasswordOp: 'static {
     fn compute(&self, password: &[u8]) -> Result<Self::Value, HashError>;
     /// Convert the success payload to a `JSValue` on the JS thread.
     fn to_js(value: Self::Value, g: &JSGlobalObject) -> JSValue;
+    /// Working memory `compute` pins, charged against
+    /// [`PASSWORD_MEMORY_BUDGET`]. Verify jobs stay at 0 — their cost comes
+    /// from the untrusted hash string, not a caller-declared parameter.
+    fn memory_cost_kib(&self) -> u64 {
+        0
+    }
 }
 
 struct HashOp {
@@ -501,6 +523,9 @@ impl PasswordOp for HashOp {
         JscZigString::init(&value).to_js(g)
         // `value` drops here.
     }
+    fn memory_cost_kib(&self) -> u64 {
+        self.algorithm.memory_cost_kib()
+    }
 }
 
 struct VerifyOp {
@@ -525,6 +550,107 @@ impl PasswordOp for VerifyOp {
     }
 }
 
+// ─── dedicated password pool + memory budget ──────────────────────────────
+//
+// Password jobs run on their own pool rather than the shared `WorkPool`: a
+// burst of argon2 hashes at high-memory settings occupies workers for
+// hundreds of milliseconds each, and on the shared pool that starves
+// unrelated jobs (PBKDF2, zlib, file reads) queued behind them. Workers are
+// spawned lazily up to the CPU count and park when idle, so the pool costs
+// nothing until `Bun.password` is used.
+
+static PASSWORD_POOL: OnceLock<ThreadPool> = OnceLock::new();
+
+fn password_pool() -> &'static ThreadPool {
+    PASSWORD_POOL.get_or_init(|| {
+        ThreadPool::init(bun_threading::thread_pool::Config {
+            max_threads: u32::from(bun_core::get_thread_count()),
+            stack_size: bun_threading::thread_pool::DEFAULT_THREAD_STACK_SIZE,
+        })
+    })
+}
+
+/// `WorkPool::schedule_owned`, but targeting the password pool.
+fn schedule_on_password_pool<T: OwnedTask>(mut task: Box<T>) {
+    task.task_mut().callback = T::__callback;
+    let raw = Box::into_raw(task);
+    // SAFETY: `raw` is a live heap allocation now owned by the pool;
+    // `IntrusiveField::field_of` projects to the embedded `Task`.
+    password_pool().schedule(Batch::from(unsafe { T::field_of(raw) }));
+}
+
+/// Caps the argon2 working memory pinned by in-flight password jobs. A
+/// worker admits its job once `in_flight + cost` fits the budget — or when
+/// nothing else is running, so a single oversize job can never deadlock.
+/// Waiting blocks the pool worker, which is the intent: memory-hungry jobs
+/// queue among themselves instead of committing unbounded memory.
+struct MemoryBudget {
+    mutex: Mutex,
+    cond: Condition,
+    /// Guarded by `mutex`. `UnsafeCell` because `acquire`/`release` take `&self`.
+    in_flight_kib: UnsafeCell<u64>,
+}
+
+// SAFETY: `in_flight_kib` is only read/written while `mutex` is held.
+unsafe impl Sync for MemoryBudget {}
+
+impl MemoryBudget {
+    /// 1 GiB of concurrent argon2 working memory — two of OWASP's
+    /// highest-recommended (512 MiB) jobs, or sixteen at Bun's 64 MiB default.
+    const LIMIT_KIB: u64 = 1 << 20;
+
+    const fn new() -> Self {
+        Self {
+            mutex: Mutex::new(),
+            cond: Condition::new(),
+            in_flight_kib: UnsafeCell::new(0),
+        }
+    }
+
+    fn acquire(&self, cost_kib: u64) {
+        if cost_kib == 0 {
+            return;
+        }
+        self.mutex.lock();
+        scopeguard::defer! { self.mutex.unlock(); }
+        // SAFETY: `mutex` is held for every access to `in_flight_kib` below.
+        while unsafe { *self.in_flight_kib.get() } != 0
+            && unsafe { *self.in_flight_kib.get() } + cost_kib > Self::LIMIT_KIB
+        {
+            self.cond.wait(&self.mutex);
+        }
+        // SAFETY: `mutex` is still held (released only by the scopeguard).
+        unsafe { *self.in_flight_kib.get() += cost_kib };
+    }
+
+    fn release(&self, cost_kib: u64) {
+        if cost_kib == 0 {
+            return;
+        }
+        self.mutex.lock();
+        scopeguard::defer! { self.mutex.unlock(); }
+        // SAFETY: `mutex` is held.
+        unsafe { *self.in_flight_kib.get() -= cost_kib };
+        // Waiters have differing costs; wake all so the largest fit is found.
+        self.cond.broadcast();
+    }
+}
+
+static PASSWORD_MEMORY_BUDGET: MemoryBudget = MemoryBudget::new();
+
+impl AlgorithmValue {
+    /// Working memory the job pins while hashing, for the pool's budget.
+    /// bcrypt's 4 KiB state is noise; only argon2 is accounted.
+    fn memory_cost_kib(&self) -> u64 {
+        match *self {
+            AlgorithmValue::Argon2i(p)
+            | AlgorithmValue::Argon2d(p)
+            | AlgorithmValue::Argon2id(p) => u64::from(p.memory_cost),
+            AlgorithmValue::Bcrypt(_) => 0,
+        }
+    }
+}
+
 /// Build the JS `Error` instance for a failed hash/verify, with `code` set
 /// to `PASSWORD_<SCREAMING_SNAKE_ERROR_NAME>`.
 fn password_error_instance(err: &HashError, verb: &str, g: &JSGlobalObject) -> JSValue {
@@ -572,7 +698,10 @@ impl<Op: PasswordOp> PasswordJob<Op> {
     // is a false positive on this macro contract.
     #[allow(clippy::boxed_local)]
     fn run_owned(mut self: Box<Self>) {
+        let cost_kib = self.op.memory_cost_kib();
+        PASSWORD_MEMORY_BUDGET.acquire(cost_kib);
         let value = self.op.compute(&self.password);
+        PASSWORD_MEMORY_BUDGET.release(cost_kib);
         let result = bun_core::heap::into_raw(Box::new(PasswordResult::<Op> {
             value,
             task: AnyTask::default(), // overwritten below
@@ -677,7 +806,7 @@ impl JSPasswordObject {
             task: WorkPoolTask::default(),
         });
         job.r#ref.ref_(bun_io::js_vm_ctx());
-        WorkPool::schedule_owned(job);
+        schedule_on_password_pool(job);
 
         Ok(promise_value)
     }
@@ -705,6 +834,158 @@ impl JSPasswordObject {
             },
         )
     }
+
+    /// `Bun.password.hashMany`: fan one hash job per password across the
+    /// password pool, resolving with the encoded hashes in input order (or
+    /// rejecting with the first failure). One promise and one completion task
+    /// instead of N.
+    fn hash_many(
+        global_object: &JSGlobalObject,
+        passwords: Vec<Box<[u8]>>,
+        algorithm: AlgorithmValue,
+    ) -> JsResult<JSValue> {
+        let count = passwords.len();
+        debug_assert!(count > 0); // caller resolves the empty batch inline
+
+        let promise = JSPromiseStrong::init(global_object);
+        let promise_value = promise.value();
+
+        let mut results = Vec::with_capacity(count);
+        results.resize_with(count, || UnsafeCell::new(None));
+
+        let mut state = Box::new(BatchState {
+            algorithm,
+            results: results.into_boxed_slice(),
+            remaining: AtomicUsize::new(count),
+            promise,
+            // SAFETY: bun_vm() is non-null for a Bun-owned global; VM outlives the batch.
+            event_loop: global_object.bun_vm().event_loop(),
+            global: std::ptr::from_ref(global_object),
+            r#ref: KeepAlive::default(),
+            task: AnyTask::default(),
+        });
+        state.r#ref.ref_(bun_io::js_vm_ctx());
+        let state = bun_core::heap::into_raw(state);
+
+        for (index, password) in passwords.into_iter().enumerate() {
+            schedule_on_password_pool(Box::new(BatchHashJob {
+                state,
+                index,
+                password,
+                task: WorkPoolTask::default(),
+            }));
+        }
+
+        Ok(promise_value)
+    }
+}
+
+// ─── hashMany batch fan-out ───────────────────────────────────────────────
+
+/// Shared state for one `hashMany` call. Owned by the last sub-job to
+/// finish, which hands it to the event loop for JS-side completion.
+struct BatchState {
+    algorithm: AlgorithmValue,
+    /// One slot per password. `UnsafeCell` because workers fill disjoint
+    /// indices concurrently through a shared `*mut BatchState`.
+    results: Box<[UnsafeCell<Option<Result<Box<[u8]>, HashError>>>]>,
+    remaining: AtomicUsize,
+    promise: JSPromiseStrong,
+    event_loop: *mut EventLoop,
+    global: *const JSGlobalObject,
+    r#ref: KeepAlive,
+    task: AnyTask,
+}
+
+impl BatchState {
+    fn run_from_js_erased(p: *mut Self) -> AnyTaskJsResult<()> {
+        Self::run_from_js(p).map_err(bun_event_loop::ErasedJsError::from)
+    }
+
+    fn run_from_js(this: *mut Self) -> JsResult<()> {
+        // SAFETY: `this` was produced by heap::into_raw in `hash_many`; the
+        // AcqRel countdown in `BatchHashJob::run_owned` guarantees the last
+        // finisher (which enqueued this task) held the only live reference.
+        let this = *unsafe { bun_core::heap::take(this) };
+        let BatchState {
+            results,
+            mut r#ref,
+            mut promise,
+            global,
+            ..
+        } = this;
+        // SAFETY: `global` stored from a live `&JSGlobalObject`; VM outlives the task.
+        let global = unsafe { &*global };
+        r#ref.unref(bun_io::js_vm_ctx());
+
+        let results = results.into_vec();
+        let array = JSValue::create_empty_array(global, results.len())?;
+        for (i, cell) in results.into_iter().enumerate() {
+            match cell.into_inner().expect("batch slot filled before countdown") {
+                Ok(hash) => {
+                    let js = JscZigString::init(&hash).to_js(global);
+                    array.put_index(global, u32::try_from(i).expect("int cast"), js)?;
+                }
+                Err(err) => {
+                    let error_instance = password_error_instance(&err, HashOp::ERR_VERB, global);
+                    promise.reject_with_async_stack(global, Ok(error_instance))?;
+                    return Ok(());
+                }
+            }
+        }
+        promise.resolve(global, array)?;
+        Ok(())
+    }
+}
+
+/// One password of a `hashMany` batch.
+struct BatchHashJob {
+    state: *mut BatchState,
+    index: usize,
+    password: Box<[u8]>,
+    task: WorkPoolTask,
+}
+
+impl Drop for BatchHashJob {
+    fn drop(&mut self) {
+        // bun.freeSensitive — volatile-zero then free, like PasswordJob.
+        bun_alloc::free_sensitive(core::mem::take(&mut self.password));
+    }
+}
+
+bun_threading::owned_task!(BatchHashJob, task);
+
+impl BatchHashJob {
+    #[allow(clippy::boxed_local)]
+    fn run_owned(self: Box<Self>) {
+        let state = self.state;
+        // SAFETY: `algorithm` is immutable after construction; shared read.
+        let algorithm = unsafe { (*state).algorithm };
+        let cost_kib = algorithm.memory_cost_kib();
+        PASSWORD_MEMORY_BUDGET.acquire(cost_kib);
+        let result = PasswordObject::hash(&self.password, algorithm);
+        PASSWORD_MEMORY_BUDGET.release(cost_kib);
+
+        // SAFETY: each sub-job writes only its own slot (indices are
+        // disjoint), through a shared borrow of the slice; the countdown
+        // below publishes the write to whoever observes `remaining == 0`.
+        unsafe {
+            *(*state).results[self.index].get() = Some(result);
+        }
+
+        // SAFETY: `remaining` is an atomic reached through a shared borrow.
+        if unsafe { (*state).remaining.fetch_sub(1, Ordering::AcqRel) } == 1 {
+            // Last one out completes the batch. Every other worker is done
+            // touching `*state` (AcqRel above), so exclusive access is ours.
+            unsafe {
+                (*state).task = AnyTask::from_typed(state, BatchState::run_from_js_erased);
+                (*(*state).event_loop).enqueue_task_concurrent(ConcurrentTask::create_from(
+                    core::ptr::addr_of_mut!((*state).task),
+                ));
+            }
+        }
+        // `self` drops here; Drop zeroes the password.
+    }
 }
 
 // ─── host functions ───────────────────────────────────────────────────────
@@ -748,6 +1029,48 @@ pub(crate) fn js_password_object_hash(
     )
 }
 
+// Once we have bindings generator, this should be replaced with a generated function
+#[bun_jsc::host_fn]
+pub(crate) fn js_password_object_hash_many(
+    global_object: &JSGlobalObject,
+    callframe: &CallFrame,
+) -> JsResult<JSValue> {
+    let arguments = callframe.arguments();
+
+    if arguments.is_empty() {
+        return Err(global_object.throw_not_enough_arguments("hashMany", 1, 0));
+    }
+
+    if !arguments[0].is_array() {
+        return Err(global_object.throw_invalid_argument_type("hashMany", "passwords", "array"));
+    }
+
+    let mut algorithm = AlgorithmValue::DEFAULT;
+
+    if arguments.len() > 1 && !arguments[1].is_empty_or_undefined_or_null() {
+        algorithm = AlgorithmValue::from_js(global_object, arguments[1])?;
+    }
+
+    let mut iter = jsc::JSArrayIterator::init(arguments[0], global_object)?;
+    let mut passwords: Vec<Box<[u8]>> = Vec::with_capacity(iter.len as usize);
+    while let Some(value) = iter.next()? {
+        let password = StringOrBuffer::from_js_to_owned_slice(global_object, value)?;
+        if password.is_empty() {
+            return Err(
+                global_object.throw_invalid_arguments(format_args!("password must not be empty"))
+            );
+        }
+        passwords.push(password.into_boxed_slice());
+    }
+
+    if passwords.is_empty() {
+        let empty = JSValue::create_empty_array(global_object, 0)?;
+        return Ok(JSPromise::resolved_promise_value(global_object, empty));
+    }
+
+    JSPasswordObject::hash_many(global_object, passwords, algorithm)
+}
+
 // Once we have bindings generator, this should be replaced with a generated function
 #[bun_jsc::host_fn]
 pub(crate) fn js_password_object_hash_sync(
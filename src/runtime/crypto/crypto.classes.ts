@@ -59,6 +59,10 @@ export default [
           args: [],
         },
       },
+      randomUUIDBatch: {
+        fn: "randomUUIDBatch",
+        length: 1,
+      },
       timingSafeEqual: {
         fn: "timingSafeEqual",
         DOMJIT: {
@@ -99,6 +103,16 @@ export default [
       update: {
         fn: "update",
         length: 2,
+        // `update(typedArray)` dominates streaming-hash workloads; for
+        // sub-1KB chunks the generic binding overhead costs more than the
+        // compression function itself.
+        DOMJIT: {
+          returns: "JSValue",
+          pure: false,
+          args: ["JSUint8Array"],
+          passThis: true,
+          enabled: true,
+        },
       },
       copy: {
         fn: "copy",
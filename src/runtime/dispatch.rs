@@ -606,6 +606,7 @@ pub fn tick_queue_with_count(
         // Incremented before dispatch so the count includes every task,
         // including the one that takes the HotReloadTask early return.
         *counter += 1;
+        bun_crash_handler::flight_recorder::record(task_tag::name(task.tag), 0);
         match run_task(task, el, vm, global)? {
             RunTaskResult::Continue => {}
             RunTaskResult::EarlyReturn => {
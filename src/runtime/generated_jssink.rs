@@ -4,8 +4,8 @@
 //! `${BUN_CODEGEN_DIR}/generated_jssink.rs`; this module `include!`s it so
 //! the `#[unsafe(no_mangle)] extern "C"` symbols land in `bun_runtime` and
 //! satisfy the `BUN_DECLARE_HOST_FUNCTION(${name}__{construct,write,end,
-//! flush,start})` / `${name}__{getInternalFd,memoryCost}` externs declared
-//! by `JSSink.cpp` / `headers.h`.
+//! flush,start})` / `${name}__{getInternalFd,memoryCost,writeValue}` externs
+//! declared by `JSSink.cpp` / `headers.h` / `JSSink.h`.
 #![allow(
     non_snake_case,
     non_camel_case_types,
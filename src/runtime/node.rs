@@ -102,6 +102,8 @@ pub mod win_watcher;
 pub mod memory_pressure;
 #[path = "node/node_fs_binding.rs"]
 pub mod node_fs_binding;
+#[path = "node/node_fs_stat_cache.rs"]
+pub mod node_fs_stat_cache;
 #[path = "node/node_fs_stat_watcher.rs"]
 pub mod node_fs_stat_watcher;
 #[path = "node/node_fs_watcher.rs"]
@@ -162,6 +162,7 @@ extern_crypto_job!(NidKeyPairJob, "NidKeyPairJob");
 extern_crypto_job!(DhKeyPairJob, "DhKeyPairJob");
 extern_crypto_job!(DhJob, "DhJob");
 extern_crypto_job!(SignJob, "SignJob");
+extern_crypto_job!(VerifyBatchJob, "VerifyBatchJob");
 
 // ───────────────────────────────────────────────────────────────────────────
 // CryptoJob<Ctx>
@@ -1231,7 +1232,9 @@ mod _impl {
                 .throw());
         }
 
-        Ok(JSValue::from(boringssl::c::constant_time_eq(l, r)))
+        // Lengths are equal (checked above), so the vectorized compare's
+        // public-length contract holds.
+        Ok(JSValue::from(bun_highway::timing_safe_equal(l, r)))
     }
 
     #[bun_jsc::host_fn]
@@ -233,6 +233,8 @@ pub use super::node_fs_constant as constants;
 pub use super::node_fs_stat_watcher as StatWatcher;
 pub use super::node_fs_watcher as Watcher;
 
+use super::node_fs_stat_cache as stat_cache;
+
 /// `Binding` is the JSC-class instance that owns the per-thread `NodeFS`
 /// (`super::node_fs_binding::Binding`). Re-exported so the async `create()`
 /// entry points keep their `&mut Binding` signature.
@@ -4753,6 +4755,7 @@ impl NodeFS {
     }
 
     pub fn append_file(&mut self, args: &args::AppendFile, _: Flavor) -> Maybe<ret::AppendFile> {
+        stat_cache::invalidate_all();
         let mut data = args.data.slice();
         match &args.file {
             PathOrFileDescriptor::Fd(fd) => {
@@ -4962,6 +4965,7 @@ impl NodeFS {
     }
 
     pub fn copy_file(&mut self, args: &args::CopyFile, _: Flavor) -> Maybe<ret::CopyFile> {
+        stat_cache::invalidate_all();
         match self.copy_file_inner(args) {
             Ok(_) => Ok(()),
             Err(err) => Err(sys::Error {
@@ -5440,6 +5444,7 @@ impl NodeFS {
     }
 
     pub fn chown(&mut self, args: &args::Chown, _: Flavor) -> Maybe<ret::Chown> {
+        stat_cache::invalidate_all();
         #[cfg(windows)]
         {
             return match Syscall::chown(
@@ -5459,6 +5464,7 @@ impl NodeFS {
     }
 
     pub fn chmod(&mut self, args: &args::Chmod, _: Flavor) -> Maybe<ret::Chmod> {
+        stat_cache::invalidate_all();
         let path = args.path.slice_z(&mut self.sync_error_buf);
         #[cfg(windows)]
         {
@@ -5582,6 +5588,7 @@ impl NodeFS {
     }
 
     pub fn lchmod(&mut self, args: &args::LCHmod, _: Flavor) -> Maybe<ret::Lchmod> {
+        stat_cache::invalidate_all();
         #[cfg(windows)]
         {
             let _ = args;
@@ -5609,6 +5616,7 @@ impl NodeFS {
     }
 
     pub fn lchown(&mut self, args: &args::LChown, _: Flavor) -> Maybe<ret::Lchown> {
+        stat_cache::invalidate_all();
         // On Windows `Syscall::lchown` routes through uv_fs_lchown, which is
         // a no-op success, matching Node.
         let path = args.path.slice_z(&mut self.sync_error_buf);
@@ -5619,6 +5627,7 @@ impl NodeFS {
     }
 
     pub fn link(&mut self, args: &args::Link, _: Flavor) -> Maybe<ret::Link> {
+        stat_cache::invalidate_all();
         let mut to_buf = PathBuffer::uninit();
         let from = args.old_path.slice_z(&mut self.sync_error_buf);
         let to = args.new_path.slice_z(&mut to_buf);
@@ -5642,29 +5651,53 @@ impl NodeFS {
 
     pub fn lstat(&mut self, args: &args::Lstat, _: Flavor) -> Maybe<ret::Lstat> {
         let path = args.path.slice_z(&mut self.sync_error_buf);
+        if stat_cache::enabled() {
+            if let Some(cached) = stat_cache::get(path.as_bytes(), true) {
+                return Self::stat_or_not_found_from_cache(
+                    cached,
+                    args.path.slice(),
+                    args.throw_if_no_entry,
+                    args.big_int,
+                    sys::Tag::lstat,
+                );
+            }
+        }
         #[cfg(any(target_os = "linux", target_os = "android"))]
         if sys::SUPPORTS_STATX_ON_LINUX.load(Ordering::Relaxed) {
             return match sys::lstatx(path, sys::STATX_MASK_FOR_STATS) {
-                Ok(result) => Ok(StatOrNotFound::Stats(Box::new(Stats::init(
-                    &result,
-                    args.big_int,
-                )))),
+                Ok(result) => {
+                    stat_cache::put(path.as_bytes(), true, Some(&result));
+                    Ok(StatOrNotFound::Stats(Box::new(Stats::init(
+                        &result,
+                        args.big_int,
+                    ))))
+                }
                 Err(err) => {
-                    if !args.throw_if_no_entry && err.get_errno() == E::ENOENT {
-                        return Ok(StatOrNotFound::NotFound);
+                    if err.get_errno() == E::ENOENT {
+                        stat_cache::put(path.as_bytes(), true, None);
+                        if !args.throw_if_no_entry {
+                            return Ok(StatOrNotFound::NotFound);
+                        }
                     }
                     Err(err.with_path(args.path.slice()))
                 }
             };
         }
         match Syscall::lstat(path) {
-            Ok(result) => Ok(StatOrNotFound::Stats(Box::new(Stats::init(
-                &PosixStat::init(&result),
-                args.big_int,
-            )))),
+            Ok(result) => {
+                let stat_ = PosixStat::init(&result);
+                stat_cache::put(path.as_bytes(), true, Some(&stat_));
+                Ok(StatOrNotFound::Stats(Box::new(Stats::init(
+                    &stat_,
+                    args.big_int,
+                ))))
+            }
             Err(err) => {
-                if !args.throw_if_no_entry && err.get_errno() == E::ENOENT {
-                    return Ok(StatOrNotFound::NotFound);
+                if err.get_errno() == E::ENOENT {
+                    stat_cache::put(path.as_bytes(), true, None);
+                    if !args.throw_if_no_entry {
+                        return Ok(StatOrNotFound::NotFound);
+                    }
                 }
                 Err(err.with_path(args.path.slice()))
             }
@@ -5672,6 +5705,7 @@ impl NodeFS {
     }
 
     pub fn mkdir(&mut self, args: &args::Mkdir, _: Flavor) -> Maybe<ret::Mkdir> {
+        stat_cache::invalidate_all();
         if args.path.slice().is_empty() {
             return Err(sys::Error {
                 errno: E::ENOENT as _,
@@ -5973,6 +6007,7 @@ impl NodeFS {
     }
 
     pub fn mkdtemp(&mut self, args: &args::MkdirTemp, _: Flavor) -> Maybe<ret::Mkdtemp> {
+        stat_cache::invalidate_all();
         let prefix_buf = &mut self.sync_error_buf;
         let prefix_slice = args.prefix.slice();
         let len = prefix_slice.len().min(prefix_buf.len().saturating_sub(7));
@@ -6035,6 +6070,11 @@ impl NodeFS {
     }
 
     pub fn open(&mut self, args: &args::Open, _: Flavor) -> Maybe<ret::Open> {
+        if (args.flags.as_int() & (sys::O::CREAT | sys::O::TRUNC)) != 0 {
+            // Only creating/truncating opens mutate the path itself; read
+            // opens must stay off the invalidation path.
+            stat_cache::invalidate_all();
+        }
         let path = if cfg!(windows) && args.path.slice() == b"/dev/null" {
             // SAFETY: literal is NUL-terminated; len excludes the sentinel.
             ZStr::from_static(b"\\\\.\\NUL\0")
@@ -6718,12 +6758,56 @@ impl NodeFS {
         root_basename: &ZStr,
         entries: &mut Vec<T>,
     ) -> Maybe<()> {
-        use std::collections::VecDeque;
-        // PERF: VecDeque<Vec<u8>> heap-allocates from the
-        // first push. Revisit with `smallvec`/arena once profiled.
-        let mut stack: VecDeque<Vec<u8>> = VecDeque::new();
-        // Sentinel: an empty item means "root" (handled below).
-        stack.push_back(Vec::new()); // empty == root marker (handled below)
+        /// The pending-directory queue, flattened into one contiguous byte
+        /// buffer: NUL-terminated relative paths stored back to back plus a
+        /// range per entry. Replaces a `VecDeque<Vec<u8>>` that paid one heap
+        /// allocation per discovered directory; here pushes amortize into two
+        /// growable buffers and the consumed prefix is reclaimed by
+        /// compaction.
+        struct PendingDirs {
+            bytes: Vec<u8>,
+            items: std::collections::VecDeque<core::ops::Range<usize>>,
+        }
+
+        impl PendingDirs {
+            /// Append `path` plus a trailing NUL so the eventual `openat`
+            /// gets a `&ZStr` without another copy.
+            fn push(&mut self, path: &[u8]) {
+                let start = self.bytes.len();
+                self.bytes.extend_from_slice(path);
+                self.bytes.push(0);
+                self.items.push_back(start..self.bytes.len());
+            }
+
+            /// Copy the front entry (including its NUL) into `scratch`.
+            /// Returns `false` when the queue is empty. Copying out keeps BFS
+            /// order while letting `push` grow or compact `bytes`
+            /// mid-iteration without invalidating the path being walked.
+            fn pop_into(&mut self, scratch: &mut Vec<u8>) -> bool {
+                let Some(range) = self.items.pop_front() else {
+                    return false;
+                };
+                scratch.clear();
+                scratch.extend_from_slice(&self.bytes[range.clone()]);
+                // Reclaim the consumed prefix once it dominates the buffer;
+                // the 4 KiB floor keeps small walks from compacting at all.
+                if range.end >= 4096 && range.end * 2 >= self.bytes.len() {
+                    self.bytes.drain(..range.end);
+                    for item in &mut self.items {
+                        item.start -= range.end;
+                        item.end -= range.end;
+                    }
+                }
+                true
+            }
+        }
+
+        let mut pending = PendingDirs {
+            bytes: Vec::new(),
+            items: std::collections::VecDeque::new(),
+        };
+        // Sentinel: an empty path means "root" (handled below).
+        pending.push(&[]);
         let mut first_is_root = true;
 
         let mut root_fd = FD::INVALID;
@@ -6742,13 +6826,15 @@ impl NodeFS {
         let mut spill: Vec<u8> = Vec::new();
         let mut dirent_spill: Vec<u8> = Vec::new();
 
-        while let Some(item) = stack.pop_front() {
-            let is_root = first_is_root && item.is_empty();
+        // Reused across iterations; holds the current entry's bytes so the
+        // queue's backing buffer stays free to grow behind it.
+        let mut item: Vec<u8> = Vec::new();
+        while pending.pop_into(&mut item) {
+            let is_root = first_is_root && item.len() == 1;
             first_is_root = false;
             // basename: root_basename for the first iteration, else the queued
-            // relative path (NUL-terminated by construction).
-            // `item` is an owned Vec<u8> dropped at end-of-loop. Exclude the
-            // trailing NUL we appended at the push site so the join below sees
+            // relative path (NUL-terminated by construction). Exclude the
+            // trailing NUL appended at the push site so the join below sees
             // clean bytes.
             let basename_bytes: &[u8] = if is_root {
                 root_basename.as_bytes()
@@ -6762,13 +6848,12 @@ impl NodeFS {
             } else {
                 *root_fd
             };
-            // root_basename is already NUL-terminated; queued items are pushed
-            // below with the join_z_buf NUL kept intact (`from_slice_with_nul`
+            // root_basename is already NUL-terminated; `PendingDirs::push`
+            // appends the NUL the queued items carry (`from_slice_with_nul`
             // debug-asserts the trailing NUL).
             let basename_z: &ZStr = if is_root {
                 root_basename
             } else {
-                // item was stored with trailing NUL (see push site).
                 ZStr::from_slice_with_nul(&item)
             };
             let fd = match Syscall::openat(atfd, basename_z, flags, 0) {
@@ -6835,12 +6920,7 @@ impl NodeFS {
                         // we know for sure it's a directory
                         sys::FileKind::Directory => {
                             if utf8_name.len() + 1 + name_to_copy.len() > paths::MAX_PATH_BYTES { break 'enqueue; }
-                            // Store with trailing NUL so the next iteration can
-                            // hand it to `openat` as a `&ZStr`.
-                            let mut owned = Vec::with_capacity(name_to_copy.len() + 1);
-                            owned.extend_from_slice(name_to_copy);
-                            owned.push(0);
-                            stack.push_back(owned);
+                            pending.push(name_to_copy);
                         }
                         // Some filesystems (e.g., Docker bind mounts, FUSE, NFS) return
                         // DT_UNKNOWN for d_type. Use lstatat to determine the actual type.
@@ -6851,10 +6931,7 @@ impl NodeFS {
                                     let real_kind = sys::kind_from_mode(st.st_mode as Mode);
                                     effective_kind = real_kind;
                                     if matches!(real_kind, sys::FileKind::Directory | sys::FileKind::SymLink) {
-                                        let mut owned = Vec::with_capacity(name_to_copy.len() + 1);
-                                        owned.extend_from_slice(name_to_copy);
-                                        owned.push(0);
-                                        stack.push_back(owned);
+                                        pending.push(name_to_copy);
                                     }
                                 }
                                 Err(_) => {} // Skip entries we can't stat
@@ -7023,6 +7100,32 @@ impl NodeFS {
         }
     }
 
+    /// The per-thread 256 KB scratch slab for the async pre-stat read in
+    /// [`read_file_with_options`](Self::read_file_with_options), allocated on
+    /// first use and reused for the life of the work-pool thread. The slab is
+    /// write-only scratch — every return path copies the filled prefix out.
+    /// Returns an empty slice on OOM so the pre-stat loop is skipped (the
+    /// same shape as the sync no-VM case).
+    fn async_pre_stat_buffer() -> *mut [u8] {
+        use bun_collections::vec_ext::VecExt as _;
+        std::thread_local! {
+            static BUFFER: core::cell::UnsafeCell<Vec<u8>> =
+                const { core::cell::UnsafeCell::new(Vec::new()) };
+        }
+        BUFFER.with(|cell| {
+            // SAFETY: thread-local, and no borrow escapes this closure — the
+            // caller receives a raw pointer it must justify itself.
+            let slab = unsafe { &mut *cell.get() };
+            if slab.is_empty() && slab.try_reserve_exact(256 * 1024).is_ok() {
+                // SAFETY: `u8` has no validity invariant; the slab is handed
+                // straight to the kernel, which only stores into it. Only the
+                // prefix actually filled by `read` is ever observed.
+                unsafe { slab.expand_to_capacity() };
+            }
+            core::ptr::slice_from_raw_parts_mut(slab.as_mut_ptr(), slab.len())
+        })
+    }
+
     pub fn read_file_with_options(
         &mut self,
         args: &args::ReadFile,
@@ -7114,18 +7217,10 @@ impl NodeFS {
         // The sync case borrows `vm.rareData().pipeReadBuffer()` (a per-VM
         // 256 KB heap slab) when a VM is present, otherwise leaves the buffer
         // zero-length so the loop is skipped and we fall through to fstat.
-        // The async path heap-allocates a 256 KB buffer instead (Zig used a
-        // comptime-sized stack array; Rust cannot size a stack array on
-        // `flavor`, so heap is forced, but the slab stays uninitialised: it
-        // is write-only, `Syscall::read` hands it straight to the kernel).
+        // The async path reuses a per-thread slab of the same size (see
+        // `async_pre_stat_buffer`): allocating and faulting in a fresh 256 KB
+        // per call cost more than the actual read for small cached files.
         use bun_collections::vec_ext::VecExt as _;
-        let mut async_stack_buffer: Vec<u8> = Vec::new();
-        if flavor != Flavor::Sync && async_stack_buffer.try_reserve_exact(256 * 1024).is_ok() {
-            // SAFETY: `u8` has no validity invariant; the buffer is handed
-            // straight to the kernel which only stores into it. Only the
-            // `[..total]` prefix actually filled by `read` is ever observed.
-            unsafe { async_stack_buffer.expand_to_capacity() };
-        }
         let pre_stat_buf: &mut [u8] = if flavor == Flavor::Sync {
             match self.vm {
                 // SAFETY: `self.vm` is the live owning `*mut VirtualMachine`;
@@ -7135,7 +7230,11 @@ impl NodeFS {
                 None => &mut [][..],
             }
         } else {
-            &mut async_stack_buffer[..]
+            // SAFETY: work-pool threads run one task at a time and this
+            // function never re-enters itself, so the per-thread slab is
+            // exclusively ours for the duration of this call; the
+            // thread-local outlives it.
+            unsafe { &mut *Self::async_pre_stat_buffer() }
         };
         let temporary_read_buffer_before_stat_call: &[u8] = {
             let mut available: &mut [u8] = &mut pre_stat_buf[..];
@@ -7522,6 +7621,7 @@ impl NodeFS {
     }
 
     pub fn write_file(&mut self, args: &args::WriteFile, _: Flavor) -> Maybe<ret::WriteFile> {
+        stat_cache::invalidate_all();
         Self::write_file_with_path_buffer(&mut self.sync_error_buf, args)
     }
 
@@ -7692,6 +7792,7 @@ impl NodeFS {
     }
 
     pub fn rename(&mut self, args: &args::Rename, _: Flavor) -> Maybe<ret::Rename> {
+        stat_cache::invalidate_all();
         let from_buf = &mut self.sync_error_buf;
         let mut to_buf = PathBuffer::uninit();
         let from = args.old_path.slice_z(from_buf);
@@ -7703,6 +7804,7 @@ impl NodeFS {
     }
 
     pub fn rmdir(&mut self, args: &args::RmDir, _: Flavor) -> Maybe<ret::Rmdir> {
+        stat_cache::invalidate_all();
         if args.recursive {
             // On Windows a rooted-but-driveless path ("/tmp/foo") must resolve
             // against the cwd drive.
@@ -7743,6 +7845,7 @@ impl NodeFS {
     }
 
     pub fn rm(&mut self, args: &args::Rm, _: Flavor) -> Maybe<ret::Rm> {
+        stat_cache::invalidate_all();
         // We cannot use removefileat() on macOS because it does not handle write-protected files as expected.
         if args.recursive {
             // See the matching comment in `rmdir`: pre-resolve the path on
@@ -7825,6 +7928,29 @@ impl NodeFS {
         }
     }
 
+    /// Materialize a [`stat_cache`] hit with the same result shape as the
+    /// syscall paths in [`stat`](Self::stat) / [`lstat`](Self::lstat).
+    fn stat_or_not_found_from_cache(
+        cached: stat_cache::Cached,
+        path: &[u8],
+        throw_if_no_entry: bool,
+        big_int: bool,
+        tag: sys::Tag,
+    ) -> Maybe<StatOrNotFound> {
+        match cached {
+            stat_cache::Cached::Stat(stat_) => Ok(StatOrNotFound::Stats(Box::new(Stats::init(
+                &stat_, big_int,
+            )))),
+            stat_cache::Cached::NoEnt => {
+                if !throw_if_no_entry {
+                    Ok(StatOrNotFound::NotFound)
+                } else {
+                    Err(sys::Error::from_code(E::ENOENT, tag).with_path(path))
+                }
+            }
+        }
+    }
+
     pub fn stat(&mut self, args: &args::Stat, _: Flavor) -> Maybe<ret::Stat> {
         let path = args.path.slice_z(&mut self.sync_error_buf);
         if let Some(graph) = standalone_module_graph_get() {
@@ -7836,29 +7962,53 @@ impl NodeFS {
                 ))));
             }
         }
+        if stat_cache::enabled() {
+            if let Some(cached) = stat_cache::get(path.as_bytes(), false) {
+                return Self::stat_or_not_found_from_cache(
+                    cached,
+                    args.path.slice(),
+                    args.throw_if_no_entry,
+                    args.big_int,
+                    sys::Tag::stat,
+                );
+            }
+        }
         #[cfg(any(target_os = "linux", target_os = "android"))]
         if sys::SUPPORTS_STATX_ON_LINUX.load(Ordering::Relaxed) {
             return match sys::statx(path, sys::STATX_MASK_FOR_STATS) {
-                Ok(result) => Ok(StatOrNotFound::Stats(Box::new(Stats::init(
-                    &result,
-                    args.big_int,
-                )))),
+                Ok(result) => {
+                    stat_cache::put(path.as_bytes(), false, Some(&result));
+                    Ok(StatOrNotFound::Stats(Box::new(Stats::init(
+                        &result,
+                        args.big_int,
+                    ))))
+                }
                 Err(err) => {
-                    if !args.throw_if_no_entry && err.get_errno() == E::ENOENT {
-                        return Ok(StatOrNotFound::NotFound);
+                    if err.get_errno() == E::ENOENT {
+                        stat_cache::put(path.as_bytes(), false, None);
+                        if !args.throw_if_no_entry {
+                            return Ok(StatOrNotFound::NotFound);
+                        }
                     }
                     Err(err.with_path(args.path.slice()))
                 }
             };
         }
         match Syscall::stat(path) {
-            Ok(result) => Ok(StatOrNotFound::Stats(Box::new(Stats::init(
-                &PosixStat::init(&result),
-                args.big_int,
-            )))),
+            Ok(result) => {
+                let stat_ = PosixStat::init(&result);
+                stat_cache::put(path.as_bytes(), false, Some(&stat_));
+                Ok(StatOrNotFound::Stats(Box::new(Stats::init(
+                    &stat_,
+                    args.big_int,
+                ))))
+            }
             Err(err) => {
-                if !args.throw_if_no_entry && err.get_errno() == E::ENOENT {
-                    return Ok(StatOrNotFound::NotFound);
+                if err.get_errno() == E::ENOENT {
+                    stat_cache::put(path.as_bytes(), false, None);
+                    if !args.throw_if_no_entry {
+                        return Ok(StatOrNotFound::NotFound);
+                    }
                 }
                 Err(err.with_path(args.path.slice()))
             }
@@ -7866,6 +8016,7 @@ impl NodeFS {
     }
 
     pub fn symlink(&mut self, args: &args::Symlink, _: Flavor) -> Maybe<ret::Symlink> {
+        stat_cache::invalidate_all();
         let mut to_buf = PathBuffer::uninit();
         #[cfg(windows)]
         {
@@ -8025,6 +8176,7 @@ impl NodeFS {
     }
 
     pub fn truncate(&mut self, args: &args::Truncate, _: Flavor) -> Maybe<ret::Truncate> {
+        stat_cache::invalidate_all();
         match &args.path {
             // Mask off the top bit so the i64 cast can't panic.
             PathOrFileDescriptor::Fd(fd) => {
@@ -8035,6 +8187,7 @@ impl NodeFS {
     }
 
     pub fn unlink(&mut self, args: &args::Unlink, _: Flavor) -> Maybe<ret::Unlink> {
+        stat_cache::invalidate_all();
         #[cfg(windows)]
         {
             return match Syscall::unlink(args.path.slice_z(&mut self.sync_error_buf)) {
@@ -8088,6 +8241,7 @@ impl NodeFS {
     }
 
     pub fn utimes(&mut self, args: &args::Utimes, _: Flavor) -> Maybe<ret::Utimes> {
+        stat_cache::invalidate_all();
         #[cfg(windows)]
         {
             let mut req = UvFsReq::new();
@@ -8125,6 +8279,7 @@ impl NodeFS {
     }
 
     pub fn lutimes(&mut self, args: &args::Lutimes, _: Flavor) -> Maybe<ret::Lutimes> {
+        stat_cache::invalidate_all();
         #[cfg(windows)]
         {
             let mut req = UvFsReq::new();
@@ -8174,6 +8329,7 @@ impl NodeFS {
     /// This function is `cpSync`, but only if you pass `{ recursive: ..., force: ..., errorOnExist: ..., mode: ... }'
     /// The other options like `filter` use a JS fallback, see `src/js/internal/fs/cp.ts`
     pub fn cp(&mut self, args: &args::Cp, _: Flavor) -> Maybe<ret::Cp> {
+        stat_cache::invalidate_all();
         let mut src_buf = OSPathBuffer::uninit();
         let mut dest_buf = OSPathBuffer::uninit();
         let name_too_long = |path: &PathLike| sys::Error {
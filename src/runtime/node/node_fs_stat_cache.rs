@@ -0,0 +1,111 @@
+//! Opt-in process-wide cache for path-based `stat`/`lstat` results
+//! (`BUN_FS_STAT_CACHE_TTL_MS=<milliseconds>`).
+//!
+//! Services that poll the same few paths (health checks re-reading a config
+//! file, per-request existence guards) pay a full syscall for every call even
+//! though the answer almost never changes. With the TTL set, path-keyed
+//! `stat`/`lstat` results — including ENOENT, which dominates `node_modules`
+//! probing — are served from memory until they expire.
+//!
+//! The contract is explicitly "stale up to the TTL": metadata changes made
+//! through file descriptors, by other processes, or by APIs that bypass
+//! node:fs path ops are not observed until the entry expires. Path-mutating
+//! node:fs ops drop the whole cache (see [`invalidate_all`]), so the common
+//! write-then-stat sequence within one process stays coherent. Entries are
+//! keyed by the raw path bytes passed in — no normalization — so the same
+//! file reached via different spellings occupies separate entries.
+
+use std::sync::LazyLock;
+
+use bun_collections::HashMap;
+use bun_core::{Timespec, TimespecMockMode};
+use bun_sys::PosixStat;
+use bun_threading::Guarded;
+
+/// Whole-map reset threshold. The target workload touches a handful of hot
+/// paths; pinning memory for an unbounded path set is never worth it.
+const MAX_ENTRIES: usize = 4096;
+
+const STAT_SEED: u64 = 59;
+const LSTAT_SEED: u64 = 61;
+
+pub enum Cached {
+    Stat(PosixStat),
+    /// The path recently resolved to ENOENT.
+    NoEnt,
+}
+
+struct Entry {
+    /// Verified on lookup so a 64-bit hash collision degrades to a miss.
+    path: Box<[u8]>,
+    /// `None` caches ENOENT.
+    stat: Option<PosixStat>,
+    expires_ns: u64,
+}
+
+static INSTANCE: LazyLock<Guarded<HashMap<u64, Entry>>> =
+    LazyLock::new(|| Guarded::init(HashMap::new()));
+
+#[inline]
+pub fn enabled() -> bool {
+    bun_core::env_var::BUN_FS_STAT_CACHE_TTL_MS::get() > 0
+}
+
+#[inline]
+fn key(path: &[u8], lstat: bool) -> u64 {
+    bun_wyhash::hash_with_seed(if lstat { LSTAT_SEED } else { STAT_SEED }, path)
+}
+
+#[inline]
+fn now_ns() -> u64 {
+    // Real time: a fake-timers test advancing the mock clock must not expire
+    // (or resurrect) fs cache entries.
+    Timespec::now(TimespecMockMode::ForceRealTime).ns()
+}
+
+/// An unexpired entry for `path`, or `None`. Callers gate on [`enabled`]
+/// first so disabled runs never initialize or lock the map.
+pub fn get(path: &[u8], lstat: bool) -> Option<Cached> {
+    let guard = INSTANCE.lock();
+    let entry = guard.get(&key(path, lstat))?;
+    if *entry.path != *path || entry.expires_ns < now_ns() {
+        return None;
+    }
+    Some(match entry.stat {
+        Some(stat) => Cached::Stat(stat),
+        None => Cached::NoEnt,
+    })
+}
+
+/// Record a fresh result (`None` = ENOENT). No-op when the cache is disabled.
+pub fn put(path: &[u8], lstat: bool, stat: Option<&PosixStat>) {
+    let ttl_ms = bun_core::env_var::BUN_FS_STAT_CACHE_TTL_MS::get();
+    if ttl_ms == 0 {
+        return;
+    }
+    let mut guard = INSTANCE.lock();
+    if guard.len() >= MAX_ENTRIES {
+        *guard = HashMap::new();
+    }
+    bun_core::handle_oom(guard.put(
+        key(path, lstat),
+        Entry {
+            path: Box::from(path),
+            stat: stat.copied(),
+            expires_ns: now_ns().saturating_add(ttl_ms.saturating_mul(1_000_000)),
+        },
+    ));
+}
+
+/// Drop everything. Called at the top of every path-mutating node:fs op so
+/// in-process write-then-stat sequences observe their own effects.
+#[inline]
+pub fn invalidate_all() {
+    if !enabled() {
+        return;
+    }
+    let mut guard = INSTANCE.lock();
+    if guard.len() > 0 {
+        *guard = HashMap::new();
+    }
+}
@@ -1,7 +1,5 @@
 use core::cell::Cell;
 use core::ffi::c_void;
-#[cfg(not(windows))]
-use core::mem::MaybeUninit;
 use core::sync::atomic::{AtomicU32, Ordering};
 
 use bun_core::Output;
@@ -137,9 +135,13 @@ pub struct FSWatchTaskPosix {
     /// embedded as `current_task` before the boxed `FSWatcher` address is
     /// known); patched to `Some` immediately after.
     ctx: Option<bun_ptr::ParentRef<FSWatcher>>,
-    count: u8,
 
-    entries: [MaybeUninit<Entry>; 8],
+    /// Events accumulated since the last backend flush. The whole batch ships
+    /// to the JS thread as one task per kernel read (the reader threads call
+    /// `on_update_end` once per batch), so an event storm costs one loop
+    /// wakeup instead of one per handful of events. Bounded by a single
+    /// backend read (≤ one 64 KiB inotify buffer).
+    entries: Vec<Event>,
     concurrent_task: ConcurrentTask,
 }
 
@@ -148,12 +150,6 @@ impl Taskable for FSWatchTaskPosix {
     const TAG: TaskTag = task_tag::FSWatchTask;
 }
 
-#[cfg(not(windows))]
-pub struct Entry {
-    event: Event,
-    needs_free: bool,
-}
-
 #[cfg(not(windows))]
 impl FSWatchTaskPosix {
     pub fn new(init: Self) -> Box<Self> {
@@ -168,29 +164,15 @@ impl FSWatchTaskPosix {
         self.ctx.as_ref().expect("FSWatchTask.ctx unset").get()
     }
 
-    pub fn append(&mut self, event: Event, needs_free: bool) {
-        if self.count == 8 {
-            self.enqueue();
-            let ctx = self.ctx;
-            *self = Self {
-                ctx,
-                count: 0,
-                entries: [const { MaybeUninit::uninit() }; 8],
-                concurrent_task: ConcurrentTask::default(),
-            };
-        }
-
-        self.entries[self.count as usize].write(Entry { event, needs_free });
-        self.count += 1;
+    pub fn append(&mut self, event: Event) {
+        self.entries.push(event);
     }
 
     pub fn run(&mut self) {
         // this runs on JS Context Thread
 
-        for i in 0..self.count as usize {
-            // SAFETY: entries [0..count) were written by `append`.
-            let entry = unsafe { self.entries[i].assume_init_ref() };
-            match &entry.event {
+        for event in &self.entries {
+            match event {
                 Event::Rename(file_path) => self.ctx().emit::<{ EventType::Rename }>(file_path),
                 Event::Change(file_path) => self.ctx().emit::<{ EventType::Change }>(file_path),
                 Event::Error(err) => self.ctx().emit_error(err),
@@ -204,28 +186,23 @@ impl FSWatchTaskPosix {
     }
 
     pub fn append_abort(&mut self) {
-        self.append(Event::Abort, false);
+        self.append(Event::Abort);
         self.enqueue();
     }
 
     pub fn enqueue(&mut self) {
-        if self.count == 0 {
+        if self.entries.is_empty() {
             return;
         }
 
         // if false is closed or detached (can still contain valid refs but will not create a new one)
         if self.ctx().ref_task() {
-            // Reshaped for borrowck — clone self into a heap task, then reset.
+            // Reshaped for borrowck — move the batch into a heap task, then reset.
             let that = bun_core::heap::into_raw(Box::new(FSWatchTaskPosix {
                 ctx: self.ctx,
-                count: self.count,
-                entries: core::mem::replace(
-                    &mut self.entries,
-                    [const { MaybeUninit::uninit() }; 8],
-                ),
+                entries: core::mem::take(&mut self.entries),
                 concurrent_task: ConcurrentTask::default(),
             }));
-            self.count = 0;
             // SAFETY: `that` is a freshly-boxed task; the concurrent queue takes
             // ownership of the `ConcurrentTask` node (and transitively the box)
             // until the JS thread drains and `heap::take`s it in `dispatch`.
@@ -243,16 +220,8 @@ impl FSWatchTaskPosix {
     }
 
     pub fn clean_entries(&mut self) {
-        for i in 0..self.count as usize {
-            // SAFETY: entries [0..count) were written by `append`.
-            let needs_free = unsafe { self.entries[i].assume_init_ref() }.needs_free;
-            if needs_free {
-                // SAFETY: entries [0..count) were written by `append`; dropped at most once
-                // (count is reset to 0 below).
-                unsafe { self.entries[i].assume_init_drop() };
-            }
-        }
-        self.count = 0;
+        // `Event`'s payload-carrying arms own their bytes; dropping frees them.
+        self.entries.clear();
     }
 }
 
@@ -534,7 +503,7 @@ impl FSWatcher {
 
         #[cfg(not(windows))]
         {
-            this.current_task.with_mut(|t| t.append(event, true));
+            this.current_task.with_mut(|t| t.append(event));
         }
         #[cfg(windows)]
         let _ = (event, is_file);
@@ -1187,8 +1156,7 @@ impl Default for FSWatchTaskPosix {
     fn default() -> Self {
         Self {
             ctx: None,
-            count: 0,
-            entries: [const { MaybeUninit::uninit() }; 8],
+            entries: Vec::new(),
             concurrent_task: ConcurrentTask::default(),
         }
     }
@@ -1,5 +1,6 @@
 use core::ffi::{c_char, c_int};
 use core::mem;
+use std::sync::Arc;
 
 use bun_zlib as c; // bun.zlib — C zlib FFI (NodeMode, z_stream, ReturnCode, FlushValue, deflate*, inflate*)
 
@@ -273,10 +274,14 @@ pub use _impl::NativeZlib;
 
 pub struct Context {
     pub mode: c::NodeMode,
-    pub state: c::z_stream,
+    // Boxed: zlib-ng's inflate/deflate state keeps a back-pointer to the
+    // z_stream (checked in inflateStateCheck), so an initialized stream must
+    // not move — and boxing is what lets one travel through the thread-local
+    // pool below.
+    pub state: Box<c::z_stream>,
     pub err: c::ReturnCode,
     pub flush: c::FlushValue,
-    pub dictionary: Vec<u8>,
+    pub dictionary: Option<Arc<[u8]>>,
     pub gzip_id_bytes_read: u8,
 }
 
@@ -284,22 +289,103 @@ impl Default for Context {
     fn default() -> Self {
         Self {
             mode: c::NodeMode::NONE,
-            state: bun_core::ffi::zeroed::<c::z_stream>(),
+            state: Box::new(bun_core::ffi::zeroed::<c::z_stream>()),
             err: c::ReturnCode::Ok,
             flush: c::FlushValue::NoFlush,
-            dictionary: Vec::new(),
+            dictionary: None,
             gzip_id_bytes_read: 0,
         }
     }
 }
 
+/// How many initialized inflate streams each JS thread keeps for reuse. An
+/// inflate state holds ~44 KB of window/table allocations, so the cap bounds
+/// idle memory at a couple hundred KB per thread.
+const INFLATE_POOL_CAP: usize = 4;
+
+struct InflatePool(core::cell::RefCell<Vec<Box<c::z_stream>>>);
+
+impl Drop for InflatePool {
+    fn drop(&mut self) {
+        for mut state in self.0.get_mut().drain(..) {
+            // SAFETY: FFI — every pooled state is an initialized inflate stream.
+            unsafe { c::inflateEnd(&raw mut *state) };
+        }
+    }
+}
+
+thread_local! {
+    // Decompress-per-message workloads construct thousands of short-lived
+    // Gunzip handles per second, and `inflateInit2_`'s window/table
+    // allocations dominate that churn. Streams are reclaimed in
+    // `Context::close` and re-targeted with `inflateReset2` in
+    // `Context::init`; both run on the JS thread, so the pool never crosses
+    // threads. Deflate streams are not pooled: windowBits/memLevel are fixed
+    // at `deflateInit2_` and cannot be re-applied to a reused state.
+    static INFLATE_POOL: InflatePool = InflatePool(core::cell::RefCell::new(Vec::new()));
+}
+
+fn take_pooled_inflate() -> Option<Box<c::z_stream>> {
+    INFLATE_POOL.with(|pool| pool.0.borrow_mut().pop())
+}
+
+/// Reclaims a finished inflate stream for the pool, or frees it when the pool
+/// is full or the stream fails to reset (e.g. a handle closed before `init`
+/// ever ran, whose z_stream is still zeroed).
+fn return_pooled_inflate(mut state: Box<c::z_stream>) -> c::ReturnCode {
+    // SAFETY: FFI — `state` either went through inflateInit2_ (reset succeeds,
+    // discarding any pending output) or is still zeroed (reset reports
+    // StreamError and the stream is freed below instead of pooled).
+    if unsafe { c::inflateReset(&raw mut *state) } == c::ReturnCode::Ok {
+        let overflow = INFLATE_POOL.with(|pool| {
+            let mut entries = pool.0.borrow_mut();
+            if entries.len() < INFLATE_POOL_CAP {
+                entries.push(state);
+                None
+            } else {
+                Some(state)
+            }
+        });
+        match overflow {
+            None => return c::ReturnCode::Ok,
+            Some(overflow) => state = overflow,
+        }
+    }
+    // SAFETY: FFI — frees the stream the pool did not take (inflateEnd on a
+    // zeroed z_stream is a no-op returning StreamError).
+    unsafe { c::inflateEnd(&raw mut *state) }
+}
+
+thread_local! {
+    // Preset-dictionary users pass the same bytes to every stream they
+    // construct; remember the last dictionary seen per thread so repeat
+    // `init` calls share one allocation instead of copying per instance.
+    static LAST_DICTIONARY: core::cell::RefCell<Option<(u64, Arc<[u8]>)>> =
+        const { core::cell::RefCell::new(None) };
+}
+
+fn intern_dictionary(bytes: &[u8]) -> Arc<[u8]> {
+    let hash = bun_wyhash::hash(bytes);
+    LAST_DICTIONARY.with(|cached| {
+        let mut cached = cached.borrow_mut();
+        if let Some((cached_hash, dict)) = &*cached {
+            if *cached_hash == hash && bun_core::strings::eql(&dict[..], bytes) {
+                return dict.clone();
+            }
+        }
+        let dict: Arc<[u8]> = Arc::from(bytes);
+        *cached = Some((hash, dict.clone()));
+        dict
+    })
+}
+
 impl Context {
     const GZIP_HEADER_ID1: u8 = 0x1f;
     const GZIP_HEADER_ID2: u8 = 0x8b;
 
     #[inline]
     fn dictionary(&self) -> &[u8] {
-        &self.dictionary
+        self.dictionary.as_deref().unwrap_or(&[])
     }
 
     pub fn init(
@@ -324,17 +410,14 @@ impl Context {
             ZSTD_COMPRESS | ZSTD_DECOMPRESS => unreachable!(),
         };
 
-        self.dictionary = match dictionary {
-            Some(d) => d.to_vec(),
-            None => Vec::new(),
-        };
+        self.dictionary = dictionary.map(intern_dictionary);
 
         match self.mode {
             NONE => unreachable!(),
             // SAFETY: FFI — `state` is a valid #[repr(C)] z_stream; zlibVersion() returns a static C string.
             DEFLATE | GZIP | DEFLATERAW => unsafe {
                 self.err = c::deflateInit2_(
-                    &raw mut self.state,
+                    &raw mut *self.state,
                     level,
                     8,
                     window_bits_actual,
@@ -344,14 +427,30 @@ impl Context {
                     c_int::try_from(mem::size_of::<c::z_stream>()).expect("int cast"),
                 );
             },
-            // SAFETY: FFI — `state` is a valid #[repr(C)] z_stream; zlibVersion() returns a static C string.
-            INFLATE | GUNZIP | UNZIP | INFLATERAW => unsafe {
-                self.err = c::inflateInit2_(
-                    &raw mut self.state,
-                    window_bits_actual,
-                    c::zlibVersion().cast(),
-                    c_int::try_from(mem::size_of::<c::z_stream>()).expect("int cast"),
-                );
+            INFLATE | GUNZIP | UNZIP | INFLATERAW => match take_pooled_inflate() {
+                Some(mut pooled) => {
+                    // SAFETY: FFI — the pooled state was initialized by
+                    // inflateInit2_; inflateReset2 re-targets it to the new
+                    // windowBits while keeping its internal allocations.
+                    self.err = unsafe { c::inflateReset2(&raw mut *pooled, window_bits_actual) };
+                    if self.err == c::ReturnCode::Ok {
+                        self.state = pooled;
+                    } else {
+                        // SAFETY: FFI — still an initialized inflate stream;
+                        // free it rather than re-pooling a stream that just
+                        // rejected the requested windowBits.
+                        unsafe { c::inflateEnd(&raw mut *pooled) };
+                    }
+                }
+                // SAFETY: FFI — `state` is a valid #[repr(C)] z_stream; zlibVersion() returns a static C string.
+                None => unsafe {
+                    self.err = c::inflateInit2_(
+                        &raw mut *self.state,
+                        window_bits_actual,
+                        c::zlibVersion().cast(),
+                        c_int::try_from(mem::size_of::<c::z_stream>()).expect("int cast"),
+                    );
+                },
             },
             BROTLI_DECODE | BROTLI_ENCODE => unreachable!(),
             ZSTD_COMPRESS | ZSTD_DECOMPRESS => unreachable!(),
@@ -379,11 +478,11 @@ impl Context {
         match self.mode {
             // SAFETY: FFI — state is an initialized deflate stream; dict_ptr/dict_len borrow the Context-owned dictionary copy.
             DEFLATE | DEFLATERAW => unsafe {
-                self.err = c::deflateSetDictionary(&raw mut self.state, dict_ptr, dict_len);
+                self.err = c::deflateSetDictionary(&raw mut *self.state, dict_ptr, dict_len);
             },
             // SAFETY: FFI — state is an initialized inflate stream; dict_ptr/dict_len borrow the Context-owned dictionary copy.
             INFLATERAW => unsafe {
-                self.err = c::inflateSetDictionary(&raw mut self.state, dict_ptr, dict_len);
+                self.err = c::inflateSetDictionary(&raw mut *self.state, dict_ptr, dict_len);
             },
             _ => {}
         }
@@ -399,7 +498,7 @@ impl Context {
         match self.mode {
             // SAFETY: FFI — state is an initialized deflate stream.
             DEFLATE | DEFLATERAW => unsafe {
-                self.err = c::deflateParams(&raw mut self.state, level, strategy);
+                self.err = c::deflateParams(&raw mut *self.state, level, strategy);
             },
             _ => {}
         }
@@ -438,11 +537,11 @@ impl Context {
         match self.mode {
             // SAFETY: FFI — state was initialized as a deflate stream by deflateInit2_.
             DEFLATE | DEFLATERAW | GZIP => unsafe {
-                self.err = c::deflateReset(&raw mut self.state);
+                self.err = c::deflateReset(&raw mut *self.state);
             },
             // SAFETY: FFI — state was initialized as an inflate stream by inflateInit2_.
             INFLATE | INFLATERAW | GUNZIP => unsafe {
-                self.err = c::inflateReset(&raw mut self.state);
+                self.err = c::inflateReset(&raw mut *self.state);
             },
             _ => {}
         }
@@ -547,12 +646,12 @@ impl Context {
 
     fn do_work_deflate(&mut self) {
         // SAFETY: FFI — state is an initialized deflate stream.
-        self.err = unsafe { c::deflate(&raw mut self.state, self.flush) };
+        self.err = unsafe { c::deflate(&raw mut *self.state, self.flush) };
     }
 
     fn do_work_inflate(&mut self) {
         // SAFETY: FFI — state is an initialized inflate stream.
-        self.err = unsafe { c::inflate(&raw mut self.state, self.flush) };
+        self.err = unsafe { c::inflate(&raw mut *self.state, self.flush) };
 
         if self.mode != c::NodeMode::INFLATERAW
             && self.err == c::ReturnCode::NeedDict
@@ -565,11 +664,11 @@ impl Context {
                 (dict.as_ptr(), u32::try_from(dict.len()).expect("int cast"))
             };
             // SAFETY: FFI — state is an initialized inflate stream; dict is the Context-owned copy.
-            self.err = unsafe { c::inflateSetDictionary(&raw mut self.state, dict_ptr, dict_len) };
+            self.err = unsafe { c::inflateSetDictionary(&raw mut *self.state, dict_ptr, dict_len) };
 
             if self.err == c::ReturnCode::Ok {
                 // SAFETY: FFI — state is an initialized inflate stream.
-                self.err = unsafe { c::inflate(&raw mut self.state, self.flush) };
+                self.err = unsafe { c::inflate(&raw mut *self.state, self.flush) };
             } else if self.err == c::ReturnCode::DataError {
                 self.err = c::ReturnCode::NeedDict;
             }
@@ -584,7 +683,7 @@ impl Context {
             // Trailing zero bytes are okay, though, since they are frequently used for padding.
             let _ = self.reset();
             // SAFETY: FFI — state was just re-initialized by reset().
-            self.err = unsafe { c::inflate(&raw mut self.state, self.flush) };
+            self.err = unsafe { c::inflate(&raw mut *self.state, self.flush) };
         }
     }
 
@@ -621,12 +720,15 @@ impl Context {
         match self.mode {
             // SAFETY: FFI — state was initialized as a deflate stream by deflateInit2_.
             DEFLATE | DEFLATERAW | GZIP => unsafe {
-                status = c::deflateEnd(&raw mut self.state);
-            },
-            // SAFETY: FFI — state was initialized as an inflate stream by inflateInit2_.
-            INFLATE | INFLATERAW | GUNZIP | UNZIP => unsafe {
-                status = c::inflateEnd(&raw mut self.state);
+                status = c::deflateEnd(&raw mut *self.state);
             },
+            INFLATE | INFLATERAW | GUNZIP | UNZIP => {
+                let state = mem::replace(
+                    &mut self.state,
+                    Box::new(bun_core::ffi::zeroed::<c::z_stream>()),
+                );
+                status = return_pooled_inflate(state);
+            }
             NONE => {}
             BROTLI_ENCODE | BROTLI_DECODE => {}
             ZSTD_COMPRESS | ZSTD_DECOMPRESS => {}
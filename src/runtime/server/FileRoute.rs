@@ -40,6 +40,7 @@ pub struct FileRoute {
     // `take()/set()` gives safe read-modify-write on the single-threaded JS
     // event loop.
     stat_hash: Cell<StatHash>,
+    has_etag_header: bool,
     has_last_modified_header: bool,
     has_content_length_header: bool,
     has_content_range_header: bool,
@@ -120,6 +121,7 @@ impl FileRoute {
         bun_core::heap::into_raw(Box::new(FileRoute {
             ref_count: Cell::new(1),
             server: Cell::new(opts.server),
+            has_etag_header: headers.get(b"etag").is_some(),
             has_last_modified_header: headers.get(b"last-modified").is_some(),
             has_content_length_header: headers.get(b"content-length").is_some(),
             has_content_range_header: headers.get(b"content-range").is_some(),
@@ -150,22 +152,6 @@ impl FileRoute {
             body_value.to_blob_if_possible();
             let needs_read = matches!(body_value, BodyValue::Blob(b) if b.needs_to_read_file());
             if needs_read {
-                // `needs_to_read_file()` ⇒ `store` is Some and `data` is `File`.
-                let is_fd = matches!(
-                    body_value,
-                    BodyValue::Blob(b)
-                        if matches!(
-                            b.store.get().as_ref().unwrap().data,
-                            StoreData::File(ref f)
-                                if matches!(f.pathlike, PathOrFileDescriptor::Fd(_))
-                        )
-                );
-                if is_fd {
-                    return Err(global.throw_todo(
-                        b"Support serving files from a file descriptor. Please pass a path instead.",
-                    ));
-                }
-
                 let blob = body_value.use_();
 
                 blob.global_this.set(std::ptr::from_ref(global));
@@ -180,6 +166,7 @@ impl FileRoute {
                 return Ok(Some(bun_core::heap::into_raw(Box::new(FileRoute {
                     ref_count: Cell::new(1),
                     server: Cell::new(None),
+                    has_etag_header: headers.get(b"etag").is_some(),
                     has_last_modified_header: headers.get(b"last-modified").is_some(),
                     has_content_length_header: headers.get(b"content-length").is_some(),
                     has_content_range_header: headers.get(b"content-range").is_some(),
@@ -206,6 +193,7 @@ impl FileRoute {
                     headers,
                     blob: b,
                     has_content_length_header: false,
+                    has_etag_header: false,
                     has_last_modified_header: false,
                     has_content_range_header: false,
                     has_date_header: false,
@@ -258,12 +246,19 @@ impl FileRoute {
             }
         }
 
-        if !self.has_last_modified_header {
+        if !self.has_last_modified_header || !self.has_etag_header {
             // `Cell::take` then restore — `write_header` is a sync uWS buffer
             // copy, no re-entry into `stat_hash` between take/set.
             let sh = self.stat_hash.take();
-            if let Some(last_modified) = sh.last_modified() {
-                resp.write_header(b"last-modified", last_modified);
+            if !self.has_last_modified_header {
+                if let Some(last_modified) = sh.last_modified() {
+                    resp.write_header(b"last-modified", last_modified);
+                }
+            }
+            if !self.has_etag_header {
+                if let Some(etag) = sh.etag() {
+                    resp.write_header(b"etag", etag);
+                }
             }
             self.stat_hash.set(sh);
         }
@@ -334,30 +329,44 @@ impl FileRoute {
             resp.timeout(server.config().idle_timeout);
         }
         let store = this.blob.store().unwrap().clone();
-        let Some(path) = store.get_path() else {
+        let StoreData::File(file) = &store.data else {
             req.set_yield(true);
             Self::on_response_complete(this_ptr, resp);
             return;
         };
 
-        let open_flags = bun_sys::O::RDONLY | bun_sys::O::CLOEXEC | bun_sys::O::NONBLOCK;
-
-        let fd_result: bun_sys::Result<Fd> = {
-            #[cfg(windows)]
-            {
-                let mut path_buffer = bun_paths::PathBuffer::uninit();
-                path_buffer[..path.len()].copy_from_slice(path);
-                path_buffer[path.len()] = 0;
-                bun_sys::open(
-                    // SAFETY: path_buffer[path.len()] == 0 written above
-                    bun_core::ZStr::from_buf(&path_buffer[..], path.len()),
-                    open_flags,
-                    0,
-                )
-            }
-            #[cfg(not(windows))]
-            {
-                bun_sys::open_a(path, open_flags, 0)
+        // Fd-backed blobs (`Bun.file(fd)`) stream the stored descriptor
+        // directly — the store keeps it open across requests, so neither this
+        // function nor FileResponseStream may close it. Reads go through
+        // pread/sendfile with explicit offsets, so concurrent requests sharing
+        // the fd never race a file position.
+        let route_fd: Option<Fd> = match &file.pathlike {
+            PathOrFileDescriptor::Fd(fd) => Some(*fd),
+            PathOrFileDescriptor::Path(_) => None,
+        };
+        let auto_close = route_fd.is_none();
+
+        let fd_result: bun_sys::Result<Fd> = match route_fd {
+            Some(fd) => Ok(fd),
+            None => {
+                let path = store.get_path().expect("Path arm carries a path");
+                let open_flags = bun_sys::O::RDONLY | bun_sys::O::CLOEXEC | bun_sys::O::NONBLOCK;
+                #[cfg(windows)]
+                {
+                    let mut path_buffer = bun_paths::PathBuffer::uninit();
+                    path_buffer[..path.len()].copy_from_slice(path);
+                    path_buffer[path.len()] = 0;
+                    bun_sys::open(
+                        // SAFETY: path_buffer[path.len()] == 0 written above
+                        bun_core::ZStr::from_buf(&path_buffer[..], path.len()),
+                        open_flags,
+                        0,
+                    )
+                }
+                #[cfg(not(windows))]
+                {
+                    bun_sys::open_a(path, open_flags, 0)
+                }
             }
         };
 
@@ -377,10 +386,12 @@ impl FileRoute {
         // before handing ownership to `FileResponseStream`.
         let mut fd_guard = scopeguard::guard(true, move |owned| {
             if owned {
-                #[cfg(windows)]
-                Closer::close(fd, bun_sys::windows::libuv::Loop::get());
-                #[cfg(not(windows))]
-                Closer::close(fd, ());
+                if auto_close {
+                    #[cfg(windows)]
+                    Closer::close(fd, bun_sys::windows::libuv::Loop::get());
+                    #[cfg(not(windows))]
+                    Closer::close(fd, ());
+                }
                 // SAFETY: this_ptr is valid; ref taken above keeps FileRoute alive until on_response_complete
                 Self::on_response_complete(this_ptr, resp);
             }
@@ -414,7 +425,7 @@ impl FileRoute {
             // `Cell::take` → mutate → `set`: single-threaded event loop, no
             // re-entry reads `stat_hash` between take/set.
             let mut sh = this.stat_hash.take();
-            sh.hash(&stat, path);
+            sh.hash(&stat, store.get_path().unwrap_or_default());
             this.stat_hash.set(sh);
 
             if bun_sys::S::ISFIFO(mode) || bun_sys::S::ISCHR(mode) {
@@ -433,6 +444,21 @@ impl FileRoute {
             return;
         }
 
+        // Stat-derived strong ETag, fresh because `hash()` ran above. Stands
+        // in as the current representation's validator whenever the route has
+        // no user-supplied `etag` header, so conditional requests get answered
+        // here without ever reaching JS.
+        let (stat_etag_buf, stat_etag_len) = if this.has_etag_header {
+            ([0u8; 18], 0u8)
+        } else {
+            let sh = this.stat_hash.take();
+            let copied = (sh.etag_buffer, sh.etag_buffer_len);
+            this.stat_hash.set(sh);
+            copied
+        };
+        let stat_etag: Option<&[u8]> =
+            (stat_etag_len > 0).then(|| &stat_etag_buf[..usize::from(stat_etag_len)]);
+
         // Range applies to the slice the route was configured with, not the
         // underlying file: a Bun.file(p).slice(a,b) route exposes only [a,b).
         // RFC 9110 §14.2: Range is only defined for GET (HEAD mirrors GET's
@@ -456,7 +482,11 @@ impl FileRoute {
             if (method == Method::HEAD || method == Method::GET) && this.status_code == 200 {
                 // Step 1: If-Match (strong comparison).
                 if let Some(im) = req.header(b"if-match").filter(|v| !v.is_empty()) {
-                    let etag = this.headers.get(b"etag").filter(|v| !v.is_empty());
+                    let etag = this
+                        .headers
+                        .get(b"etag")
+                        .filter(|v| !v.is_empty())
+                        .or(stat_etag);
                     if !ETag::if_match(etag, im) {
                         break 'brk 412;
                     }
@@ -479,7 +509,12 @@ impl FileRoute {
             if method == Method::HEAD || method == Method::GET {
                 if let Some(inm) = req.header(b"if-none-match").filter(|v| !v.is_empty()) {
                     if this.status_code == 200 {
-                        let matched = match this.headers.get(b"etag").filter(|v| !v.is_empty()) {
+                        let matched = match this
+                            .headers
+                            .get(b"etag")
+                            .filter(|v| !v.is_empty())
+                            .or(stat_etag)
+                        {
                             Some(etag) => ETag::if_none_match(etag, inm),
                             // No stored ETag: only `*` can match (RFC 9110
                             // §13.1.2 — any current representation).
@@ -588,7 +623,7 @@ impl FileRoute {
         *fd_guard = false;
         FileResponseStream::start(&FileResponseStreamOptions {
             fd,
-            auto_close: true,
+            auto_close,
             resp,
             vm: bun_ptr::BackRef::new(this.server.get().unwrap().vm()),
             file_type,
@@ -165,6 +165,10 @@ pub struct RequestContext<
     /// When the response body is a temporary value
     pub response_buf_owned: Vec<u8>,
 
+    /// Monotonic ns when the current backpressure episode began (see
+    /// `ServerMetrics`); 0 while no episode is open.
+    pub backpressure_start_ns: u64,
+
     /// Defer finalization until after the request handler task is completed?
     ///
     /// BORROW_PARAM: points at a `Cell<bool>` on the dispatching frame's
@@ -1103,8 +1107,8 @@ where
             return;
         }
 
-        self.flags.set_has_marked_pending(true);
         self.response_buf_owned = bb;
+        self.note_backpressure(self.response_buf_owned.len());
 
         if let Some(resp) = self.resp {
             // SAFETY: FFI handle
@@ -1229,6 +1233,26 @@ where
         }
     }
 
+    /// Mark the response as pending on socket backpressure and open a
+    /// `ServerMetrics` episode; `buffered` is the byte count still queued.
+    /// Only the genuine backpressure paths (a failed `try_end`/`write`) route
+    /// through here — the other `set_has_marked_pending` sites mark in-flight
+    /// bodies, not a congested socket.
+    #[inline]
+    fn note_backpressure(&mut self, buffered: usize) {
+        self.flags.set_has_marked_pending(true);
+        self.backpressure_start_ns = self.server().metrics().on_backpressure(buffered);
+    }
+
+    /// Record the drain wake for the episode opened by
+    /// [`Self::note_backpressure`]. Taking the timestamp makes repeated
+    /// `on_writable` invocations for one episode count once.
+    #[inline]
+    fn note_drained(&mut self) {
+        let started_ns = core::mem::replace(&mut self.backpressure_start_ns, 0);
+        self.server().metrics().on_drain(started_ns);
+    }
+
     /// # Safety
     /// `this` must be the live `RequestContext` user-data pointer registered with uWS.
     pub(crate) fn on_writable_response_buffer(
@@ -1244,6 +1268,7 @@ where
         if this.is_aborted_or_ended() {
             return false;
         }
+        this.note_drained();
         this.end(b"", this.should_close_connection());
         false
     }
@@ -1263,6 +1288,7 @@ where
         if this.is_aborted_or_ended() {
             return false;
         }
+        this.note_drained();
         this.send_writable_bytes_for_complete_response_buffer(write_offset, resp)
     }
 
@@ -1328,6 +1354,7 @@ where
                 response_body_readable_stream_ref: readable_stream::Strong::default(),
                 pathname: BunString::empty(),
                 response_buf_owned: Vec::new(),
+                backpressure_start_ns: 0,
                 additional_on_abort: None,
             });
         }
@@ -1613,6 +1640,7 @@ where
         if this.is_aborted_or_ended() {
             return false;
         }
+        this.note_drained();
 
         // Copy to stack memory to prevent aliasing issues in release builds
         // NOTE: AnyBlob is not Copy in Rust; reborrow through a raw ptr
@@ -1643,7 +1671,7 @@ where
             self.deref();
             true
         } else {
-            self.flags.set_has_marked_pending(true);
+            self.note_backpressure(bytes.len());
             // SAFETY: FFI handle
             resp.on_writable(
                 |this, off, resp| Self::on_writable_bytes(this, off, resp),
@@ -1677,7 +1705,7 @@ where
             self.end_request_streaming_and_drain();
             self.deref();
         } else {
-            self.flags.set_has_marked_pending(true);
+            self.note_backpressure(total_len.saturating_sub(write_offset));
             // SAFETY: FFI handle
             resp.on_writable(
                 |this, off, resp| Self::on_writable_complete_response_buffer(this, off, resp),
@@ -3293,7 +3321,7 @@ where
         } else {
             // when it's the last one, we just want to know if it's done
             if is_done {
-                this.flags.set_has_marked_pending(true);
+                this.note_backpressure(chunk.len());
                 // SAFETY: FFI handle
                 resp.on_writable(
                     |this, off, resp| Self::on_writable_response_buffer(this, off, resp),
@@ -3798,7 +3826,7 @@ where
         if let Some(resp) = self.resp {
             // SAFETY: FFI handle
             if !resp.try_end(bytes, bytes.len(), self.should_close_connection()) {
-                self.flags.set_has_marked_pending(true);
+                self.note_backpressure(bytes.len());
                 // SAFETY: FFI handle
                 resp.on_writable(
                     |this, off, resp| Self::on_writable_bytes(this, off, resp),
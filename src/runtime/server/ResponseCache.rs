@@ -0,0 +1,100 @@
+//! Pre-rendered response cache behind `server.cache(path, response, { ttlMs })`.
+//!
+//! Each entry is a [`StaticRoute`] — the same status + serialized header block
+//! + body snapshot static routes use — keyed by request path. A hit is served
+//! straight from `on_request` before a JS `Request` object or `RequestContext`
+//! exists, so the hot path costs one map lookup plus the corked
+//! `StaticRoute` write. Entries expire on a monotonic deadline and are
+//! re-validated lazily on lookup; `server.cache(path)` with no response
+//! invalidates eagerly.
+
+use std::collections::HashMap;
+
+use bun_core::{Timespec, TimespecMockMode};
+use bun_http::Method;
+use bun_uws::AnyResponse;
+
+use crate::server::StaticRoute;
+
+#[derive(Default)]
+pub struct ResponseCache {
+    entries: HashMap<Box<[u8]>, Entry>,
+}
+
+struct Entry {
+    /// Owns one intrusive ref; released in `Entry::drop`.
+    route: *mut StaticRoute,
+    /// Monotonic deadline; `None` = no TTL.
+    expires_at: Option<Timespec>,
+}
+
+impl Entry {
+    fn is_expired(&self) -> bool {
+        match &self.expires_at {
+            Some(deadline) => Timespec::now(TimespecMockMode::AllowMockedTime).greater(deadline),
+            None => false,
+        }
+    }
+}
+
+impl Drop for Entry {
+    fn drop(&mut self) {
+        // SAFETY: `route` carries the ref transferred in `ResponseCache::insert`.
+        unsafe { StaticRoute::deref_(self.route) };
+    }
+}
+
+impl ResponseCache {
+    /// Store `route`, transferring the caller's intrusive ref. A replaced
+    /// entry releases its ref via `Entry::drop`.
+    pub fn insert(&mut self, path: Box<[u8]>, route: *mut StaticRoute, ttl_ms: Option<u64>) {
+        self.entries.insert(
+            path,
+            Entry {
+                route,
+                expires_at: ttl_ms.map(|ms| {
+                    Timespec::ms_from_now(
+                        TimespecMockMode::AllowMockedTime,
+                        i64::try_from(ms).unwrap_or(i64::MAX),
+                    )
+                }),
+            },
+        );
+    }
+
+    /// Returns `true` when an entry existed (expired or not).
+    pub fn remove(&mut self, path: &[u8]) -> bool {
+        self.entries.remove(path).is_some()
+    }
+
+    /// Serve a cache hit for `path`, or return `false` to fall through to the
+    /// JS handler. Expired entries are removed here, so a stale path costs one
+    /// miss before JS repopulates it.
+    pub fn serve(&mut self, path: &[u8], method: Method, resp: AnyResponse) -> bool {
+        let Some(entry) = self.entries.get(path) else {
+            return false;
+        };
+        if entry.is_expired() {
+            self.entries.remove(path);
+            return false;
+        }
+        // SAFETY: `route` is live (the entry's ref is held across this call);
+        // `on_with_method` takes its own ref for the response lifetime.
+        unsafe { StaticRoute::on_with_method(entry.route, method, resp) };
+        true
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.entries.is_empty()
+    }
+
+    pub fn memory_cost(&self) -> usize {
+        self.entries
+            .iter()
+            .map(|(path, entry)| {
+                // SAFETY: `route` is live while the entry exists.
+                path.len() + unsafe { (*entry.route).memory_cost() }
+            })
+            .sum()
+    }
+}
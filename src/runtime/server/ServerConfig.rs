@@ -55,6 +55,10 @@ pub struct ServerConfig {
     pub websocket: Option<WebSocketServerContext>,
 
     pub reuse_port: bool,
+    /// Declared SO_REUSEPORT shard count from `reusePort: { workers: N }`.
+    /// Each shard is a Worker running `Bun.serve` with this same config; the
+    /// kernel distributes accepts across the N listen sockets. `1` = unsharded.
+    pub reuse_port_workers: u32,
     pub id: Box<[u8]>,
     pub allow_hot: bool,
     pub ipv6_only: bool,
@@ -88,6 +92,7 @@ impl Default for ServerConfig {
             on_node_http_request: JSValue::ZERO,
             websocket: None,
             reuse_port: false,
+            reuse_port_workers: 1,
             id: Box::default(),
             allow_hot: true,
             ipv6_only: false,
@@ -272,6 +277,7 @@ impl ServerConfig {
             on_node_http_request: self.on_node_http_request,
             websocket: self.websocket.take(),
             reuse_port: self.reuse_port,
+            reuse_port_workers: self.reuse_port_workers,
             id: core::mem::take(&mut self.id),
             allow_hot: self.allow_hot,
             ipv6_only: self.ipv6_only,
@@ -1272,8 +1278,35 @@ impl ServerConfig {
             }
         }
 
-        if let Some(dev) = arg.get(global, "reusePort")? {
-            args.reuse_port = dev.to_boolean();
+        if let Some(reuse_port) = arg.get(global, "reusePort")? {
+            if reuse_port.is_object() {
+                // `reusePort: { workers: N }` — SO_REUSEPORT listener sharding.
+                // One VM owns one event loop, so the N shards are Workers each
+                // running `Bun.serve` with this config; the object form enables
+                // SO_REUSEPORT everywhere and records the declared shard count.
+                args.reuse_port = true;
+                if let Some(workers) = reuse_port.get_truthy(global, "workers")? {
+                    if !workers.is_any_int() {
+                        return Err(global.throw_invalid_arguments(format_args!(
+                            "Bun.serve expects reusePort.workers to be an integer",
+                        )));
+                    }
+                    let n = workers.to_int64();
+                    if !(1..=1024).contains(&n) {
+                        return Err(global.throw_invalid_arguments(format_args!(
+                            "Bun.serve expects reusePort.workers to be between 1 and 1024",
+                        )));
+                    }
+                    args.reuse_port_workers = n as u32;
+                    if args.reuse_port_workers > 1 && vm.is_main_thread {
+                        return Err(global.throw_todo(
+                            b"Spawn reusePort.workers shards automatically. For now, start N Workers that each call Bun.serve() with this config; SO_REUSEPORT is already enabled for all of them.",
+                        ));
+                    }
+                }
+            } else {
+                args.reuse_port = reuse_port.to_boolean();
+            }
         }
         if global.has_exception() {
             return Err(JsError::Thrown);
@@ -1430,11 +1463,35 @@ impl ServerConfig {
             }
         }
 
+        // `quic: true` / `quic: { cert, key, ... }` — enable HTTP/3 alongside
+        // the TCP listener. The object form carries the QUIC certificate when
+        // `tls` was not given (QUIC always terminates TLS 1.3).
+        if let Some(quic) = arg.get_truthy(global, "quic")? {
+            args.http3 = true;
+            if quic.is_object() {
+                if let Some(ssl_config) = SSLConfig::from_js(vm, global, quic)? {
+                    if args.ssl_config.is_some() {
+                        drop(ssl_config);
+                        return Err(global.throw_invalid_arguments(format_args!(
+                            "Pass certificates in either 'tls' or 'quic', not both"
+                        )));
+                    }
+                    args.ssl_config = Some(ssl_config);
+                }
+                if global.has_exception() {
+                    return Err(JsError::Thrown);
+                }
+            }
+        }
+        if global.has_exception() {
+            return Err(JsError::Thrown);
+        }
+
         if args.http3 {
             if args.ssl_config.is_none() {
-                return Err(
-                    global.throw_invalid_arguments(format_args!("HTTP/3 requires 'tls' to be set"))
-                );
+                return Err(global.throw_invalid_arguments(format_args!(
+                    "HTTP/3 requires 'tls' or 'quic' to provide a certificate"
+                )));
             }
         } else if !args.http1 {
             return Err(global.throw_invalid_arguments(format_args!(
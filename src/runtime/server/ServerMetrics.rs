@@ -0,0 +1,114 @@
+//! `server.metrics()` — backpressure observability for `Bun.serve`.
+//!
+//! Counters are plain `Cell`s bumped on the paths that already detect
+//! backpressure (a failed `try_end`/`write` that parks an `on_writable`
+//! callback), so they are cheap enough to stay on in production. The two
+//! `node:perf_hooks`-style histograms are allocated by the first
+//! `metrics()` call and GC-rooted here; until then the per-sample record
+//! path is a single emptiness check.
+
+use core::cell::Cell;
+
+use bun_core::{Timespec, TimespecMockMode};
+
+use crate::server::jsc::{self, JSGlobalObject, JSValue, JsError, JsResult};
+
+unsafe extern "C" {
+    /// `JSNodePerformanceHooksHistogramConstructor.cpp` — native creation
+    /// path. Returns an empty value (with a pending exception) on failure.
+    safe fn JSNodePerformanceHooksHistogram_create(
+        global: &JSGlobalObject,
+        lowest: i64,
+        highest: i64,
+        figures: i32,
+    ) -> JSValue;
+    safe fn JSNodePerformanceHooksHistogram_recordDelay(histogram: JSValue, value: i64);
+}
+
+#[derive(Default)]
+pub struct ServerMetrics {
+    /// Response writes that could not complete synchronously and parked an
+    /// `on_writable` callback.
+    backpressure_events: Cell<u64>,
+    /// Backpressure episodes that have since seen their drain wake.
+    drain_events: Cell<u64>,
+    /// Sum of bytes still queued at the moment each episode began.
+    buffered_bytes_total: Cell<u64>,
+    /// Distribution of bytes queued when backpressure began.
+    buffered_bytes_histogram: jsc::JsCell<jsc::JsRef>,
+    /// Distribution of nanoseconds from backpressure to the drain callback.
+    drain_latency_histogram: jsc::JsCell<jsc::JsRef>,
+}
+
+impl ServerMetrics {
+    /// Note a write that hit backpressure with `buffered` bytes still queued.
+    /// Returns the episode's start timestamp, which the caller stashes and
+    /// hands back to [`Self::on_drain`] when the socket becomes writable.
+    pub fn on_backpressure(&self, buffered: usize) -> u64 {
+        self.backpressure_events
+            .set(self.backpressure_events.get().wrapping_add(1));
+        self.buffered_bytes_total
+            .set(self.buffered_bytes_total.get().wrapping_add(buffered as u64));
+        if let Some(histogram) = self.buffered_bytes_histogram.get().try_get() {
+            JSNodePerformanceHooksHistogram_recordDelay(histogram, buffered as i64);
+        }
+        Timespec::now(TimespecMockMode::ForceRealTime).ns()
+    }
+
+    /// Note the drain wake for the episode opened at `started_ns` (the value
+    /// returned by [`Self::on_backpressure`]; 0 means no episode is open, so
+    /// repeated `on_writable` invocations count once).
+    pub fn on_drain(&self, started_ns: u64) {
+        if started_ns == 0 {
+            return;
+        }
+        self.drain_events.set(self.drain_events.get().wrapping_add(1));
+        if let Some(histogram) = self.drain_latency_histogram.get().try_get() {
+            let elapsed = Timespec::now(TimespecMockMode::ForceRealTime)
+                .ns()
+                .saturating_sub(started_ns);
+            // i64::MAX ns is ~292 years; the cast cannot wrap in practice.
+            JSNodePerformanceHooksHistogram_recordDelay(histogram, elapsed as i64);
+        }
+    }
+
+    /// Build the `server.metrics()` snapshot. The first call allocates the
+    /// histograms (rooting them here), enabling distribution sampling for
+    /// the rest of the server's lifetime; counters are always live.
+    pub fn to_js(&self, global: &JSGlobalObject) -> JsResult<JSValue> {
+        let buffered_bytes = self.histogram(&self.buffered_bytes_histogram, global)?;
+        let drain_latency = self.histogram(&self.drain_latency_histogram, global)?;
+
+        let obj = JSValue::create_empty_object(global, 5);
+        obj.put(
+            global,
+            b"backpressureEvents",
+            JSValue::js_number(self.backpressure_events.get() as f64),
+        );
+        obj.put(
+            global,
+            b"drainEvents",
+            JSValue::js_number(self.drain_events.get() as f64),
+        );
+        obj.put(
+            global,
+            b"bufferedBytesTotal",
+            JSValue::js_number(self.buffered_bytes_total.get() as f64),
+        );
+        obj.put(global, b"bufferedBytes", buffered_bytes);
+        obj.put(global, b"drainLatency", drain_latency);
+        Ok(obj)
+    }
+
+    fn histogram(&self, slot: &jsc::JsCell<jsc::JsRef>, global: &JSGlobalObject) -> JsResult<JSValue> {
+        if let Some(histogram) = slot.get().try_get() {
+            return Ok(histogram);
+        }
+        let histogram = JSNodePerformanceHooksHistogram_create(global, 1, i64::MAX, 3);
+        if histogram.is_empty() || global.has_exception() {
+            return Err(JsError::Thrown);
+        }
+        slot.set(jsc::JsRef::init_strong(histogram, global));
+        Ok(histogram)
+    }
+}
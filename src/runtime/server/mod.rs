@@ -81,6 +81,14 @@ pub use file_route::FileRoute;
 pub mod file_response_stream;
 pub use file_response_stream::FileResponseStream;
 
+#[path = "ResponseCache.rs"]
+pub mod response_cache;
+pub use response_cache::ResponseCache;
+
+#[path = "ServerMetrics.rs"]
+pub mod server_metrics;
+pub use server_metrics::ServerMetrics;
+
 #[path = "HTMLBundle.rs"]
 pub mod html_bundle;
 pub use html_bundle::HTMLBundle;
@@ -300,6 +308,14 @@ pub struct NewServer<const SSL: bool, const DEBUG: bool> {
     /// `JSValue::ZERO` when unset; written by `server_set_on_connection_`.
     pub on_connection: JSValue,
 
+    /// `server.cache(path, response, { ttlMs })` entries, consulted in
+    /// `on_request` before the JS `fetch` handler is dispatched.
+    pub response_cache: ResponseCache,
+
+    /// Backpressure counters (always on) + lazily-allocated histograms,
+    /// surfaced through `server.metrics()`.
+    pub metrics: ServerMetrics,
+
     pub inspector_server_id: jsc::DebuggerId,
 }
 
@@ -463,6 +479,7 @@ impl<const SSL: bool, const DEBUG: bool> NewServer<SSL, DEBUG> {
         core::mem::size_of::<Self>()
             + self.base_url_string_for_joining.len()
             + self.config.memory_cost()
+            + self.response_cache.memory_cost()
             + self.dev_server.as_ref().map_or(0, |d| d.memory_cost())
     }
 
@@ -1067,6 +1084,24 @@ impl<const SSL: bool, const DEBUG: bool> NewServer<SSL, DEBUG> {
             server_body::respond_stopped_503(bun_opaque::opaque_deref_mut(resp));
             return;
         };
+
+        // `server.cache()` hit path: serve the pre-rendered snapshot without
+        // materializing a `Request`/`RequestContext` or entering JS.
+        // SAFETY: `this` is the live server backref for this request.
+        let server_mut = unsafe { &mut *this };
+        if !server_mut.response_cache.is_empty() {
+            if let Some(method @ (bun_http::Method::GET | bun_http::Method::HEAD)) =
+                bun_http::Method::find(req.method())
+            {
+                if server_mut
+                    .response_cache
+                    .serve(req.url(), method, any_response_from::<SSL>(resp))
+                {
+                    return;
+                }
+            }
+        }
+
         let should_deinit_context = core::cell::Cell::new(false);
         let Some(prepared) = Self::prepare_js_request_context(
             this,
@@ -2026,6 +2061,8 @@ impl<const SSL: bool, const DEBUG: bool> NewServer<SSL, DEBUG> {
             user_routes: Vec::new(),
             on_clienterror: JSValue::ZERO,
             on_connection: JSValue::ZERO,
+            response_cache: ResponseCache::default(),
+            metrics: ServerMetrics::default(),
             inspector_server_id: jsc::DebuggerId::init(0),
         }));
 
@@ -3360,6 +3397,7 @@ pub trait ServerLike {
     fn on_request_complete(&mut self);
     fn dev_server(&self) -> Option<&crate::bake::DevServer::DevServer>;
     fn js_value(&self) -> &jsc::JsRef;
+    fn metrics(&self) -> &ServerMetrics;
     fn h3_alt_svc(&self) -> Option<&[u8]>;
     fn terminated(&self) -> bool;
     /// Return `ctx` to the per-server HiveArray pool for the matching transport.
@@ -3405,6 +3443,10 @@ impl<const SSL: bool, const DEBUG: bool> ServerLike for NewServer<SSL, DEBUG> {
     fn js_value(&self) -> &jsc::JsRef {
         &self.js_value
     }
+    #[inline(always)]
+    fn metrics(&self) -> &ServerMetrics {
+        &self.metrics
+    }
     #[inline]
     fn h3_alt_svc(&self) -> Option<&[u8]> {
         Self::h3_alt_svc(self)
@@ -28,6 +28,10 @@ function generate(name) {
         fn: "doReload",
         length: 2,
       },
+      cache: {
+        fn: "doCache",
+        length: 3,
+      },
       "@@dispose": {
         fn: "dispose",
         length: 0,
@@ -36,6 +40,10 @@ function generate(name) {
         fn: "closeIdleConnections",
         length: 0,
       },
+      metrics: {
+        fn: "doMetrics",
+        length: 0,
+      },
       stop: {
         fn: "doStop",
         length: 1,
@@ -134,6 +142,10 @@ export default [
         fn: "write",
         length: 3,
       },
+      writev: {
+        fn: "writev",
+        length: 2,
+      },
       end: {
         fn: "end",
         length: 2,
@@ -1566,6 +1566,66 @@ where
         self.timeout(global, callframe)
     }
 
+    /// `server.cache(path, response, { ttlMs })` — store a pre-rendered
+    /// response snapshot served from `on_request` without entering JS.
+    /// `server.cache(path)` invalidates. Returns whether an entry was
+    /// stored/removed.
+    pub fn do_cache(
+        &mut self,
+        global: &JSGlobalObject,
+        callframe: &CallFrame,
+    ) -> JsResult<JSValue> {
+        let arguments = callframe.arguments();
+        if arguments.is_empty() || arguments[0].is_empty_or_undefined_or_null() {
+            return Err(global.throw_not_enough_arguments("cache", 1, arguments.len()));
+        }
+
+        let path_str = BunString::from_js(arguments[0], global)?;
+        let path = path_str.to_utf8_bytes();
+        if !path.starts_with(b"/") {
+            return Err(global.throw_invalid_arguments(format_args!(
+                "cache() expects a path starting with '/'"
+            )));
+        }
+
+        // No response (or an explicit null) invalidates the entry.
+        let response = arguments.get(1).copied().unwrap_or(JSValue::UNDEFINED);
+        if response.is_empty_or_undefined_or_null() {
+            return Ok(if self.response_cache.remove(&path) {
+                JSValue::TRUE
+            } else {
+                JSValue::FALSE
+            });
+        }
+
+        let mut ttl_ms: Option<u64> = None;
+        if let Some(options) = arguments.get(2).copied() {
+            if options.is_object() {
+                if let Some(ttl) = options.get_truthy(global, "ttlMs")? {
+                    if !ttl.is_number() {
+                        return Err(global.throw_invalid_arguments(format_args!(
+                            "cache() expects ttlMs to be a number"
+                        )));
+                    }
+                    ttl_ms = Some(u64::try_from(ttl.to_int64().max(0)).expect("int cast"));
+                }
+            }
+        }
+
+        let Some(route) = StaticRoute::from_js(global, response)? else {
+            return Err(global.throw_invalid_arguments(format_args!(
+                "cache() expects a Response with a fully buffered body"
+            )));
+        };
+        // SAFETY: `from_js` returned a fresh heap route (ref_count = 1); that
+        // ref is transferred to the cache entry. The server backref mirrors
+        // what `set_routes` does for static routes registered at listen time.
+        unsafe { (*route).server.set(Some(self.as_any_server())) };
+        self.response_cache
+            .insert(path.into_boxed_slice(), route, ttl_ms);
+        Ok(JSValue::TRUE)
+    }
+
     pub fn request_ip(&self, request: &Request) -> JsResult<JSValue> {
         if matches!(self.config.address, server_config::Address::Unix(_)) {
             return Ok(JSValue::NULL);
@@ -2535,6 +2595,18 @@ where
         Ok(JSValue::UNDEFINED)
     }
 
+    /// `server.metrics()` — backpressure counters + histograms (see
+    /// `ServerMetrics`). The first call allocates the histograms, turning on
+    /// distribution sampling for the rest of the server's lifetime.
+    #[bun_jsc::host_fn(method)]
+    pub fn do_metrics(
+        &mut self,
+        global: &JSGlobalObject,
+        _callframe: &CallFrame,
+    ) -> JsResult<JSValue> {
+        self.metrics.to_js(global)
+    }
+
     pub fn stop_from_js(&mut self, abruptly: Option<JSValue>) -> JSValue {
         let rc = self.get_all_closed_promise(&self.global());
 
@@ -107,6 +107,11 @@ export const SSLConfig = b.dictionary(
       default: 0,
       internalName: "session_timeout",
     },
+    sessionCacheSize: {
+      type: b.u32,
+      default: 0,
+      internalName: "session_cache_size",
+    },
     sigalgs: b.String.nullable,
   },
 );
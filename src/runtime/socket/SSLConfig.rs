@@ -177,6 +177,7 @@ impl SSLConfigFromJs for SSLConfig {
         result.ssl_min_version = generated.ssl_min_version;
         result.ssl_max_version = generated.ssl_max_version;
         result.session_timeout = generated.session_timeout;
+        result.session_cache_size = generated.session_cache_size;
         result.allow_partial_trust_chain = generated.allow_partial_trust_chain;
         if let Some(sigalgs) = generated.sigalgs.get() {
             result.sigalgs = zbox_into_raw(&sigalgs.to_owned_slice_z());
@@ -190,6 +191,7 @@ impl SSLConfigFromJs for SSLConfig {
             || result.ssl_min_version != 0
             || result.ssl_max_version != 0
             || result.session_timeout != 0
+            || result.session_cache_size != 0
             || result.allow_partial_trust_chain;
 
         result.ca = handle_file_for_field(global, "ca", &generated.ca)?;
@@ -206,6 +208,7 @@ impl SSLConfigFromJs for SSLConfig {
             || result.ssl_max_version != 0
             || !result.sigalgs.is_null()
             || result.session_timeout != 0
+            || result.session_cache_size != 0
             || result.allow_partial_trust_chain;
 
         if let Some(key_file) = generated.key_file.get() {
@@ -195,7 +195,8 @@ impl UpgradedDuplex {
         };
 
         if let Some(data) = data {
-            let buffer = match bun_jsc::array_buffer::BinaryType::Buffer.to_js(data, &global) {
+            let buffer = match bun_jsc::array_buffer::BinaryType::Buffer.to_js_pooled(data, &global)
+            {
                 Ok(b) => b,
                 Err(err) => {
                     (self.handlers.on_error)(self.handlers.ctx, global.take_exception(err));
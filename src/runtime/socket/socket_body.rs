@@ -2089,7 +2089,7 @@ impl<const SSL: bool> NewSocket<SSL> {
 
         let global = handlers.global_object;
         let this_value = this.get_this_value(&global);
-        let output_value = match handlers.binary_type.get().to_js(data, &global) {
+        let output_value = match handlers.binary_type.get().to_js_pooled(data, &global) {
             Ok(v) => v,
             Err(err) => {
                 this.handle_error(global.take_exception(err));
@@ -1258,13 +1258,17 @@ impl Expect {
         };
 
         if let Some(saved_value) = existing_value {
-            // clone to owned to release the &mut borrow on runner.snapshots
-            // before mutating passed/failed counters below.
-            let saved_value: Vec<u8> = saved_value.to_vec();
-            if strings::eql_long(&pretty_value, &saved_value, true) {
+            // Clone to owned to release the &mut borrow on runner.snapshots
+            // before mutating passed/failed counters below — but only on
+            // mismatch: the passing path doesn't need the saved body once
+            // compared, and it's the overwhelmingly common one.
+            let saved_value: Option<Vec<u8>> =
+                (!strings::eql_long(&pretty_value, saved_value, true))
+                    .then(|| saved_value.to_vec());
+            let Some(saved_value) = saved_value else {
                 runner.snapshots.passed += 1;
                 return Ok(JSValue::UNDEFINED);
-            }
+            };
 
             runner.snapshots.failed += 1;
             let signature = Self::get_signature(fn_name, "<green>expected<r>", false);
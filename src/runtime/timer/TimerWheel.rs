@@ -0,0 +1,109 @@
+//! Hashed timer wheel for timers due in a future second.
+//!
+//! `All.timers` is a single pairing heap; with hundreds of thousands of
+//! pending timers (per-connection idle timeouts) the meld/combine passes —
+//! and their cross-crate epoch lookups in [`EventLoopTimer::less`] — dominate
+//! profiles. Timers whose deadline lands in a future second are hashed by
+//! deadline second into one of [`SLOT_COUNT`] slots, each an independent
+//! [`TimerHeap`], so insertion stays O(1) and cancellation only restructures
+//! the (much smaller) slot heap. Slots keep full deadline order, so there is
+//! no cascading pass when the wheel turns — `All::next` pops straight from
+//! the owning slot.
+//!
+//! The earliest node across all slots is cached so the event loop computes a
+//! single wakeup for the whole wheel instead of consulting every slot per
+//! tick; the cache is invalidated when the minimum is removed and rebuilt
+//! lazily with one peek per slot.
+
+use super::{EventLoopTimer, TimerHeap};
+
+pub(crate) const SLOT_COUNT: usize = 64;
+
+pub struct TimerWheel {
+    slots: Box<[TimerHeap; SLOT_COUNT]>,
+    len: usize,
+    /// Cached earliest node across all slots; meaningless while `min_stale`.
+    min: Option<*mut EventLoopTimer>,
+    min_stale: bool,
+}
+
+impl Default for TimerWheel {
+    fn default() -> Self {
+        Self {
+            slots: Box::new(core::array::from_fn(|_| TimerHeap::default())),
+            len: 0,
+            min: None,
+            min_stale: false,
+        }
+    }
+}
+
+impl TimerWheel {
+    #[inline]
+    fn slot_of(sec: i64) -> usize {
+        // rem_euclid: the monotonic clock is non-negative in practice, but a
+        // mocked Timespec can sit at EPOCH; keep the index in range regardless.
+        sec.rem_euclid(SLOT_COUNT as i64) as usize
+    }
+
+    /// # Safety
+    /// `v` is a valid, exclusively-owned node not currently in any heap
+    /// (its `IntrusiveField` links are null).
+    pub(crate) unsafe fn insert(&mut self, v: *mut EventLoopTimer) {
+        // SAFETY: `v` is live per fn contract.
+        let slot = Self::slot_of(unsafe { (*v).next.sec });
+        // SAFETY: forwarded — see fn contract.
+        unsafe { self.slots[slot].insert(v) };
+        self.len += 1;
+        if !self.min_stale {
+            match self.min {
+                // SAFETY: both nodes are live heap members.
+                Some(min) if !unsafe { EventLoopTimer::less((), &*v, &*min) } => {}
+                _ => self.min = Some(v),
+            }
+        }
+    }
+
+    /// # Safety
+    /// `v` is a node currently in this wheel, with `next` unchanged since
+    /// insertion (the slot index is recomputed from `next.sec`).
+    pub(crate) unsafe fn remove(&mut self, v: *mut EventLoopTimer) {
+        // SAFETY: `v` is live per fn contract.
+        let slot = Self::slot_of(unsafe { (*v).next.sec });
+        // SAFETY: forwarded — see fn contract.
+        unsafe { self.slots[slot].remove(v) };
+        self.len -= 1;
+        if self.min == Some(v) {
+            self.min = None;
+            self.min_stale = self.len > 0;
+        }
+    }
+
+    /// Earliest node across all slots, or `None` when the wheel is empty.
+    /// Rebuilds the min cache when stale (one peek per slot).
+    pub(crate) fn peek(&mut self) -> Option<*mut EventLoopTimer> {
+        if self.min_stale {
+            let mut min: Option<*mut EventLoopTimer> = None;
+            for slot in self.slots.iter() {
+                let Some(candidate) = slot.peek() else { continue };
+                min = match min {
+                    // SAFETY: slot peeks return live heap members; the full
+                    // comparator keeps the epoch tiebreak for equal deadlines.
+                    Some(cur) if !unsafe { EventLoopTimer::less((), &*candidate, &*cur) } => {
+                        Some(cur)
+                    }
+                    _ => Some(candidate),
+                };
+            }
+            self.min = min;
+            self.min_stale = false;
+        }
+        self.min
+    }
+
+    /// Slot-heap roots for the teardown walk in
+    /// [`All::cancel_all_timeout_objects`](super::All::cancel_all_timeout_objects).
+    pub(crate) fn roots(&self) -> impl Iterator<Item = *mut EventLoopTimer> + '_ {
+        self.slots.iter().map(|s| s.0.root).filter(|r| !r.is_null())
+    }
+}
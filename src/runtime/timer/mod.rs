@@ -343,6 +343,10 @@ impl TimerHeap {
     }
 }
 
+#[path = "TimerWheel.rs"]
+mod timer_wheel;
+pub use timer_wheel::TimerWheel;
+
 /// i32 is exposed to JavaScript and can be used with clearTimeout, clearInterval, etc.
 pub(crate) type TimeoutMap = ArrayHashMap<i32, *mut EventLoopTimer>;
 
@@ -608,6 +612,12 @@ pub struct All {
     pub last_id: i32,
     pub thread_id: std::thread::ThreadId,
     pub timers: TimerHeap,
+    /// Timers due in a future second, hashed by deadline second (see
+    /// TimerWheel.rs). `timers` keeps only nodes due within the current one.
+    pub wheel: TimerWheel,
+    /// Most recent whole second observed by `next()`. Inserts with
+    /// `next.sec` past this go to `wheel`; the rest go to `timers`.
+    pub wheel_floor_sec: i64,
     pub active_timer_count: i32,
     #[cfg(windows)]
     pub uv_timer: bun_sys::windows::libuv::Timer,
@@ -634,6 +644,8 @@ impl All {
             last_id: 1,
             thread_id: std::thread::current().id(),
             timers: TimerHeap::default(),
+            wheel: TimerWheel::default(),
+            wheel_floor_sec: 0,
             active_timer_count: 0,
             #[cfg(windows)]
             uv_timer: bun_core::ffi::zeroed(),
@@ -686,9 +698,14 @@ impl All {
         } else {
             // SAFETY: see fn contract
             unsafe {
-                self.timers.insert(timer);
+                if (*timer).next.sec > self.wheel_floor_sec {
+                    self.wheel.insert(timer);
+                    (*timer).in_heap = InHeap::Wheel;
+                } else {
+                    self.timers.insert(timer);
+                    (*timer).in_heap = InHeap::Regular;
+                }
                 (*timer).state = EventLoopTimerState::ACTIVE;
-                (*timer).in_heap = InHeap::Regular;
             }
             #[cfg(windows)]
             self.ensure_uv_timer();
@@ -724,6 +741,15 @@ impl All {
                 nsec: next.nsec,
             }
         });
+        let wheel_next = self.wheel.peek().map(|timer| {
+            // SAFETY: `peek` returns a live heap node.
+            let next = unsafe { &(*timer).next };
+            Timespec {
+                sec: next.sec,
+                nsec: next.nsec,
+            }
+        });
+        let reg_next = Self::soonest(reg_next, wheel_next);
         let wtf_next = self.wtf_timers.lock().peek().map(|timer| {
             // SAFETY: `peek` returns a live heap node.
             let next = unsafe { &(*timer).next };
@@ -802,6 +828,9 @@ impl All {
             }
             // SAFETY: timer is in `self.timers` per `in_heap`
             InHeap::Regular => unsafe { self.timers.remove(timer) },
+            // SAFETY: timer is in `self.wheel` per `in_heap`; `next` has not
+            // changed since insertion (`update` removes before rewriting it)
+            InHeap::Wheel => unsafe { self.wheel.remove(timer) },
             // SAFETY: timer is in `self.fake_timers.timers` per `in_heap`
             InHeap::Fake => unsafe { self.fake_timers.timers.remove(timer) },
         }
@@ -974,6 +1003,18 @@ impl All {
             }
         });
 
+        // SAFETY: `this` is live; short-lived exclusive borrow for the wheel's
+        // lazy min-cache rebuild, dropped at the end of this statement.
+        let wheel_next = (unsafe { &mut *this }).wheel.peek().map(|min| {
+            // SAFETY: `peek` returns a live heap node.
+            let next = unsafe { &(*min).next };
+            Timespec {
+                sec: next.sec,
+                nsec: next.nsec,
+            }
+        });
+        let reg_next = Self::soonest(reg_next, wheel_next);
+
         let Some(next) = Self::soonest(wtf_next, reg_next) else {
             if let Some(us) = quic_next_tick_us {
                 if us >= 0 {
@@ -1016,11 +1057,27 @@ impl All {
     /// Pop the next due timer. `now` is filled lazily on first call so we
     /// don't pay for `clock_gettime` when the heap is empty.
     fn next(&mut self, has_set_now: &mut bool, now: &mut Timespec) -> Option<*mut EventLoopTimer> {
-        let timer = self.timers.peek()?;
+        let timer = match (self.timers.peek(), self.wheel.peek()) {
+            (None, None) => return None,
+            (Some(t), None) | (None, Some(t)) => t,
+            // SAFETY: both peeks return live heap members; the full comparator
+            // keeps the epoch tiebreak for equal-deadline timers that ended up
+            // split across the two structures.
+            (Some(h), Some(w)) => {
+                if unsafe { EventLoopTimer::less((), &*h, &*w) } {
+                    h
+                } else {
+                    w
+                }
+            }
+        };
         if !*has_set_now {
-            // Real clock: this heap is the opt-out-of-fake-timers set.
+            // Real clock: these heaps are the opt-out-of-fake-timers set.
             *now = Timespec::now(TimespecMockMode::ForceRealTime);
             *has_set_now = true;
+            // Advance the wheel floor so inserts due within the current
+            // second land in the precise heap.
+            self.wheel_floor_sec = now.sec;
         }
         // SAFETY: peek returns a live heap node
         let next = unsafe { &(*timer).next };
@@ -1032,8 +1089,17 @@ impl All {
         {
             return None;
         }
-        let deleted = self.timers.delete_min().expect("peek succeeded");
-        debug_assert!(core::ptr::eq(deleted, timer));
+        // SAFETY: `timer` is the peeked minimum of the structure named by its
+        // `in_heap`, and has not been touched since the peek above.
+        match unsafe { (*timer).in_heap } {
+            InHeap::Regular => {
+                let deleted = self.timers.delete_min().expect("peek succeeded");
+                debug_assert!(core::ptr::eq(deleted, timer));
+            }
+            // SAFETY: see above — popping the wheel's cached minimum.
+            InHeap::Wheel => unsafe { self.wheel.remove(timer) },
+            InHeap::None | InHeap::Fake => unreachable!("peeked node is in a regular structure"),
+        }
         Some(timer)
     }
 
@@ -1196,6 +1262,9 @@ impl All {
                 stack.push(root);
             }
         }
+        // SAFETY: same invariant — the wheel's slot heaps are owned by `All`
+        // and only hold live nodes. `roots()` filters out empty slots.
+        stack.extend(unsafe { &(*this).wheel }.roots());
         while let Some(node) = stack.pop() {
             // SAFETY: intrusive-heap invariant — every node reachable from a
             // root is a live `EventLoopTimer` while linked. Read-only walk.
@@ -197,7 +197,7 @@ impl Promise {
     pub fn resolve(
         &mut self,
         global_object: &JSGlobalObject,
-        value: &mut protocol::RESPValue,
+        value: &mut protocol::RESPValue<'_>,
     ) -> Result<(), jsc::JsTerminated> {
         let options = ToJSOptions {
             return_as_buffer: self.meta.contains(Meta::RETURN_AS_BUFFER),
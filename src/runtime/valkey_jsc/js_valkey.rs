@@ -1217,7 +1217,7 @@ impl JSValkeyClient {
     }
 
     // Callback for when Valkey client connects
-    pub fn on_valkey_connect(&self, value: &mut protocol::RESPValue) -> JsTerminatedResult<()> {
+    pub fn on_valkey_connect(&self, value: &mut protocol::RESPValue<'_>) -> JsTerminatedResult<()> {
         debug_assert!(self.client.get().status == valkey::Status::Connected);
         // we should always have a strong reference to the object here
         debug_assert!(self.this_value.get().is_strong());
@@ -1282,7 +1282,7 @@ impl JSValkeyClient {
         self.update_poll_ref();
     }
 
-    pub fn on_valkey_subscribe(&self, value: &mut protocol::RESPValue) {
+    pub fn on_valkey_subscribe(&self, value: &mut protocol::RESPValue<'_>) {
         debug_assert!(self.is_subscriber());
         debug_assert!(self.this_value.get().is_strong());
 
@@ -1303,7 +1303,7 @@ impl JSValkeyClient {
         Ok(())
     }
 
-    pub fn on_valkey_message(&self, value: &mut [protocol::RESPValue]) {
+    pub fn on_valkey_message(&self, value: &mut [protocol::RESPValue<'_>]) {
         if !self.is_subscriber() {
             debug!("onMessage called but client is not in subscriber mode");
             return;
@@ -61,7 +61,7 @@ pub fn valkey_error_to_js(
     )
 }
 
-pub fn resp_value_to_js(this: &mut RESPValue, global: &JSGlobalObject) -> JsResult<JSValue> {
+pub fn resp_value_to_js(this: &mut RESPValue<'_>, global: &JSGlobalObject) -> JsResult<JSValue> {
     resp_value_to_js_with_options(this, global, ToJSOptions::default())
 }
 
@@ -72,16 +72,16 @@ pub struct ToJSOptions {
 
 fn valkey_str_to_js_value(
     global: &JSGlobalObject,
-    str: &mut Box<[u8]>,
+    str: &[u8],
     options: ToJSOptions,
 ) -> JsResult<JSValue> {
     if options.return_as_buffer {
-        // The parser's payload is an owned allocation that is only converted
-        // once; adopt it as the Buffer backing store instead of copying it
-        // into a fresh ArrayBuffer.
+        // The parser's payload borrows the socket read buffer, so this is the
+        // single copy on the returnAsBuffer path (the parse itself no longer
+        // copies).
         Ok(JSValue::create_buffer_from_box(
             global,
-            core::mem::take(str),
+            Box::<[u8]>::from(str),
         ))
     } else {
         bun_string_jsc::create_utf8_for_js(global, str)
@@ -89,7 +89,7 @@ fn valkey_str_to_js_value(
 }
 
 pub fn resp_value_to_js_with_options(
-    this: &mut RESPValue,
+    this: &mut RESPValue<'_>,
     global: &JSGlobalObject,
     options: ToJSOptions,
 ) -> JsResult<JSValue> {
@@ -121,9 +121,7 @@ pub fn resp_value_to_js_with_options(
             &**str,
             RedisError::InvalidBlobError,
         )),
-        RESPValue::VerbatimString(verbatim) => {
-            valkey_str_to_js_value(global, &mut verbatim.content, options)
-        }
+        RESPValue::VerbatimString(verbatim) => valkey_str_to_js_value(global, verbatim.content, options),
         RESPValue::Map(entries) => {
             let js_obj = JSValue::create_empty_object_with_null_prototype(global);
             for entry in entries.iter_mut() {
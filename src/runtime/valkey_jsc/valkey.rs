@@ -752,73 +752,16 @@ impl ValkeyClient {
                 .write(data)
                 .expect("failed to write to read buffer");
 
-            // Process as many complete messages from the buffer as possible
-            loop {
-                let remaining_buffer = self.read_buffer.remaining();
-                if remaining_buffer.is_empty() {
-                    break; // Buffer processed completely
-                }
-
-                // Incrementally check whether a complete reply is buffered
-                // before running the allocating tree parser. The scanner
-                // resumes from its saved position, so the elements of a
-                // partially-received aggregate are not re-parsed on every
-                // socket callback (which is quadratic in the element count).
-                match self.reply_scanner.scan(remaining_buffer) {
-                    Ok(protocol::ScanResult::Complete) => {}
-                    Ok(protocol::ScanResult::NeedMoreData) => {
-                        // Need more data in the buffer, wait for next onData call
-                        if cfg!(debug_assertions) {
-                            debug!(
-                                "read_buffer: needs more data ({} bytes available)",
-                                remaining_buffer.len()
-                            );
-                        }
-                        return Ok(());
-                    }
-                    Err(err) => {
-                        self.fail(b"Failed to read data (buffer path)", err)?;
-                        return Ok(());
-                    }
-                }
-
-                let mut reader = protocol::ValkeyReader::init(remaining_buffer);
-                let before_read_pos = reader_pos(&reader);
-
-                let value = match reader.read_value() {
-                    Ok(v) => v,
-                    Err(err) => {
-                        // The scanner verified a complete reply is buffered, so
-                        // a parse failure here (including `InvalidResponse`) is
-                        // a protocol error, not a short read.
-                        self.fail(b"Failed to read data (buffer path)", err)?;
-                        return Ok(());
-                    }
-                };
-                // Note: `defer value.deinit(allocator)` — RESPValue should impl Drop.
-
-                let bytes_consumed = reader_pos(&reader) - before_read_pos;
-                if bytes_consumed == 0 && !remaining_buffer.is_empty() {
-                    self.fail(
-                        b"Parser consumed 0 bytes unexpectedly (buffer path)",
-                        RedisError::InvalidResponse,
-                    )?;
-                    return Ok(());
-                }
-
-                self.read_buffer
-                    .consume(u32::try_from(bytes_consumed).expect("int cast"));
-                self.reply_scanner.reset();
-
-                let mut value_to_handle = value; // Use temp var for defer
-                self.handle_response(&mut value_to_handle)?;
-
-                if self.status == Status::Disconnected || self.flags.failed {
-                    return Ok(());
-                }
-                self.send_next_command();
-            }
-            return Ok(()); // Finished processing buffered data for now
+            // Move the buffer out of `self` so the parsed `RESPValue`s can
+            // borrow it across `handle_response(&mut self, ..)`. Re-entrant
+            // code during handling (JS callbacks, `close()`) only ever sees the
+            // empty placeholder, and `on_data` itself cannot re-enter.
+            let mut read_buffer = core::mem::take(&mut self.read_buffer);
+            let result = self.process_read_buffer(&mut read_buffer);
+            // Restore unconditionally so a partial reply survives for the next
+            // socket callback; on a dead connection it just drops with `self`.
+            self.read_buffer = read_buffer;
+            return result;
         }
 
         // Path 2: Buffer is empty, try processing directly from stack 'data'
@@ -853,7 +796,6 @@ impl ValkeyClient {
                 }
             };
             // Successfully read a full message from the stack data
-            // Note: `defer value.deinit(allocator)` — RESPValue should impl Drop.
 
             let bytes_consumed = reader_pos(&reader) - before_read_pos;
             if bytes_consumed == 0 {
@@ -869,7 +811,7 @@ impl ValkeyClient {
             current_data_slice = &current_data_slice[bytes_consumed..];
 
             // Handle the successfully parsed response
-            let mut value_to_handle = value; // Use temp var for defer
+            let mut value_to_handle = value;
             self.handle_response(&mut value_to_handle)?;
 
             // Check connection status after handling
@@ -887,11 +829,81 @@ impl ValkeyClient {
         Ok(())
     }
 
+    /// Drain complete replies from `read_buffer` (taken out of `self` by
+    /// `on_data`). Parsed values borrow the buffer, so each reply's bytes are
+    /// consumed only after `handle_response` is done with it.
+    fn process_read_buffer(&mut self, read_buffer: &mut OffsetByteList) -> JsTerminated<()> {
+        loop {
+            let remaining_buffer = read_buffer.remaining();
+            if remaining_buffer.is_empty() {
+                return Ok(()); // Buffer processed completely
+            }
+
+            // Incrementally check whether a complete reply is buffered
+            // before running the tree parser. The scanner resumes from its
+            // saved position, so the elements of a partially-received
+            // aggregate are not re-parsed on every socket callback (which is
+            // quadratic in the element count).
+            match self.reply_scanner.scan(remaining_buffer) {
+                Ok(protocol::ScanResult::Complete) => {}
+                Ok(protocol::ScanResult::NeedMoreData) => {
+                    // Need more data in the buffer, wait for next onData call
+                    if cfg!(debug_assertions) {
+                        debug!(
+                            "read_buffer: needs more data ({} bytes available)",
+                            remaining_buffer.len()
+                        );
+                    }
+                    return Ok(());
+                }
+                Err(err) => {
+                    self.fail(b"Failed to read data (buffer path)", err)?;
+                    return Ok(());
+                }
+            }
+
+            let mut reader = protocol::ValkeyReader::init(remaining_buffer);
+            let before_read_pos = reader_pos(&reader);
+
+            let mut value = match reader.read_value() {
+                Ok(v) => v,
+                Err(err) => {
+                    // The scanner verified a complete reply is buffered, so
+                    // a parse failure here (including `InvalidResponse`) is
+                    // a protocol error, not a short read.
+                    self.fail(b"Failed to read data (buffer path)", err)?;
+                    return Ok(());
+                }
+            };
+
+            let bytes_consumed = reader_pos(&reader) - before_read_pos;
+            if bytes_consumed == 0 && !remaining_buffer.is_empty() {
+                self.fail(
+                    b"Parser consumed 0 bytes unexpectedly (buffer path)",
+                    RedisError::InvalidResponse,
+                )?;
+                return Ok(());
+            }
+
+            self.reply_scanner.reset();
+
+            self.handle_response(&mut value)?;
+            drop(value);
+
+            read_buffer.consume(u32::try_from(bytes_consumed).expect("int cast"));
+
+            if self.status == Status::Disconnected || self.flags.failed {
+                return Ok(());
+            }
+            self.send_next_command();
+        }
+    }
+
     /// Try handling this response as a subscriber-state response.
     /// Returns `handled` if we handled it, `fallthrough` if we did not.
     fn handle_subscribe_response(
         &mut self,
-        value: &mut RESPValue,
+        value: &mut RESPValue<'_>,
         pair: Option<&mut command::PromisePair>,
     ) -> JsResult<SubscribeHandled> {
         // Resolve the promise with the potentially transformed value
@@ -971,7 +983,7 @@ impl ValkeyClient {
         }
     }
 
-    fn handle_hello_response(&mut self, value: &mut RESPValue) -> JsTerminated<()> {
+    fn handle_hello_response(&mut self, value: &mut RESPValue<'_>) -> JsTerminated<()> {
         debug!("Processing HELLO response");
 
         match value {
@@ -1039,7 +1051,7 @@ impl ValkeyClient {
     }
 
     /// Handle Valkey protocol response
-    fn handle_response(&mut self, value: &mut RESPValue) -> JsTerminated<()> {
+    fn handle_response(&mut self, value: &mut RESPValue<'_>) -> JsTerminated<()> {
         // Special handling for the initial HELLO response
         if !self.flags.is_authenticated {
             self.handle_hello_response(value)?;
@@ -1515,11 +1527,11 @@ impl ValkeyClient {
         self.parent().global_object
     }
 
-    pub fn on_valkey_connect(&mut self, value: &mut RESPValue) -> JsTerminated<()> {
+    pub fn on_valkey_connect(&mut self, value: &mut RESPValue<'_>) -> JsTerminated<()> {
         self.parent().on_valkey_connect(value)
     }
 
-    pub fn on_valkey_subscribe(&mut self, value: &mut RESPValue) {
+    pub fn on_valkey_subscribe(&mut self, value: &mut RESPValue<'_>) {
         self.parent().on_valkey_subscribe(value);
     }
 
@@ -1527,7 +1539,7 @@ impl ValkeyClient {
         self.parent().on_valkey_unsubscribe()
     }
 
-    pub fn on_valkey_message(&mut self, value: &mut [RESPValue]) {
+    pub fn on_valkey_message(&mut self, value: &mut [RESPValue<'_>]) {
         self.parent().on_valkey_message(value);
     }
 
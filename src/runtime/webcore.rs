@@ -307,6 +307,9 @@ pub mod prompt;
 pub mod form_data;
 pub use form_data::{AsyncFormData, FormData};
 
+#[path = "webcore/multipart_stream.rs"]
+pub mod multipart_stream;
+
 #[path = "webcore/ScriptExecutionContext.rs"]
 pub mod script_execution_context;
 
@@ -535,10 +535,14 @@ impl BlobExt for Blob {
                         c,
                         match r {
                             // SAFETY: `buf` is `Box::<[u8]>::into_raw` from the
-                            // ReadFile finisher; reclaim ownership here.
-                            read_file::ReadFileResultType::Result(b) => ReadBytesResult::Ok(
-                                unsafe { bun_core::heap::take(b.buf) }.into_vec(),
-                            ),
+                            // ReadFile finisher (`create_with_ctx` flows never
+                            // produce `mmap_store`); reclaim ownership here.
+                            read_file::ReadFileResultType::Result(b) => {
+                                debug_assert!(b.mmap_store.is_none());
+                                ReadBytesResult::Ok(
+                                    unsafe { bun_core::heap::take(b.buf) }.into_vec(),
+                                )
+                            }
                             read_file::ReadFileResultType::Err(e) => {
                                 ReadBytesResult::Err(Box::new(e))
                             }
@@ -6332,9 +6336,18 @@ impl read_file::ReadFileToJs for ToUint8ArrayWithBytesFn {
 #[allow(clippy::not_unsafe_ptr_arg_deref)]
 impl read_file::ReadFileToJs for ToFormDataWithBytesFn {
     fn call(b: &Blob, g: &JSGlobalObject, by: *mut [u8], l: Lifetime) -> JsResult<JSValue> {
-        let _ = l; // FormData ignores lifetime — bytes are read-only.
+        // FormData parses and copies out of `by` either way; the lifetime only
+        // decides whether the buffer is freed here (`Temporary`) or remains
+        // owned by the caller's store (e.g. an mmap'd read).
         // SAFETY: `by` is valid for reads per the `ReadFileToJs::call` contract.
-        Ok(unsafe { b.to_form_data_with_bytes::<{ Lifetime::Temporary }>(g, by) })
+        Ok(unsafe {
+            match l {
+                Lifetime::Temporary => {
+                    b.to_form_data_with_bytes::<{ Lifetime::Temporary }>(g, by)
+                }
+                _ => b.to_form_data_with_bytes::<{ Lifetime::Share }>(g, by),
+            }
+        })
     }
 }
 
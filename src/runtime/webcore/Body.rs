@@ -2289,8 +2289,11 @@ impl<'a> ValueBufferer<'a> {
                 );
             }
             blob::read_file::ReadFileResultType::Result(data) => {
-                // SAFETY: every producer sets `buf = heap::alloc(v.into_boxed_slice())`
-                // (read_file.rs); reclaim ownership here. Dropped at end of scope.
+                // SAFETY: every `create_with_ctx` producer sets
+                // `buf = heap::alloc(v.into_boxed_slice())` (read_file.rs) and
+                // never produces `mmap_store`; reclaim ownership here. Dropped
+                // at end of scope.
+                debug_assert!(data.mmap_store.is_none());
                 let buf = unsafe { Box::<[u8]>::from_raw(data.buf) };
                 bun_core::scoped_log!(
                     BodyValueBufferer,
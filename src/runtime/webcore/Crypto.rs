@@ -99,6 +99,52 @@ impl Crypto {
 
     // DOMJIT fast path.
 
+    /// `crypto.randomUUIDBatch(n)` — fills an array with `n` v4 UUID strings in
+    /// one native pass. Each UUID still draws from the per-VM entropy cache
+    /// (refilled 128 UUIDs at a time), so the win over calling `randomUUID()`
+    /// in a JS loop is amortizing the binding crossing, not the RNG.
+    #[bun_jsc::host_fn(method)]
+    pub fn random_uuid_batch(
+        &self,
+        global: &JSGlobalObject,
+        callframe: &CallFrame,
+    ) -> JsResult<JSValue> {
+        let arguments = callframe.arguments_undef::<1>();
+        let count_value = if arguments.len > 0 {
+            arguments.ptr[0]
+        } else {
+            JSValue::UNDEFINED
+        };
+
+        let count = global.validate_integer_range::<i64>(
+            count_value,
+            0,
+            bun_jsc::IntegerRange {
+                min: 0,
+                max: i128::from(u32::MAX),
+                field_name: b"count",
+                ..Default::default()
+            },
+        )?;
+        let count = u32::try_from(count).expect("int cast");
+
+        let array = JSValue::create_empty_array(global, count as usize)?;
+        for i in 0..count {
+            let (mut str, bytes) = BunString::create_uninitialized_latin1(36);
+
+            // SAFETY: `bun_vm()` never returns null for a Bun-owned global.
+            let uuid = global.bun_vm().as_mut().rare_data().next_uuid();
+
+            uuid.print(
+                (&mut bytes[0..36])
+                    .try_into()
+                    .expect("infallible: size matches"),
+            );
+            array.put_index(global, i, str.transfer_to_js(global)?)?;
+        }
+        Ok(array)
+    }
+
     // `#[JsClass]` emits `CryptoClass__construct` calling this.
     pub fn constructor(global: &JSGlobalObject, _callframe: &CallFrame) -> JsResult<*mut Crypto> {
         Err(global.throw_illegal_constructor())
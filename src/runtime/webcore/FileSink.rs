@@ -595,6 +595,16 @@ impl FileSink {
             return sys::Result::Ok(());
         }
 
+        #[cfg(not(windows))]
+        if options.chunk_size > 0 {
+            // The user's `highWaterMark` becomes the writer's buffering
+            // threshold: small writes batch up to it before a syscall is
+            // issued, instead of draining at the page-size default.
+            // SAFETY(JsCell): single-field write; does not call into JS.
+            self.writer
+                .with_mut(|w| w.chunk_size = options.chunk_size as usize);
+        }
+
         // reshaped for borrowck — split into a local capture and apply after.
         // R-2: out-params for `bun_io::open_for_writing` are local then `Cell::set`.
         let mut force_sync_out = self.force_sync.get();
@@ -11,6 +11,8 @@ use core::ffi::c_void;
 
 use crate::webcore::Blob;
 use crate::webcore::BlobExt as _;
+use crate::webcore::multipart_stream::{self, PartBody, StreamingMultipartParser};
+use crate::webcore::node_types::PathOrFileDescriptor;
 
 declare_scope!(FormData, visible);
 
@@ -172,6 +174,13 @@ pub fn to_js_from_multipart_data(
     input: &[u8],
     boundary: &[u8],
 ) -> crate::Result<JSValue> {
+    // Large bodies go through the streaming parser so file parts past the
+    // spill threshold become fd-backed Blobs instead of full in-memory
+    // copies. Small bodies keep the zero-copy slicing path below.
+    if input.len() >= multipart_stream::SPILL_THRESHOLD {
+        return to_js_from_multipart_data_streaming(global, input, boundary);
+    }
+
     let form_data_value = DOMFormData::create(global);
     form_data_value.ensure_still_alive();
     let Some(form) = DOMFormData::from_js(form_data_value) else {
@@ -257,6 +266,101 @@ pub fn to_js_from_multipart_data(
     Ok(form_data_value)
 }
 
+/// Chunk-fed variant of [`to_js_from_multipart_data`]: drives
+/// [`StreamingMultipartParser`] over the buffered body so that file parts
+/// beyond the spill threshold land in temp files and are appended as
+/// fd-backed Blobs rather than pinning full-size heap copies. The input
+/// arrives here already buffered by the upstream body consumer; the parser
+/// itself is fed incrementally and keeps only bounded state per part.
+fn to_js_from_multipart_data_streaming(
+    global: &JSGlobalObject,
+    input: &[u8],
+    boundary: &[u8],
+) -> crate::Result<JSValue> {
+    let form_data_value = DOMFormData::create(global);
+    form_data_value.ensure_still_alive();
+    let Some(form) = DOMFormData::from_js(form_data_value) else {
+        scoped_log!(FormData, "failed to create DOMFormData.fromJS");
+        return Err(crate::Error::FailedToParseMultipartData);
+    };
+
+    let mut parser = StreamingMultipartParser::init(boundary)?;
+    {
+        let mut sink = |part: multipart_stream::Part<'_>| {
+            let key = ZigString::init_utf8(part.name);
+
+            let Some(filename_str) = part.filename else {
+                let PartBody::Bytes(bytes) = part.body else {
+                    // Non-file fields never spill.
+                    unreachable!()
+                };
+                let value = ZigString::init_utf8(strings::without_utf8_bom(&bytes));
+                form.append(&key, &value);
+                return;
+            };
+
+            let (mut blob, sniff_source) = match part.body {
+                PartBody::Bytes(bytes) => (Blob::create(&bytes, global, false), Some(bytes)),
+                PartBody::Spilled(mut spilled) => {
+                    let Some(file) = spilled.take_file() else {
+                        // `append_body` only records a `SpilledFile` after a
+                        // successful write, so the descriptor is present.
+                        unreachable!()
+                    };
+                    let mut path_or_fd = PathOrFileDescriptor::Fd(file.into_raw());
+                    // The store owns the descriptor; the temp path itself is
+                    // unlinked when `spilled` drops below.
+                    (
+                        Blob::find_or_create_file_from_path(&mut path_or_fd, global, false),
+                        None,
+                    )
+                }
+            };
+
+            if !part.content_type.is_empty() {
+                blob.content_type
+                    .set(crate::webcore::blob::BlobContentType::Owned(
+                        part.content_type.into(),
+                    ));
+                blob.content_type_was_set.set(true);
+            } else {
+                let mime = 'brk: {
+                    if !filename_str.is_empty() {
+                        let extension = bun_paths::extension(filename_str);
+                        if !extension.is_empty() {
+                            if let Some(m) =
+                                bun_http::MimeType::by_extension_no_default(&extension[1..])
+                            {
+                                break 'brk Some(m);
+                            }
+                        }
+                    }
+                    // Spilled bodies are on disk; extension is the only
+                    // content-type signal there.
+                    sniff_source.as_deref().and_then(bun_http::MimeType::sniff)
+                };
+                if let Some(mime) = mime {
+                    blob.content_type
+                        .set(crate::webcore::blob::BlobContentType::from(mime));
+                    blob.content_type_was_set.set(false);
+                }
+            }
+
+            let filename = ZigString::init_utf8(filename_str);
+            form.append_blob(global, &key, (&raw mut blob).cast::<c_void>(), &filename);
+            // `append_blob` dupes the content type; release this stack-local.
+            blob.detach();
+        };
+
+        if let Err(e) = parser.feed(input, &mut sink).and_then(|()| parser.finish()) {
+            scoped_log!(FormData, "failed to parse multipart data");
+            return Err(e);
+        }
+    }
+
+    Ok(form_data_value)
+}
+
 pub fn for_each_multipart_entry<C>(
     input: &[u8],
     boundary: &[u8],
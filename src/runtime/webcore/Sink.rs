@@ -435,7 +435,6 @@ impl<T: JsSinkType + JsSinkAbi> JSSink<T> {
         global: &crate::webcore::jsc::JSGlobalObject,
         frame: &crate::webcore::jsc::CallFrame,
     ) -> crate::webcore::jsc::JsResult<crate::webcore::jsc::JSValue> {
-        use crate::webcore::jsc::JSValue;
         bun_core::mark_binding!();
         // SAFETY: get_this returns a live ThisSink* on Ok.
         let this = Self::get_this(global, frame)?;
@@ -451,7 +450,34 @@ impl<T: JsSinkType + JsSinkAbi> JSSink<T> {
             )));
         }
 
-        let arg = frame.argument(0);
+        Self::write_chunk(global, &mut this.sink, frame.argument(0))
+    }
+
+    /// `${abi_name}__writeValue` body — the `readStreamIntoSink` pump's direct
+    /// write (`BunStreamSource.cpp`) with a raw `m_sinkPtr` and the chunk as a
+    /// bare value: no host-fn callframe, so exceptions become `.zero`.
+    pub fn js_write_value(
+        global: &crate::webcore::jsc::JSGlobalObject,
+        this: &mut T,
+        chunk: crate::webcore::jsc::JSValue,
+    ) -> crate::webcore::jsc::JSValue {
+        bun_core::mark_binding!();
+        let result = match this.get_pending_error() {
+            Some(err) => Err(global.throw_value(err)),
+            None => Self::write_chunk(global, this, chunk),
+        };
+        bun_jsc::to_js_host_fn_result(global, result)
+    }
+
+    /// The chunk-level tail shared by `js_write` and `js_write_value`: value
+    /// coercion (ArrayBuffer/view, UTF-16/Latin-1 string) and the write
+    /// dispatch.
+    fn write_chunk(
+        global: &crate::webcore::jsc::JSGlobalObject,
+        sink: &mut T,
+        arg: crate::webcore::jsc::JSValue,
+    ) -> crate::webcore::jsc::JsResult<crate::webcore::jsc::JSValue> {
+        use crate::webcore::jsc::JSValue;
         arg.ensure_still_alive();
         let _keep = bun_jsc::EnsureStillAlive(arg);
 
@@ -469,10 +495,7 @@ impl<T: JsSinkType + JsSinkAbi> JSSink<T> {
             }
             // Borrowed view over GC-kept buffer for the duration of the call.
             let data = bun_ptr::RawSlice::new(slice);
-            return Ok(this
-                .sink
-                .write_bytes(&streams::Result::Temporary(data))
-                .to_js(global));
+            return Ok(sink.write_bytes(&streams::Result::Temporary(data)).to_js(global));
         }
 
         if !arg.is_string() {
@@ -495,18 +518,12 @@ impl<T: JsSinkType + JsSinkAbi> JSSink<T> {
             let bytes: &[u8] = bytemuck::cast_slice(utf16);
             // Borrowed view over GC-kept JSString.
             let data = bun_ptr::RawSlice::new(bytes);
-            return Ok(this
-                .sink
-                .write_utf16(&streams::Result::Temporary(data))
-                .to_js(global));
+            return Ok(sink.write_utf16(&streams::Result::Temporary(data)).to_js(global));
         }
 
         // Borrowed view over GC-kept JSString (Latin-1 path).
         let data = bun_ptr::RawSlice::new(view.slice());
-        Ok(this
-            .sink
-            .write_latin1(&streams::Result::Temporary(data))
-            .to_js(global))
+        Ok(sink.write_latin1(&streams::Result::Temporary(data)).to_js(global))
     }
 
     /// `${abi_name}__flush` host-fn body.
@@ -238,16 +238,29 @@ impl TextDecoder {
             false
         };
 
+        let input = arguments.first().copied().unwrap_or(JSValue::UNDEFINED);
+        self.decode_value(global_this, input, stream)
+    }
+
+    /// The options-free tail of `decode`, shared with the `TextDecoderStream`
+    /// transform (`TextDecoder__decodeValue` below): input extraction, the
+    /// WHATWG steps 1-2 bookkeeping, and the const-generic flush dispatch.
+    fn decode_value(
+        &self,
+        global_this: &JSGlobalObject,
+        input: JSValue,
+        stream: bool,
+    ) -> JsResult<JSValue> {
         // Hoisted out of the labeled block — `ArrayBuffer::slice` borrows from
         // the by-value `ArrayBuffer`, so it must outlive the `'input_slice` block.
         let array_buffer;
         let owned_input;
         let input_slice: &[u8] = 'input_slice: {
-            if arguments.is_empty() || arguments[0].is_undefined() {
+            if input.is_undefined() {
                 break 'input_slice b"";
             }
 
-            if let Some(ab) = arguments[0].as_array_buffer(global_this) {
+            if let Some(ab) = input.as_array_buffer(global_this) {
                 array_buffer = ab;
                 if array_buffer.shared || array_buffer.resizable {
                     owned_input = Box::<[u8]>::from(array_buffer.slice());
@@ -642,3 +655,25 @@ impl TextDecoder {
         Ok(bun_core::heap::into_raw(TextDecoder::new(decoder)))
     }
 }
+
+// Direct entry point for the `TextDecoderStream` transform
+// (`JSTextDecoderStream.cpp`): one chunk straight into the wrapped decoder —
+// no options object, no prototype lookup, no JS call frame. `flush` maps to
+// `{stream: !flush}`. Plain `extern "C"` (not `host_call`) for the same ABI
+// reason as the `Server__*` shims in `server_body.rs`.
+#[unsafe(export_name = "TextDecoder__decodeValue")]
+extern "C" fn text_decoder_decode_value_shim(
+    global: &JSGlobalObject,
+    decoder: JSValue,
+    input: JSValue,
+    flush: bool,
+) -> JSValue {
+    // `m_decoder` is always the generated TextDecoder wrapper; anything else
+    // is a bindings bug.
+    let Some(this) = decoder.as_class_ref::<TextDecoder>() else {
+        debug_assert!(false, "TextDecoder__decodeValue called with a non-TextDecoder");
+        return JSValue::UNDEFINED;
+    };
+
+    jsc::to_js_host_fn_result(global, this.decode_value(global, input, !flush))
+}
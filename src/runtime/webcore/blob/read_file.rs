@@ -11,6 +11,8 @@ use crate::webcore::Lifetime;
 #[cfg(not(windows))]
 use crate::webcore::blob::ClosingState;
 use crate::webcore::blob::store::{Bytes as ByteStore, Data, File as FileStore};
+#[cfg(not(windows))]
+use crate::webcore::blob::store::{Store, StoreExt as _};
 use crate::webcore::blob::{Blob, FileCloser, FileOpener, MAX_SIZE, SizeType, StoreRef};
 use crate::webcore::node_types::PathOrFileDescriptor;
 #[cfg(windows)]
@@ -108,11 +110,26 @@ impl<'a, F: ReadFileToJs> ReadFileCompletion for NewReadFileHandler<'a, F> {
                     blob.size
                         .set((bytes.len() as SizeType).min(blob.size.get()));
                 }
-                // The `#[track_caller]` `to_js_host_call` inside `AnyPromise::wrap`
-                // provides the source-location/exception-scope behaviour.
-                AnyPromise::Normal(promise).wrap(global_this, move |g| {
-                    F::call(&blob, g, bytes, Lifetime::Temporary)
-                })?;
+                if let Some(mmap_store) = result.mmap_store {
+                    // The mapping becomes the blob's backing store and the
+                    // view is delivered `Share`'d against it: the resulting
+                    // ArrayBuffer/external string pins a store ref, so the
+                    // pages live until GC and munmap runs on the last deref —
+                    // the file contents are never copied onto the heap.
+                    blob.offset.set(0);
+                    blob.size.set(bytes.len() as SizeType);
+                    blob.store.set(Some(mmap_store));
+                    AnyPromise::Normal(promise).wrap(global_this, move |g| {
+                        F::call(&blob, g, bytes, Lifetime::Share)
+                    })?;
+                } else {
+                    // The `#[track_caller]` `to_js_host_call` inside
+                    // `AnyPromise::wrap` provides the source-location/
+                    // exception-scope behaviour.
+                    AnyPromise::Normal(promise).wrap(global_this, move |g| {
+                        F::call(&blob, g, bytes, Lifetime::Temporary)
+                    })?;
+                }
             }
             ReadFileResultType::Err(err) => {
                 // SAFETY: `promise` was just swapped out of a live `Strong`
@@ -134,17 +151,23 @@ impl<'a, F: ReadFileToJs> ReadFileCompletion for NewReadFileHandler<'a, F> {
 pub type ReadFileOnReadFileCallback = fn(ctx: *mut c_void, bytes: ReadFileResultType);
 
 pub struct ReadFileRead {
-    /// Always a `Box::<[u8]>::into_raw` from the producer's read buffer
-    /// (`Vec::into_boxed_slice()` so layout is exactly `(ptr, len)`). Every
-    /// consumer reclaims via `heap::take` — there is no borrow case left
-    /// (only the two finishers below construct this type and both hand off
-    /// owned bytes).
+    /// When `mmap_store` is `None`: always a `Box::<[u8]>::into_raw` from the
+    /// producer's read buffer (`Vec::into_boxed_slice()` so layout is exactly
+    /// `(ptr, len)`), reclaimed by the consumer via `heap::take`.
+    /// When `mmap_store` is `Some`: a borrowed view into that store's mapped
+    /// pages — never reclaimed directly.
     /// Stored as a raw pointer rather than `Box<[u8]>` because the
     /// `NewReadFileHandler` consumer forwards it straight into
-    /// `to_*_with_bytes::<Temporary>(*mut [u8])`, which itself decides whether
+    /// `to_*_with_bytes::<LIFETIME>(*mut [u8])`, which itself decides whether
     /// the bytes are freed locally or transferred to a JSC external string.
     pub buf: *mut [u8],
     pub total_size: SizeType,
+    /// `Some` when [`ReadFile::try_mmap`] mapped the file region instead of
+    /// reading it: `buf` borrows into this store's pages and must be delivered
+    /// `Lifetime::Share`'d against the store (which munmaps on last deref).
+    /// Only produced for `ReadFile::create` flows — the raw `create_with_ctx`
+    /// callers reclaim `buf` as a `Box` and never see this.
+    pub mmap_store: Option<StoreRef>,
 }
 
 /// Result-or-error union for a completed read.
@@ -191,6 +214,14 @@ pub struct ReadFile {
     pub read_eof: bool,
     pub size: SizeType,
     pub buffer: Vec<u8>,
+    /// Set by [`Self::try_mmap`]: the adopted mapping (whole pages) and the
+    /// byte offset of the requested region within it.
+    pub mmap_store: Option<StoreRef>,
+    pub mmap_delta: usize,
+    /// The mmap fast path is only sound for completion handlers that
+    /// understand [`ReadFileRead::mmap_store`]; `create` opts in,
+    /// `create_with_ctx` callers keep the plain `Box` contract.
+    pub allow_mmap: bool,
     pub task: WorkPoolTask,
     pub system_error: Option<SystemError>,
     pub errno: Option<Error>,
@@ -353,6 +384,9 @@ impl ReadFile {
             read_eof: false,
             size: 0,
             buffer: Vec::new(),
+            mmap_store: None,
+            mmap_delta: 0,
+            allow_mmap: false,
             task: WorkPoolTask {
                 node: Default::default(),
                 callback: Self::do_read_loop_task,
@@ -393,13 +427,19 @@ impl ReadFile {
             // `on_complete_ctx`; ownership transfers per `ReadFileCompletion::run`.
             let _ = unsafe { C::run(ctx.cast::<C>(), bytes) };
         }
-        ReadFile::create_with_ctx(
+        let mut read_file = ReadFile::create_with_ctx(
             store,
             context.cast::<c_void>(),
             handler_run::<C>,
             off,
             max_len,
-        )
+        )?;
+        // `NewReadFileHandler` (the only `ReadFileCompletion`) delivers
+        // `ReadFileRead::mmap_store` results `Lifetime::Share`'d against the
+        // store; the raw `create_with_ctx` callers reclaim `buf` as a `Box`,
+        // so only this entry point opts into the mmap fast path.
+        read_file.allow_mmap = true;
+        Ok(read_file)
     }
 
     pub const IO_TAG: io::Tag = io::Tag::ReadFile;
@@ -594,6 +634,8 @@ impl ReadFile {
         // `_store` is dropped at end of scope (= store.deref()).
         let system_error = this.system_error.take();
         let total_size = this.total_size;
+        let mmap_store = this.mmap_store.take();
+        let mmap_delta = this.mmap_delta;
         drop(this);
 
         if let Some(err) = system_error {
@@ -601,6 +643,32 @@ impl ReadFile {
             return Ok(());
         }
 
+        if let Some(mmap_store) = mmap_store {
+            // `try_mmap` mapped the file region in place of the read loop. The
+            // view skips the page-alignment padding; the store ref handed to
+            // the consumer keeps the mapping alive (and munmaps on last deref).
+            let view: *mut [u8] = {
+                // `as_array_list_leak` yields the mapping with write
+                // provenance (the Share consumer reborrows it `&mut` for JSC).
+                let all = mmap_store.data_mut().as_bytes_mut().as_array_list_leak();
+                core::ptr::slice_from_raw_parts_mut(
+                    // SAFETY: `try_mmap` mapped `mmap_delta + len` bytes with
+                    // `len > 0`, so the offset stays in bounds.
+                    unsafe { all.as_mut_ptr().add(mmap_delta) },
+                    all.len() - mmap_delta,
+                )
+            };
+            cb(
+                cb_ctx,
+                ReadFileResultType::Result(ReadFileRead {
+                    buf: view,
+                    total_size,
+                    mmap_store: Some(mmap_store),
+                }),
+            );
+            return Ok(());
+        }
+
         // The receiver takes ownership. Normalize to `Box<[u8]>` so every
         // consumer can reclaim via `heap::take` with a matching layout.
         cb(
@@ -608,6 +676,7 @@ impl ReadFile {
             ReadFileResultType::Result(ReadFileRead {
                 buf: bun_core::heap::into_raw(buf.into_boxed_slice()),
                 total_size,
+                mmap_store: None,
             }),
         );
         Ok(())
@@ -713,6 +782,64 @@ impl ReadFile {
         }
     }
 
+    /// Below this size the mmap/munmap + page-fault overhead loses to a plain
+    /// `read()` into a heap buffer.
+    #[cfg(not(windows))]
+    const MMAP_THRESHOLD: SizeType = 256 * 1024;
+
+    /// Fast path for large regular files: map `[offset, offset + len)` and
+    /// adopt the mapping as a `Bytes` store instead of copying through the
+    /// read loop. `MAP_PRIVATE` pages stay shared with the page cache until
+    /// written (JS may write to the resulting ArrayBuffer), so RSS stays
+    /// reclaimable no matter how many large blobs are in flight. Returns
+    /// `false` — falling through to `do_read_loop` — when the path doesn't
+    /// apply or the mapping fails.
+    #[cfg(not(windows))]
+    fn try_mmap(&mut self, fd: Fd) -> bool {
+        if !self.allow_mmap || self.could_block {
+            return false;
+        }
+        // `resolve_size_and_last_modified` set `size = total.min(max_length)`
+        // without accounting for `offset`; clamp to the bytes the read loop
+        // would actually deliver. Mapping past EOF is not slack like a short
+        // `read()` — touching those pages raises SIGBUS.
+        let len = self.size.min(self.total_size.saturating_sub(self.offset));
+        if len < Self::MMAP_THRESHOLD {
+            return false;
+        }
+        // The file offset handed to mmap must be page-aligned; map whole
+        // pages covering the region and remember where the bytes start.
+        let page = bun_sys::page_size();
+        let delta = (self.offset as usize) % page;
+        let aligned_offset = self.offset as usize - delta;
+        let map_len = delta + len as usize;
+        let ptr = match bun_sys::mmap(
+            core::ptr::null_mut(),
+            map_len,
+            libc::PROT_READ | libc::PROT_WRITE,
+            libc::MAP_PRIVATE,
+            fd,
+            aligned_offset as i64,
+        ) {
+            Ok(p) => p,
+            Err(_) => return false,
+        };
+        // Consumers scan the bytes front to back. This is a best-effort hint,
+        // so call libc madvise directly and ignore failures (same as
+        // StandaloneModuleGraph's page hints).
+        // SAFETY: `[ptr, ptr + map_len)` is the mapping created above.
+        unsafe {
+            let _ = libc::madvise(ptr.cast(), map_len, libc::MADV_SEQUENTIAL);
+        }
+        // SAFETY: `ptr[..map_len]` is the page-aligned mapping created above;
+        // ownership moves into the store, whose `Bytes` munmaps on last deref.
+        self.mmap_store = Some(Store::init_mmap(unsafe {
+            core::slice::from_raw_parts_mut(ptr, map_len)
+        }));
+        self.mmap_delta = delta;
+        true
+    }
+
     #[cfg(not(windows))]
     fn run_async_with_fd(&mut self, fd: Fd) {
         if self.errno.is_some() {
@@ -737,6 +864,11 @@ impl ReadFile {
             return;
         }
 
+        if self.try_mmap(fd) {
+            self.on_finish();
+            return;
+        }
+
         // add an extra 16 bytes to the buffer to avoid having to resize it for trailing extra data
         if !self.could_block || (self.size > 0 && self.size != MAX_SIZE) {
             let want = (self.size as usize).saturating_add(16);
@@ -1110,6 +1242,7 @@ impl<'a> ReadFileUV<'a> {
             ReadFileResultType::Result(ReadFileRead {
                 buf: bun_core::heap::into_raw(boxed),
                 total_size: this_box.total_size,
+                mmap_store: None,
             })
         };
 
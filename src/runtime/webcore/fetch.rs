@@ -221,6 +221,27 @@ fn data_url_response(data_url_: DataURL, global_this: &JSGlobalObject) -> JSValu
     )
 }
 
+/// Exposed via `bun:internal-for-testing` so connection-reuse tests (and ad
+/// hoc diagnosis of keep-alive hit rates) can read the HTTP client's dial
+/// counters without scraping debug logs. Counts are process-wide, summed
+/// across the plain and TLS contexts on the HTTP thread.
+#[bun_jsc::host_fn]
+pub(crate) fn js_http_agent_stats(global: &JSGlobalObject, _: &CallFrame) -> JsResult<JSValue> {
+    use core::sync::atomic::Ordering;
+    let obj = JSValue::create_empty_object(global, 2);
+    obj.put(
+        global,
+        b"freshConnections",
+        JSValue::js_number(http::http_context::FRESH_CONNECTIONS.load(Ordering::Relaxed) as f64),
+    );
+    obj.put(
+        global,
+        b"reusedConnections",
+        JSValue::js_number(http::http_context::REUSED_CONNECTIONS.load(Ordering::Relaxed) as f64),
+    );
+    Ok(obj)
+}
+
 // ──────────────────────────────────────────────────────────────────────────
 // Bun__fetchPreconnect
 // ──────────────────────────────────────────────────────────────────────────
@@ -0,0 +1,429 @@
+//! Streaming `multipart/form-data` parser with bounded memory.
+//!
+//! [`crate::webcore::form_data::for_each_multipart_entry`] needs the whole
+//! body resident and hands out borrowed slices into it. This parser instead
+//! accepts arbitrary byte chunks through [`StreamingMultipartParser::feed`]
+//! and emits each part through the sink as soon as its closing delimiter is
+//! seen. File-part bodies that grow past [`SPILL_THRESHOLD`] move to a temp
+//! file instead of accumulating in memory, so peak usage is bounded by the
+//! carried-over seam, one header block, and the largest single chunk —
+//! independent of the body size. Delimiter scanning routes through
+//! `bun_core::strings` (the highway SIMD kernels).
+
+use bun_core::{ZBox, declare_scope, scoped_log, strings};
+use bun_resolver::fs as Fs;
+use bun_sys::O;
+
+use crate::cli::upgrade_command::FileSystemTmpdirExt as _;
+
+declare_scope!(multipart, hidden);
+
+/// File-part bodies larger than this spill to a temp file. Non-file fields
+/// become JS strings and stay in memory regardless.
+pub const SPILL_THRESHOLD: usize = 1 << 20;
+
+/// Hard cap on one part's header block. A part whose headers never terminate
+/// is an error, not an unbounded buffer.
+const MAX_HEADER_BYTES: usize = 16 * 1024;
+
+/// One completed part. `name`/`filename`/`content_type` borrow the parser's
+/// header storage and are only valid for the duration of the sink call; the
+/// body is handed over by value.
+pub struct Part<'p> {
+    pub name: &'p [u8],
+    pub filename: Option<&'p [u8]>,
+    pub content_type: &'p [u8],
+    pub body: PartBody,
+}
+
+pub enum PartBody {
+    Bytes(Vec<u8>),
+    Spilled(SpilledFile),
+}
+
+/// A part body that outgrew [`SPILL_THRESHOLD`], written to a uniquely-named
+/// file in the OS temp directory. The path is unlinked on `Drop` (best-effort
+/// — on Windows the unlink fails while a taken descriptor is still open and
+/// the file lingers for OS temp cleanup).
+pub struct SpilledFile {
+    file: Option<bun_sys::File>,
+    dir: bun_sys::Dir,
+    name: ZBox,
+    len: u64,
+}
+
+impl SpilledFile {
+    /// `None` on any filesystem failure — the caller falls back to buffering
+    /// in memory so the upload still succeeds.
+    fn create() -> Option<SpilledFile> {
+        let dir = Fs::FileSystem::instance().tmpdir().ok()?;
+        let mut name_buf = bun_paths::path_buffer_pool::get();
+        let name = Fs::FileSystem::tmpname(b"part", &mut name_buf[..], 0).ok()?;
+        let file = bun_sys::File::openat(
+            dir.fd(),
+            name.as_bytes(),
+            O::CREAT | O::EXCL | O::CLOEXEC | O::RDWR,
+            0o600,
+        )
+        .ok()?;
+        Some(SpilledFile {
+            file: Some(file),
+            dir,
+            name: ZBox::from_bytes(name.as_bytes()),
+            len: 0,
+        })
+    }
+
+    fn write(&mut self, bytes: &[u8]) -> bool {
+        let Some(file) = &self.file else {
+            return false;
+        };
+        if file.write_all(bytes).is_err() {
+            return false;
+        }
+        self.len += bytes.len() as u64;
+        true
+    }
+
+    pub fn len(&self) -> u64 {
+        self.len
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.len == 0
+    }
+
+    /// Hand the open descriptor to the caller (e.g. an fd-backed `Blob`
+    /// store), rewound to the start so the next read sees the spilled bytes.
+    /// The temp path is still unlinked when `self` drops; on POSIX the data
+    /// stays readable through the descriptor.
+    pub fn take_file(&mut self) -> Option<bun_sys::File> {
+        let file = self.file.take()?;
+        let _ = bun_sys::set_file_offset(file.fd(), 0);
+        Some(file)
+    }
+}
+
+impl Drop for SpilledFile {
+    fn drop(&mut self) {
+        // Close before unlinking so Windows can remove the name.
+        self.file = None;
+        let _ = bun_sys::unlinkat(self.dir.fd(), self.name.as_zstr());
+    }
+}
+
+enum State {
+    /// Discarding the preamble while scanning for the first delimiter.
+    Preamble,
+    /// Just consumed a delimiter; the next two bytes pick the transition
+    /// (`\r\n` → headers of the next part, `--` → close delimiter).
+    AfterDelimiter,
+    /// Accumulating one part's header block up to `\r\n\r\n`.
+    Headers,
+    /// Streaming one part's body, scanning for the next delimiter.
+    Body,
+    /// Close delimiter seen; the epilogue is discarded.
+    Done,
+}
+
+struct OpenPart {
+    name: Vec<u8>,
+    filename: Option<Vec<u8>>,
+    content_type: Vec<u8>,
+    bytes: Vec<u8>,
+    spilled: Option<SpilledFile>,
+    /// Part without a usable `name` — body is consumed and discarded, same
+    /// as the buffered parser skipping nameless entries.
+    skip: bool,
+}
+
+pub struct StreamingMultipartParser {
+    /// `\r\n--{boundary}`.
+    delimiter: Vec<u8>,
+    state: State,
+    /// Unconsumed tail carried between feeds. Bounded: at most
+    /// `delimiter.len() + 3` bytes outside header collection, at most
+    /// [`MAX_HEADER_BYTES`] inside it.
+    carry: Vec<u8>,
+    current: Option<OpenPart>,
+}
+
+impl StreamingMultipartParser {
+    pub fn init(boundary: &[u8]) -> crate::Result<StreamingMultipartParser> {
+        if boundary.is_empty() {
+            return Err(crate::Error::FailedToParseMultipartData);
+        }
+        // Same bound as the buffered parser's 76-byte `--{boundary}--` buffer
+        // (RFC 2046 §5.1.1 caps the boundary at 70 bytes).
+        if boundary.len() + 4 > 76 {
+            return Err(crate::Error::BoundaryIsTooLong);
+        }
+        let mut delimiter = Vec::with_capacity(boundary.len() + 4);
+        delimiter.extend_from_slice(b"\r\n--");
+        delimiter.extend_from_slice(boundary);
+        Ok(StreamingMultipartParser {
+            delimiter,
+            state: State::Preamble,
+            // Virtual CRLF so a body opening directly with `--{boundary}`
+            // (no preceding line break) matches the same delimiter as every
+            // later one.
+            carry: b"\r\n".to_vec(),
+            current: None,
+        })
+    }
+
+    /// Consume one chunk. Completed parts are handed to `sink` in order.
+    pub fn feed(&mut self, chunk: &[u8], sink: &mut impl FnMut(Part<'_>)) -> crate::Result<()> {
+        let mut chunk = chunk;
+        // Resolve the seam between the carried tail and this chunk first;
+        // once the carry is drained the rest of the chunk is scanned in
+        // place, so a large chunk is never copied wholesale.
+        while !self.carry.is_empty() && !chunk.is_empty() {
+            let graft = chunk.len().min(self.delimiter.len() + 3);
+            let mut taken = core::mem::take(&mut self.carry);
+            taken.extend_from_slice(&chunk[..graft]);
+            chunk = &chunk[graft..];
+            let used = self.run(&taken, sink)?;
+            // `run` leaves only a bounded tail behind (or an incomplete
+            // header block, which keeps accumulating here).
+            self.carry.extend_from_slice(&taken[used..]);
+        }
+        if self.carry.is_empty() {
+            let used = self.run(chunk, sink)?;
+            self.carry.extend_from_slice(&chunk[used..]);
+        }
+        Ok(())
+    }
+
+    /// Signal end of input. Errors unless the close delimiter was seen.
+    pub fn finish(&mut self) -> crate::Result<()> {
+        match self.state {
+            State::Done => Ok(()),
+            _ => Err(crate::Error::MissingFinalBoundary),
+        }
+    }
+
+    /// Process as much of `data` as possible; returns the consumed byte
+    /// count. Everything past it is either a potential delimiter prefix, an
+    /// incomplete two-byte transition, or an incomplete header block.
+    fn run(&mut self, data: &[u8], sink: &mut impl FnMut(Part<'_>)) -> crate::Result<usize> {
+        let mut pos = 0;
+        loop {
+            let rest = &data[pos..];
+            match self.state {
+                State::Done => return Ok(data.len()),
+                State::Preamble | State::Body => {
+                    let delimiter_len = self.delimiter.len();
+                    if let Some(idx) = strings::index_of(rest, &self.delimiter) {
+                        if matches!(self.state, State::Body) {
+                            self.append_body(&rest[..idx])?;
+                            self.finish_part(sink);
+                        }
+                        pos += idx + delimiter_len;
+                        self.state = State::AfterDelimiter;
+                    } else {
+                        // No full delimiter; one overlapping the end must
+                        // start within the last `delimiter_len - 1` bytes,
+                        // so everything before that is settled body.
+                        let keep = rest.len().min(delimiter_len - 1);
+                        let flush = rest.len() - keep;
+                        if matches!(self.state, State::Body) {
+                            self.append_body(&rest[..flush])?;
+                        }
+                        return Ok(pos + flush);
+                    }
+                }
+                State::AfterDelimiter => {
+                    if rest.len() < 2 {
+                        return Ok(pos);
+                    }
+                    match &rest[..2] {
+                        b"\r\n" => self.state = State::Headers,
+                        b"--" => self.state = State::Done,
+                        _ => return Err(crate::Error::FailedToParseMultipartData),
+                    }
+                    pos += 2;
+                }
+                State::Headers => {
+                    if let Some(end) = strings::index_of(rest, b"\r\n\r\n") {
+                        self.open_part(&rest[..end + 2])?;
+                        pos += end + 4;
+                        self.state = State::Body;
+                    } else {
+                        if rest.len() > MAX_HEADER_BYTES {
+                            return Err(crate::Error::IsMissingHeaderEnd);
+                        }
+                        return Ok(pos);
+                    }
+                }
+            }
+        }
+    }
+
+    fn append_body(&mut self, bytes: &[u8]) -> crate::Result<()> {
+        if bytes.is_empty() {
+            return Ok(());
+        }
+        let Some(part) = &mut self.current else {
+            return Err(crate::Error::FailedToParseMultipartData);
+        };
+        if part.skip {
+            return Ok(());
+        }
+        if let Some(spilled) = &mut part.spilled {
+            if !spilled.write(bytes) {
+                return Err(crate::Error::FailedToParseMultipartData);
+            }
+            return Ok(());
+        }
+        // Only file parts spill — non-file fields become JS strings and end
+        // up in memory either way.
+        if part.filename.is_some() && part.bytes.len() + bytes.len() > SPILL_THRESHOLD {
+            if let Some(mut spilled) = SpilledFile::create() {
+                if spilled.write(&part.bytes) && spilled.write(bytes) {
+                    part.bytes = Vec::new();
+                    part.spilled = Some(spilled);
+                    return Ok(());
+                }
+            }
+            scoped_log!(
+                multipart,
+                "failed to spill multipart part to disk; buffering in memory"
+            );
+        }
+        part.bytes.extend_from_slice(bytes);
+        Ok(())
+    }
+
+    fn finish_part(&mut self, sink: &mut impl FnMut(Part<'_>)) {
+        let Some(part) = self.current.take() else {
+            return;
+        };
+        if part.skip {
+            return;
+        }
+        let body = match part.spilled {
+            Some(spilled) => PartBody::Spilled(spilled),
+            None => PartBody::Bytes(part.bytes),
+        };
+        sink(Part {
+            name: &part.name,
+            filename: part.filename.as_deref(),
+            content_type: &part.content_type,
+            body,
+        });
+    }
+
+    /// Parse one complete header block (sans the final CRLF CRLF) and open
+    /// the part. Mirrors the `Content-Disposition` / `Content-Type` handling
+    /// of the buffered parser, copying the values out since the chunk they
+    /// arrived in does not outlive this call.
+    fn open_part(&mut self, header: &[u8]) -> crate::Result<()> {
+        let mut name: &[u8] = b"";
+        let mut filename: Option<&[u8]> = None;
+        let mut content_type: &[u8] = b"";
+
+        let mut header_chunk = header;
+        while !header_chunk.is_empty() {
+            let line_end = strings::index_of(header_chunk, b"\r\n")
+                .ok_or(crate::Error::IsMissingHeaderLineEnd)?;
+            let line = &header_chunk[..line_end];
+            header_chunk = &header_chunk[line_end + 2..];
+            let colon =
+                strings::index_of(line, b":").ok_or(crate::Error::IsMissingHeaderColonSeparator)?;
+
+            let key = &line[..colon];
+            let value: &[u8] = if line.len() > colon + 1 {
+                &line[colon + 1..]
+            } else {
+                b""
+            };
+            if strings::eql_case_insensitive_ascii(key, b"content-disposition", true) {
+                (name, filename) = parse_disposition(value);
+            } else if !value.is_empty()
+                && content_type.is_empty()
+                && strings::eql_case_insensitive_ascii(key, b"content-type", true)
+            {
+                let trimmed = strings::trim(value, b"; \t");
+                // Same printable-ASCII guard as the buffered parser: the
+                // value is reflected into outgoing headers via the Blob's
+                // content type, so CR/LF and controls must not get through.
+                if trimmed
+                    .iter()
+                    .all(|&b| b == b'\t' || (0x20..=0x7E).contains(&b))
+                {
+                    content_type = trimmed;
+                }
+            }
+        }
+
+        self.current = Some(OpenPart {
+            skip: name.is_empty(),
+            name: name.to_vec(),
+            filename: filename.map(<[u8]>::to_vec),
+            content_type: content_type.to_vec(),
+            bytes: Vec::new(),
+            spilled: None,
+        });
+        Ok(())
+    }
+}
+
+/// Extract `name` and `filename` from a `Content-Disposition` value. Same
+/// tolerant quoting rules as the buffered parser (a missing closing quote is
+/// accepted because some browsers omit it).
+fn parse_disposition(mut value: &[u8]) -> (&[u8], Option<&[u8]>) {
+    let mut name: &[u8] = b"";
+    let mut filename: Option<&[u8]> = None;
+
+    value = strings::trim(value, b" \t");
+    if strings::starts_with_case_insensitive_ascii(value, b"form-data;") {
+        value = &value[b"form-data;".len()..];
+        value = strings::trim(value, b" \t");
+    }
+
+    while let Some(eql_start) = strings::index_of(value, b"=") {
+        let eql_key = strings::trim(&value[..eql_start], b" \t;");
+        value = &value[eql_start + 1..];
+        if value.starts_with(b"\"") {
+            value = &value[1..];
+        }
+
+        let mut field_value = value;
+        {
+            let mut i: usize = 0;
+            while i < field_value.len() {
+                match field_value[i] {
+                    b'"' => {
+                        field_value = &field_value[..i];
+                        break;
+                    }
+                    b'\\' => {
+                        i += (field_value.len() > i + 1 && field_value[i + 1] == b'"') as usize;
+                    }
+                    _ => {}
+                }
+                i += 1;
+            }
+            value = &value[(i + 1).min(value.len())..];
+        }
+
+        if strings::eql_case_insensitive_ascii(eql_key, b"name", true) {
+            name = field_value;
+        } else if strings::eql_case_insensitive_ascii(eql_key, b"filename", true) {
+            filename = Some(field_value);
+        }
+
+        if !name.is_empty() && filename.is_some() {
+            break;
+        }
+
+        if let Some(semi_start) = strings::index_of_char(value, b';') {
+            value = &value[semi_start as usize + 1..];
+        } else {
+            break;
+        }
+    }
+
+    (name, filename)
+}
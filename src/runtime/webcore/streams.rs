@@ -1262,6 +1262,41 @@ impl<const SSL: bool, const HTTP3: bool> HTTPServerWritable<SSL, HTTP3> {
         self.send_without_auto_flusher(buf)
     }
 
+    /// One gathered write of the buffered bytes plus `extra`, skipping the
+    /// copy of `extra` into `self.buffer` just to flush it. Plain-write path
+    /// only — callers run before `requested_end` can be set (`write` returns
+    /// early once an end was requested), so the `try_end`/`end` arms of
+    /// `send_readable_without_auto_flusher` cannot apply here.
+    fn send_vectored(&mut self, extra: &[u8]) -> bool {
+        debug_assert!(!self.done && !self.requested_end);
+        self.unregister_auto_flusher();
+
+        let Some(res) = self.any_res() else {
+            return false;
+        };
+        // `res` is `Copy` (raw uWS handle); see the note in
+        // `send_without_auto_flusher` re: holding it across `on_first_write`.
+        self.end_len = 0;
+        self.handle_first_write_if_necessary();
+
+        let base = self.offset as usize;
+        let buffered_len = self.buffer.len().saturating_sub(base);
+        self.has_backpressure = matches!(
+            res.writev(&[&self.buffer[base..], extra]),
+            uws::WriteResult::Backpressure(_)
+        );
+        self.handle_wrote(buffered_len);
+        self.wrote += extra.len() as BlobSizeType;
+        bun_core::scoped_log!(
+            HTTPServerWritableLog,
+            "sendVectored: {} + {} bytes (backpressure: {})",
+            buffered_len,
+            extra.len(),
+            self.has_backpressure
+        );
+        true
+    }
+
     /// `self.send(&self.readable_slice()[from..])` without laundering a slice
     /// of `self.buffer` through `from_raw_parts` to dodge the `&mut self`
     /// borrow. Mirrors `send_without_auto_flusher` but re-slices `self.buffer`
@@ -1593,13 +1628,15 @@ impl<const SSL: bool, const HTTP3: bool> HTTPServerWritable<SSL, HTTP3> {
                 return Writable::Err(SysError::from_code(sys::E::ENOMEM, sys::Tag::write));
             }
         } else if self.buffer.len() as BlobSizeType + len >= self.high_water_mark {
-            // TODO: attempt to write both in a corked buffer?
+            // One gathered write of buffer + chunk in a single cork, skipping
+            // the copy of `bytes` into the buffer just to flush it.
+            if self.send_vectored(bytes) {
+                return self.writable_result(len);
+            }
+            // No response handle: keep the bytes buffered like `send` would.
             if self.buffer.write(bytes).is_err() {
                 return Writable::Err(SysError::from_code(sys::E::ENOMEM, sys::Tag::write));
             }
-            if self.send_readable(0) {
-                return self.writable_result(len);
-            }
         } else {
             // queue the data wait until highWaterMark is reached or the auto flusher kicks in
             if self.buffer.write(bytes).is_err() {
@@ -1657,6 +1694,11 @@ impl<const SSL: bool, const HTTP3: bool> HTTPServerWritable<SSL, HTTP3> {
             // kinda fast path:
             // - combined chunk is large enough to flush automatically
             // - no backpressure
+            // ASCII needs no re-encode, so the chunk can go straight into the
+            // gathered write alongside the buffered bytes.
+            if strings::is_all_ascii(bytes) && self.send_vectored(bytes) {
+                return self.writable_result(len);
+            }
             if self.buffer.write_latin1(bytes).is_err() {
                 return Writable::Err(SysError::from_code(sys::E::ENOMEM, sys::Tag::write));
             }
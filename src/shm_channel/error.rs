@@ -0,0 +1,39 @@
+#[derive(Debug, Clone, Copy, PartialEq, Eq, thiserror::Error)]
+pub enum Error {
+    #[error(transparent)]
+    Sys(#[from] bun_errno::SystemErrno),
+
+    /// The frame (plus its length header) cannot ever fit in this ring.
+    #[error("FrameTooLarge")]
+    FrameTooLarge,
+
+    /// The mapped fd does not carry a ring this version understands
+    /// (bad magic, impossible capacity, or a size that disagrees with it).
+    #[error("BadHeader")]
+    BadHeader,
+}
+
+impl Error {
+    #[allow(clippy::trivially_copy_pass_by_ref)]
+    pub fn name(&self) -> &'static str {
+        match self {
+            Self::Sys(e) => <&'static str>::from(e),
+            Self::FrameTooLarge => "FrameTooLarge",
+            Self::BadHeader => "BadHeader",
+        }
+    }
+}
+
+impl bun_core::output::ErrName for Error {
+    fn name(&self) -> &[u8] {
+        (*self).name().as_bytes()
+    }
+}
+
+impl From<bun_sys::Error> for Error {
+    fn from(e: bun_sys::Error) -> Self {
+        Self::Sys(e.into())
+    }
+}
+
+pub type Result<T, E = Error> = core::result::Result<T, E>;
@@ -0,0 +1,29 @@
+//! Lock-free SPSC ring buffer over shared memory, for structured IPC between
+//! Bun processes.
+//!
+//! Pipe-based IPC serializes every message through `write(2)` and is bounded
+//! by the kernel pipe buffer; at tens of MB/s the syscall and copy cost
+//! dominate. A [`Ring`] is a single-producer / single-consumer byte-frame
+//! queue living in one shared mapping: the producer writes frames directly
+//! into the ring and only touches the kernel to wake a sleeping consumer
+//! (shared futex on Linux). Frames are opaque bytes — the JS tier carries
+//! serialized-script-value payloads through them, this crate does not care.
+//!
+//! The fd backing the mapping (memfd on Linux, an unlinked POSIX shm object
+//! elsewhere) is exposed via [`Ring::fd`] so the embedder can hand it to the
+//! peer process through spawn fd inheritance; the peer maps the same ring
+//! with [`Ring::open`]. Exactly one process may send and exactly one may
+//! receive on a given ring; a bidirectional channel is two rings.
+//!
+//! Unix-only: Windows has neither memfd nor a shared futex, and its IPC path
+//! stays on libuv pipes.
+
+#![warn(unused_must_use)]
+
+pub mod error;
+pub use error::{Error, Result};
+
+#[cfg(unix)]
+mod ring;
+#[cfg(unix)]
+pub use ring::Ring;
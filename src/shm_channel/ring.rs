@@ -0,0 +1,564 @@
+use core::ptr::NonNull;
+use core::sync::atomic::{AtomicU32, AtomicU64, Ordering};
+
+use bun_sys::Fd;
+use bun_sys::FdExt as _;
+
+use crate::{Error, Result};
+
+const MAGIC: u32 = u32::from_le_bytes(*b"BSC1");
+
+/// The data region starts one page in so the header never shares a page (or a
+/// cache line) with frame bytes, and so `capacity` stays page-aligned.
+const DATA_OFFSET: usize = 4096;
+
+/// A frame record is `[u32 length][bytes, padded to 4]`; a length of
+/// `u32::MAX` is the wrap marker telling the consumer to skip to offset 0.
+const WRAP: u32 = u32::MAX;
+
+/// Shared-mapping header. Producer-written and consumer-written fields sit on
+/// separate 64-byte lines so the two sides never false-share.
+#[repr(C)]
+struct Header {
+    magic: u32,
+    /// Data-region size in bytes (page multiple; the mapping is
+    /// `DATA_OFFSET + capacity` long).
+    capacity: u32,
+    _pad0: [u8; 56],
+
+    /// Monotonic byte offset of the next write (producer-owned).
+    tail: AtomicU64,
+    /// Bumped after every publish; the consumer futex-waits on this word.
+    data_seq: AtomicU32,
+    /// Set by the consumer before sleeping; the producer swaps it to 0 and
+    /// wakes only when it was set, so the uncontended path makes no syscall.
+    reader_waiting: AtomicU32,
+    _pad1: [u8; 48],
+
+    /// Monotonic byte offset of the next read (consumer-owned).
+    head: AtomicU64,
+    /// Bumped after every consume; the producer futex-waits on this word.
+    space_seq: AtomicU32,
+    writer_waiting: AtomicU32,
+    _pad2: [u8; 48],
+}
+
+const _: () = assert!(core::mem::size_of::<Header>() == 192);
+const _: () = assert!(core::mem::size_of::<Header>() <= DATA_OFFSET);
+
+/// One direction of a shared-memory channel. See the crate docs for the
+/// ownership model (one sending process, one receiving process).
+pub struct Ring {
+    map: NonNull<u8>,
+    map_len: usize,
+    fd: Fd,
+}
+
+// The mapping and fd are process-global resources; the !Send of NonNull does
+// not apply. !Sync stays: each side drives its end from one thread.
+// SAFETY: no thread-affine state; see above.
+unsafe impl Send for Ring {}
+
+impl Ring {
+    /// Create a new empty ring whose data region holds at least
+    /// `capacity_hint` bytes (rounded up to a whole number of pages).
+    pub fn create(capacity_hint: usize) -> Result<Ring> {
+        let page = 4096usize;
+        let capacity = capacity_hint.max(page).div_ceil(page) * page;
+        if capacity > u32::MAX as usize {
+            return Err(Error::FrameTooLarge);
+        }
+        let fd = create_backing_fd()?;
+        let map_len = DATA_OFFSET + capacity;
+        if let Err(err) = bun_sys::ftruncate(fd, map_len as i64) {
+            fd.close();
+            return Err(err.into());
+        }
+        let map = match map_fd(fd, map_len) {
+            Ok(map) => map,
+            Err(err) => {
+                fd.close();
+                return Err(err);
+            }
+        };
+        let ring = Ring { map, map_len, fd };
+        // The mapping is freshly zeroed by the kernel; the atomics are
+        // already in their initial state. No peer can observe the header
+        // until the caller hands the fd over, so plain writes suffice.
+        // SAFETY: the mapping is at least size_of::<Header>() long.
+        unsafe {
+            let header = ring.map.as_ptr().cast::<Header>();
+            (*header).capacity = capacity as u32;
+            (*header).magic = MAGIC;
+        }
+        Ok(ring)
+    }
+
+    /// Map a ring created by the peer process (the fd arrives via spawn fd
+    /// inheritance). Takes ownership of `fd`; it is closed on drop.
+    pub fn open(fd: Fd) -> Result<Ring> {
+        let close_and = |err: Error| {
+            fd.close();
+            err
+        };
+        let stat = bun_sys::fstat(fd).map_err(|e| close_and(e.into()))?;
+        let map_len = usize::try_from(stat.st_size).unwrap_or(0);
+        if map_len <= DATA_OFFSET {
+            return Err(close_and(Error::BadHeader));
+        }
+        let map = map_fd(fd, map_len).map_err(close_and)?;
+        let ring = Ring { map, map_len, fd };
+        let header = ring.header();
+        if header.magic != MAGIC
+            || header.capacity as usize != map_len - DATA_OFFSET
+            || header.capacity % 4 != 0
+        {
+            return Err(Error::BadHeader); // drop unmaps + closes
+        }
+        Ok(ring)
+    }
+
+    /// The fd backing the mapping, for handing to the peer process.
+    #[inline]
+    pub fn fd(&self) -> Fd {
+        self.fd
+    }
+
+    #[inline]
+    pub fn capacity(&self) -> usize {
+        self.header().capacity as usize
+    }
+
+    /// Largest frame [`try_send`](Self::try_send) will ever accept. Half the
+    /// ring, so a frame can always fit even right after a wrap marker.
+    #[inline]
+    pub fn max_frame_len(&self) -> usize {
+        self.capacity() / 2 - 4
+    }
+
+    #[inline]
+    pub fn is_empty(&self) -> bool {
+        let h = self.header();
+        h.head.load(Ordering::Acquire) == h.tail.load(Ordering::Acquire)
+    }
+
+    #[inline]
+    fn header(&self) -> &Header {
+        // SAFETY: the mapping is at least DATA_OFFSET long (checked at
+        // create/open) and lives until munmap in Drop; Header is repr(C) at
+        // offset 0 of a page-aligned mapping. Concurrent access is confined
+        // to the atomics; the non-atomic fields are written once before the
+        // fd ever reaches a peer.
+        unsafe { &*self.map.as_ptr().cast::<Header>() }
+    }
+
+    #[inline]
+    fn data(&self) -> *mut u8 {
+        // SAFETY: DATA_OFFSET is inside the mapping (create/open checked).
+        unsafe { self.map.as_ptr().add(DATA_OFFSET) }
+    }
+
+    /// Write one frame. Returns `Ok(false)` when the ring currently has no
+    /// room (the caller waits via [`wait_writable`](Self::wait_writable) and
+    /// retries); `Err(FrameTooLarge)` when it never will.
+    pub fn try_send(&self, frame: &[u8]) -> Result<bool> {
+        let capacity = self.capacity() as u64;
+        let record = 4 + frame.len().div_ceil(4) * 4;
+        if record > self.max_frame_len() + 4 {
+            return Err(Error::FrameTooLarge);
+        }
+        let record = record as u64;
+
+        let h = self.header();
+        let tail = h.tail.load(Ordering::Relaxed); // producer-owned
+        let head = h.head.load(Ordering::Acquire);
+        let free = capacity - (tail - head);
+        let pos = (tail % capacity) as usize;
+        let contiguous = capacity - pos as u64;
+
+        let (write_at, new_tail) = if contiguous < record {
+            // Not enough room before the end of the ring: burn the remainder
+            // with a wrap marker and start the record at offset 0.
+            if free < contiguous + record {
+                return Ok(false);
+            }
+            // SAFETY: pos is 4-aligned (records are) and < capacity.
+            unsafe { self.data().add(pos).cast::<u32>().write(WRAP) };
+            (0usize, tail + contiguous + record)
+        } else {
+            if free < record {
+                return Ok(false);
+            }
+            (pos, tail + record)
+        };
+
+        // SAFETY: [write_at, write_at + record) is inside the data region and
+        // not readable by the consumer until the tail store below publishes it.
+        unsafe {
+            let dst = self.data().add(write_at);
+            dst.cast::<u32>().write(frame.len() as u32);
+            core::ptr::copy_nonoverlapping(frame.as_ptr(), dst.add(4), frame.len());
+        }
+        h.tail.store(new_tail, Ordering::Release);
+
+        h.data_seq.fetch_add(1, Ordering::Release);
+        if h.reader_waiting.swap(0, Ordering::AcqRel) != 0 {
+            notify::wake(&h.data_seq);
+        }
+        Ok(true)
+    }
+
+    /// Read one frame into `out` (replacing its contents). Returns `Ok(false)`
+    /// when the ring is empty.
+    pub fn try_recv(&self, out: &mut Vec<u8>) -> Result<bool> {
+        let capacity = self.capacity() as u64;
+        let h = self.header();
+        let mut head = h.head.load(Ordering::Relaxed); // consumer-owned
+
+        loop {
+            let tail = h.tail.load(Ordering::Acquire);
+            if head == tail {
+                return Ok(false);
+            }
+            let pos = (head % capacity) as usize;
+            // SAFETY: [pos, tail % capacity) was published by the tail
+            // acquire above; pos is 4-aligned.
+            let len = unsafe { self.data().add(pos).cast::<u32>().read() };
+            if len == WRAP {
+                head += capacity - pos as u64;
+                continue;
+            }
+            let len = len as usize;
+            out.clear();
+            out.reserve(len);
+            // SAFETY: the producer wrote `len` bytes at pos + 4 before
+            // publishing; `out` has room for them after the reserve.
+            unsafe {
+                core::ptr::copy_nonoverlapping(self.data().add(pos + 4), out.as_mut_ptr(), len);
+                out.set_len(len);
+            }
+            h.head
+                .store(head + 4 + (len as u64).div_ceil(4) * 4, Ordering::Release);
+
+            h.space_seq.fetch_add(1, Ordering::Release);
+            if h.writer_waiting.swap(0, Ordering::AcqRel) != 0 {
+                notify::wake(&h.space_seq);
+            }
+            return Ok(true);
+        }
+    }
+
+    /// Block until the ring is (probably) non-empty. Spurious returns are
+    /// allowed; callers loop around [`try_recv`](Self::try_recv). Returns
+    /// false only on timeout.
+    pub fn wait_readable(&self, timeout_ns: Option<u64>) -> bool {
+        let h = self.header();
+        let seq = h.data_seq.load(Ordering::Acquire);
+        if !self.is_empty() {
+            return true;
+        }
+        h.reader_waiting.store(1, Ordering::SeqCst);
+        if !self.is_empty() {
+            // The producer may have missed the flag; it costs at most one
+            // spurious wake, so just consume.
+            return true;
+        }
+        notify::wait(&h.data_seq, seq, timeout_ns)
+    }
+
+    /// Block until some space was freed. Same contract as
+    /// [`wait_readable`](Self::wait_readable): spurious returns allowed,
+    /// false only on timeout; callers loop around `try_send`.
+    pub fn wait_writable(&self, timeout_ns: Option<u64>) -> bool {
+        let h = self.header();
+        let seq = h.space_seq.load(Ordering::Acquire);
+        let full = |h: &Header| {
+            h.tail.load(Ordering::Acquire) - h.head.load(Ordering::Acquire)
+                >= self.capacity() as u64
+        };
+        if !full(h) {
+            return true;
+        }
+        h.writer_waiting.store(1, Ordering::SeqCst);
+        if !full(h) {
+            return true;
+        }
+        notify::wait(&h.space_seq, seq, timeout_ns)
+    }
+}
+
+impl Drop for Ring {
+    fn drop(&mut self) {
+        let _ = bun_sys::munmap(self.map.as_ptr(), self.map_len);
+        self.fd.close();
+    }
+}
+
+fn map_fd(fd: Fd, len: usize) -> Result<NonNull<u8>> {
+    let ptr = bun_sys::mmap(
+        core::ptr::null_mut(),
+        len,
+        libc::PROT_READ | libc::PROT_WRITE,
+        libc::MAP_SHARED,
+        fd,
+        0,
+    )?;
+    Ok(NonNull::new(ptr).expect("mmap success returns a non-null mapping"))
+}
+
+#[cfg(any(target_os = "linux", target_os = "android"))]
+fn create_backing_fd() -> Result<Fd> {
+    Ok(bun_sys::memfd_create(
+        c"bun-shm-channel",
+        bun_sys::MemfdFlags::CrossProcess,
+    )?)
+}
+
+/// Non-Linux unix: an unlinked POSIX shm object. The fd keeps the object
+/// alive after `shm_unlink`, exactly like an anonymous memfd.
+#[cfg(all(unix, not(any(target_os = "linux", target_os = "android"))))]
+fn create_backing_fd() -> Result<Fd> {
+    use core::sync::atomic::AtomicU32 as Counter;
+    static COUNTER: Counter = Counter::new(0);
+    loop {
+        let name = format!(
+            "/bun-shm-{}-{}\0",
+            std::process::id(),
+            COUNTER.fetch_add(1, Ordering::Relaxed)
+        );
+        // SAFETY: `name` is NUL-terminated above.
+        let rc = unsafe {
+            libc::shm_open(
+                name.as_ptr().cast(),
+                libc::O_RDWR | libc::O_CREAT | libc::O_EXCL,
+                0o600,
+            )
+        };
+        if rc < 0 {
+            let errno = bun_errno::SystemErrno::init(i64::from(bun_sys::last_errno()))
+                .unwrap_or(bun_errno::SystemErrno::EINVAL);
+            if errno == bun_errno::SystemErrno::EEXIST {
+                continue;
+            }
+            return Err(Error::Sys(errno));
+        }
+        // SAFETY: same NUL-terminated name; unlinking immediately makes the
+        // object anonymous (the fd and future mappings keep it alive).
+        unsafe { libc::shm_unlink(name.as_ptr().cast()) };
+        return Ok(Fd::from_native(rc));
+    }
+}
+
+#[cfg(any(target_os = "linux", target_os = "android"))]
+mod notify {
+    use core::sync::atomic::AtomicU32;
+
+    use bun_core::time::NS_PER_S;
+    use bun_sys::linux;
+
+    /// Shared (non-private) futex wait: the waiter may be in another process.
+    pub(super) fn wait(word: &AtomicU32, expect: u32, timeout_ns: Option<u64>) -> bool {
+        // SAFETY: ts is initialized below whenever it is passed.
+        let mut ts: linux::timespec = unsafe { bun_core::ffi::zeroed_unchecked() };
+        if let Some(timeout_ns) = timeout_ns {
+            ts.sec = <_>::try_from(timeout_ns / NS_PER_S).unwrap_or(i64::MAX);
+            ts.nsec = <_>::try_from(timeout_ns % NS_PER_S).unwrap_or(0);
+        }
+        // SAFETY: `word` points into a live mapping for the duration of the
+        // call; the timespec pointer is null or points at the local above.
+        let rc = unsafe {
+            linux::futex_4arg(
+                word.as_ptr().cast(),
+                linux::FutexOp {
+                    cmd: linux::FutexCmd::WAIT,
+                    private: false,
+                },
+                expect,
+                if timeout_ns.is_some() {
+                    &raw const ts
+                } else {
+                    core::ptr::null()
+                },
+            )
+        };
+        // EINTR/EAGAIN are spurious-return cases by contract; only a real
+        // timeout reports false.
+        linux::E::init(rc) != linux::E::TIMEDOUT
+    }
+
+    pub(super) fn wake(word: &AtomicU32) {
+        // SAFETY: `word` points into a live mapping for the duration of the call.
+        let _ = unsafe {
+            linux::futex_3arg(
+                word.as_ptr().cast(),
+                linux::FutexOp {
+                    cmd: linux::FutexCmd::WAKE,
+                    private: false,
+                },
+                i32::MAX as u32,
+            )
+        };
+    }
+}
+
+/// macOS and the BSDs expose no cross-process futex; fall back to a bounded
+/// sleep-poll. Wakes stay free because the poll observes the sequence word.
+#[cfg(all(unix, not(any(target_os = "linux", target_os = "android"))))]
+mod notify {
+    use core::sync::atomic::{AtomicU32, Ordering};
+
+    pub(super) fn wait(word: &AtomicU32, expect: u32, timeout_ns: Option<u64>) -> bool {
+        let start = std::time::Instant::now();
+        loop {
+            if word.load(Ordering::SeqCst) != expect {
+                return true;
+            }
+            if let Some(timeout_ns) = timeout_ns {
+                if start.elapsed().as_nanos() as u64 >= timeout_ns {
+                    return false;
+                }
+            }
+            std::thread::sleep(core::time::Duration::from_micros(100));
+        }
+    }
+
+    pub(super) fn wake(_word: &AtomicU32) {}
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn roundtrip_in_order() {
+        let ring = Ring::create(4096).unwrap();
+        assert!(ring.is_empty());
+        assert!(ring.try_send(b"hello").unwrap());
+        assert!(ring.try_send(b"").unwrap());
+        assert!(ring.try_send(&[7u8; 33]).unwrap());
+
+        let mut out = Vec::new();
+        assert!(ring.try_recv(&mut out).unwrap());
+        assert_eq!(out, b"hello");
+        assert!(ring.try_recv(&mut out).unwrap());
+        assert_eq!(out, b"");
+        assert!(ring.try_recv(&mut out).unwrap());
+        assert_eq!(out, vec![7u8; 33]);
+        assert!(!ring.try_recv(&mut out).unwrap());
+        assert!(ring.is_empty());
+    }
+
+    #[test]
+    fn rejects_oversized_frames_and_reports_full() {
+        let ring = Ring::create(4096).unwrap();
+        let too_big = vec![0u8; ring.max_frame_len() + 1];
+        assert_eq!(ring.try_send(&too_big), Err(Error::FrameTooLarge));
+
+        // Fill until full, then drain one and confirm a send fits again.
+        let frame = vec![1u8; 1000];
+        let mut sent = 0;
+        while ring.try_send(&frame).unwrap() {
+            sent += 1;
+        }
+        assert!(sent >= 3);
+        let mut out = Vec::new();
+        assert!(ring.try_recv(&mut out).unwrap());
+        assert_eq!(out, frame);
+        assert!(ring.try_send(&frame).unwrap());
+    }
+
+    #[test]
+    fn wraps_across_the_ring_boundary() {
+        let ring = Ring::create(4096).unwrap();
+        // Odd-sized frames so head/tail land unaligned with the ring end and
+        // the wrap-marker path actually runs.
+        let frame = vec![9u8; 1021];
+        let mut out = Vec::new();
+        for _ in 0..64 {
+            assert!(ring.try_send(&frame).unwrap());
+            assert!(ring.try_send(&frame).unwrap());
+            assert!(ring.try_recv(&mut out).unwrap());
+            assert_eq!(out, frame);
+            assert!(ring.try_recv(&mut out).unwrap());
+            assert_eq!(out, frame);
+        }
+        assert!(ring.is_empty());
+    }
+
+    #[test]
+    fn open_maps_the_same_ring() {
+        let ring = Ring::create(4096).unwrap();
+        // Simulate the peer: dup the fd (spawn would) and map it again.
+        let peer_fd = bun_sys::dup(ring.fd()).unwrap();
+        let peer = Ring::open(peer_fd).unwrap();
+        assert_eq!(peer.capacity(), ring.capacity());
+
+        assert!(ring.try_send(b"cross-mapping").unwrap());
+        let mut out = Vec::new();
+        assert!(peer.try_recv(&mut out).unwrap());
+        assert_eq!(out, b"cross-mapping");
+    }
+
+    #[test]
+    fn futex_wakes_a_sleeping_consumer() {
+        let ring = std::sync::Arc::new(Ring::create(4096).unwrap());
+        // Not-readable with a timeout: must time out, not hang.
+        assert!(!ring.wait_readable(Some(1_000_000)));
+
+        let consumer = {
+            let ring = std::sync::Arc::clone(&ring);
+            std::thread::spawn(move || {
+                let mut out = Vec::new();
+                loop {
+                    if ring.try_recv(&mut out).unwrap() {
+                        return out;
+                    }
+                    ring.wait_readable(None);
+                }
+            })
+        };
+        // Give the consumer a chance to actually sleep in the futex; the
+        // handshake is correct either way, this just exercises the wake path.
+        while !consumer.is_finished() {
+            if ring.try_send(b"wake up").unwrap() {
+                break;
+            }
+        }
+        assert_eq!(consumer.join().unwrap(), b"wake up");
+    }
+
+    #[test]
+    fn spsc_stress_across_threads() {
+        let ring = std::sync::Arc::new(Ring::create(16 * 1024).unwrap());
+        const FRAMES: u32 = 10_000;
+
+        let consumer = {
+            let ring = std::sync::Arc::clone(&ring);
+            std::thread::spawn(move || {
+                let mut out = Vec::new();
+                for i in 0..FRAMES {
+                    loop {
+                        if ring.try_recv(&mut out).unwrap() {
+                            break;
+                        }
+                        ring.wait_readable(None);
+                    }
+                    assert_eq!(out.len(), 4 + (i as usize * 7) % 512);
+                    assert_eq!(&out[..4], &i.to_le_bytes());
+                    assert!(out[4..].iter().all(|&b| b == (i % 251) as u8));
+                }
+            })
+        };
+
+        let mut frame = Vec::new();
+        for i in 0..FRAMES {
+            frame.clear();
+            frame.resize(4 + (i as usize * 7) % 512, (i % 251) as u8);
+            frame[..4].copy_from_slice(&i.to_le_bytes());
+            while !ring.try_send(&frame).unwrap() {
+                ring.wait_writable(None);
+            }
+        }
+        consumer.join().unwrap();
+    }
+}
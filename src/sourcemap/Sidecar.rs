@@ -0,0 +1,198 @@
+//! Binary source-map sidecar (`<chunk>.js.map.bin`).
+//!
+//! A JSON `.map` costs a full JSON + VLQ parse the first time a stack trace
+//! touches it; on big bundles that is the dominant cost of the first error.
+//! `bun build` for the bun target writes this sidecar next to each external
+//! `.map`: the same sorted `Mapping.List` column arrays, raw and
+//! little-endian, so the runtime restores them with three `memcpy`s and
+//! binary-searches as usual — no parse step.
+//!
+//! The sidecar is a cache, never a source of truth. It stores the byte length
+//! of the sibling `.map` JSON; at load time a `stat` of the `.map` must match
+//! or the sidecar is ignored and the JSON path runs. Only mappings and source
+//! names are stored — lookups that want `sourcesContent` keep parsing the
+//! JSON (see the `MappingsOnly` gate in `get_source_map_impl`).
+//!
+//! ## Layout (little-endian)
+//!
+//!     [ 0.. 4]  magic:             u32  -- "BSMb"
+//!     [ 4.. 8]  version:           u32
+//!     [ 8..16]  map_json_len:      u64  -- byte length of the sibling .map
+//!     [16..20]  mapping_count:     u32  = n
+//!     [20..24]  source_name_count: u32
+//!     [24..32]  input_line_count:  u64
+//!     [32..  ]  generated:         [i32; 2] * n  (line, column)
+//!               original:          [i32; 2] * n
+//!               source_index:      i32 * n
+//!               names:             count * (len: u32, bytes)
+
+use core::mem::size_of;
+
+use bun_collections::MultiArrayList;
+
+use crate::mapping::{self, MappingWithoutName};
+use crate::{LineColumnOffset, ParseUrl, ParseUrlResultHint, ParsedSourceMap};
+
+const MAGIC: u32 = u32::from_le_bytes(*b"BSMb");
+const VERSION: u32 = 1;
+const HEADER_SIZE: usize = 32;
+
+// The column arrays are written byte-for-byte; both asserts back the casts in
+// `offsets_as_bytes` / `decode` (same contract as `parse_simd`).
+const _: () = assert!(size_of::<LineColumnOffset>() == size_of::<[i32; 2]>());
+const _: () = assert!(cfg!(target_endian = "little"));
+
+fn offsets_as_bytes(s: &[LineColumnOffset]) -> &[u8] {
+    // SAFETY: `LineColumnOffset` is `repr(C)` over two i32s with no padding
+    // (const asserts above), so its slice bytes are plain initialized data.
+    unsafe { core::slice::from_raw_parts(s.as_ptr().cast::<u8>(), core::mem::size_of_val(s)) }
+}
+
+fn i32s_as_bytes(s: &[i32]) -> &[u8] {
+    // SAFETY: i32 has no padding; plain initialized data.
+    unsafe { core::slice::from_raw_parts(s.as_ptr().cast::<u8>(), core::mem::size_of_val(s)) }
+}
+
+/// Parse `map_json` (the `.map` bytes about to be written) and encode the
+/// sidecar payload. `None` when the JSON does not parse or a count overflows
+/// u32 — the caller just skips writing the sidecar.
+pub fn encode_from_json(map_json: &[u8]) -> Option<Vec<u8>> {
+    let parsed = crate::parse_json(map_json, ParseUrlResultHint::MappingsOnly).ok()?;
+    let map = parsed.map?;
+    encode(&map, u64::try_from(map_json.len()).ok()?)
+}
+
+fn encode(map: &ParsedSourceMap, map_json_len: u64) -> Option<Vec<u8>> {
+    let n = map.mappings.len();
+    let n32 = u32::try_from(n).ok()?;
+    let names = &map.external_source_names;
+    let names32 = u32::try_from(names.len()).ok()?;
+    let input_line_count = u64::try_from(map.input_line_count).ok()?;
+
+    let names_bytes: usize = names.iter().map(|s| 4 + s.len()).sum();
+    let mut out: Vec<u8> = Vec::with_capacity(HEADER_SIZE + n * 20 + names_bytes);
+    out.extend_from_slice(&MAGIC.to_le_bytes());
+    out.extend_from_slice(&VERSION.to_le_bytes());
+    out.extend_from_slice(&map_json_len.to_le_bytes());
+    out.extend_from_slice(&n32.to_le_bytes());
+    out.extend_from_slice(&names32.to_le_bytes());
+    out.extend_from_slice(&input_line_count.to_le_bytes());
+    out.extend_from_slice(offsets_as_bytes(map.mappings.generated()));
+    out.extend_from_slice(offsets_as_bytes(map.mappings.original()));
+    out.extend_from_slice(i32s_as_bytes(map.mappings.source_index()));
+    for name in names.iter() {
+        out.extend_from_slice(&u32::try_from(name.len()).ok()?.to_le_bytes());
+        out.extend_from_slice(name);
+    }
+    Some(out)
+}
+
+fn read_u32(bytes: &[u8], at: usize) -> u32 {
+    u32::from_le_bytes(bytes[at..at + 4].try_into().expect("unreachable"))
+}
+
+fn read_u64(bytes: &[u8], at: usize) -> u64 {
+    u64::from_le_bytes(bytes[at..at + 8].try_into().expect("unreachable"))
+}
+
+/// Decode a sidecar payload. Returns the recorded `.map` byte length (the
+/// caller validates it against a `stat` of the sibling file) and the restored
+/// map. `None` on any structural mismatch — never an error, it is a cache.
+fn decode(bytes: &[u8]) -> Option<(u64, ParsedSourceMap)> {
+    if bytes.len() < HEADER_SIZE || read_u32(bytes, 0) != MAGIC || read_u32(bytes, 4) != VERSION {
+        return None;
+    }
+    let map_json_len = read_u64(bytes, 8);
+    let n = read_u32(bytes, 16) as usize;
+    let name_count = read_u32(bytes, 20) as usize;
+    let input_line_count = usize::try_from(read_u64(bytes, 24)).ok()?;
+
+    let columns_len = n.checked_mul(20)?;
+    let mut rest = bytes.get(HEADER_SIZE..HEADER_SIZE.checked_add(columns_len)?)?;
+
+    let mut list: MultiArrayList<MappingWithoutName> = MultiArrayList::default();
+    list.ensure_total_capacity(n).ok()?;
+    if n > 0 {
+        // SAFETY: `ensure_total_capacity(n)` reserved every column;
+        // `rest` holds exactly `n * 20` bytes laid out column-by-column in
+        // the same representation (const asserts at the top). The three
+        // column ranges are disjoint SoA storage.
+        unsafe {
+            core::ptr::copy_nonoverlapping(
+                rest.as_ptr(),
+                list.items_raw::<"generated", LineColumnOffset>()
+                    .cast::<u8>(),
+                n * 8,
+            );
+            core::ptr::copy_nonoverlapping(
+                rest.as_ptr().add(n * 8),
+                list.items_raw::<"original", LineColumnOffset>()
+                    .cast::<u8>(),
+                n * 8,
+            );
+            core::ptr::copy_nonoverlapping(
+                rest.as_ptr().add(n * 16),
+                list.items_raw::<"source_index", i32>().cast::<u8>(),
+                n * 4,
+            );
+            list.set_len(n);
+        }
+    }
+
+    rest = bytes.get(HEADER_SIZE + columns_len..)?;
+    let mut names: Vec<Box<[u8]>> = Vec::with_capacity(name_count);
+    for _ in 0..name_count {
+        if rest.len() < 4 {
+            return None;
+        }
+        let len = read_u32(rest, 0) as usize;
+        let name = rest.get(4..4usize.checked_add(len)?)?;
+        names.push(Box::from(name));
+        rest = &rest[4 + len..];
+    }
+
+    let mut psm = ParsedSourceMap::default();
+    psm.mappings = mapping::List {
+        r#impl: mapping::ListValue::WithoutNames(list),
+        ..Default::default()
+    };
+    psm.input_line_count = input_line_count;
+    psm.external_source_names = names;
+    Some((map_json_len, psm))
+}
+
+/// Try `<source_filename>.map.bin`. `Some` only when the sidecar reads,
+/// decodes, and its recorded length matches a `stat` of the sibling `.map` —
+/// anything else falls through to the JSON path in the caller.
+pub fn try_load(source_filename: &[u8]) -> Option<ParseUrl> {
+    const EXT: &[u8] = b".map.bin";
+    let mut path_buf = bun_paths::path_buffer_pool::get();
+    if source_filename.len() + EXT.len() + 1 > path_buf.len() {
+        return None;
+    }
+    path_buf[..source_filename.len()].copy_from_slice(source_filename);
+    path_buf[source_filename.len()..source_filename.len() + EXT.len()].copy_from_slice(EXT);
+    path_buf[source_filename.len() + EXT.len()] = 0;
+    // SAFETY: byte at `len` was just set to NUL; buffer outlives `path`.
+    let path = bun_core::ZStr::from_buf(&path_buf[..], source_filename.len() + EXT.len());
+
+    let data = bun_sys::File::read_from(bun_core::Fd::cwd(), path).ok()?;
+    let (map_json_len, psm) = decode(&data)?;
+
+    // Shallow staleness check: the bundler writes the `.map` and the sidecar
+    // together, so a `.map` rewritten without its sidecar shows up as a
+    // length mismatch.
+    path_buf[source_filename.len() + b".map".len()] = 0;
+    // SAFETY: as above, shorter NUL-terminated view into the same buffer.
+    let map_path = bun_core::ZStr::from_buf(&path_buf[..], source_filename.len() + b".map".len());
+    let stat = bun_sys::stat(map_path).ok()?;
+    if bun_sys::PosixStat::init(&stat).size != map_json_len {
+        return None;
+    }
+
+    Some(ParseUrl {
+        map: Some(std::sync::Arc::new(psm)),
+        mapping: None,
+        source_contents: None,
+    })
+}
@@ -20,6 +20,8 @@ pub mod line_offset_table;
 pub mod mapping;
 #[path = "ParsedSourceMap.rs"]
 pub mod parsed_source_map;
+#[path = "Sidecar.rs"]
+pub mod sidecar;
 
 pub use bun_base64::vlq;
 pub use vlq::VLQ;
@@ -526,6 +528,17 @@ pub fn get_source_map_impl<P: SourceProvider + ?Sized>(
                     }
                 }
 
+                // `bun build` for the bun target writes a binary sidecar next
+                // to the `.map` (see Sidecar.rs); mappings-only lookups
+                // restore it with no JSON/VLQ parse. Hints that want source
+                // contents keep parsing the JSON below, and a stale or absent
+                // sidecar falls through silently.
+                if matches!(result, ParseUrlResultHint::MappingsOnly) {
+                    if let Some(parsed) = sidecar::try_load(source_filename) {
+                        break 'parsed (SourceMapLoadHint::IsExternalMap, parsed);
+                    }
+                }
+
                 let mut load_path_buf = bun_paths::path_buffer_pool::get();
                 // `+ 4` for ".map" plus a trailing NUL for the
                 // `&ZStr` open path; reserve `+ 5`.
@@ -206,6 +206,25 @@ impl Tag {
         0
     }
 
+    /// Tags we can *decode* from binary result format. Superset of
+    /// `is_binary_format_supported`: int2/int8/uuid have native decoders in
+    /// `DataCell::from_bytes` but no binary *parameter* encoder in
+    /// `write_bind`, so they must not change the parameter format code.
+    pub fn is_binary_result_supported(self) -> bool {
+        match self {
+            Tag::int2 | Tag::int8 | Tag::uuid => true,
+            _ => self.is_binary_format_supported(),
+        }
+    }
+
+    pub fn result_format_code(self) -> Short {
+        if self.is_binary_result_supported() {
+            return 1;
+        }
+
+        0
+    }
+
     // `toJSTypedArrayType` / `toJS` / `fromJS` are extension-trait methods in
     // `bun_sql_jsc`.
 
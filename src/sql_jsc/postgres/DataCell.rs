@@ -765,8 +765,15 @@ pub(crate) fn from_bytes(
         }
         // postgres when reading bigint as int8 it returns a string unless type: { bigint: postgres.BigInt is set
         T::int8 => {
-            if bigint {
-                // .int8 is a 64-bit integer always string
+            if binary && bytes.len() == 8 {
+                let value = parse_binary_int8(bytes)?;
+                if bigint {
+                    Ok(SQLDataCell::int8(value))
+                } else {
+                    let mut buf = bun_core::fmt::ItoaBuf::new();
+                    Ok(SQLDataCell::string(bun_core::fmt::itoa(&mut buf, value)))
+                }
+            } else if bigint {
                 Ok(SQLDataCell::int8(
                     bun_core::fmt::parse_decimal::<i64>(bytes).unwrap_or(0),
                 ))
@@ -890,6 +897,29 @@ pub(crate) fn from_bytes(
             }
         }
 
+        T::uuid => {
+            if binary {
+                if bytes.len() != 16 {
+                    return Err(AnyPostgresError::InvalidBinaryData);
+                }
+                let mut hex = [0u8; 32];
+                bun_core::fmt::bytes_to_hex_lower(bytes, &mut hex);
+                // Canonical 8-4-4-4-12 form, matching Postgres' uuid_out.
+                let mut out = [0u8; 36];
+                out[..8].copy_from_slice(&hex[..8]);
+                out[8] = b'-';
+                out[9..13].copy_from_slice(&hex[8..12]);
+                out[13] = b'-';
+                out[14..18].copy_from_slice(&hex[12..16]);
+                out[18] = b'-';
+                out[19..23].copy_from_slice(&hex[16..20]);
+                out[23] = b'-';
+                out[24..].copy_from_slice(&hex[20..32]);
+                Ok(SQLDataCell::string(&out))
+            } else {
+                Ok(SQLDataCell::string(bytes))
+            }
+        }
         T::bytea => {
             if binary {
                 Ok(SQLDataCell {
@@ -1261,7 +1291,7 @@ impl<'a> Putter<'a> {
             };
             *cell = if let Some(data) = optional_bytes {
                 from_bytes(
-                    (field.binary || self.binary) && tag.is_binary_format_supported(),
+                    (field.binary || self.binary) && tag.is_binary_result_supported(),
                     self.bigint,
                     tag,
                     data.slice(),
@@ -236,7 +236,7 @@ pub fn write_bind<Context: WriterContext>(
 
     let mut any_non_text_fields: bool = false;
     for field in result_fields {
-        if field.type_tag().is_binary_format_supported() {
+        if field.type_tag().is_binary_result_supported() {
             any_non_text_fields = true;
             break;
         }
@@ -248,7 +248,7 @@ pub fn write_bind<Context: WriterContext>(
         }
         writer.short(result_fields.len())?;
         for field in result_fields {
-            writer.short(field.type_tag().format_code())?;
+            writer.short(field.type_tag().result_format_code())?;
         }
     } else {
         writer.short(0)?;
@@ -271,6 +271,34 @@ impl<const SSL: bool> Response<SSL> {
         }
     }
 
+    /// Gathered write: corks once and appends every buffer to the cork
+    /// buffer, so the batch flushes as a single syscall on uncork instead of
+    /// one cork/send round trip per `write()` call.
+    pub fn writev(&mut self, bufs: &[&[u8]]) -> WriteResult {
+        let iov: Vec<c::uws_res_write_buf_t> = bufs
+            .iter()
+            .map(|b| c::uws_res_write_buf_t {
+                data: b.as_ptr(),
+                length: b.len(),
+            })
+            .collect();
+        let mut written: usize = 0;
+        // SAFETY: self is a live opaque uws_res handle owned by uWS; `iov`
+        // outlives the synchronous FFI call.
+        match unsafe {
+            c::uws_res_writev(
+                Self::ssl_flag(),
+                self.downcast(),
+                iov.as_ptr(),
+                iov.len(),
+                &raw mut written,
+            )
+        } {
+            true => WriteResult::WantMore(written),
+            false => WriteResult::Backpressure(written),
+        }
+    }
+
     /// Write body bytes without copying the unwritten tail into uWS backpressure.
     /// Returns the number of body bytes accepted. See `HttpResponse::tryWriteBody`.
     pub fn try_write_body(&mut self, data: &[u8], is_first: bool) -> usize {
@@ -802,6 +830,11 @@ impl AnyResponse {
         any_dispatch!(self, |r| r.write(data))
     }
 
+    /// Gathered write of all buffers in one cork; see `Response::writev`.
+    pub fn writev(self, bufs: &[&[u8]]) -> WriteResult {
+        any_dispatch!(self, |r| r.writev(bufs))
+    }
+
     pub fn try_write_body(self, data: &[u8], is_first: bool) -> usize {
         any_dispatch!(self, |r| r.try_write_body(data, is_first))
     }
@@ -1062,6 +1095,13 @@ pub mod c {
         pub struct uws_res;
     }
 
+    /// Matches the C shim's `uws_res_write_buf_t` (libuwsockets.cpp).
+    #[repr(C)]
+    pub struct uws_res_write_buf_t {
+        pub data: *const u8,
+        pub length: usize,
+    }
+
     // `uws_res` is `#[repr(C)]` with `UnsafeCell<[u8; 0]>`, so `&uws_res` /
     // `&mut uws_res` are ABI-identical to a non-null pointer. Value-typed
     // shims are `safe fn`; (ptr,len), nullable raw, *mut c_void ctx stay
@@ -1145,6 +1185,13 @@ pub mod c {
             data: *const u8,
             length: *mut usize,
         ) -> bool;
+        pub(crate) fn uws_res_writev(
+            ssl: i32,
+            res: *mut uws_res,
+            bufs: *const uws_res_write_buf_t,
+            count: usize,
+            written: *mut usize,
+        ) -> bool;
         pub(crate) fn uws_res_try_write_body(
             ssl: i32,
             res: *mut uws_res,
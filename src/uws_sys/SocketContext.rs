@@ -119,6 +119,7 @@ pub struct BunSocketContextOptions {
     pub client_renegotiation_limit: u32,
     pub client_renegotiation_window: u32,
     pub session_timeout: i32,
+    pub session_cache_size: u32,
     pub crl: *const *const c_char,
     pub crl_count: u32,
     pub allow_partial_trust_chain: i32,
@@ -149,6 +150,7 @@ impl Default for BunSocketContextOptions {
             client_renegotiation_limit: 3,
             client_renegotiation_window: 600,
             session_timeout: 0,
+            session_cache_size: 0,
             crl: ptr::null(),
             crl_count: 0,
             allow_partial_trust_chain: 0,
@@ -254,6 +256,7 @@ impl BunSocketContextOptions {
         h.update(bun_core::bytes_of(&self.client_renegotiation_limit));
         h.update(bun_core::bytes_of(&self.client_renegotiation_window));
         h.update(bun_core::bytes_of(&self.session_timeout));
+        h.update(bun_core::bytes_of(&self.session_cache_size));
         feed_arr(&mut h, self.crl, self.crl_count);
         h.update(bun_core::bytes_of(&self.allow_partial_trust_chain));
         feed_z(&mut h, self.sigalgs);
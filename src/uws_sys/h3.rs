@@ -113,6 +113,29 @@ impl Response {
             WriteResult::Backpressure(len)
         }
     }
+    pub fn writev(&mut self, bufs: &[&[u8]]) -> WriteResult {
+        // HTTP/3 has no cork-buffer gathering; sequential writes for
+        // AnyResponse dispatch parity.
+        let mut written = 0;
+        let mut want_more = true;
+        for buf in bufs {
+            match self.write(buf) {
+                WriteResult::WantMore(n) => {
+                    written += n;
+                    want_more = true;
+                }
+                WriteResult::Backpressure(n) => {
+                    written += n;
+                    want_more = false;
+                }
+            }
+        }
+        if want_more {
+            WriteResult::WantMore(written)
+        } else {
+            WriteResult::Backpressure(written)
+        }
+    }
     pub fn try_write_body(&mut self, data: &[u8], _is_first: bool) -> usize {
         // node:http (the only caller) never reaches HTTP/3; fall through to
         // the copying write for AnyResponse dispatch parity.
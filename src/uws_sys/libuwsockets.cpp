@@ -1425,6 +1425,68 @@ extern "C"
       }
     return uwsRes->write(stringViewFromC(data, *length), length);
   }
+
+  typedef struct
+  {
+    const char *data;
+    size_t length;
+  } uws_res_write_buf_t;
+
+  bool uws_res_writev(int ssl, uws_res_r res, const uws_res_write_buf_t *bufs, size_t count, size_t *written) nonnull_fn_decl;
+
+  // Gathered write: cork once, append every buffer to the cork buffer, flush
+  // as a single syscall on uncork. One chunked-framing pass per buffer (same
+  // framing `count` separate uws_res_write calls would produce), but without
+  // the per-call cork/send round trips.
+  bool uws_res_writev(int ssl, uws_res_r res, const uws_res_write_buf_t *bufs, size_t count, size_t *written)
+  {
+    size_t total = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+      total += bufs[i].length;
+    }
+    bool wantMore = true;
+    size_t accepted = 0;
+    if (ssl)
+    {
+      uWS::HttpResponse<true> *uwsRes = (uWS::HttpResponse<true> *)res;
+      if (total < 16 * 1024 && total > 0 && !uwsRes->uWS::AsyncSocket<true>::isCorked())
+      {
+        uwsRes->uWS::AsyncSocket<true>::cork();
+      }
+      for (size_t i = 0; i < count; i++)
+      {
+        size_t length = bufs[i].length;
+        if (length == 0)
+        {
+          continue;
+        }
+        wantMore = uwsRes->write(stringViewFromC(bufs[i].data, length), &length);
+        accepted += length;
+      }
+    }
+    else
+    {
+      uWS::HttpResponse<false> *uwsRes = (uWS::HttpResponse<false> *)res;
+      if (total < 16 * 1024 && total > 0 && !uwsRes->uWS::AsyncSocket<false>::isCorked())
+      {
+        uwsRes->uWS::AsyncSocket<false>::cork();
+      }
+      for (size_t i = 0; i < count; i++)
+      {
+        size_t length = bufs[i].length;
+        if (length == 0)
+        {
+          continue;
+        }
+        wantMore = uwsRes->write(stringViewFromC(bufs[i].data, length), &length);
+        accepted += length;
+      }
+    }
+    *written = accepted;
+    return wantMore;
+  }
+
   size_t uws_res_try_write_body(int ssl, uws_res_r res, const char *data, size_t length, bool is_first) nonnull_fn_decl;
 
   size_t uws_res_try_write_body(int ssl, uws_res_r res, const char *data, size_t length, bool is_first)
@@ -86,30 +86,33 @@ impl RESPType {
     }
 }
 
-pub enum RESPValue {
+/// A parsed RESP reply. String payloads borrow the read buffer the reply was
+/// parsed from — the tree parser only runs once [`ReplyScanner`] reports a
+/// complete reply, so the slices stay valid until the caller consumes those
+/// buffered bytes. Conversion to owned data (JS strings, Buffers) happens at
+/// the retention point, not during the parse.
+pub enum RESPValue<'a> {
     // RESP2 types
-    SimpleString(Box<[u8]>),
-    Error(Box<[u8]>),
+    SimpleString(&'a [u8]),
+    Error(&'a [u8]),
     Integer(i64),
-    BulkString(Option<Box<[u8]>>),
-    Array(Vec<RESPValue>),
+    BulkString(Option<&'a [u8]>),
+    Array(Vec<RESPValue<'a>>),
 
     // RESP3 types
     Null,
     Double(f64),
     Boolean(bool),
-    BlobError(Box<[u8]>),
-    VerbatimString(VerbatimString),
-    Map(Vec<MapEntry>),
-    Set(Vec<RESPValue>),
-    Attribute(Attribute),
-    Push(Push),
-    BigNumber(Box<[u8]>),
+    BlobError(&'a [u8]),
+    VerbatimString(VerbatimString<'a>),
+    Map(Vec<MapEntry<'a>>),
+    Set(Vec<RESPValue<'a>>),
+    Attribute(Attribute<'a>),
+    Push(Push<'a>),
+    BigNumber(&'a [u8]),
 }
 
-// `deinit` deleted — all payloads are Box/Vec; Drop is automatic.
-
-impl fmt::Display for RESPValue {
+impl fmt::Display for RESPValue<'_> {
     fn fmt(&self, writer: &mut fmt::Formatter<'_>) -> fmt::Result {
         match self {
             RESPValue::SimpleString(str) => write!(writer, "{}", BStr::new(str)),
@@ -289,7 +292,7 @@ impl<'a> ValkeyReader<'a> {
         }
     }
 
-    pub fn read_verbatim_string(&mut self) -> Result<VerbatimString, RedisError> {
+    pub fn read_verbatim_string(&mut self) -> Result<VerbatimString<'a>, RedisError> {
         let len = self.read_integer()?;
         if !(0..=Self::MAX_BULK_LEN).contains(&len) {
             return Err(RedisError::InvalidVerbatimString);
@@ -313,10 +316,10 @@ impl<'a> ValkeyReader<'a> {
             return Err(RedisError::InvalidVerbatimString);
         }
 
-        let format = Box::<[u8]>::from(&content_with_format[0..3]);
-        let content = Box::<[u8]>::from(&content_with_format[4..]);
-
-        Ok(VerbatimString { format, content })
+        Ok(VerbatimString {
+            format: &content_with_format[0..3],
+            content: &content_with_format[4..],
+        })
     }
 
     /// Maximum allowed nesting depth for RESP aggregate types.
@@ -348,25 +351,23 @@ impl<'a> ValkeyReader<'a> {
         cap
     }
 
-    pub fn read_value(&mut self) -> Result<RESPValue, RedisError> {
+    pub fn read_value(&mut self) -> Result<RESPValue<'a>, RedisError> {
         self.prealloc_budget = self.buffer.len() - self.pos;
         self.read_value_with_depth(0)
     }
 
-    fn read_value_with_depth(&mut self, depth: usize) -> Result<RESPValue, RedisError> {
+    fn read_value_with_depth(&mut self, depth: usize) -> Result<RESPValue<'a>, RedisError> {
         let type_byte = self.read_byte()?;
 
         match RESPType::from_byte(type_byte).ok_or(RedisError::InvalidResponseType)? {
             // RESP2 types
             RESPType::SimpleString => {
                 let str = self.read_until_crlf()?;
-                let owned = Box::<[u8]>::from(str);
-                Ok(RESPValue::SimpleString(owned))
+                Ok(RESPValue::SimpleString(str))
             }
             RESPType::Error => {
                 let str = self.read_until_crlf()?;
-                let owned = Box::<[u8]>::from(str);
-                Ok(RESPValue::Error(owned))
+                Ok(RESPValue::Error(str))
             }
             RESPType::Integer => {
                 let int = self.read_integer()?;
@@ -390,8 +391,7 @@ impl<'a> ValkeyReader<'a> {
                 if !crlf.is_empty() {
                     return Err(RedisError::InvalidBulkString);
                 }
-                let owned = Box::<[u8]>::from(str);
-                Ok(RESPValue::BulkString(Some(owned)))
+                Ok(RESPValue::BulkString(Some(str)))
             }
             RESPType::Array => {
                 if depth >= Self::MAX_NESTING_DEPTH {
@@ -441,8 +441,7 @@ impl<'a> ValkeyReader<'a> {
                 if !crlf.is_empty() {
                     return Err(RedisError::InvalidBlobError);
                 }
-                let owned = Box::<[u8]>::from(str);
-                Ok(RESPValue::BlobError(owned))
+                Ok(RESPValue::BlobError(str))
             }
             RESPType::VerbatimString => Ok(RESPValue::VerbatimString(self.read_verbatim_string()?)),
             RESPType::Map => {
@@ -529,8 +528,7 @@ impl<'a> ValkeyReader<'a> {
 
                 // First element is the push type
                 let push_type = self.read_value_with_depth(depth + 1)?;
-                // defer push_type.deinit() — drops at scope end
-                let push_type_str: &[u8] = match &push_type {
+                let push_type_str: &'a [u8] = match push_type {
                     RESPValue::SimpleString(str) => str,
                     RESPValue::BulkString(maybe_str) => {
                         if let Some(str) = maybe_str {
@@ -542,10 +540,6 @@ impl<'a> ValkeyReader<'a> {
                     _ => return Err(RedisError::InvalidPush),
                 };
 
-                // Copy the push type string since the original will be freed
-                let push_type_dup = Box::<[u8]>::from(push_type_str);
-                // errdefer free(push_type_dup) — drops automatically on `?`
-
                 // Read the rest of the data
                 let data_len = usize::try_from(len - 1).expect("int cast");
                 let mut data =
@@ -558,14 +552,13 @@ impl<'a> ValkeyReader<'a> {
                 }
 
                 Ok(RESPValue::Push(Push {
-                    kind: push_type_dup,
+                    kind: push_type_str,
                     data,
                 }))
             }
             RESPType::BigNumber => {
                 let str = self.read_until_crlf()?;
-                let owned = Box::<[u8]>::from(str);
-                Ok(RESPValue::BigNumber(owned))
+                Ok(RESPValue::BigNumber(str))
             }
         }
     }
@@ -753,34 +746,26 @@ impl ReplyScanner {
     }
 }
 
-pub struct MapEntry {
-    pub key: RESPValue,
-    pub value: RESPValue,
+pub struct MapEntry<'a> {
+    pub key: RESPValue<'a>,
+    pub value: RESPValue<'a>,
 }
 
-// `MapEntry::deinit` deleted — fields drop automatically.
-
-pub struct VerbatimString {
-    pub format: Box<[u8]>, // e.g. "txt" or "mkd"
-    pub content: Box<[u8]>,
+pub struct VerbatimString<'a> {
+    pub format: &'a [u8], // e.g. "txt" or "mkd"
+    pub content: &'a [u8],
 }
 
-// `VerbatimString::deinit` deleted — Box<[u8]> fields drop automatically.
-
-pub struct Push {
-    pub kind: Box<[u8]>,
-    pub data: Vec<RESPValue>,
+pub struct Push<'a> {
+    pub kind: &'a [u8],
+    pub data: Vec<RESPValue<'a>>,
 }
 
-// `Push::deinit` deleted — Box/Vec fields drop automatically.
-
-pub struct Attribute {
-    pub attributes: Vec<MapEntry>,
-    pub value: Box<RESPValue>,
+pub struct Attribute<'a> {
+    pub attributes: Vec<MapEntry<'a>>,
+    pub value: Box<RESPValue<'a>>,
 }
 
-// `Attribute::deinit` deleted — Vec/Box fields drop automatically.
-
 #[repr(u8)]
 #[derive(Clone, Copy, PartialEq, Eq, Debug)]
 pub enum SubscriptionPushMessage {
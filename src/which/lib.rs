@@ -12,6 +12,8 @@ use bun_paths::resolve_path::posix_to_platform_in_place;
 use bun_paths::w_path_buffer_pool;
 use bun_paths::{MAX_PATH_BYTES, PathBuffer, SEP, WPathBuffer, is_absolute, path_buffer_pool};
 
+pub mod spawn_cache;
+
 #[allow(non_upper_case_globals)]
 mod scope {
     bun_core::declare_scope!(which, hidden);
@@ -0,0 +1,103 @@
+//! Memoized `$PATH` resolution for spawn-heavy workloads.
+//!
+//! A bare command name costs one `access(2)` per `$PATH` segment until it is
+//! found; a CI runner spawning the same handful of binaries hundreds of times
+//! a minute pays that walk on every spawn. The cache remembers where a bare
+//! name resolved, keyed by the exact `$PATH` string it was resolved against,
+//! and re-verifies the remembered file with a single `access(2)` on each hit
+//! so an unlinked or chmod'd target falls back to a full walk.
+//!
+//! One deliberate divergence from an uncached walk: while a cached entry
+//! stays valid, a new executable installed into an *earlier* `$PATH` segment
+//! does not shadow it until the cached file disappears or `$PATH` changes.
+//!
+//! The cache is thread-local (spawn argv resolution happens on the JS
+//! thread), so lookups take no locks.
+
+use core::sync::atomic::{AtomicU64, Ordering};
+use std::cell::RefCell;
+
+use bun_core::{ZStr, strings};
+use bun_paths::{MAX_PATH_BYTES, PathBuffer};
+
+/// Validated cache hits (one `access(2)` instead of a `$PATH` walk).
+pub static HITS: AtomicU64 = AtomicU64::new(0);
+/// Full walks for cacheable bare names (cold, invalidated, or evicted).
+pub static MISSES: AtomicU64 = AtomicU64::new(0);
+
+/// Spawn workloads use a handful of distinct binaries; a bounded linear-scan
+/// table beats hashing at this size and caps memory. Full table ⇒ start over.
+const MAX_ENTRIES: usize = 64;
+
+#[derive(Default)]
+struct Cache {
+    /// The `$PATH` string the entries below were resolved against; any other
+    /// `$PATH` clears the table.
+    path: Vec<u8>,
+    /// `(bare name, resolved absolute path)`, both without NUL.
+    entries: Vec<(Box<[u8]>, Box<[u8]>)>,
+}
+
+thread_local! {
+    static CACHE: RefCell<Cache> = RefCell::new(Cache::default());
+}
+
+/// [`crate::which_for_spawn`] with the bare-name memoization above.
+///
+/// Names containing a separator resolve against `cwd` and absolute paths skip
+/// the walk entirely, so neither is cached. Windows additionally consults the
+/// working directory before `$PATH` for bare names (CreateProcessW order), so
+/// the cache only engages on POSIX.
+pub fn which_for_spawn_cached<'a>(
+    buf: &'a mut PathBuffer,
+    path: &[u8],
+    cwd: &[u8],
+    bin: &[u8],
+) -> Option<&'a ZStr> {
+    if cfg!(windows)
+        || bin.is_empty()
+        || bin.len() >= MAX_PATH_BYTES
+        || strings::index_of_char(bin, b'/').is_some()
+    {
+        return crate::which_for_spawn(buf, path, cwd, bin);
+    }
+
+    let cached_len: Option<usize> = CACHE.with(|cache| {
+        let mut cache = cache.borrow_mut();
+        if cache.path != path {
+            cache.path.clear();
+            cache.path.extend_from_slice(path);
+            cache.entries.clear();
+            return None;
+        }
+        let idx = cache.entries.iter().position(|(name, _)| &**name == bin)?;
+        let resolved = &cache.entries[idx].1;
+        let len = resolved.len();
+        buf[..len].copy_from_slice(resolved);
+        buf[len] = 0;
+        // SAFETY: buf[len] == 0 written above
+        if bun_sys::is_executable_file_path(ZStr::from_buf(&buf[..], len)) {
+            Some(len)
+        } else {
+            // The remembered target was unlinked or chmod'd; re-walk.
+            cache.entries.swap_remove(idx);
+            None
+        }
+    });
+    if let Some(len) = cached_len {
+        HITS.fetch_add(1, Ordering::Relaxed);
+        // SAFETY: buf[len] == 0 written in the closure above
+        return Some(ZStr::from_buf(&buf[..], len));
+    }
+
+    let found = crate::which_for_spawn(buf, path, cwd, bin)?;
+    MISSES.fetch_add(1, Ordering::Relaxed);
+    CACHE.with(|cache| {
+        let mut cache = cache.borrow_mut();
+        if cache.entries.len() >= MAX_ENTRIES {
+            cache.entries.clear();
+        }
+        cache.entries.push((bin.into(), found.as_bytes().into()));
+    });
+    Some(found)
+}
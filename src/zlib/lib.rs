@@ -141,6 +141,11 @@ unsafe extern "C" {
 
     pub fn inflateReset(stream: *mut zStream_struct) -> ReturnCode;
 
+    /// Like inflateReset, but also permits changing the wrap and window size requests. The window_size parameter is interpreted the same as it is for inflateInit2. If the window size is changed, then the memory allocated for the window is freed, and the window will be reallocated by inflate() if needed.
+    ///
+    /// inflateReset2 returns Z_OK if success, or Z_STREAM_ERROR if the source stream state was inconsistent (such as zalloc or state being Z_NULL), or if the window_size parameter is invalid.
+    pub fn inflateReset2(stream: *mut zStream_struct, window_size: c_int) -> ReturnCode;
+
     pub fn crc32(crc: uLong, buf: *const Bytef, len: uInt) -> uLong;
 }
 
@@ -22,6 +22,23 @@ describe("bundler", () => {
     },
     run: { stdout: "Hello, world!", stderr: "" },
   });
+  // `--target` accepts a comma-separated list for multi-target compiles; the
+  // whole list is validated up front, before any per-target worker spawns.
+  test("compile/MultiTargetRejectsInvalidListEntry", async () => {
+    using dir = tempDir("compile-multi-target-invalid", {
+      "entry.ts": `console.log("hi");`,
+    });
+    await using proc = Bun.spawn({
+      cmd: [bunExe(), "build", "--compile", "--target=bun-linux-x64,linux-arm64", "./entry.ts"],
+      env: bunEnv,
+      cwd: String(dir),
+      stdout: "pipe",
+      stderr: "pipe",
+    });
+    const [, stderr, exitCode] = await Promise.all([proc.stdout.text(), proc.stderr.text(), proc.exited]);
+    expect(stderr).toContain("Unsupported compile target: linux-arm64");
+    expect(exitCode).toBe(1);
+  });
   // --footer/--banner are concatenated verbatim (UTF-8). Guard against the
   // standalone module graph treating those bytes as Latin-1, which would
   // print "rÃ©sumÃ©" / "ã\x81\x93ã\x82\x93..." (one Latin-1 char per UTF-8
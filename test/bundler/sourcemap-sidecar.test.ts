@@ -0,0 +1,71 @@
+import { describe, expect, test } from "bun:test";
+import { bunEnv, bunExe, tempDir } from "harness";
+import { join } from "path";
+
+describe.concurrent("binary sourcemap sidecar", () => {
+  const helperFiles = {
+    "helper.js": `export function helperFunction() {
+  throw new Error("Error from helper module");
+}`,
+    "app.js": `import { helperFunction } from "./helper.js";
+
+helperFunction();`,
+  };
+
+  async function build(dir: unknown) {
+    const result = await Bun.build({
+      entrypoints: [join(String(dir), "app.js")],
+      outdir: join(String(dir), "out"),
+      target: "bun",
+      sourcemap: "linked",
+    });
+    expect(result.success).toBe(true);
+    return join(String(dir), "out", "app.js");
+  }
+
+  async function expectRemappedStack(dir: unknown, entry: string) {
+    await using proc = Bun.spawn({
+      cmd: [bunExe(), entry],
+      env: bunEnv,
+      cwd: String(dir),
+      stderr: "pipe",
+    });
+    const [stderr, exitCode] = await Promise.all([proc.stderr.text(), proc.exited]);
+    expect(stderr).toContain("helper.js");
+    expect(exitCode).not.toBe(0);
+  }
+
+  test("bun-target builds emit a .map.bin next to the .map and stack traces remap", async () => {
+    using dir = tempDir("sourcemap-sidecar", helperFiles);
+    const entry = await build(dir);
+
+    expect(await Bun.file(`${entry}.map`).exists()).toBe(true);
+    expect(await Bun.file(`${entry}.map.bin`).exists()).toBe(true);
+
+    await expectRemappedStack(dir, entry);
+  });
+
+  test("a stale sidecar is ignored and the JSON map still remaps", async () => {
+    using dir = tempDir("sourcemap-sidecar-stale", helperFiles);
+    const entry = await build(dir);
+
+    // Grow the .map without rewriting the sidecar: the recorded length no
+    // longer matches, so the runtime must fall back to parsing the JSON.
+    const mapPath = `${entry}.map`;
+    await Bun.write(mapPath, (await Bun.file(mapPath).text()) + " ");
+
+    await expectRemappedStack(dir, entry);
+  });
+
+  test("a corrupt sidecar is ignored and the JSON map still remaps", async () => {
+    using dir = tempDir("sourcemap-sidecar-corrupt", helperFiles);
+    const entry = await build(dir);
+
+    const sidecarPath = `${entry}.map.bin`;
+    const bytes = new Uint8Array(await Bun.file(sidecarPath).arrayBuffer());
+    bytes.fill(0xff, 0, Math.min(bytes.length, 16));
+    await Bun.write(sidecarPath, bytes);
+
+    await expectRemappedStack(dir, entry);
+  });
+});
@@ -0,0 +1,68 @@
+import { expect, test } from "bun:test";
+import { existsSync, unlinkSync } from "fs";
+import { bunEnv, bunExe, tempDir } from "harness";
+import { join } from "path";
+
+const env = { ...bunEnv, BUN_RESOLUTION_CACHE: "1" };
+
+async function run(dir: unknown, expected: string) {
+  await using proc = Bun.spawn({
+    cmd: [bunExe(), "index.js"],
+    env,
+    cwd: String(dir),
+    stderr: "pipe",
+  });
+  const [stdout, stderr, exitCode] = await Promise.all([proc.stdout.text(), proc.stderr.text(), proc.exited]);
+  expect(stderr).toBe("");
+  expect(stdout).toBe(expected);
+  expect(exitCode).toBe(0);
+}
+
+test.concurrent("persists bare require() resolutions and reuses them across runs", async () => {
+  using dir = tempDir("resolution-cache", {
+    "package.json": `{ "name": "app" }`,
+    "index.js": `console.log(require("dep")());`,
+    "node_modules/dep/package.json": `{ "name": "dep", "main": "main.js" }`,
+    "node_modules/dep/main.js": `module.exports = () => "dep-value";`,
+  });
+
+  // First run records, second run resolves from the on-disk cache.
+  await run(dir, "dep-value\n");
+  expect(existsSync(join(String(dir), "node_modules/.cache/bun/resolve.cache"))).toBe(true);
+  await run(dir, "dep-value\n");
+});
+
+test.concurrent("a stale recorded path falls back to the directory walk", async () => {
+  using dir = tempDir("resolution-cache-stale", {
+    "package.json": `{ "name": "app" }`,
+    "index.js": `console.log(require("dep")());`,
+    "node_modules/dep/package.json": `{ "name": "dep", "main": "main.js" }`,
+    "node_modules/dep/main.js": `module.exports = () => "old-value";`,
+  });
+
+  await run(dir, "old-value\n");
+
+  // Repoint the package without touching the top-level package.json: the
+  // recorded path no longer resolves, so the walk must run again.
+  await Bun.write(
+    join(String(dir), "node_modules/dep/package.json"),
+    `{ "name": "dep", "main": "other.js" }`,
+  );
+  await Bun.write(join(String(dir), "node_modules/dep/other.js"), `module.exports = () => "new-value";`);
+  unlinkSync(join(String(dir), "node_modules/dep/main.js"));
+
+  await run(dir, "new-value\n");
+});
+
+test.concurrent("changing the top-level package.json invalidates the cache", async () => {
+  using dir = tempDir("resolution-cache-invalidate", {
+    "package.json": `{ "name": "app" }`,
+    "index.js": `console.log(require("dep")());`,
+    "node_modules/dep/package.json": `{ "name": "dep", "main": "main.js" }`,
+    "node_modules/dep/main.js": `module.exports = () => "dep-value";`,
+  });
+
+  await run(dir, "dep-value\n");
+  await Bun.write(join(String(dir), "package.json"), `{ "name": "app-renamed" }`);
+  await run(dir, "dep-value\n");
+});
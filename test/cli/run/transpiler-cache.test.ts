@@ -223,6 +223,45 @@ describe("transpiler cache", () => {
     expect(b.stdout == "production 5");
     expect(newCacheCount()).toBe(0);
   });
+  test("bytecode sidecar is written on a miss and reused on a hit", () => {
+    writeFileSync(join(temp_dir, "a.js"), dummyFile((50 * 1024 * 1.5) | 0, "1", "bc"));
+    const bc_env = { ...env, BUN_RUNTIME_TRANSPILER_CACHE_BYTECODE: "1" };
+
+    // Miss: writes the transpiled entry plus its bytecode sidecar.
+    const a = bunRun(join(temp_dir, "a.js"), bc_env);
+    expect(a.stdout).toBe("bc");
+    expect(newCacheCount()).toBe(2);
+    expect(readdirSync(cache_dir).filter(f => f.endsWith(".pile-bc"))).toHaveLength(1);
+
+    // Hit: the sidecar is handed to JSC; no new files.
+    const b = bunRun(join(temp_dir, "a.js"), bc_env);
+    expect(b.stdout).toBe("bc");
+    expect(newCacheCount()).toBe(0);
+
+    // Without the flag the hit path ignores the sidecar.
+    const c = bunRun(join(temp_dir, "a.js"), env);
+    expect(c.stdout).toBe("bc");
+    expect(newCacheCount()).toBe(0);
+  });
+  test("corrupt bytecode sidecar falls back to the transpiled entry", () => {
+    writeFileSync(join(temp_dir, "a.js"), dummyFile((50 * 1024 * 1.5) | 0, "1", "bc2"));
+    const bc_env = { ...env, BUN_RUNTIME_TRANSPILER_CACHE_BYTECODE: "1" };
+
+    const a = bunRun(join(temp_dir, "a.js"), bc_env);
+    expect(a.stdout).toBe("bc2");
+    expect(newCacheCount()).toBe(2);
+
+    const sidecar = readdirSync(cache_dir).find(f => f.endsWith(".pile-bc"))!;
+    const data = readFileSync(join(cache_dir, sidecar));
+    data.fill(0xff, data.length - 16);
+    writeFileSync(join(cache_dir, sidecar), data);
+
+    // The bad-hash sidecar is deleted and the plain entry still satisfies the
+    // hit, so the run both works and nets out to one fewer cache file.
+    const b = bunRun(join(temp_dir, "a.js"), bc_env);
+    expect(b.stdout).toBe("bc2");
+    expect(newCacheCount()).toBe(-1);
+  });
   test("--feature flag invalidates cache", () => {
     // feature() can only appear in an if/ternary, so wrap it
     const code = `import { feature } from "bun:bundle";\nif (feature("SUPER_SECRET")) console.log("enabled"); else console.log("disabled");`;
@@ -129,3 +129,30 @@ describe("Bun.deepEquals strict mode", () => {
     expect(Bun.deepEquals(Object.create(null), {}, true)).toBe(false);
   });
 });
+
+// Exercises the structure plan cache: one comparison re-encounters the same
+// hidden class for every element, so later rows take the cached-offsets path.
+describe.each([true, false])("Bun.deepEquals with many same-shaped objects (strict: %p)", strict => {
+  const makeRows = (count: number) =>
+    Array.from({ length: count }, (_, i) => ({ id: i, name: `row-${i}`, tags: ["a", "b"] }));
+
+  it("large arrays of same-shaped rows compare equal", () => {
+    expect(Bun.deepEquals(makeRows(1000), makeRows(1000), strict)).toBe(true);
+  });
+
+  it("detects a mismatch deep inside a late row", () => {
+    const a = makeRows(1000);
+    const b = makeRows(1000);
+    b[987].tags[1] = "c";
+    expect(Bun.deepEquals(a, b, strict)).toBe(false);
+  });
+
+  it("still ignores non-enumerable properties on a shared shape", () => {
+    const makeRow = () => {
+      const row = { id: 1 };
+      Object.defineProperty(row, "hidden", { value: Math.random(), enumerable: false });
+      return row;
+    };
+    expect(Bun.deepEquals([makeRow(), makeRow()], [makeRow(), makeRow()], strict)).toBe(true);
+  });
+});
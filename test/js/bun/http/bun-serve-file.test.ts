@@ -490,7 +490,7 @@ describe("Bun.file in serve routes", () => {
         if (method === "GET") expect(await res.text()).toBe("Hello, World!");
       });
 
-      it("If-Match: * on a file route without a stored ETag → 200", async () => {
+      it("If-Match: * on a file route without a user-set ETag → 200", async () => {
         const res = await fetch(new URL(`/hello-blob.txt`, server.url), {
           method,
           headers: { "If-Match": "*" },
@@ -498,7 +498,7 @@ describe("Bun.file in serve routes", () => {
         expect(res.status).toBe(200);
       });
 
-      it("If-Match: tag list on a file route without a stored ETag → 412", async () => {
+      it("If-Match: tag list on a file route without a user-set ETag → 412", async () => {
         const res = await fetch(new URL(`/hello-blob.txt`, server.url), {
           method,
           headers: { "If-Match": '"anything"' },
@@ -561,9 +561,11 @@ describe("Bun.file in serve routes", () => {
       });
     });
 
-    it.todo("handles ETag", async () => {
+    it("handles ETag", async () => {
       const res1 = await fetch(new URL(`/hello.txt`, server.url));
       const etag = res1.headers.get("ETag");
+      // Strong quoted tag derived from the stat hash.
+      expect(etag).toMatch(/^"[0-9a-f]{16}"$/);
 
       const res2 = await fetch(new URL(`/hello.txt`, server.url), {
         headers: {
@@ -572,8 +574,15 @@ describe("Bun.file in serve routes", () => {
       });
 
       expect(res2.status).toBe(304);
+      expect(res2.headers.get("ETag")).toBe(etag);
       expect(await res2.text()).toBe("");
     });
+
+    it("user-set ETag header suppresses the computed one", async () => {
+      const res = await fetch(new URL(`/with-etag.txt`, server.url));
+      expect(res.status).toBe(200);
+      expect(res.headers.get("ETag")).toBe('"custom-etag"');
+    });
   });
 
   describe("Stress testing", () => {
@@ -1279,3 +1288,31 @@ test("file route serves a burst of concurrent requests after reloads", async ()
   const a = await fetch(`${server.url}a`).then(r => r.text());
   expect(a).toBe("a-new");
 });
+
+test("fd-backed Bun.file route serves the descriptor across concurrent requests", async () => {
+  using dir = tempDir("file-route-fd", {
+    "hello.txt": "hello from an fd route",
+  });
+  const body = "hello from an fd route";
+  const { openSync, closeSync } = await import("node:fs");
+  const fd = openSync(join(String(dir), "hello.txt"), "r");
+  try {
+    await using server = Bun.serve({
+      port: 0,
+      routes: { "/f": new Response(Bun.file(fd)) },
+      fetch: () => new Response("fallback", { status: 404 }),
+    });
+
+    // The store owns the fd for the route's lifetime; every request streams
+    // from it at an explicit offset, so concurrent reads must not interleave.
+    const N = 32;
+    const bodies = await Promise.all(Array.from({ length: N }, () => fetch(`${server.url}f`).then(r => r.text())));
+    expect(bodies).toEqual(Array(N).fill(body));
+
+    const head = await fetch(`${server.url}f`, { method: "HEAD" });
+    expect(await head.text()).toBe("");
+    expect(head.status).toBe(200);
+  } finally {
+    closeSync(fd);
+  }
+});
@@ -345,3 +345,53 @@ describe("static route preconditions (RFC 9110 §13.2.2)", () => {
     });
   });
 });
+
+describe("server.cache", () => {
+  test("a cached path is served without invoking the fetch handler", async () => {
+    const handler = mock(() => new Response("from handler"));
+    using server = Bun.serve({ port: 0, fetch: handler });
+
+    expect(server.cache("/stats", Response.json({ ok: true }))).toBe(true);
+
+    const res = await fetch(new URL("/stats", server.url));
+    expect(await res.json()).toEqual({ ok: true });
+    expect(res.headers.get("content-type")).toBe("application/json;charset=utf-8");
+    expect(handler).toHaveBeenCalledTimes(0);
+
+    // Other paths and non-GET/HEAD methods still reach the handler.
+    await fetch(new URL("/other", server.url)).then(r => r.text());
+    await fetch(new URL("/stats", server.url), { method: "POST" }).then(r => r.text());
+    expect(handler).toHaveBeenCalledTimes(2);
+  });
+
+  test("cache(path) invalidates", async () => {
+    const handler = mock(() => new Response("from handler"));
+    using server = Bun.serve({ port: 0, fetch: handler });
+
+    server.cache("/a", new Response("cached"));
+    expect(await (await fetch(new URL("/a", server.url))).text()).toBe("cached");
+
+    expect(server.cache("/a")).toBe(true);
+    expect(server.cache("/a")).toBe(false); // already gone
+    expect(await (await fetch(new URL("/a", server.url))).text()).toBe("from handler");
+  });
+
+  test("an entry past its ttlMs falls through to the fetch handler", async () => {
+    const handler = mock(() => new Response("from handler"));
+    using server = Bun.serve({ port: 0, fetch: handler });
+
+    server.cache("/b", new Response("cached"), { ttlMs: 1 });
+
+    // Poll until the deadline passes rather than sleeping a fixed amount.
+    const deadline = Date.now() + 5_000;
+    while (Date.now() < deadline) {
+      if ((await (await fetch(new URL("/b", server.url))).text()) === "from handler") break;
+    }
+    expect(handler).toHaveBeenCalled();
+  });
+
+  test("rejects paths that do not start with '/'", () => {
+    using server = Bun.serve({ port: 0, fetch: () => new Response("x") });
+    expect(() => server.cache("no-slash", new Response("x"))).toThrow("path starting with '/'");
+  });
+});
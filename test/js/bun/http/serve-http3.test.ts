@@ -425,6 +425,36 @@ describe("Bun.serve HTTP/3", () => {
     });
   });
 
+  test("quic object form supplies the certificate and enables HTTP/3", async () => {
+    const script = `
+      const server = Bun.serve({
+        port: 0, quic: ${JSON.stringify(tls)},
+        fetch: () => new Response("ok over quic"),
+      });
+      console.error("PORT=" + server.port);
+      ${STOP_ON_STDIN_END}
+    `;
+    await withCustomServer(script, async port => {
+      expect(await fetchH3(port, "/").then(r => r.text())).toBe("ok over quic");
+    });
+  });
+
+  test("validation: certificates in both tls and quic throw", async () => {
+    await using proc = Bun.spawn({
+      cmd: [
+        bunExe(),
+        "-e",
+        `Bun.serve({ port: 0, tls: ${JSON.stringify(tls)}, quic: ${JSON.stringify(tls)}, fetch: () => new Response("x") })`,
+      ],
+      env: bunEnv,
+      stdout: "pipe",
+      stderr: "pipe",
+    });
+    const [stderr, exitCode] = await Promise.all([proc.stderr.text(), proc.exited]);
+    expect(stderr).toContain("either 'tls' or 'quic'");
+    expect(exitCode).not.toBe(0);
+  });
+
   test("validation: http3 without tls throws", async () => {
     await using proc = Bun.spawn({
       cmd: [bunExe(), "-e", "Bun.serve({ port: 0, http3: true, fetch: () => new Response('x') })"],
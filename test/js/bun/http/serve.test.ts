@@ -3650,6 +3650,22 @@ describe("a client half-close after the request does not truncate a large respon
   });
 });
 
+it("server.metrics() exposes backpressure counters and histograms", async () => {
+  using server = serve({ port: 0, fetch: () => new Response("ok") });
+  const res = await fetch(server.url);
+  expect(await res.text()).toBe("ok");
+
+  const metrics = server.metrics();
+  expect(metrics.backpressureEvents).toBeGreaterThanOrEqual(0);
+  expect(metrics.drainEvents).toBeGreaterThanOrEqual(0);
+  expect(metrics.bufferedBytesTotal).toBeGreaterThanOrEqual(0);
+  // The histograms are node:perf_hooks Histogram objects, lazily allocated by
+  // the first metrics() call.
+  expect(typeof metrics.bufferedBytes.percentile).toBe("function");
+  expect(typeof metrics.drainLatency.percentile).toBe("function");
+  expect(metrics.drainLatency).toBe(server.metrics().drainLatency);
+});
+
 // The node:http compat parser tolerates empty lines (and a bare CR/LF) before the
 // request-line like llhttp's s_start state. That leniency must stay behind the
 // node-http flag: Bun.serve still rejects a request that does not begin with the
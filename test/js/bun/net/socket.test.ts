@@ -7,6 +7,7 @@ import {
   bunEnv,
   bunExe,
   expectMaxObjectTypeCount,
+  expiredTls,
   getMaxFD,
   isLinux,
   isWindows,
@@ -651,6 +652,106 @@ describe.concurrent("socket", () => {
     }
   });
 
+  // `sessionCacheSize` turns on BoringSSL's internal server-side session-ID
+  // cache, so a TLS 1.2 client re-presenting its session skips the full
+  // handshake. SSL_OP_NO_TICKET forces the session-ID path — with tickets the
+  // client would resume statelessly and the test would prove nothing about
+  // the cache.
+  it("tls sessionCacheSize enables server-side session resumption", async () => {
+    const SSL_OP_NO_TICKET = 0x4000;
+    const server = Bun.listen({
+      hostname: "127.0.0.1",
+      port: 0,
+      socket: {
+        data() {},
+        close() {},
+        error() {},
+      },
+      tls: {
+        cert: tls.cert,
+        key: tls.key,
+        sessionCacheSize: 128,
+        secureOptions: SSL_OP_NO_TICKET,
+      },
+    });
+    const connectOnce = (session?: Buffer) =>
+      new Promise<{ session: Buffer; reused: boolean }>((resolve, reject) => {
+        const client = tlsConnect({
+          port: server.port,
+          host: "127.0.0.1",
+          rejectUnauthorized: false,
+          maxVersion: "TLSv1.2",
+          session,
+        });
+        client.on("secureConnect", () => {
+          const result = { session: client.getSession()!, reused: client.isSessionReused() };
+          client.end();
+          resolve(result);
+        });
+        client.on("error", reject);
+      });
+    try {
+      const first = await connectOnce();
+      expect(first.reused).toBe(false);
+      expect(first.session).toBeInstanceOf(Buffer);
+      const second = await connectOnce(first.session);
+      expect(second.reused).toBe(true);
+    } finally {
+      server.stop(true);
+    }
+  });
+
+  // The peer-chain verdict cache (keyed by chain fingerprint) must never let
+  // one client's successful verification leak onto a different chain: after a
+  // trusted client cert verifies (and is cached), an expired self-signed
+  // client cert on the same server must still fail verification.
+  it("tls client-cert verification stays per-chain across connections", async () => {
+    const verdicts: (Error | null)[] = [];
+    const waiters: (() => void)[] = [];
+    const server = Bun.listen({
+      hostname: "127.0.0.1",
+      port: 0,
+      socket: {
+        handshake(_socket, _success, authorizationError) {
+          verdicts.push(authorizationError ?? null);
+          waiters.shift()?.();
+        },
+        data() {},
+        close() {},
+        error() {},
+      },
+      tls: {
+        cert: tls.cert,
+        key: tls.key,
+        ca: tls.cert,
+        requestCert: true,
+        rejectUnauthorized: false,
+      },
+    });
+    const connectWith = (clientTls: object) =>
+      new Promise<void>((resolve, reject) => {
+        waiters.push(resolve);
+        const client = tlsConnect({
+          port: server.port,
+          host: "127.0.0.1",
+          rejectUnauthorized: false,
+          ...clientTls,
+        });
+        client.on("secureConnect", () => client.end());
+        client.on("error", reject);
+      });
+    try {
+      await connectWith(tls);
+      await connectWith(tls);
+      await connectWith(expiredTls);
+      expect(verdicts[0]).toBeNull();
+      expect(verdicts[1]).toBeNull();
+      expect(verdicts[2]).not.toBeNull();
+    } finally {
+      server.stop(true);
+    }
+  });
+
   it("upgradeTLS handles errors", async () => {
     using server = Bun.serve({
       port: 0,
@@ -30,3 +30,48 @@ test("concurrent dynamic imports of the same module both resolve", async () => {
   expect(stdout.trim()).toBe("ok");
   expect(exitCode).toBe(0);
 });
+
+// Speculative pre-transpilation (a worker parses a module's relative imports
+// before the registry asks for them) must be invisible: identical results
+// with the feature on and off, including when the speculated module-type
+// guess is wrong (a CJS dep under TS importers) and when a speculated file
+// is never actually imported.
+test.concurrent.each([
+  ["enabled", {}],
+  ["disabled", { BUN_FEATURE_FLAG_DISABLE_SPECULATIVE_TRANSPILE: "1" }],
+])("speculative import pre-loading is transparent (%s)", async (_name, extraEnv) => {
+  using dir = tempDir("speculative-preload", {
+    "entry.mjs": `
+      const { chain } = await import("./a.ts");
+      console.log(chain);
+    `,
+    "a.ts": `
+      import { b } from "./b";
+      import { maybe } from "./conditional";
+      export const chain = "a->" + b + (maybe ? "!" : "");
+    `,
+    "b.ts": `
+      import c from "./c.cjs";
+      export const b = "b->" + c;
+    `,
+    "c.cjs": `module.exports = "c";`,
+    "conditional.ts": `
+      export const maybe = false;
+      export function unused() {
+        return import("./never-imported");
+      }
+    `,
+    "never-imported.ts": `export default "never";`,
+  });
+
+  await using proc = Bun.spawn({
+    cmd: [bunExe(), "entry.mjs"],
+    cwd: String(dir),
+    env: { ...bunEnv, ...extraEnv },
+    stdio: ["ignore", "pipe", "pipe"],
+  });
+  const [stdout, stderr, exitCode] = await Promise.all([proc.stdout.text(), proc.stderr.text(), proc.exited]);
+  expect(stderr).toBe("");
+  expect(stdout.trim()).toBe("a->b->c");
+  expect(exitCode).toBe(0);
+});
@@ -0,0 +1,70 @@
+import { describe, expect, test } from "bun:test";
+
+describe("Bun.scheduler", () => {
+  test("postTask resolves with the callback's return value", async () => {
+    expect(await Bun.scheduler.postTask(() => 42)).toBe(42);
+    expect(await Bun.scheduler.postTask(async () => "async")).toBe("async");
+  });
+
+  test("postTask rejects when the callback throws", async () => {
+    await expect(
+      Bun.scheduler.postTask(() => {
+        throw new Error("boom");
+      }),
+    ).rejects.toThrow("boom");
+  });
+
+  test("postTask validates its arguments", () => {
+    // @ts-expect-error intentionally not a function
+    expect(() => Bun.scheduler.postTask("nope")).toThrow();
+    expect(() => Bun.scheduler.postTask(() => {}, { priority: "urgent" as any })).toThrow();
+  });
+
+  test("higher-priority tasks run before lower-priority ones", async () => {
+    const order: string[] = [];
+    const tasks = [
+      Bun.scheduler.postTask(() => order.push("background"), { priority: "background" }),
+      Bun.scheduler.postTask(() => order.push("visible")),
+      Bun.scheduler.postTask(() => order.push("blocking"), { priority: "user-blocking" }),
+    ];
+    await Promise.all(tasks);
+    expect(order).toEqual(["blocking", "visible", "background"]);
+  });
+
+  test("queueDepths reports queued tasks per tier", async () => {
+    const posted = [
+      Bun.scheduler.postTask(() => {}, { priority: "user-blocking" }),
+      Bun.scheduler.postTask(() => {}, { priority: "background" }),
+      Bun.scheduler.postTask(() => {}, { priority: "background" }),
+    ];
+    const depths = Bun.scheduler.queueDepths();
+    expect(depths["user-blocking"]).toBe(1);
+    expect(depths["background"]).toBe(2);
+    await Promise.all(posted);
+    const drained = Bun.scheduler.queueDepths();
+    expect(drained["user-blocking"]).toBe(0);
+    expect(drained["user-visible"]).toBe(0);
+    expect(drained["background"]).toBe(0);
+  });
+
+  test("background tasks are not starved by a user-blocking flood", async () => {
+    let backgroundRan = false;
+    const done = Bun.scheduler.postTask(() => {
+      backgroundRan = true;
+    }, { priority: "background" });
+
+    // Re-posting user-blocking work keeps the top tier non-empty; aging must
+    // still let the background task through.
+    let floods = 0;
+    const flood = () => {
+      if (backgroundRan || floods >= 1000) return;
+      floods++;
+      Bun.scheduler.postTask(flood, { priority: "user-blocking" });
+    };
+    flood();
+
+    await done;
+    expect(backgroundRan).toBe(true);
+    expect(floods).toBeLessThan(1000);
+  });
+});
@@ -1,6 +1,6 @@
 import { expect, test } from "bun:test";
-import { chmodSync } from "fs";
-import { bunEnv, isWindows, tempDirWithFiles } from "harness";
+import { chmodSync, rmSync } from "fs";
+import { bunEnv, bunExe, isWindows, tempDirWithFiles } from "harness";
 import path from "path";
 
 test.skipIf(isWindows)("spawn uses PATH from env if present", async () => {
@@ -24,3 +24,60 @@ echo "hello from script"`,
   const status = await proc.exited;
   expect(status).toBe(0);
 });
+
+test.skipIf(isWindows)("PATH cache revalidates when the resolved binary disappears", async () => {
+  const tmpDir = await tempDirWithFiles("spawn-path-cache", {
+    "cached-script": `#!/usr/bin/env bash
+echo "from cache"`,
+  });
+  chmodSync(path.join(tmpDir, "cached-script"), 0o777);
+  const env = { ...bunEnv, PATH: tmpDir + ":" + bunEnv.PATH };
+
+  // Two spawns so the second one resolves through the cache.
+  for (let i = 0; i < 2; i++) {
+    const proc = Bun.spawn(["cached-script"], { env });
+    expect((await proc.stdout.text()).trim()).toBe("from cache");
+    expect(await proc.exited).toBe(0);
+  }
+
+  // The cached resolution must not outlive the file: deleting it has to make
+  // the next spawn fail to resolve, not exec a stale path.
+  rmSync(path.join(tmpDir, "cached-script"));
+  expect(() => Bun.spawnSync({ cmd: ["cached-script"], env })).toThrow();
+});
+
+// The counters are process-wide, so read them in a subprocess where this
+// test's spawns are the only spawns.
+test.skipIf(isWindows)("spawnStats counts spawns, latency, and PATH cache hits", async () => {
+  await using proc = Bun.spawn({
+    cmd: [
+      bunExe(),
+      "-e",
+      `
+      import { spawnStats } from "bun:internal-for-testing";
+      const before = spawnStats();
+      for (let i = 0; i < 5; i++) {
+        Bun.spawnSync({ cmd: ["echo", "hi"] });
+      }
+      const after = spawnStats();
+      console.log(JSON.stringify({
+        spawns: after.spawns - before.spawns,
+        nanosPositive: after.totalSpawnNanos > before.totalSpawnNanos,
+        hits: after.pathCacheHits - before.pathCacheHits,
+        misses: after.pathCacheMisses - before.pathCacheMisses,
+      }));
+      process.exit(0);
+      `,
+    ],
+    env: bunEnv,
+    stdout: "pipe",
+    stderr: "pipe",
+  });
+
+  const [stdout, stderr, exitCode] = await Promise.all([proc.stdout.text(), proc.stderr.text(), proc.exited]);
+  const result = stdout.startsWith("{") ? JSON.parse(stdout.trim()) : { stdout, stderr };
+  // "echo" is a bare name resolved against an unchanging $PATH: the first
+  // spawn walks (one miss), the remaining four hit the cache.
+  expect(result).toEqual({ spawns: 5, nanosPositive: true, hits: 4, misses: 1 });
+  expect(exitCode).toBe(0);
+});
@@ -113,6 +113,323 @@ describe("safeIntegers", () => {
   });
 });
 
+describe("columnar", () => {
+  it("returns typed arrays for numeric columns and plain arrays for the rest", () => {
+    const db = Database.open(":memory:");
+    db.exec("CREATE TABLE foo (id INTEGER PRIMARY KEY, score REAL, name TEXT, data BLOB)");
+    db.run("INSERT INTO foo VALUES (1, 1.5, 'alice', ?)", new Uint8Array([1, 2]));
+    db.run("INSERT INTO foo VALUES (2, 2.5, 'bob', ?)", new Uint8Array([3]));
+    db.run("INSERT INTO foo VALUES (3, 3.5, 'carol', NULL)");
+
+    const result = db.query("SELECT * FROM foo ORDER BY id").columnar();
+    expect(result).toEqual({
+      id: new Float64Array([1, 2, 3]),
+      score: new Float64Array([1.5, 2.5, 3.5]),
+      name: ["alice", "bob", "carol"],
+      data: [new Uint8Array([1, 2]), new Uint8Array([3]), null],
+    });
+  });
+
+  it("mixes integers and floats into a Float64Array", () => {
+    const db = Database.open(":memory:");
+    db.exec("CREATE TABLE foo (n NUMERIC)");
+    db.exec("INSERT INTO foo VALUES (1), (2.5), (3)");
+
+    expect(db.query("SELECT n FROM foo").columnar()).toEqual({ n: new Float64Array([1, 2.5, 3]) });
+  });
+
+  it("returns BigInt64Array for integer columns with safeIntegers", () => {
+    const db = Database.open(":memory:", { safeIntegers: true });
+    db.exec("CREATE TABLE foo (id INTEGER PRIMARY KEY AUTOINCREMENT, age INTEGER NOT NULL)");
+    db.run("INSERT INTO foo (age) VALUES (?)", BigInt(Number.MAX_SAFE_INTEGER) + 10n);
+    db.run("INSERT INTO foo (age) VALUES (?)", 42n);
+
+    const result = db.query("SELECT * FROM foo ORDER BY id").columnar();
+    expect(result).toEqual({
+      id: new BigInt64Array([1n, 2n]),
+      age: new BigInt64Array([BigInt(Number.MAX_SAFE_INTEGER) + 10n, 42n]),
+    });
+  });
+
+  it("demotes a numeric column to a plain array when a NULL or text appears", () => {
+    const db = Database.open(":memory:");
+    db.exec("CREATE TABLE foo (n)");
+    db.exec("INSERT INTO foo VALUES (1), (2), (NULL), ('three')");
+
+    expect(db.query("SELECT n FROM foo").columnar()).toEqual({ n: [1, 2, null, "three"] });
+  });
+
+  it("binds parameters like values()", () => {
+    const db = Database.open(":memory:");
+    db.exec("CREATE TABLE foo (id INTEGER, name TEXT)");
+    db.exec("INSERT INTO foo VALUES (1, 'alice'), (2, 'bob')");
+
+    const stmt = db.prepare("SELECT id, name FROM foo WHERE id = ?");
+    expect(stmt.columnar(2)).toEqual({ id: new Float64Array([2]), name: ["bob"] });
+    expect(stmt.columnar(1)).toEqual({ id: new Float64Array([1]), name: ["alice"] });
+  });
+
+  it("returns empty columns when there are no rows", () => {
+    const db = Database.open(":memory:");
+    db.exec("CREATE TABLE foo (id INTEGER, name TEXT)");
+
+    expect(db.query("SELECT id, name FROM foo").columnar()).toEqual({
+      id: new Float64Array(0),
+      name: new Float64Array(0),
+    });
+  });
+});
+
+describe("runBatch", () => {
+  it("executes once per row and counts the whole batch", () => {
+    const db = Database.open(":memory:");
+    db.exec("CREATE TABLE users (name TEXT, age INTEGER)");
+
+    const insert = db.prepare("INSERT INTO users (name, age) VALUES (?, ?)");
+    const changes = insert.runBatch([
+      ["alice", 30],
+      ["bob", 41],
+      ["carol", 52],
+    ]);
+    expect(changes.changes).toBe(3);
+    expect(changes.lastInsertRowid).toBe(3);
+
+    expect(db.query("SELECT name, age FROM users ORDER BY rowid").all()).toEqual([
+      { name: "alice", age: 30 },
+      { name: "bob", age: 41 },
+      { name: "carol", age: 52 },
+    ]);
+  });
+
+  it("binds named parameter objects per row", () => {
+    const db = Database.open(":memory:");
+    db.exec("CREATE TABLE users (name TEXT, age INTEGER)");
+
+    const insert = db.prepare("INSERT INTO users (name, age) VALUES ($name, $age)");
+    insert.runBatch([
+      { $name: "alice", $age: 30 },
+      { $name: "bob", $age: 41 },
+    ]);
+
+    expect(db.query("SELECT name, age FROM users ORDER BY rowid").all()).toEqual([
+      { name: "alice", age: 30 },
+      { name: "bob", age: 41 },
+    ]);
+  });
+
+  it("rolls back the whole batch when a row fails", () => {
+    const db = Database.open(":memory:");
+    db.exec("CREATE TABLE users (id INTEGER PRIMARY KEY, name TEXT)");
+
+    const insert = db.prepare("INSERT INTO users (id, name) VALUES (?, ?)");
+    expect(() =>
+      insert.runBatch([
+        [1, "alice"],
+        [1, "duplicate"],
+        [2, "bob"],
+      ]),
+    ).toThrow();
+
+    expect(db.query("SELECT COUNT(*) as count FROM users").get()).toEqual({ count: 0 });
+  });
+
+  it("joins an already-open transaction instead of nesting one", () => {
+    const db = Database.open(":memory:");
+    db.exec("CREATE TABLE users (name TEXT)");
+
+    const insert = db.prepare("INSERT INTO users (name) VALUES (?)");
+    db.exec("BEGIN");
+    insert.runBatch([["alice"], ["bob"]]);
+    db.exec("ROLLBACK");
+
+    expect(db.query("SELECT COUNT(*) as count FROM users").get()).toEqual({ count: 0 });
+  });
+
+  it("throws a TypeError for non-array input and non-object rows", () => {
+    const db = Database.open(":memory:");
+    db.exec("CREATE TABLE users (name TEXT)");
+
+    const insert = db.prepare("INSERT INTO users (name) VALUES (?)");
+    expect(() => insert.runBatch("alice")).toThrow(TypeError);
+    expect(() => insert.runBatch([["alice"], "bob"])).toThrow(TypeError);
+  });
+
+  it("handles an empty batch", () => {
+    const db = Database.open(":memory:");
+    db.exec("CREATE TABLE users (name TEXT)");
+
+    const changes = db.prepare("INSERT INTO users (name) VALUES (?)").runBatch([]);
+    expect(changes.changes).toBe(0);
+  });
+});
+
+describe("resultCache", () => {
+  function makeDb(options = { resultCache: true }) {
+    const db = new Database(":memory:", options);
+    db.exec("CREATE TABLE foo (id INTEGER PRIMARY KEY, name TEXT, score REAL, data BLOB)");
+    db.run("INSERT INTO foo VALUES (1, 'alice', 1.5, ?)", new Uint8Array([1, 2]));
+    db.run("INSERT INTO foo VALUES (2, 'bob', 2.5, NULL)");
+    return db;
+  }
+
+  it("repeated queries return the same rows, per bound parameters", () => {
+    const db = makeDb();
+    const q = db.query("SELECT * FROM foo WHERE id = ?");
+    const expected = { id: 1, name: "alice", score: 1.5, data: new Uint8Array([1, 2]) };
+    expect(q.get(1)).toEqual(expected);
+    // Second execution is answered from the cache.
+    expect(q.get(1)).toEqual(expected);
+    expect(q.get(2)).toEqual({ id: 2, name: "bob", score: 2.5, data: null });
+
+    const all = db.query("SELECT name FROM foo ORDER BY id");
+    expect(all.all()).toEqual([{ name: "alice" }, { name: "bob" }]);
+    expect(all.all()).toEqual([{ name: "alice" }, { name: "bob" }]);
+  });
+
+  it("get() and all() of the same SQL don't share entries", () => {
+    const db = makeDb();
+    const sql = "SELECT name FROM foo ORDER BY id";
+    expect(db.query(sql).get()).toEqual({ name: "alice" });
+    expect(db.query(sql).all()).toEqual([{ name: "alice" }, { name: "bob" }]);
+  });
+
+  it("is invalidated by writes through prepared statements", () => {
+    const db = makeDb();
+    const q = db.query("SELECT count(*) as n FROM foo");
+    expect(q.get()).toEqual({ n: 2 });
+    db.run("INSERT INTO foo VALUES (3, 'carol', 3.5, NULL)");
+    expect(q.get()).toEqual({ n: 3 });
+    db.run("DELETE FROM foo WHERE id = 3");
+    expect(q.get()).toEqual({ n: 2 });
+  });
+
+  it("is invalidated by exec(), including DDL", () => {
+    const db = makeDb();
+    const q = db.query("SELECT count(*) as n FROM foo");
+    expect(q.get()).toEqual({ n: 2 });
+    db.exec("INSERT INTO foo VALUES (3, 'carol', 3.5, NULL)");
+    expect(q.get()).toEqual({ n: 3 });
+    // DELETE without WHERE takes sqlite's truncate optimization path.
+    db.exec("DELETE FROM foo");
+    expect(q.get()).toEqual({ n: 0 });
+  });
+
+  it("is invalidated by commits from another connection", () => {
+    const dir = tempDirWithFiles("sqlite-result-cache", { "empty.txt": "" });
+    const file = path.join(dir, "cache.sqlite");
+    const db = new Database(file, { resultCache: true });
+    db.exec("PRAGMA journal_mode = WAL");
+    db.exec("CREATE TABLE foo (id INTEGER PRIMARY KEY)");
+    db.exec("INSERT INTO foo VALUES (1)");
+
+    const q = db.query("SELECT count(*) as n FROM foo");
+    expect(q.get()).toEqual({ n: 1 });
+    expect(q.get()).toEqual({ n: 1 });
+
+    const other = new Database(file);
+    other.exec("INSERT INTO foo VALUES (2)");
+    other.close();
+
+    expect(q.get()).toEqual({ n: 2 });
+    db.close();
+  });
+
+  it("does not serve rows recorded inside a rolled-back transaction", () => {
+    const db = makeDb();
+    const q = db.query("SELECT count(*) as n FROM foo");
+    db.exec("BEGIN");
+    db.run("INSERT INTO foo VALUES (3, 'carol', 3.5, NULL)");
+    expect(q.get()).toEqual({ n: 3 });
+    db.exec("ROLLBACK");
+    expect(q.get()).toEqual({ n: 2 });
+  });
+
+  it("respects safeIntegers on replay", () => {
+    const db = new Database(":memory:", { resultCache: true, safeIntegers: true });
+    db.exec("CREATE TABLE big (n INTEGER)");
+    db.run("INSERT INTO big VALUES (?)", BigInt(Number.MAX_SAFE_INTEGER) + 10n);
+    const q = db.query("SELECT n FROM big");
+    expect(q.get()).toEqual({ n: BigInt(Number.MAX_SAFE_INTEGER) + 10n });
+    expect(q.get()).toEqual({ n: BigInt(Number.MAX_SAFE_INTEGER) + 10n });
+  });
+});
+
+describe("openBlob", () => {
+  function createArtifactDB(size) {
+    const db = Database.open(":memory:");
+    db.exec("CREATE TABLE artifacts (id INTEGER PRIMARY KEY, data BLOB)");
+    const data = new Uint8Array(size);
+    for (let i = 0; i < size; i++) data[i] = i & 0xff;
+    db.run("INSERT INTO artifacts (id, data) VALUES (1, ?)", data);
+    return { db, data };
+  }
+
+  it("streams a blob out in chunks", async () => {
+    const { db, data } = createArtifactDB(200_000);
+
+    const blob = db.openBlob("artifacts", "data", 1);
+    expect(blob.byteLength).toBe(data.length);
+
+    const chunks = [];
+    for await (const chunk of blob.stream(65536)) {
+      chunks.push(chunk);
+    }
+    expect(chunks.length).toBe(4);
+    expect(Buffer.concat(chunks)).toEqual(Buffer.from(data));
+
+    blob.close();
+    expect(blob.closed).toBe(true);
+  });
+
+  it("reads ranges incrementally", () => {
+    const { db, data } = createArtifactDB(1024);
+
+    using blob = db.openBlob("artifacts", "data", 1);
+    expect(blob.readAt(0, 4)).toEqual(data.subarray(0, 4));
+    expect(blob.readAt(1000, 24)).toEqual(data.subarray(1000, 1024));
+    expect(() => blob.readAt(1000, 100)).toThrow();
+  });
+
+  it("writes incrementally into a zeroblob placeholder", () => {
+    const db = Database.open(":memory:");
+    db.exec("CREATE TABLE artifacts (id INTEGER PRIMARY KEY, data BLOB)");
+    db.exec("INSERT INTO artifacts (id, data) VALUES (1, zeroblob(8))");
+
+    {
+      using blob = db.openBlob("artifacts", "data", 1, { write: true });
+      blob.writeAt(new Uint8Array([1, 2, 3, 4]), 0);
+      blob.writeAt(new Uint8Array([5, 6, 7, 8]), 4);
+    }
+
+    expect(db.query("SELECT data FROM artifacts WHERE id = 1").get().data).toEqual(
+      new Uint8Array([1, 2, 3, 4, 5, 6, 7, 8]),
+    );
+  });
+
+  it("rejects writes on a read-only blob and I/O after close", () => {
+    const { db } = createArtifactDB(16);
+
+    const blob = db.openBlob("artifacts", "data", 1);
+    expect(() => blob.writeAt(new Uint8Array(4))).toThrow();
+
+    blob.close();
+    blob.close(); // safe to call twice
+    expect(() => blob.readAt(0, 4)).toThrow("Blob has closed");
+  });
+
+  it("throws for a missing row", () => {
+    const { db } = createArtifactDB(16);
+    expect(() => db.openBlob("artifacts", "data", 9999)).toThrow(SQLiteError);
+  });
+
+  it("closes open blob handles when the database closes", () => {
+    const { db } = createArtifactDB(16);
+    const blob = db.openBlob("artifacts", "data", 1);
+    db.close(true);
+    expect(blob.closed).toBe(true);
+  });
+});
+
 {
   const strictInputs = [
     { name: "myname", age: 42 },
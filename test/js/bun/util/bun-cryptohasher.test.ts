@@ -52,6 +52,20 @@ test("CryptoHasher.update(str, 'hex') rejects odd-length hex like node:crypto",
     createHash("sha1").update(Buffer.from("abc")).digest("hex"),
   );
 });
+test("CryptoHasher.update(typedArray) in a hot loop matches node:crypto", () => {
+  // Hot enough to tier up into the DOMJIT fast path for update(typedArray);
+  // the digest proves every chunk reached the hasher either way.
+  const chunk = Buffer.alloc(64, 7);
+  const hasher = new Bun.CryptoHasher("sha256");
+  const reference = createHash("sha256");
+  for (let i = 0; i < 1000; i++) {
+    // update() returns this for chaining in both tiers.
+    expect(hasher.update(chunk)).toBe(hasher);
+    reference.update(chunk);
+  }
+  expect(hasher.digest("hex")).toBe(reference.digest("hex"));
+});
+
 test("CryptoHasher throws on non-latin1 algorithm names instead of crashing", () => {
   // @ts-expect-error
   expect(() => Bun.CryptoHasher.hash("🚀", "hello")).toThrow(/Unsupported algorithm/);
@@ -22,6 +22,16 @@ it(`Bun.hash.crc32()`, () => {
   gcTick();
   expect(Bun.hash.crc32(new TextEncoder().encode("hello world"))).toBe(0x0d4a1185);
 });
+it(`Bun.hash.crc32c()`, () => {
+  expect(Bun.hash.crc32c("hello world")).toBe(0xc99465aa);
+  gcTick();
+  expect(Bun.hash.crc32c(new TextEncoder().encode("hello world"))).toBe(0xc99465aa);
+  // Standard CRC catalogue check value and RFC 3720 zero vector.
+  expect(Bun.hash.crc32c("123456789")).toBe(0xe3069283);
+  expect(Bun.hash.crc32c(new Uint8Array(32))).toBe(0x8a9136aa);
+  // The seed is the running CRC, so hashing in two chunks chains.
+  expect(Bun.hash.crc32c("world", Bun.hash.crc32c("hello "))).toBe(0xc99465aa);
+});
 it(`Bun.hash.cityHash32()`, () => {
   expect(Bun.hash.cityHash32("hello world")).toBe(0x19a7581a);
   gcTick();
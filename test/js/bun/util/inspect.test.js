@@ -316,6 +316,20 @@ it("jsx with fragment", () => {
   expect(input).toBe(output);
 });
 
+it("maxBytes", () => {
+  const big = { items: Array.from({ length: 1000 }, (_, i) => ({ id: i, name: "item-" + i })) };
+  const full = Bun.inspect(big);
+  expect(Bun.inspect(big, { maxBytes: 64 })).toBe(full.slice(0, 64));
+  expect(Bun.inspect(big, { maxBytes: Infinity })).toBe(full);
+  expect(Bun.inspect(big, { maxBytes: full.length + 1 })).toBe(full);
+  // Never cuts a multi-byte character in half.
+  const emoji = Bun.inspect({ a: "😀😀😀😀" }, { maxBytes: 12 });
+  expect(emoji.length).toBeLessThanOrEqual(12);
+  expect(emoji.includes("�")).toBe(false);
+  expect(() => Bun.inspect(big, { maxBytes: -1 })).toThrow();
+  expect(() => Bun.inspect(big, { maxBytes: 1.5 })).toThrow();
+});
+
 it("inspect", () => {
   expect(Bun.inspect(new TypeError("what")).includes("TypeError: what")).toBe(true);
   expect(Bun.inspect("hi")).toBe('"hi"');
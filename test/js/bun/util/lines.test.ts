@@ -0,0 +1,77 @@
+import { describe, expect, test } from "bun:test";
+
+async function collect(iter: AsyncIterable<string>) {
+  const lines: string[] = [];
+  for await (const line of iter) {
+    lines.push(line);
+  }
+  return lines;
+}
+
+function streamOfChunks(chunks: string[]) {
+  return new ReadableStream<Uint8Array>({
+    pull(controller) {
+      const next = chunks.shift();
+      if (next === undefined) {
+        controller.close();
+      } else {
+        controller.enqueue(new TextEncoder().encode(next));
+      }
+    },
+  });
+}
+
+describe("Bun.lines", () => {
+  test("iterates the lines of a Blob", async () => {
+    const blob = new Blob(["first\nsecond\nthird\n"]);
+    expect(await collect(Bun.lines(blob))).toEqual(["first", "second", "third"]);
+  });
+
+  test("yields a final unterminated line", async () => {
+    expect(await collect(Bun.lines(new Blob(["a\nb"])))).toEqual(["a", "b"]);
+  });
+
+  test("strips \\r\\n line endings", async () => {
+    expect(await collect(Bun.lines(new Blob(["a\r\nb\r\n"])))).toEqual(["a", "b"]);
+  });
+
+  test("preserves empty lines", async () => {
+    expect(await collect(Bun.lines(new Blob(["a\n\nb\n"])))).toEqual(["a", "", "b"]);
+  });
+
+  test("reassembles lines split across chunks", async () => {
+    const stream = streamOfChunks(["hel", "lo\nwor", "ld\npart", "ial"]);
+    expect(await collect(Bun.lines(stream))).toEqual(["hello", "world", "partial"]);
+  });
+
+  test("handles \\r\\n split across a chunk boundary", async () => {
+    const stream = streamOfChunks(["a\r", "\nb\n"]);
+    expect(await collect(Bun.lines(stream))).toEqual(["a", "b"]);
+  });
+
+  test("handles non-ASCII content", async () => {
+    const blob = new Blob(["😋 emoji\nünïcödé\n"]);
+    expect(await collect(Bun.lines(blob))).toEqual(["😋 emoji", "ünïcödé"]);
+  });
+
+  test("an empty input yields no lines", async () => {
+    expect(await collect(Bun.lines(new Blob([])))).toEqual([]);
+  });
+
+  test("rejects inputs that are not a stream or blob", () => {
+    // @ts-expect-error intentionally invalid
+    expect(() => Bun.lines("a\nb")).toThrow(TypeError);
+    // @ts-expect-error intentionally invalid
+    expect(() => Bun.lines(42)).toThrow(TypeError);
+  });
+
+  test("parses NDJSON from a file", async () => {
+    const rows = [{ a: 1 }, { b: 2 }, { c: 3 }];
+    const blob = new Blob([rows.map(row => JSON.stringify(row)).join("\n") + "\n"]);
+    const parsed: unknown[] = [];
+    for await (const line of Bun.lines(blob)) {
+      parsed.push(JSON.parse(line));
+    }
+    expect(parsed).toEqual(rows);
+  });
+});
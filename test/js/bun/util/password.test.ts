@@ -278,6 +278,33 @@ test.concurrent("argon2 memoryCost at the 8 minimum is encoded faithfully (regre
   expect(await password.verify("test", hashed)).toBeTrue();
 });
 
+describe("hashMany", () => {
+  // Cheap argon2 settings so the fan-out across the pool stays fast in debug builds.
+  const cheap = { algorithm: "argon2id", memoryCost: 8, timeCost: 1 } as const;
+
+  test.concurrent("hashes every password in input order", async () => {
+    const passwords = ["hunter2", "hunter3", Buffer.from("hunter4")];
+    const hashes = await password.hashMany(passwords, cheap);
+    expect(hashes.length).toBe(3);
+    for (let i = 0; i < passwords.length; i++) {
+      expect(hashes[i]).toStartWith("$argon2id$");
+      expect(await password.verify(passwords[i], hashes[i])).toBeTrue();
+      // Random salts: same inputs must not share a hash.
+      expect(hashes.indexOf(hashes[i])).toBe(i);
+    }
+  });
+
+  test.concurrent("empty batch resolves to an empty array", async () => {
+    expect(await password.hashMany([])).toEqual([]);
+  });
+
+  test.concurrent("argument errors throw synchronously", () => {
+    expect(() => password.hashMany("hunter2" as any)).toThrow();
+    expect(() => password.hashMany(["hunter2", ""], cheap)).toThrow("password must not be empty");
+    expect(() => password.hashMany(["hunter2"], "nonsense" as any)).toThrow();
+  });
+});
+
 const defaultAlgorithm = "argon2id";
 const algorithms = [undefined, "argon2id", "bcrypt"];
 const argons = ["argon2i", "argon2id", "argon2d"];
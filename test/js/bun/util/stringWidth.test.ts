@@ -1888,3 +1888,29 @@ describe("width tables: combining marks, jamo, U16/17 emoji, VS after zero-width
     expect(Bun.stringWidth(wrapped, { ambiguousIsNarrow: false, countAnsiEscapeCodes: true })).toBe(11);
   });
 });
+
+describe("Bun.stringWidth.batch", () => {
+  test("matches Bun.stringWidth element-wise", () => {
+    const inputs = ["", "abc", "😀😀", "\x1b[31mhello\x1b[39m", "中文", "café"];
+    expect(Bun.stringWidth.batch(inputs)).toEqual(inputs.map(s => Bun.stringWidth(s)));
+    expect(Bun.stringWidth.batch(inputs, { countAnsiEscapeCodes: true })).toEqual(
+      inputs.map(s => Bun.stringWidth(s, { countAnsiEscapeCodes: true })),
+    );
+    expect(Bun.stringWidth.batch(inputs, { ambiguousIsNarrow: false })).toEqual(
+      inputs.map(s => Bun.stringWidth(s, { ambiguousIsNarrow: false })),
+    );
+  });
+
+  test("coerces non-string elements like Bun.stringWidth does", () => {
+    // undefined is width 0; everything else goes through ToString.
+    expect(Bun.stringWidth.batch([undefined, null, 123, "ab"])).toEqual([0, 4, 3, 2]);
+    expect(Bun.stringWidth.batch([])).toEqual([]);
+  });
+
+  test("throws on non-array input", () => {
+    // @ts-expect-error testing invalid input
+    expect(() => Bun.stringWidth.batch("abc")).toThrow(TypeError);
+    // @ts-expect-error testing invalid input
+    expect(() => Bun.stringWidth.batch()).toThrow(TypeError);
+  });
+});
@@ -114,3 +114,64 @@ describe("crypto.verify", () => {
     expect(verified).toBe(true);
   });
 });
+
+describe("crypto.verifyBatch", () => {
+  const bit = (mask: Uint8Array, i: number) => (mask[i >> 3] >> (i & 7)) & 1;
+
+  test("resolves to a bitmask of valid entries", async () => {
+    const { privateKey, publicKey } = crypto.generateKeyPairSync("ed25519");
+    const entries = [];
+    for (let i = 0; i < 10; i++) {
+      const data = Buffer.from(`message ${i}`);
+      const signature = crypto.sign(null, data, privateKey);
+      if (i % 3 === 0) signature[0] ^= 1;
+      entries.push({ key: publicKey, data, signature });
+    }
+
+    const mask = await crypto.verifyBatch(entries);
+    expect(mask).toBeInstanceOf(Uint8Array);
+    expect(mask.length).toBe(2);
+    for (let i = 0; i < 10; i++) {
+      expect(bit(mask, i)).toBe(i % 3 === 0 ? 0 : 1);
+    }
+  });
+
+  test("entries verify against their own key, not their neighbor's", async () => {
+    const a = crypto.generateKeyPairSync("ed25519");
+    const b = crypto.generateKeyPairSync("ed25519");
+    const data = Buffer.from("cross-key");
+    const signature = crypto.sign(null, data, a.privateKey);
+
+    const mask = await crypto.verifyBatch([
+      { key: a.publicKey, data, signature },
+      { key: b.publicKey, data, signature },
+    ]);
+    expect(bit(mask, 0)).toBe(1);
+    expect(bit(mask, 1)).toBe(0);
+  });
+
+  test("accepts PEM keys and an empty batch", async () => {
+    const { privateKey, publicKey } = crypto.generateKeyPairSync("ed25519");
+    const data = Buffer.from("pem entry");
+    const signature = crypto.sign(null, data, privateKey);
+    const pem = publicKey.export({ type: "spki", format: "pem" });
+
+    const mask = await crypto.verifyBatch([{ key: pem, data, signature }]);
+    expect(bit(mask, 0)).toBe(1);
+
+    const empty = await crypto.verifyBatch([]);
+    expect(empty.length).toBe(0);
+  });
+
+  test("rejects non-Ed25519 keys and malformed entries", async () => {
+    const { privateKey, publicKey } = crypto.generateKeyPairSync("ec", { namedCurve: "prime256v1" });
+    const data = Buffer.from("wrong key type");
+    const signature = crypto.sign("sha256", data, privateKey);
+
+    await expect(crypto.verifyBatch([{ key: publicKey, data, signature }])).rejects.toThrow(
+      "verifyBatch() only supports Ed25519 keys",
+    );
+    await expect(crypto.verifyBatch("nope")).rejects.toThrow(/must be an instance of Array/);
+    await expect(crypto.verifyBatch([null])).rejects.toThrow(/must be of type object/);
+  });
+});
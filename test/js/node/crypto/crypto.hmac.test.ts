@@ -1,5 +1,5 @@
 import { describe, expect, test } from "bun:test";
-import { Hmac, createHmac, createSecretKey } from "crypto";
+import { Hmac, createHmac, createSecretKey, hmac } from "crypto";
 import { PassThrough } from "stream";
 
 function testHmac(algo, key, data, expected) {
@@ -450,3 +450,34 @@ describe("crypto.Hmac", () => {
     );
   });
 });
+
+describe("crypto.hmac (one-shot)", () => {
+  test("matches the streaming Hmac, defaults to hex", async () => {
+    expect(hmac("sha256", "key", "data")).toBe(createHmac("sha256", "key").update("data").digest("hex"));
+    expect(hmac("sha256", "key", "data", "base64")).toBe(createHmac("sha256", "key").update("data").digest("base64"));
+    expect(hmac("sha256", "key", "data", "buffer")).toEqual(createHmac("sha256", "key").update("data").digest());
+  });
+
+  test("accepts Buffer and TypedArray data", async () => {
+    const data = Buffer.from("data");
+    expect(hmac("sha1", "key", data)).toBe(createHmac("sha1", "key").update(data).digest("hex"));
+    expect(hmac("sha1", "key", new Uint8Array(data))).toBe(createHmac("sha1", "key").update(data).digest("hex"));
+  });
+
+  test("KeyObject keys stay consistent across repeated calls and digests", async () => {
+    // Repeated/interleaved algorithms exercise the per-KeyObject schedule
+    // cache (populate, hit, and replace on digest change).
+    const keyObject = createSecretKey(Buffer.from("0123456789abcdef"));
+    for (let i = 0; i < 3; i++) {
+      expect(hmac("sha256", keyObject, "data")).toBe(createHmac("sha256", "0123456789abcdef").update("data").digest("hex"));
+      expect(hmac("sha512", keyObject, "data")).toBe(createHmac("sha512", "0123456789abcdef").update("data").digest("hex"));
+    }
+    // A streaming Hmac over the same KeyObject also goes through the cache.
+    expect(createHmac("sha256", keyObject).update("data").digest("hex")).toBe(hmac("sha256", keyObject, "data"));
+  });
+
+  test("argument errors", async () => {
+    expect(() => hmac("sha7", "key", "data")).toThrow("Invalid digest: sha7");
+    expect(() => hmac("sha256", "key", 42 as any)).toThrow(/The "data" argument must be of type string/);
+  });
+});
@@ -0,0 +1,83 @@
+import { expect, test } from "bun:test";
+import { writeFileSync } from "fs";
+import { bunEnv, bunExe, tempDir } from "harness";
+import { join } from "path";
+
+const env = { ...bunEnv, BUN_FS_STAT_CACHE_TTL_MS: "60000" };
+
+test.concurrent("repeated statSync is served from the cache until a path op invalidates it", async () => {
+  using dir = tempDir("fs-stat-cache", {
+    "index.js": `
+      const fs = require("node:fs");
+      fs.writeFileSync("target.txt", "aaaa");
+      console.log("first:", fs.statSync("target.txt").size);
+      // Grow the file through the fd: fd-based writes are documented as
+      // invisible to the cache, so the next stat must still say 4.
+      const fd = fs.openSync("target.txt", "r+");
+      fs.writeSync(fd, "bbbb", 4);
+      fs.closeSync(fd);
+      console.log("cached:", fs.statSync("target.txt").size);
+      // Any path-mutating op drops the whole cache.
+      fs.writeFileSync("other.txt", "x");
+      console.log("fresh:", fs.statSync("target.txt").size);
+    `,
+  });
+
+  await using proc = Bun.spawn({
+    cmd: [bunExe(), "index.js"],
+    env,
+    cwd: String(dir),
+    stderr: "pipe",
+  });
+  const [stdout, stderr, exitCode] = await Promise.all([proc.stdout.text(), proc.stderr.text(), proc.exited]);
+  expect(stderr).toBe("");
+  expect(stdout).toBe("first: 4\ncached: 4\nfresh: 8\n");
+  expect(exitCode).toBe(0);
+});
+
+test.concurrent("ENOENT is cached until a path op invalidates it", async () => {
+  using dir = tempDir("fs-stat-cache-enoent", {
+    "index.js": `
+      const fs = require("node:fs");
+      try { fs.statSync("missing.txt"); console.log("exists-1"); } catch { console.log("enoent-1"); }
+      // The parent creates missing.txt once it sees enoent-1, then pokes stdin.
+      await new Promise(resolve => process.stdin.once("data", resolve));
+      try { fs.statSync("missing.txt"); console.log("exists-2"); } catch { console.log("enoent-2"); }
+      fs.writeFileSync("other.txt", "x");
+      console.log("size:", fs.statSync("missing.txt").size);
+    `,
+  });
+
+  await using proc = Bun.spawn({
+    cmd: [bunExe(), "index.js"],
+    env,
+    cwd: String(dir),
+    stdin: "pipe",
+    stderr: "pipe",
+  });
+
+  const decoder = new TextDecoder();
+  const reader = proc.stdout.getReader();
+  let stdout = "";
+  while (!stdout.includes("enoent-1\n")) {
+    const { value, done } = await reader.read();
+    if (done) break;
+    stdout += decoder.decode(value);
+  }
+
+  // Another process creating the file is exactly the staleness the TTL
+  // contract allows: the cached negative entry must survive it.
+  writeFileSync(join(String(dir), "missing.txt"), "abc");
+  proc.stdin.write("go\n");
+  await proc.stdin.end();
+
+  while (true) {
+    const { value, done } = await reader.read();
+    if (done) break;
+    stdout += decoder.decode(value);
+  }
+  const [stderr, exitCode] = await Promise.all([proc.stderr.text(), proc.exited]);
+  expect(stderr).toBe("");
+  expect(stdout).toBe("enoent-1\nenoent-2\nsize: 3\n");
+  expect(exitCode).toBe(0);
+});
@@ -70,6 +70,20 @@ describe("Web Crypto", () => {
     expect(new TextDecoder().decode(decrypted)).toBe("Hello World!");
   });
 
+  it("AES-GCM round-trips across the inline/offload size threshold", async () => {
+    const key = await crypto.subtle.generateKey({ name: "AES-GCM", length: 256 }, true, ["encrypt", "decrypt"]);
+    const iv = crypto.getRandomValues(new Uint8Array(12));
+    // Small payloads complete inline; large ones go through the work pool.
+    // Straddle the 64KB boundary to cover both paths and the exact edge.
+    for (const size of [16, 64 * 1024 - 17, 64 * 1024, 64 * 1024 + 1]) {
+      const data = new Uint8Array(size).map((_, i) => i & 0xff);
+      const encrypted = await crypto.subtle.encrypt({ name: "AES-GCM", iv }, key, data);
+      expect(encrypted.byteLength).toBe(size + 16);
+      const decrypted = await crypto.subtle.decrypt({ name: "AES-GCM", iv }, key, encrypted);
+      expect(new Uint8Array(decrypted)).toEqual(data);
+    }
+  });
+
   it("should verify and sign", async () => {
     async function importKey(secret: string) {
       return await crypto.subtle.importKey(
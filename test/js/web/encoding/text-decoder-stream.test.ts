@@ -191,6 +191,16 @@ test("TextDecoderStream accepts undefined and null options", () => {
   expect(new TextDecoderStream("utf-8", { fatal: true }).fatal).toBe(true);
 });
 
+test("a multi-byte sequence split across chunks is buffered until complete", async () => {
+  const bytes = new TextEncoder().encode("I \u{1F499} streams");
+  // Split inside the 4-byte U+1F499 sequence so the first chunk ends mid-scalar.
+  const input = readableStreamFromArray([bytes.slice(0, 4), bytes.slice(4)]);
+  const output = input.pipeThrough(new TextDecoderStream());
+  const chunks = await Bun.readableStreamToArray(output);
+  expect(chunks.join("")).toBe("I \u{1F499} streams");
+  expect(chunks.join("")).not.toInclude("�");
+});
+
 // https://github.com/oven-sh/bun/pull/33193 — a transform/flush failure must reject the
 // write/close promise, not throw synchronously or leave the in-flight op unsettled.
 test("cancelling the readable inside a patched decode() rejects the write instead of throwing", async () => {
@@ -683,3 +683,39 @@ describe("TextEncoder UTF-16 exact-size path", () => {
     }
   });
 });
+
+describe("TextEncoder.encodePooled", () => {
+  it("should encode like encode() for ASCII, Latin-1 and UTF-16 inputs", () => {
+    const encoder = new TextEncoder();
+    for (const text of ["", "hello", "héllo wörld", "n💕ó".repeat(100), "ab\ud800cd"]) {
+      const pooled = encoder.encodePooled(text);
+      expect(pooled).toBeInstanceOf(Uint8Array);
+      expect(Array.from(pooled)).toEqual(Array.from(encoder.encode(text)));
+    }
+  });
+
+  it("should reuse the backing buffer across calls on the same encoder", () => {
+    const encoder = new TextEncoder();
+    const first = encoder.encodePooled("hello world");
+    const firstBuffer = first.buffer;
+    const second = encoder.encodePooled("bye");
+    expect(second.buffer).toBe(firstBuffer);
+    // The first view now aliases the overwritten buffer.
+    expect(new TextDecoder().decode(first.subarray(0, 3))).toBe("bye");
+  });
+
+  it("should not share buffers between encoders", () => {
+    const a = new TextEncoder();
+    const b = new TextEncoder();
+    expect(a.encodePooled("x").buffer).not.toBe(b.encodePooled("x").buffer);
+  });
+
+  it("should grow the buffer when the input needs more space", () => {
+    const encoder = new TextEncoder();
+    const small = encoder.encodePooled("tiny");
+    const big = encoder.encodePooled("💕".repeat(4096));
+    expect(big.buffer).not.toBe(small.buffer);
+    expect(big.length).toBe(4 * 4096);
+    expect(new TextDecoder().decode(big)).toBe("💕".repeat(4096));
+  });
+});
@@ -36,6 +36,45 @@ test("keepalive", async () => {
   }
 });
 
+// The counters are process-wide (they sum every fetch in the process), so read
+// them in a subprocess where this test's traffic is the only traffic.
+test("httpAgentStats counts fresh dials vs keep-alive reuse", async () => {
+  await using proc = Bun.spawn({
+    cmd: [
+      bunExe(),
+      "-e",
+      `
+      import { httpAgentStats } from "bun:internal-for-testing";
+      const server = Bun.serve({ port: 0, fetch: () => new Response("ok") });
+      const url = "http://127.0.0.1:" + server.port + "/";
+      const before = httpAgentStats();
+      for (let i = 0; i < 8; i++) {
+        await (await fetch(url)).text();
+      }
+      const after = httpAgentStats();
+      server.stop();
+      console.log(JSON.stringify({
+        fresh: after.freshConnections - before.freshConnections,
+        reused: after.reusedConnections - before.reusedConnections,
+      }));
+      process.exit(0);
+      `,
+    ],
+    env: bunEnv,
+    stdout: "pipe",
+    stderr: "pipe",
+  });
+
+  const [stdout, stderr, exitCode] = await Promise.all([proc.stdout.text(), proc.stderr.text(), proc.exited]);
+  const result = stdout.startsWith("{") ? JSON.parse(stdout.trim()) : { stdout, stderr };
+  // Every request either dialed or reused; at least the first dialed, and
+  // sequential keep-alive requests to one origin must reuse at least once.
+  expect(result.fresh + result.reused).toBe(8);
+  expect(result.fresh).toBeGreaterThanOrEqual(1);
+  expect(result.reused).toBeGreaterThanOrEqual(1);
+  expect(exitCode).toBe(0);
+});
+
 test("fetch does not reuse a pooled TLS connection for a request with a different Host header", async () => {
   using server = Bun.serve({
     port: 0,
@@ -255,6 +255,47 @@ describe("FormData", () => {
     }
   });
 
+  // Bodies >= 1 MiB take the streaming parser, which spills large file parts
+  // to temp files and hands them back as fd-backed Blobs.
+  describe("large multipart bodies", () => {
+    const headers = { "Content-Type": "multipart/form-data; boundary=foo" };
+
+    it("parses a file part larger than the spill threshold", async () => {
+      const fileContent = Buffer.alloc(2 * 1024 * 1024, "Bun").toString();
+      const body =
+        "--foo\r\n" +
+        'Content-Disposition: form-data; name="field"\r\n\r\nvalue\r\n' +
+        "--foo\r\n" +
+        'Content-Disposition: form-data; name="upload"; filename="big.txt"\r\nContent-Type: text/plain\r\n\r\n' +
+        fileContent +
+        "\r\n--foo--\r\n";
+      const formData = await new Response(body, { headers }).formData();
+      expect(formData.get("field")).toBe("value");
+      const file = formData.get("upload") as File;
+      expect(file instanceof Blob).toBe(true);
+      expect(file.name).toBe("big.txt");
+      expect(file.type).toBe("text/plain");
+      expect(file.size).toBe(fileContent.length);
+      expect(await file.text()).toBe(fileContent);
+    });
+
+    it("keeps small parts of a large body in memory", async () => {
+      const padding = Buffer.alloc(2 * 1024 * 1024, "a").toString();
+      const body =
+        "--foo\r\n" +
+        'Content-Disposition: form-data; name="pad"\r\n\r\n' +
+        padding +
+        "\r\n--foo\r\n" +
+        'Content-Disposition: form-data; name="small"; filename="small.txt"\r\n\r\nhello\r\n' +
+        "--foo--\r\n";
+      const formData = await new Response(body, { headers }).formData();
+      expect(formData.get("pad")).toBe(padding);
+      const file = formData.get("small") as File;
+      expect(file instanceof Blob).toBe(true);
+      expect(await file.text()).toBe("hello");
+    });
+  });
+
   // RFC 2045 §5.1 / RFC 7231 §3.1.1.1: media type/subtype and parameter
   // attribute names are case-insensitive; the boundary VALUE is byte-exact.
   describe("Content-Type case-insensitivity", () => {
@@ -178,6 +178,20 @@ it("crypto.timingSafeEqual", () => {
   for (let i = 0; i < 9000; i++) {
     if (!crypto.timingSafeEqual(shorter, shorter)) throw new Error("fail");
   }
+
+  // Lengths straddling every SIMD lane-count boundary, with the differing
+  // byte placed in the vector body and in the scalar tail.
+  for (const len of [0, 1, 2, 15, 16, 17, 31, 32, 33, 63, 64, 65, 127, 128, 129]) {
+    const a = Buffer.alloc(len, 0xab);
+    const b = Buffer.alloc(len, 0xab);
+    expect(crypto.timingSafeEqual(a, b)).toBe(true);
+    for (const at of new Set([0, len >> 1, len - 1])) {
+      if (at < 0 || at >= len) continue;
+      b[at] ^= 1;
+      expect(crypto.timingSafeEqual(a, b)).toBe(false);
+      b[at] ^= 1;
+    }
+  }
 });
 
 it("crypto.randomUUID", () => {
@@ -201,6 +215,22 @@ it("crypto.randomUUID", () => {
   });
 });
 
+it("crypto.randomUUIDBatch", () => {
+  expect(crypto.randomUUIDBatch(0)).toEqual([]);
+  expect(crypto.randomUUIDBatch()).toEqual([]);
+
+  const uuids = crypto.randomUUIDBatch(1000);
+  expect(uuids.length).toBe(1000);
+  const regex = /^[0-9a-f]{8}-[0-9a-f]{4}-4[0-9a-f]{3}-[89ab][0-9a-f]{3}-[0-9a-f]{12}$/;
+  for (const uuid of uuids) {
+    expect(uuid).toMatch(regex);
+  }
+  expect(new Set(uuids).size).toBe(1000);
+
+  expect(() => crypto.randomUUIDBatch(-1)).toThrow(RangeError);
+  expect(() => crypto.randomUUIDBatch(1.5)).toThrow(TypeError);
+});
+
 it("crypto.randomUUID version, issues#3575", () => {
   var uuid = crypto.randomUUID();
 